@@ -283,6 +283,7 @@ function syncOscillationInputs(data) {
   }
   if (AppState.editing.oscField !== 'oscWaveform' && document.activeElement !== DOM.oscWaveform) {
     DOM.oscWaveform.value = data.oscillation.waveform;
+    updateCustomWaveformRow();
   }
   
   syncOscillationFrequencyInput(data, isTransitioning);
@@ -348,6 +349,101 @@ function updateOscillationButtons(isRunningOrPaused, isPaused, isError) {
 // OSCILLATION MODE - INITIALIZATION
 // ============================================================================
 
+// ============================================================================
+// OSCILLATION MODE - CUSTOM WAVEFORMS (library stored on the ESP32)
+// ============================================================================
+
+const OSC_WAVEFORM_CUSTOM = 3;
+
+/**
+ * Show the custom waveform row only while "Custom" is selected
+ */
+function updateCustomWaveformRow() {
+  const row = document.getElementById('oscCustomWaveformRow');
+  const isCustom = Number.parseInt(DOM.oscWaveform.value) === OSC_WAVEFORM_CUSTOM;
+  row.style.display = isCustom ? 'flex' : 'none';
+}
+
+/**
+ * Fill the custom waveform select from GET /api/waveforms
+ */
+function loadWaveformLibrary() {
+  getWithRetry('/api/waveforms', { silent: true })
+    .then(data => {
+      const select = document.getElementById('oscCustomWaveform');
+      select.innerHTML = '';
+      const names = data.waveforms || [];
+      if (names.length === 0) {
+        const option = document.createElement('option');
+        option.value = '';
+        option.textContent = t('oscillation.noCustomWaveform');
+        select.appendChild(option);
+      }
+      names.forEach(name => {
+        const option = document.createElement('option');
+        option.value = name;
+        option.textContent = name;
+        select.appendChild(option);
+      });
+      select.value = data.active || '';
+    })
+    .catch(error => console.debug('🌊 Waveform library unavailable:', error.message));
+}
+
+function selectCustomWaveform(name) {
+  if (!name) return;
+  postWithRetry('/api/waveforms/select', { name: name })
+    .then(() => showNotification('✅ ' + t('oscillation.waveformSelected', {name: name}), 'success', 2000))
+    .catch(error => {
+      showNotification('❌ ' + t('common.error') + ': ' + error.message, 'error');
+      loadWaveformLibrary();
+    });
+}
+
+/**
+ * Upload a waveform JSON file ({name, kind, points}); the ESP32 selects it
+ */
+function uploadCustomWaveform() {
+  const input = document.createElement('input');
+  input.type = 'file';
+  input.accept = '.json';
+
+  input.onchange = async function(e) {
+    const file = e.target.files[0];
+    if (!file) return;
+
+    try {
+      const waveform = JSON.parse(await file.text());
+      await postWithRetry('/api/waveforms/save', waveform);
+      showNotification('✅ ' + t('oscillation.waveformSelected', {name: waveform.name}), 'success', 2000);
+      loadWaveformLibrary();
+    } catch (error) {
+      showNotification('❌ ' + t('common.error') + ': ' + error.message, 'error');
+    }
+  };
+
+  input.click();
+}
+
+async function deleteCustomWaveform() {
+  const name = document.getElementById('oscCustomWaveform').value;
+  if (!name) return;
+
+  const confirmed = await showConfirm(t('oscillation.confirmDeleteWaveform', {name: name}), {
+    type: 'danger',
+    confirmText: '🗑️ ' + t('common.delete'),
+    dangerous: true
+  });
+  if (!confirmed) return;
+
+  postWithRetry('/api/waveforms/delete', { name: name })
+    .then(() => {
+      showNotification('✅ ' + t('oscillation.waveformDeleted', {name: name}), 'success', 2000);
+      loadWaveformLibrary();
+    })
+    .catch(error => showNotification('❌ ' + t('common.error') + ': ' + error.message, 'error'));
+}
+
 /**
  * Initialize all oscillation mode event listeners
  * Called from main.js on window load
@@ -369,8 +465,16 @@ function initOscillationListeners() {
   
   // Waveform (select): send on change
   setupEditableOscInput('oscWaveform', {
-    onChange: () => sendOscillationConfig()
+    onChange: () => { updateCustomWaveformRow(); sendOscillationConfig(); }
+  });
+
+  // Custom waveform library
+  document.getElementById('oscCustomWaveform').addEventListener('change', function() {
+    selectCustomWaveform(this.value);
   });
+  document.getElementById('btnUploadWaveform').addEventListener('click', uploadCustomWaveform);
+  document.getElementById('btnDeleteWaveform').addEventListener('click', deleteCustomWaveform);
+  loadWaveformLibrary();
   
   // Frequency: validate + send on blur, live validation + preset update on input
   setupEditableOscInput('oscFrequency', {
@@ -15,7 +15,7 @@
  * Dependencies: 
  *   - app.js (AppState, SystemState, WS_CMD)
  *   - DOMManager.js (DOM cache)
- *   - utils.js (sendCommand, showNotification)
+ *   - utils.js (sendCommand, sendBinaryCommand, showNotification)
  * ============================================================================
  */
 
@@ -100,12 +100,13 @@ function setGaugeTarget(positionMM) {
 
 /**
  * Send pursuit move command to ESP32
+ * Binary 'P' frame (9 bytes): sent at 50Hz, so no JSON encode/parse
  */
 function sendPursuitCommand() {
-  sendCommand(WS_CMD.PURSUIT_MOVE, {
-    targetPosition: AppState.pursuit.targetMM,
-    maxSpeed: AppState.pursuit.maxSpeedLevel
-  });
+  sendBinaryCommand(WS_BIN.PURSUIT_MOVE, [
+    AppState.pursuit.targetMM,
+    AppState.pursuit.maxSpeedLevel
+  ]);
 }
 
 /**
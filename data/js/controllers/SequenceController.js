@@ -128,6 +128,71 @@ function addSequenceLine() {
   sendCommand(WS_CMD.ADD_SEQUENCE_LINE, newLine);
 }
 
+// ========================================================================
+// CONTROL LINES (repeat / call / random / wait / end)
+// ========================================================================
+
+/**
+ * Ask for the argument of a control line
+ * @param {number} op - SEQUENCE_OP value
+ * @param {number} currentArg - Current opArg (edit) or 0 (new line)
+ * @returns {Promise<number|null>} opArg, or null if cancelled / invalid
+ */
+async function promptControlArg(op, currentArg) {
+  const prompts = {
+    [SEQUENCE_OP.REPEAT]: { key: 'sequencer.repeatPrompt', value: currentArg || 2, max: SEQ_LIMITS.MAX_CYCLE_COUNT },
+    [SEQUENCE_OP.RANDOM]: { key: 'sequencer.randomPrompt', value: currentArg || 2, max: SEQ_LIMITS.MAX_CYCLE_COUNT },
+    [SEQUENCE_OP.WAIT]:   { key: 'sequencer.waitPrompt', value: currentArg ? currentArg / 1000 : 5, max: SEQ_LIMITS.MAX_WAIT_SEC }
+  };
+
+  if (op === SEQUENCE_OP.CALL) {
+    // Users think in line numbers, the firmware in lineIds (stable across reorders)
+    const currentIndex = sequenceLines.findIndex(l => l.lineId === currentArg);
+    const answer = await showPrompt(t('sequencer.callPrompt'), {
+      title: '⤴️ ' + t('sequencer.opCall'),
+      defaultValue: currentIndex >= 0 ? String(currentIndex + 1) : ''
+    });
+    if (answer === null || answer === '') return null;
+    const target = sequenceLines[Number.parseInt(answer, 10) - 1];
+    if (!target) {
+      showAlert(t('sequencer.callTargetInvalid', { n: answer }), { type: 'error' });
+      return null;
+    }
+    return target.lineId;
+  }
+
+  const spec = prompts[op];
+  if (!spec) return 0;  // END_REPEAT / RETURN / END take no argument
+
+  const answer = await showPrompt(t(spec.key, { max: spec.max }), { defaultValue: String(spec.value) });
+  if (answer === null || answer === '') return null;
+  const value = Number.parseFloat(answer);
+  if (!Number.isFinite(value) || value <= 0 || value > spec.max) {
+    showAlert(t('sequencer.controlArgInvalid', { max: spec.max }), { type: 'error' });
+    return null;
+  }
+  return op === SEQUENCE_OP.WAIT ? Math.round(value * 1000) : Math.round(value);
+}
+
+async function addControlLine(op) {
+  const opArg = await promptControlArg(op, 0);
+  if (opArg === null) return;
+
+  sendCommand(WS_CMD.ADD_SEQUENCE_LINE, { enabled: true, op: op, opArg: opArg, movementType: 0, cycleCount: 1, pauseAfterMs: 0 });
+}
+
+async function editControlLine(line) {
+  if (line.op === SEQUENCE_OP.END_REPEAT || line.op === SEQUENCE_OP.RETURN || line.op === SEQUENCE_OP.END) {
+    showNotification('ℹ️ ' + t('sequencer.controlNoArg'), 'info', 2000);
+    return;
+  }
+
+  const opArg = await promptControlArg(line.op, line.opArg);
+  if (opArg === null) return;
+
+  sendCommand(WS_CMD.UPDATE_SEQUENCE_LINE, { ...line, opArg: opArg });
+}
+
 async function deleteSequenceLine(lineId) {
   const confirmed = await showConfirm(t('sequencer.deleteLineConfirm'), {
     title: t('sequencer.deleteLineTitle'),
@@ -176,15 +241,63 @@ function exportSequence() {
   sendCommand(WS_CMD.EXPORT_SEQUENCE, {});
 }
 
+/** Download the compact binary export (.seqb) straight from the ESP32 */
+function exportSequenceBinary() {
+  const a = document.createElement('a');
+  a.href = '/api/sequence/export?format=bin';
+  a.download = 'sequence_' + new Date().toISOString().slice(0, 10) + '.seqb';
+  document.body.appendChild(a);
+  a.click();
+  a.remove();
+}
+
+/**
+ * Report the result of an HTTP sequence import
+ * @param {Promise<Object>} request - Resolves to the JSON reply
+ */
+function reportSequenceImport(request) {
+  request
+  .then(data => {
+    if (data.success) {
+      console.debug('✅ Import successful:', data.message);
+      showAlert(t('sequencer.importSuccess'), { type: 'success' });
+      sendCommand(WS_CMD.GET_SEQUENCE_TABLE, {});
+    } else {
+      console.error('❌ Import failed:', data.error);
+      showAlert(t('common.error') + ' import: ' + (data.error || 'Unknown error'), { type: 'error' });
+    }
+  })
+  .catch(error => {
+    console.error('❌ HTTP request failed:', error);
+    showAlert(t('sequencer.networkError', {msg: error.message}), { type: 'error' });
+  });
+}
+
+async function postSequenceBinary(file) {
+  // Streamed into the table by the ESP32 as it arrives: no size limit beyond the table itself
+  const response = await fetchWithRetry('/api/sequence/import', {
+    method: 'POST',
+    headers: { 'Content-Type': 'application/octet-stream' },
+    body: await file.arrayBuffer()
+  }, { maxRetries: 0 });
+  return response.json().catch(() => ({ success: false, error: `HTTP ${response.status}` }));
+}
+
 function importSequence() {
   const input = document.createElement('input');
   input.type = 'file';
-  input.accept = '.json';
+  input.accept = '.json,.seqb';
   
   input.onchange = async function(e) {
     const file = e.target.files[0];
     if (!file) return;
     
+    if (file.name.toLowerCase().endsWith('.seqb')) {
+      console.debug('📤 Sending binary import via HTTP:', file.size, 'bytes');
+      reportSequenceImport(postSequenceBinary(file));
+      return;
+    }
+    
     try {
       let jsonText = await file.text();
       jsonText = jsonText.replace(/\/\*[\s\S]*?\*\//g, '');
@@ -194,21 +307,7 @@ function importSequence() {
       
       console.debug('📤 Sending import via HTTP:', parsed.lineCount, 'lines,', jsonText.length, 'bytes');
       
-      postWithRetry('/api/sequence/import', parsed)
-      .then(data => {
-        if (data.success) {
-          console.debug('✅ Import successful:', data.message);
-          showAlert(t('sequencer.importSuccess'), { type: 'success' });
-          sendCommand(WS_CMD.GET_SEQUENCE_TABLE, {});
-        } else {
-          console.error('❌ Import failed:', data.error);
-          showAlert(t('common.error') + ' import: ' + (data.error || 'Unknown error'), { type: 'error' });
-        }
-      })
-      .catch(error => {
-        console.error('❌ HTTP request failed:', error);
-        showAlert(t('sequencer.networkError', {msg: error.message}), { type: 'error' });
-      });
+      reportSequenceImport(postWithRetry('/api/sequence/import', parsed));
       
     } catch (error) {
       console.error('❌ JSON parse error:', error);
@@ -219,6 +318,55 @@ function importSequence() {
   input.click();
 }
 
+// ========================================================================
+// NAMED SEQUENCES (stored on the ESP32)
+// ========================================================================
+
+async function saveNamedSequence() {
+  const name = await showPrompt(t('sequencer.saveNamePrompt'), {
+    title: t('sequencer.saveSeqTitle'),
+    defaultValue: seqState.activeName || ''
+  });
+  if (!name) return;
+
+  seqState.listPending = 'save';
+  sendCommand(WS_CMD.SAVE_SEQUENCE, { name: name.trim() });
+}
+
+function loadNamedSequence() {
+  seqState.listPending = 'load';
+  sendCommand(WS_CMD.LIST_SEQUENCES, {});
+}
+
+/**
+ * Handle the list of saved sequences (reply to list/save/delete)
+ * @param {Array<{name: string, size: number}>} list
+ */
+async function handleSequenceList(list) {
+  const pending = seqState.listPending;
+  seqState.listPending = null;
+
+  if (pending === 'save') {
+    showNotification('💾 ' + t('sequencer.seqSaved', { name: seqState.activeName }), 'success', 3000);
+    return;
+  }
+  if (pending !== 'load') return;
+
+  if (!list || list.length === 0) {
+    showAlert(t('sequencer.noSavedSequences'), { type: 'info' });
+    return;
+  }
+
+  const names = list.map(item => item.name).sort((a, b) => a.localeCompare(b));
+  const name = await showPrompt(t('sequencer.loadNamePrompt', { names: names.join(', ') }), {
+    title: t('sequencer.loadSeqTitle'),
+    defaultValue: names.includes(seqState.activeName) ? seqState.activeName : names[0]
+  });
+  if (!name) return;
+
+  sendCommand(WS_CMD.LOAD_SEQUENCE, { name: name.trim() });
+}
+
 function downloadTemplate() {
   // Use helper from SequenceUtils.js
   const fullDoc = getSequenceTemplateDoc();
@@ -364,6 +512,11 @@ function editSequenceLine(lineId) { // NOSONAR — sequential form population, l
     return;
   }
   
+  if (isControlLine(line)) {
+    editControlLine(line);
+    return;
+  }
+  
   console.debug('✅ Found line:', line);
   seqState.editingLineId = lineId;
   seqState.isLoadingEditForm = true;
@@ -993,6 +1146,7 @@ function updateSequenceStatus(status) {
 function renderSequenceTable(data) {
   if (data?.lines) {
     setSequenceLines(data.lines);
+    seqState.activeName = data.name || '';
   } else if (!sequenceLines || sequenceLines.length === 0) {
     console.error('Invalid sequence data');
     return;
@@ -1069,11 +1223,21 @@ function createSequenceRow(line, index) {
   row.dataset.tooltip = tooltipContent.replaceAll('"', '&quot;');
   row.dataset.lineNumber = index + 1;
   
+  const isControl = isControlLine(line);
   const movementType = line.movementType === undefined ? 0 : line.movementType;
-  const typeDisplay = getTypeDisplay(movementType, line);
-  const decelSummary = getDecelSummary(line, movementType);
-  const speedsDisplay = getSpeedsDisplay(line, movementType);
-  const { cyclesDisplay, pauseDisplay, pauseColor, pauseWeight } = getCyclesPause(line, movementType);
+  let typeDisplay, decelSummary, speedsDisplay;
+  let { cyclesDisplay, pauseDisplay, pauseColor, pauseWeight } = getCyclesPause(line, movementType);
+  if (isControl) {
+    const targetIndex = line.op === SEQUENCE_OP.CALL ? sequenceLines.findIndex(l => l.lineId === line.opArg) : -1;
+    typeDisplay = getControlDisplay(line, targetIndex + 1);
+    decelSummary = speedsDisplay = cyclesDisplay = pauseDisplay = '--';
+    pauseColor = '#999';
+    pauseWeight = 'normal';
+  } else {
+    typeDisplay = getTypeDisplay(movementType, line);
+    decelSummary = getDecelSummary(line, movementType);
+    speedsDisplay = getSpeedsDisplay(line, movementType);
+  }
   
   row.innerHTML = `
     <td class="seq-cell">
@@ -1106,10 +1270,10 @@ function createSequenceRow(line, index) {
       ${pauseDisplay}
     </td>
     <td class="seq-cell-last">
-      <button onclick="testSequenceLine(${line.lineId})" 
+      ${isControl ? '' : `<button onclick="testSequenceLine(${line.lineId})" 
         id="btnTestLine_${line.lineId}"
         class="btn-action btn-action-test"
-        title="${t('sequencer.testThisLine')}">▶️</button>
+        title="${t('sequencer.testThisLine')}">▶️</button>`}
       <button onclick="editSequenceLine(${line.lineId})" 
         class="btn-action btn-action-edit"
         title="${t('sequencer.editBtn')}">✏️</button>
@@ -1313,6 +1477,14 @@ function initSequenceListeners() {
   DOM.btnClearAll.addEventListener('click', clearSequence);
   DOM.btnImportSeq.addEventListener('click', importSequence);
   DOM.btnExportSeq.addEventListener('click', exportSequence);
+  document.getElementById('btnExportSeqBin').addEventListener('click', exportSequenceBinary);
+  DOM.btnSaveSeq.addEventListener('click', saveNamedSequence);
+  DOM.btnLoadSeq.addEventListener('click', loadNamedSequence);
+  document.getElementById('selAddControl').addEventListener('change', (e) => {
+    const op = Number.parseInt(e.target.value, 10);
+    e.target.value = '';
+    if (op > 0) addControlLine(op);
+  });
   document.getElementById('btnDownloadTemplate').addEventListener('click', downloadTemplate);
   
   // ===== PLAYBACK CONTROLS =====
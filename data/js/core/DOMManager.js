@@ -168,6 +168,8 @@ function initDOMCache() {
   DOM.btnClearAll = document.getElementById('btnClearAll');
   DOM.btnImportSeq = document.getElementById('btnImportSeq');
   DOM.btnExportSeq = document.getElementById('btnExportSeq');
+  DOM.btnSaveSeq = document.getElementById('btnSaveSeq');
+  DOM.btnLoadSeq = document.getElementById('btnLoadSeq');
   DOM.sequenceTableBody = document.getElementById('sequenceTableBody');
 
   // ========================================================================
@@ -203,6 +205,9 @@ function initDOMCache() {
   DOM.statsFileInput = document.getElementById('statsFileInput');
   DOM.statsTableBody = document.getElementById('statsTableBody');
   DOM.statsChartCanvas = document.getElementById('statsChart');
+  DOM.metricsChartCanvas = document.getElementById('metricsChart');
+  DOM.metricsField = document.getElementById('metricsField');
+  DOM.metricsResolution = document.getElementById('metricsResolution');
   DOM.statsTotalDistance = document.getElementById('statsTotalDistance');
   DOM.statsTotalMilestone = document.getElementById('statsTotalMilestone');
   DOM.statsRecordingEnabled = document.getElementById('statsRecordingEnabled');
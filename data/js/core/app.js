@@ -56,6 +56,8 @@ const AppState = {
     isTestingLine: false,  // Line test in progress flag
     testedLineId: null,    // ID of line being tested
     sequenceBackup: null,  // Backup of sequence state during test
+    activeName: '',        // Name of the saved sequence on the table ('' = unsaved)
+    listPending: null,     // 'save' | 'load' while waiting for sequenceList
     drag: {
       lineId: null,        // Currently dragged line ID
       lineIndex: null,     // Currently dragged line index
@@ -66,6 +68,7 @@ const AppState = {
   // Stats state
   stats: {
     chart: null,            // Chart.js instance reference
+    metricsChart: null,     // Chart.js instance for the machine metrics history
     isEditingRecording: false // Prevent status updates from overwriting user toggle
   },
   
@@ -189,6 +192,10 @@ const WS_CMD = Object.freeze({
   SKIP_SEQUENCE_LINE: 'skipSequenceLine',
   CLEAR_SEQUENCE: 'clearSequence',
   EXPORT_SEQUENCE: 'exportSequence',
+  SAVE_SEQUENCE: 'saveSequence',
+  LOAD_SEQUENCE: 'loadSequence',
+  DELETE_SAVED_SEQUENCE: 'deleteSavedSequence',
+  LIST_SEQUENCES: 'listSequences',
   GET_SEQUENCE_TABLE: 'getSequenceTable',
   
   // === Pursuit Mode ===
@@ -203,6 +210,18 @@ const WS_CMD = Object.freeze({
   REQUEST_STATS: 'requestStats'
 });
 
+// ============================================================================
+// WEBSOCKET BINARY OPCODES - Mirror of Config.h WS_BINARY_*
+// ============================================================================
+// Why: High-rate control (pursuit at 50Hz) skips JSON on both ends.
+// Frame = opcode byte + little-endian float32 payload (see sendBinaryCommand)
+const WS_BIN = Object.freeze({
+  PURSUIT_MOVE: 0x50,  // 'P' + targetMM, maxSpeedLevel
+  SET_SPEED: 0x56,     // 'V' + speedLevel (forward + backward)
+  PAUSE: 0x48,         // 'H' - toggle pause
+  STOP: 0x58           // 'X'
+});
+
 // ============================================================================
 // CONSOLE WRAPPER - Respect AppState.logging preferences
 // ============================================================================
@@ -162,6 +162,7 @@ const messageHandlers = {
   sequenceTable: (data) => { if (typeof renderSequenceTable === 'function') renderSequenceTable(data.data); },
   sequenceStatus: (data) => { if (typeof updateSequenceStatus === 'function') updateSequenceStatus(data); },
   exportData: (data) => handleExportData(data.data),
+  sequenceList: (data) => { if (typeof handleSequenceList === 'function') handleSequenceList(data.data); },
   fsList: (data) => handleFileSystemList(data.files),
   log: (data) => handleLogMessage(data),
 };
@@ -6,6 +6,7 @@
  * - Stats panel (show/hide, clear, export, import)
  * - Loading and displaying distance statistics
  * - Weekly charts (Chart.js)
+ * - Machine metrics history (binary GET /api/metrics)
  * - Milestone tracking display
  * 
  * Dependencies:
@@ -368,6 +369,128 @@ function renderStatsChart(labels, distances, sortedWeeks, weeklyData) {
   });
 }
 
+// ============================================================================
+// MACHINE METRICS HISTORY (GET /api/metrics - layout in MetricsHistory.h)
+// ============================================================================
+
+const METRICS_HEADER_SIZE = 16;
+
+/** Sample fields: byte offset in a sample, DataView reader, scale to display units */
+const METRICS_FIELDS = {
+  speed:  { offset: 6,  read: 'getUint16', scale: 0.1, label: 'stats.metricsSpeed' },
+  cpm:    { offset: 8,  read: 'getUint16', scale: 0.1, label: 'stats.metricsCpm' },
+  heap:   { offset: 10, read: 'getUint16', scale: 1,   label: 'stats.metricsHeap' },
+  psram:  { offset: 12, read: 'getUint16', scale: 1,   label: 'stats.metricsPsram' },
+  jitter: { offset: 14, read: 'getUint16', scale: 1,   label: 'stats.metricsJitter' },
+  temp:   { offset: 16, read: 'getInt16',  scale: 0.1, label: 'stats.metricsTemp' },
+  rssi:   { offset: 18, read: 'getInt8',   scale: 1,   label: 'stats.metricsRssi' }
+};
+
+/**
+ * Decode a /api/metrics download
+ * @param {ArrayBuffer} buffer - Response body
+ * @returns {Array<{time: Date|null, uptime: number, view: DataView}>} Non-empty samples, oldest first
+ */
+function decodeMetrics(buffer) {
+  const view = new DataView(buffer);
+  if (buffer.byteLength < METRICS_HEADER_SIZE ||
+      String.fromCharCode(view.getUint8(0), view.getUint8(1), view.getUint8(2)) !== 'MTR' ||
+      view.getUint8(3) !== 1) {
+    throw new Error('Unexpected metrics format');
+  }
+  const nowUptime = view.getUint32(4, true);
+  const nowEpoch = view.getUint32(8, true);  // 0 = device clock not synced
+  const sampleSize = view.getUint16(12, true);
+  const count = view.getUint16(14, true);
+
+  const samples = [];
+  for (let i = 0; i < count; i++) {
+    const offset = METRICS_HEADER_SIZE + i * sampleSize;
+    if (offset + sampleSize > buffer.byteLength) break;
+    const sample = new DataView(buffer, offset, sampleSize);
+    if (sample.getUint16(4, true) === 0) continue;  // Overwritten during download
+    const uptime = sample.getUint32(0, true);
+    samples.push({
+      uptime: uptime,
+      time: nowEpoch ? new Date((nowEpoch - (nowUptime - uptime)) * 1000) : null,
+      view: sample
+    });
+  }
+  return samples;
+}
+
+/**
+ * Load and chart the selected metric at the selected resolution
+ */
+function loadMetricsHistory() {
+  if (!DOM.metricsChartCanvas) return;
+  const resolution = DOM.metricsResolution ? DOM.metricsResolution.value : 's';
+
+  fetch('/api/metrics?res=' + resolution)
+    .then(response => {
+      if (!response.ok) throw new Error('HTTP ' + response.status);
+      return response.arrayBuffer();
+    })
+    .then(buffer => renderMetricsChart(decodeMetrics(buffer), resolution))
+    .catch(error => {
+      console.warn('Metrics history:', error);
+      showNotification(t('stats.metricsLoadError'), 'warning');
+    });
+}
+
+/**
+ * Render the metrics line chart
+ * @param {Array} samples - From decodeMetrics()
+ * @param {string} resolution - 's', 'm' or 'h'
+ */
+function renderMetricsChart(samples, resolution) {
+  const fieldKey = DOM.metricsField ? DOM.metricsField.value : 'speed';
+  const field = METRICS_FIELDS[fieldKey] || METRICS_FIELDS.speed;
+
+  const labels = samples.map(sample => {
+    if (!sample.time) return formatUptime(sample.uptime);  // Uptime when the clock is not synced
+    return resolution === 'h' ? sample.time.toLocaleString([], { month: '2-digit', day: '2-digit', hour: '2-digit' })
+                              : sample.time.toLocaleTimeString();
+  });
+  const values = samples.map(sample => sample.view[field.read](field.offset, true) * field.scale);
+
+  if (AppState.stats.metricsChart) {
+    AppState.stats.metricsChart.destroy();
+  }
+
+  AppState.stats.metricsChart = new Chart(DOM.metricsChartCanvas.getContext('2d'), {
+    type: 'line',
+    data: {
+      labels: labels,
+      datasets: [{
+        label: t(field.label),
+        data: values,
+        borderColor: 'rgba(102, 126, 234, 1)',
+        backgroundColor: 'rgba(102, 126, 234, 0.15)',
+        borderWidth: 1,
+        pointRadius: 0,
+        fill: true
+      }]
+    },
+    options: {
+      responsive: true,
+      maintainAspectRatio: true,
+      animation: false,
+      plugins: {
+        legend: { display: false }
+      },
+      scales: {
+        y: {
+          title: { display: true, text: t(field.label) }
+        },
+        x: {
+          ticks: { maxTicksLimit: 8, maxRotation: 0 }
+        }
+      }
+    }
+  });
+}
+
 // ============================================================================
 // STATS PANEL MANAGEMENT
 // ============================================================================
@@ -404,6 +527,7 @@ function toggleStatsPanel() {
     
     // Load stats data
     loadStatsData();
+    loadMetricsHistory();
   }
 }
 
@@ -717,6 +841,10 @@ function initStatsListeners() {
   DOM.btnImportStats.addEventListener('click', triggerStatsImport);
   DOM.statsFileInput.addEventListener('change', handleStatsFileImport);
   
+  // Machine metrics history: reload on field / resolution change
+  if (DOM.metricsField) DOM.metricsField.addEventListener('change', loadMetricsHistory);
+  if (DOM.metricsResolution) DOM.metricsResolution.addEventListener('change', loadMetricsHistory);
+  
   // Stats recording toggle
   if (DOM.statsRecordingEnabled) {
     DOM.statsRecordingEnabled.addEventListener('change', toggleStatsRecording);
@@ -23,7 +23,7 @@ const MODE_ICONS = {
   chaos: '🎲'
 };
 
-const WAVEFORM_NAMES = ['Sine', 'Triangle', 'Square'];
+const WAVEFORM_NAMES = ['Sine', 'Triangle', 'Square', 'Custom'];
 
 function getTypeNames() {
   return [t('utils.backAndForth'), t('utils.oscillation'), t('utils.chaos'), t('utils.calibration')];
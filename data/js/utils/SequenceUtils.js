@@ -28,8 +28,25 @@ const MOVEMENT_TYPE = {
   CALIBRATION: 4
 };
 
+// Control-flow opcodes (mirror SequenceOp in Types.h); MOVE lines use movementType
+const SEQUENCE_OP = {
+  MOVE: 0,
+  REPEAT: 1,
+  END_REPEAT: 2,
+  CALL: 3,
+  RETURN: 4,
+  RANDOM: 5,
+  WAIT: 6,
+  END: 7
+};
+
+/** True for a control-flow line (no movement of its own) */
+function isControlLine(line) {
+  return (line.op || SEQUENCE_OP.MOVE) !== SEQUENCE_OP.MOVE;
+}
+
 // Short names for sequence table display (SIN/TRI/SQR)
-const WAVEFORM_SHORT = ['SIN', 'TRI', 'SQR'];
+const WAVEFORM_SHORT = ['SIN', 'TRI', 'SQR', 'USR'];
 const SPEED_CURVE_LABELS = ['Lin', 'Sin', 'Tri⁻¹', 'Sin⁻¹'];
 function getSpeedEffectLabels() { return ['', t('seqUtils.decel'), t('seqUtils.accel')]; }
 
@@ -114,6 +131,33 @@ function getTypeDisplay(movementType, line) {
   return { typeIcon, typeInfo, typeName };
 }
 
+/**
+ * Get display information for a control-flow line
+ * @param {Object} line - Sequence line object (op > 0)
+ * @param {number} targetNumber - CALL: 1-based number of the target line (0 if missing)
+ * @returns {Object} { typeIcon, typeInfo, typeName }
+ */
+function getControlDisplay(line, targetNumber) {
+  const arg = line.opArg || 0;
+  const controls = {
+    [SEQUENCE_OP.REPEAT]:     ['🔁', 'sequencer.opRepeat',    `×${arg}`],
+    [SEQUENCE_OP.END_REPEAT]: ['🔚', 'sequencer.opEndRepeat', ''],
+    [SEQUENCE_OP.CALL]:       ['⤴️', 'sequencer.opCall',      targetNumber > 0 ? `→ #${targetNumber}` : '→ ?'],
+    [SEQUENCE_OP.RETURN]:     ['↩️', 'sequencer.opReturn',    ''],
+    [SEQUENCE_OP.RANDOM]:     ['🎲', 'sequencer.opRandom',    `1 / ${arg}`],
+    [SEQUENCE_OP.WAIT]:       ['⏳', 'sequencer.opWait',      `${(arg / 1000).toFixed(1)}s`],
+    [SEQUENCE_OP.END]:        ['⏹️', 'sequencer.opEnd',       '']
+  };
+  const [typeIcon, nameKey, detail] = controls[line.op] || ['❔', 'utils.unknown', ''];
+  const typeName = t(nameKey);
+  const typeInfo = `<div style="font-size: 10px; line-height: 1.2;">
+      <div>${typeName}</div>
+      ${detail ? `<div class="text-bold">${detail}</div>` : ''}
+    </div>`;
+  
+  return { typeIcon, typeInfo, typeName };
+}
+
 // ============================================================================
 // ZONE EFFECTS SUMMARY
 // ============================================================================
@@ -285,7 +329,8 @@ function getSequenceTemplateDoc() {
       }]
     },
     DOCUMENTATION: {
-      "Note": "Minimal template - See full documentation for more options"
+      "Note": "Minimal template - See full documentation for more options",
+      "op": "0=move (default), 1=repeat opArg times until 2=end repeat, 3=call line with lineId opArg until 4=return, 5=play one of the next opArg lines at random, 6=wait opArg ms, 7=end"
     }
   };
 }
@@ -306,6 +351,7 @@ const SEQ_LIMITS = Object.freeze({
   MAX_CYCLE_PAUSE_SEC: 300,
   MAX_CHAOS_DURATION_SEC: 3600,
   MAX_CYCLE_COUNT: 9999,
+  MAX_WAIT_SEC: 3600,
   CHAOS_PATTERN_COUNT: 11
 });
 
@@ -566,6 +566,22 @@ function sendCommand(cmd, params = {}) {
   }
 }
 
+/**
+ * Send a binary opcode frame to the ESP32 (no JSON on either side)
+ * @param {number} opcode - Frame opcode (use WS_BIN constants)
+ * @param {number[]} floats - Payload values, encoded as little-endian float32
+ */
+function sendBinaryCommand(opcode, floats = []) {
+  if (AppState.ws?.readyState === WebSocket.OPEN) {
+    const view = new DataView(new ArrayBuffer(1 + floats.length * 4));
+    view.setUint8(0, opcode);
+    floats.forEach((value, i) => view.setFloat32(1 + i * 4, value, true));
+    AppState.ws.send(view.buffer);
+  } else {
+    console.warn('Cannot send binary command: 0x' + opcode.toString(16), '- WebSocket not connected (retrying...)');
+  }
+}
+
 // ============================================================================
 // NUMERIC INPUT CONSTRAINTS
 // ============================================================================
@@ -52,12 +52,6 @@ void sendJsonSuccess(AsyncWebServerRequest* request, const String& message = "")
  */
 void sendJsonSuccessWithId(AsyncWebServerRequest* request, int id);
 
-/**
- * Send empty playlist structure
- * @param request The async request to respond to
- */
-void sendEmptyPlaylistStructure(AsyncWebServerRequest* request);
-
 // ============================================================================
 // BODY COLLECTION & JSON HELPERS (shared across APIRoutes + FilesystemManager)
 // ============================================================================
@@ -8,8 +8,10 @@
  *
  * Architecture:
  * - Singleton pattern for global access
- * - Chain of responsibility pattern for command handlers
- * - Each handler returns true if command was processed
+ * - constexpr command table: name → handler + flags + argument schema,
+ *   resolved through a compile-time perfect hash (O(1) for every command)
+ * - Arguments schema-checked before the handler runs
+ * - Fragmented messages rebuilt by WsMessageAssembler (bounded arena)
  *
  * Module Singletons Used:
  * - SeqTable: Sequence table CRUD operations
@@ -18,6 +20,8 @@
  * - Pursuit: Pursuit mode control
  * - Chaos: Chaos mode control
  * - Calibration: Calibration operations
+ * - Timeline: Scheduled starts ("startAt") + wall-clock phase lock
+ * - Trajectory: Keyframe playback + binary keyframe frames
  */
 
 #pragma once
@@ -30,6 +34,7 @@
 #include "core/UtilityEngine.h"
 #include "core/Validators.h"
 #include "core/GlobalState.h"
+#include "communication/CommandTable.h"
 
 // Module singletons
 #include "movement/SequenceExecutor.h"
@@ -67,6 +72,11 @@ public:
      */
     void handleCommand(uint8_t clientNum, const String& message);
 
+    /**
+     * Process a JSON command of len bytes (no NUL terminator required)
+     */
+    void handleCommand(uint8_t clientNum, const char* json, size_t len);
+
 private:
     // Singleton - private constructor
     CommandDispatcher() = default;
@@ -76,72 +86,180 @@ private:
     // WebSocket server reference
     AsyncWebSocket* _webSocket = nullptr;
 
+    // Client whose WebSocket message is being handled (0 = none, e.g. a scheduled replay)
+    uint32_t _commandClientId = 0;
+
     // ========================================================================
-    // COMMAND HANDLERS - Each returns true if command was handled
+    // COMMAND TABLE - constexpr perfect hash (see CommandTable.h)
     // ========================================================================
 
-    /**
-     * Handler 1/8: Basic system commands
-     * Commands: calibrate, start, pause, stop, getStatus, returnToStart,
-     *           resetTotalDistance, saveStats, setMaxDistanceLimit
-     */
-    bool handleBasicCommands(const char* cmd, JsonDocument& doc);
+    /** One handler per command; arguments already schema-checked */
+    using CommandHandler = void (CommandDispatcher::*)(JsonDocument& doc);
 
-    /**
-     * Handler 2/8: Configuration commands
-     * Commands: setDistance, setStartPosition, setSpeedForward, setSpeedBackward
-     */
-    bool handleConfigCommands(const char* cmd, JsonDocument& doc);
+    /** Motion timeline behaviour of a command */
+    enum CommandFlags : uint8_t {
+        CMD_NONE = 0,
+        CMD_SCHEDULABLE = 1 << 0,       // "startAt" parks it in Timeline
+        CMD_PHASE_LOCKABLE = 1 << 1,    // "phaseAnchor" engages the phase lock
+        CMD_CANCELS_TIMELINE = 1 << 2   // Drops a pending start + phase lock
+    };
 
-    /**
-     * Handler 3/8: Deceleration zone commands
-     * Commands: setDecelZone
-     */
-    bool handleDecelZoneCommands(const char* cmd, JsonDocument& doc, const String& message);
+    struct CommandSpec {
+        const char* name;
+        CommandHandler handler;
+        uint8_t flags;
+        CommandTable::ArgList args;
+    };
 
     /**
-     * Handler 4/8: Cycle pause commands (VA-ET-VIENT + Oscillation)
-     * Commands: updateCyclePause, updateCyclePauseOsc
+     * Resolve a command name: one hash + one compare
+     * @return nullptr if unknown
      */
-    bool handleCyclePauseCommands(const char* cmd, JsonDocument& doc);
+    [[nodiscard]] static const CommandSpec* findCommand(const char* cmd);
 
     /**
-     * Handler 5/8: Pursuit mode commands
-     * Commands: enablePursuitMode, pursuitMove
+     * Check the command's argument schema (required + types)
+     * @return false if rejected (error sent)
      */
-    bool handlePursuitCommands(const char* cmd, JsonDocument& doc);
+    [[nodiscard]] bool checkArguments(const CommandSpec& spec, const JsonDocument& doc);
 
     /**
-     * Handler 6/8: Chaos mode commands
-     * Commands: startChaos, stopChaos, setChaosConfig
+     * Pre-handler: motion timeline (runs before the command handler)
+     * - CMD_SCHEDULABLE with "startAt" (epoch ms) → parked in Timeline,
+     *   replayed at that instant (returns true: command consumed for now)
+     * - CMD_PHASE_LOCKABLE with "phaseAnchor" → phase lock engaged
+     *   ("phaseLock": false opts out of the default anchor = startAt)
+     * - CMD_CANCELS_TIMELINE, or a start without startAt → pending start
+     *   cancelled, lock released
      */
-    bool handleChaosCommands(const char* cmd, JsonDocument& doc, const String& message);
+    bool handleTimelineCommands(const CommandSpec& spec, JsonDocument& doc);
 
     /**
-     * Handler 7/8: Oscillation mode commands
-     * Commands: setOscillation, startOscillation, stopOscillation
+     * Binary WebSocket frames: opcode byte + fixed little-endian payload
+     * (see Config.h WS_BINARY_*). No JsonDocument, no String on the hot path:
+     * pursuit move, speed, pause, stop, trajectory keyframes.
      */
-    bool handleOscillationCommands(const char* cmd, JsonDocument& doc, const String& message);
+    void handleBinaryFrame(const uint8_t* data, size_t len);
 
-    /**
-     * Handler 8/8: Sequencer commands
-     * Commands: addSequenceLine, deleteSequenceLine, updateSequenceLine,
-     *           moveSequenceLine, duplicateSequenceLine, toggleSequenceLine,
-     *           clearSequence, getSequenceTable, startSequence, loopSequence,
-     *           stopSequence, toggleSequencePause, skipSequenceLine,
-     *           exportSequence, importSequence, toggleDebug, requestStats
-     */
-    bool handleSequencerCommands(const char* cmd, JsonDocument& doc, const String& message);
+    // ========================================================================
+    // HANDLERS 1/9: BASIC SYSTEM COMMANDS
+    // ========================================================================
+
+    void cmdCalibrate(JsonDocument& doc);
+    void cmdStart(JsonDocument& doc);           // Validation + movement start
+    void cmdPause(JsonDocument& doc);
+    void cmdStop(JsonDocument& doc);
+    void cmdGetStatus(JsonDocument& doc);
+    void cmdSyncTime(JsonDocument& doc);
+    void cmdReturnToStart(JsonDocument& doc);
+    void cmdResetTotalDistance(JsonDocument& doc);
+    void cmdSaveStats(JsonDocument& doc);
+    void cmdSetStatsRecording(JsonDocument& doc);
+    void cmdSetMaxDistanceLimit(JsonDocument& doc);
+    void cmdSetSensorsInverted(JsonDocument& doc);
+    void cmdSetAutoRecalibrate(JsonDocument& doc);
+    void cmdResetGovernor(JsonDocument& doc);
+    void cmdToggleDebug(JsonDocument& doc);
+    void cmdRequestStats(JsonDocument& doc);
+    void cmdTelemetry(JsonDocument& doc);       // Per-client step telemetry stream
+
+    // ========================================================================
+    // HANDLERS 2/9: CONFIGURATION COMMANDS
+    // ========================================================================
+
+    void cmdSetDistance(JsonDocument& doc);
+    void cmdSetStartPosition(JsonDocument& doc);
+    void cmdSetSpeedForward(JsonDocument& doc);
+    void cmdSetSpeedBackward(JsonDocument& doc);
+
+    // ========================================================================
+    // HANDLERS 3/9: ZONE EFFECT COMMANDS (setZoneEffect, legacy setDecelZone)
+    // ========================================================================
+
+    void cmdSetZoneEffect(JsonDocument& doc);
+
+    // ========================================================================
+    // HANDLERS 4/9: CYCLE PAUSE COMMANDS (VA-ET-VIENT + Oscillation)
+    // ========================================================================
+
+    void cmdUpdateCyclePause(JsonDocument& doc);
+    void cmdUpdateCyclePauseOsc(JsonDocument& doc);
+
+    // ========================================================================
+    // HANDLERS 5/9: PURSUIT MODE COMMANDS
+    // ========================================================================
+
+    void cmdEnablePursuitMode(JsonDocument& doc);
+    void cmdDisablePursuitMode(JsonDocument& doc);
+    void cmdPursuitMove(JsonDocument& doc);
+
+    /** Shared by JSON pursuitMove and the binary 'P' frame */
+    void pursuitMove(float targetMM, float maxSpeedLevel);
+
+    // ========================================================================
+    // HANDLERS 6/9: CHAOS MODE COMMANDS
+    // ========================================================================
+
+    void cmdStartChaos(JsonDocument& doc);
+    void cmdStopChaos(JsonDocument& doc);
+    void cmdSetChaosConfig(JsonDocument& doc);
+
+    // ========================================================================
+    // HANDLERS 7/9: OSCILLATION MODE COMMANDS
+    // ========================================================================
+
+    void cmdSetOscillation(JsonDocument& doc);  // Validated, rolled back on error
+    void cmdStartOscillation(JsonDocument& doc);
+    void cmdStopOscillation(JsonDocument& doc);
+
+    // ========================================================================
+    // HANDLERS 8/9: SEQUENCER COMMANDS
+    // ========================================================================
+
+    void cmdAddSequenceLine(JsonDocument& doc);  // Parse + validate + add
+    void cmdGetSequenceTable(JsonDocument& doc);
+    void cmdClearSequence(JsonDocument& doc);
+    void cmdDeleteSequenceLine(JsonDocument& doc);
+    void cmdUpdateSequenceLine(JsonDocument& doc);
+    void cmdMoveSequenceLine(JsonDocument& doc);
+    void cmdReorderSequenceLine(JsonDocument& doc);
+    void cmdDuplicateSequenceLine(JsonDocument& doc);
+    void cmdToggleSequenceLine(JsonDocument& doc);
+    void cmdStartSequence(JsonDocument& doc);
+    void cmdLoopSequence(JsonDocument& doc);
+    void cmdStopSequence(JsonDocument& doc);
+    void cmdToggleSequencePause(JsonDocument& doc);
+    void cmdSkipSequenceLine(JsonDocument& doc);
+    void cmdExportSequence(JsonDocument& doc);
+    void cmdImportSequence(JsonDocument& doc);
+    void cmdSaveSequence(JsonDocument& doc);         // Named sequences (LittleFS)
+    void cmdLoadSequence(JsonDocument& doc);
+    void cmdDeleteSavedSequence(JsonDocument& doc);
+    void cmdListSequences(JsonDocument& doc);
+
+    // ========================================================================
+    // HANDLERS 9/9: TRAJECTORY PLAYBACK COMMANDS
+    // ========================================================================
+
+    void cmdStartTrajectory(JsonDocument& doc);
+    void cmdStopTrajectory(JsonDocument& doc);
+    void cmdLoadTrajectory(JsonDocument& doc);
+    void cmdClearTrajectory(JsonDocument& doc);
 
     // ========================================================================
     // HELPER METHODS
     // ========================================================================
 
     /**
-     * Parse JSON command string into document
+     * Parse len bytes of JSON into document
      * @return true if parsing successful
      */
-    [[nodiscard]] bool parseJsonCommand(const String& jsonStr, JsonDocument& doc);
+    [[nodiscard]] bool parseJsonCommand(const char* json, size_t len, JsonDocument& doc);
+
+    /**
+     * Route one complete WebSocket message by opcode (text → JSON, binary → frame)
+     */
+    void dispatchMessage(uint32_t clientId, uint8_t opcode, const uint8_t* data, size_t len);
 
     /**
      * Validate and report errors via WebSocket
@@ -158,38 +276,9 @@ private:
      */
     void applyCyclePauseConfig(CyclePauseConfig& target, JsonDocument& doc, const char* label);
 
-    // ========================================================================
-    // EXTRACTED COMMAND BODIES (reduce cognitive complexity of handlers)
-    // ========================================================================
-
-    /** Start command logic (validation + movement start) */
-    bool cmdStart(JsonDocument& doc);
-
-    /** addSequenceLine command logic (parse + validate + add) */
-    bool cmdAddSequenceLine(const JsonDocument& doc);
-
     /** Zone effect configuration parsing from JSON */
     void applyZoneEffectConfig(JsonDocument& doc);
 
-    /** Oscillation config from setOscillation command */
-    bool applyOscillationConfig(JsonDocument& doc);
-
-    /** startChaos command body */
-    bool cmdStartChaos(JsonDocument& doc);
-
-    /** setChaosConfig command body */
-    bool cmdSetChaosConfig(JsonDocument& doc);
-
-    // ========================================================================
-    // SUB-HANDLERS (extracted to reduce cognitive complexity)
-    // ========================================================================
-
-    /** handleBasicCommands sub: system settings (maxDistanceLimit, sensorsInverted) */
-    bool handleSystemSettingsCommands(const char* cmd, JsonDocument& doc);
-
-    /** handleBasicCommands sub: debug & stats (toggleDebug, requestStats) */
-    bool handleDebugAndStatsCommands(const char* cmd, JsonDocument& doc);
-
     /** applyZoneEffectConfig sub: zone enable/disable + mirror + zoneSize */
     void applyZoneSettings(JsonDocument& doc);
 
@@ -205,16 +294,7 @@ private:
     /** applyZoneEffectConfig sub: debug logging of zone config */
     void logZoneEffectDebug();
 
-    /** handleSequencerCommands sub: CRUD operations (add/delete/update/move/reorder/duplicate/toggle/clear/get) */
-    bool handleSequencerCRUD(const char* cmd, JsonDocument& doc);
-
-    /** handleSequencerCommands sub: execution control (start/loop/stop/pause/skip) */
-    bool handleSequencerControl(const char* cmd);
-
-    /** handleSequencerCommands sub: import/export */
-    bool handleSequencerIO(const char* cmd, JsonDocument& doc);
-
-    /** applyOscillationConfig sub: live transitions for center/amplitude changes */
+    /** cmdSetOscillation sub: live transitions for center/amplitude changes */
     void applyOscillationLiveTransitions(float oldCenter, float oldAmplitude,
                                           float oldFrequency, OscillationWaveform oldWaveform);
 };
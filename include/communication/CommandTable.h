@@ -0,0 +1,168 @@
+// ============================================================================
+// COMMAND_TABLE.H - Compile-time perfect hash for WebSocket command names
+// ============================================================================
+// CommandDispatcher resolves a command with one hash + one name compare,
+// whatever the command, instead of walking a strcmp cascade. The index is
+// built by the compiler from the dispatcher's constexpr command table:
+// - commandHash():      FNV-1a + seeded avalanche, usable at compile and run time
+// - buildPerfectHash(): searches a seed that gives every name its own slot
+// - find():             slot → entry, confirmed by a full name compare
+//
+// Argument schemas (CommandArg) are declared next to each entry; the
+// ArduinoJson-side check lives in CommandDispatcher.
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace CommandTable {
+
+// ============================================================================
+// ARGUMENT SCHEMA
+// ============================================================================
+
+enum class ArgType : uint8_t {
+    NUMBER,   // int or float
+    INTEGER,  // int (64-bit OK: epoch ms)
+    BOOL,
+    STRING,
+    ARRAY
+};
+
+struct CommandArg {
+    const char* name = nullptr;  // nullptr = unused slot (end of list)
+    ArgType type = ArgType::NUMBER;
+    bool required = false;
+};
+
+// Why 3? Widest schema (moveSequenceLine, pursuitMove) checks 2-3 fields;
+// everything else a handler reads keeps its historical default.
+constexpr size_t MAX_ARGS = 3;
+
+using ArgList = std::array<CommandArg, MAX_ARGS>;
+
+/** Required argument: missing or mistyped → command rejected */
+constexpr CommandArg req(const char* name, ArgType type) { return {name, type, true}; }
+
+/** Optional argument: type-checked only when present */
+constexpr CommandArg opt(const char* name, ArgType type) { return {name, type, false}; }
+
+/** Human-readable type name for error messages */
+constexpr const char* argTypeName(ArgType type) {
+    switch (type) {
+        case ArgType::NUMBER:  return "a number";
+        case ArgType::INTEGER: return "an integer";
+        case ArgType::BOOL:    return "a boolean";
+        case ArgType::STRING:  return "a string";
+        case ArgType::ARRAY:   return "an array";
+    }
+    return "?";
+}
+
+// ============================================================================
+// HASHING
+// ============================================================================
+
+constexpr uint8_t EMPTY_SLOT = 0xFF;
+
+// Why 1024? A seed is collision-free with probability ~exp(-n²/2m) for n
+// names in m slots; at a load factor up to 1/8 (64 names in 512 slots) that
+// is one seed in ~55, so 1024 tries fail only on a duplicate name. The bound
+// stops that hopeless search well inside the compiler's constexpr budget, so
+// the caller's static_assert reports it.
+constexpr uint32_t MAX_SEED_SEARCH = 1024;
+
+/** FNV-1a over a NUL-terminated name (seed-independent part) */
+constexpr uint32_t fnv1a(const char* name) {
+    uint32_t hash = 2166136261u;
+    for (; *name != '\0'; ++name) {
+        hash ^= static_cast<uint8_t>(*name);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/** MurmurHash3 finalizer: every slot bit depends on every hash + seed bit */
+constexpr uint32_t avalanche(uint32_t hash) {
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+constexpr uint32_t commandHash(const char* name, uint32_t seed) {
+    return avalanche(fnv1a(name) ^ seed);
+}
+
+/** Full name compare (constexpr strcmp == 0) */
+constexpr bool namesEqual(const char* lhs, const char* rhs) {
+    for (; *lhs != '\0' && *lhs == *rhs; ++lhs, ++rhs) {}
+    return *lhs == *rhs;
+}
+
+// ============================================================================
+// PERFECT HASH INDEX
+// ============================================================================
+
+template <size_t SlotCount>
+struct PerfectHashIndex {
+    static_assert((SlotCount & (SlotCount - 1)) == 0, "SlotCount must be a power of two");
+
+    uint32_t seed = 0;
+    bool valid = false;                // false: no collision-free seed found
+    std::array<uint8_t, SlotCount> slots{};
+
+    /** Entry index the name would occupy, EMPTY_SLOT if none */
+    [[nodiscard]] constexpr uint8_t candidate(const char* name) const {
+        return slots[commandHash(name, seed) & (SlotCount - 1)];
+    }
+};
+
+/**
+ * Build a collision-free slot index over entries[i].name.
+ * Check .valid with a static_assert: false means a duplicate name or a
+ * SlotCount too small for the table.
+ */
+template <size_t SlotCount, typename Entry, size_t N>
+constexpr PerfectHashIndex<SlotCount> buildPerfectHash(const std::array<Entry, N>& entries) {
+    static_assert(N < EMPTY_SLOT, "Slot index is uint8_t");
+    static_assert(N <= SlotCount, "More entries than slots");
+
+    std::array<uint32_t, N> baseHashes{};
+    for (size_t idx = 0; idx < N; ++idx) {
+        baseHashes[idx] = fnv1a(entries[idx].name);
+    }
+
+    PerfectHashIndex<SlotCount> index;
+    for (uint32_t seed = 0; seed < MAX_SEED_SEARCH; ++seed) {
+        index.slots.fill(EMPTY_SLOT);
+        bool collision = false;
+        for (size_t idx = 0; idx < N && !collision; ++idx) {
+            size_t slot = avalanche(baseHashes[idx] ^ seed) & (SlotCount - 1);
+            collision = index.slots[slot] != EMPTY_SLOT;
+            index.slots[slot] = static_cast<uint8_t>(idx);
+        }
+        if (!collision) {
+            index.seed = seed;
+            index.valid = true;
+            return index;
+        }
+    }
+    return index;
+}
+
+/** Entry for name, nullptr if unknown: one hash + one compare */
+template <size_t SlotCount, typename Entry, size_t N>
+constexpr const Entry* find(const std::array<Entry, N>& entries,
+                            const PerfectHashIndex<SlotCount>& index, const char* name) {
+    uint8_t idx = index.candidate(name);
+    if (idx == EMPTY_SLOT || !namesEqual(entries[idx].name, name)) return nullptr;
+    return &entries[idx];
+}
+
+} // namespace CommandTable
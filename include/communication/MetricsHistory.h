@@ -0,0 +1,92 @@
+// ============================================================================
+// METRICS_HISTORY.H - On-device time series for long-run dashboards
+// ============================================================================
+// Once a second networkTask samples speed, cycles/min (both from the
+// odometer), free heap / PSRAM, WiFi RSSI, chip temperature and the worst
+// motor loop gap (step jitter bound) into MetricsSeries rings at 1s / 1min /
+// 1h resolution, kept in PSRAM. A dashboard downloads a range in one binary
+// request instead of staying connected or polling.
+//
+// GET /api/metrics?res=s|m|h[&since=<uptimeSec>] returns:
+//   "MTR" version(1) | uptimeSec u32 | epochSec u32 (0 = NTP not synced) |
+//   sampleSize u16 | sampleCount u16 | sampleCount x MetricsSeries::Sample
+// all little-endian, oldest sample first. A sample overwritten while the
+// response streams is sent with count = 0.
+// ============================================================================
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "core/Config.h"
+#include "communication/MetricsSeries.h"
+
+class MetricsHistory {
+public:
+    static MetricsHistory& getInstance();
+
+    static constexpr uint8_t VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 16;
+
+    /** Allocate the rings (PSRAM, else smaller in internal RAM) - call in setup() */
+    void begin();
+
+    [[nodiscard]] bool isReady() const { return m_ready; }
+
+    /** Take a 1s sample when due (call from networkTask) */
+    void update();
+
+    /**
+     * Record a motor loop iteration (Core 1, every loop)
+     * @param active Motor running - idle loops sleep on purpose and are not timed
+     */
+    void noteMotorLoop(bool active);
+
+    // ========================================================================
+    // DOWNLOAD
+    // ========================================================================
+
+    /** A frozen [first, first + count) range of one resolution */
+    struct Range {
+        MetricsSeries::Resolution resolution = MetricsSeries::SECONDS;
+        uint32_t first = 0;
+        uint16_t count = 0;
+        uint32_t uptimeSec = 0;
+        uint32_t epochSec = 0;
+    };
+
+    /** Samples of resolution starting after sinceUptimeSec (0 = all held) */
+    Range openRange(MetricsSeries::Resolution resolution, uint32_t sinceUptimeSec);
+
+    [[nodiscard]] static size_t rangeBytes(const Range& range) {
+        return HEADER_SIZE + range.count * sizeof(MetricsSeries::Sample);
+    }
+
+    /**
+     * Encode the bytes of range at [offset, offset + maxLen) (response filler)
+     * @return Bytes written (0 at the end)
+     */
+    size_t readRange(const Range& range, uint8_t* out, size_t maxLen, size_t offset);
+
+private:
+    MetricsHistory() = default;
+    MetricsHistory(const MetricsHistory&) = delete;
+    MetricsHistory& operator=(const MetricsHistory&) = delete;
+
+    MetricsSeries::Sample takeSample(uint32_t uptimeSec, uint32_t elapsedMs);
+
+    MetricsSeries::Downsampler m_series;
+    SemaphoreHandle_t m_mutex = nullptr;  // update() (networkTask) vs readRange() (async_tcp)
+    bool m_ready = false;
+
+    unsigned long m_lastSampleMs = 0;
+    uint64_t m_lastSteps = 0;
+    uint64_t m_lastReversals = 0;
+
+    // Motor loop timing (written by Core 1, drained by update())
+    uint32_t m_loopPrevMicros = 0;
+    std::atomic<uint32_t> m_loopMaxGapUs{0};
+};
+
+// Global accessor
+inline MetricsHistory& Metrics = MetricsHistory::getInstance();
@@ -0,0 +1,192 @@
+// ============================================================================
+// METRICS_SERIES.H - Samples, downsampling and rings behind MetricsHistory
+// ============================================================================
+// A Sample is one time bucket of system/motion metrics in fixed point. The
+// Downsampler takes one 1s Sample per second and folds it into 1min and 1h
+// buckets (means weighted by seconds, worst case for heap / PSRAM / jitter),
+// each resolution kept in its own Ring.
+//
+// Rings live in caller-provided storage and number samples by a running
+// sequence: a reader asks for sequence N and learns if it was overwritten,
+// so a download that races the sampler never sees a torn range.
+// ============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace MetricsSeries {
+
+/** One bucket - sent as-is (little-endian) by GET /api/metrics */
+struct Sample {
+    uint32_t uptimeSec = 0;   // Bucket start
+    uint16_t count = 0;       // Seconds aggregated (0 = empty / overwritten)
+    uint16_t speedDmmS = 0;   // Mean speed (0.1 mm/s)
+    uint16_t cpmX10 = 0;      // Mean cycles per minute (x10)
+    uint16_t heapFreeKB = 0;  // Lowest free heap
+    uint16_t psramFreeKB = 0; // Lowest free PSRAM
+    uint16_t jitterUs = 0;    // Worst motor loop gap while running (µs, saturated)
+    int16_t tempDeciC = 0;    // Mean chip temperature (0.1 °C)
+    int8_t rssi = 0;          // Mean WiFi RSSI (dBm, 0 = not connected)
+    uint8_t reserved = 0;
+};
+static_assert(sizeof(Sample) == 20, "Sample layout is part of the /api/metrics format");
+
+enum Resolution : uint8_t { SECONDS = 0, MINUTES = 1, HOURS = 2, RESOLUTION_COUNT = 3 };
+
+constexpr std::array<uint32_t, RESOLUTION_COUNT> BUCKET_SECONDS = {1, 60, 3600};
+
+/** Saturating narrow */
+template <typename T>
+constexpr T clampTo(int64_t value) {
+    return static_cast<T>(std::clamp<int64_t>(value, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()));
+}
+
+// ============================================================================
+// ACCUMULATOR - folds finer samples into one coarser bucket
+// ============================================================================
+
+class Accumulator {
+public:
+    [[nodiscard]] bool empty() const { return m_seconds == 0; }
+
+    /** true if a sample starting at uptimeSec belongs to the next bucket */
+    [[nodiscard]] bool closedBy(uint32_t uptimeSec, uint32_t width) const {
+        return !empty() && uptimeSec - m_start >= width;
+    }
+
+    void add(const Sample& sample) {
+        if (sample.count == 0) return;
+        if (empty()) {
+            m_start = sample.uptimeSec;
+            m_heapMin = sample.heapFreeKB;
+            m_psramMin = sample.psramFreeKB;
+            m_jitterMax = 0;
+        }
+        uint32_t weight = sample.count;
+        m_seconds += weight;
+        m_speed += static_cast<uint64_t>(sample.speedDmmS) * weight;
+        m_cpm += static_cast<uint64_t>(sample.cpmX10) * weight;
+        m_temp += static_cast<int64_t>(sample.tempDeciC) * weight;
+        m_rssi += static_cast<int64_t>(sample.rssi) * weight;
+        m_heapMin = std::min(m_heapMin, sample.heapFreeKB);
+        m_psramMin = std::min(m_psramMin, sample.psramFreeKB);
+        m_jitterMax = std::max(m_jitterMax, sample.jitterUs);
+    }
+
+    /** The bucket so far, then start over */
+    Sample take() {
+        Sample out;
+        if (empty()) return out;
+        auto seconds = static_cast<int64_t>(m_seconds);
+        out.uptimeSec = m_start;
+        out.count = clampTo<uint16_t>(seconds);
+        out.speedDmmS = clampTo<uint16_t>(static_cast<int64_t>(m_speed) / seconds);
+        out.cpmX10 = clampTo<uint16_t>(static_cast<int64_t>(m_cpm) / seconds);
+        out.tempDeciC = clampTo<int16_t>(m_temp / seconds);
+        out.rssi = clampTo<int8_t>(m_rssi / seconds);
+        out.heapFreeKB = m_heapMin;
+        out.psramFreeKB = m_psramMin;
+        out.jitterUs = m_jitterMax;
+        *this = Accumulator();
+        return out;
+    }
+
+private:
+    uint32_t m_start = 0;
+    uint32_t m_seconds = 0;
+    uint64_t m_speed = 0;
+    uint64_t m_cpm = 0;
+    int64_t m_temp = 0;
+    int64_t m_rssi = 0;
+    uint16_t m_heapMin = 0;
+    uint16_t m_psramMin = 0;
+    uint16_t m_jitterMax = 0;
+};
+
+// ============================================================================
+// RING - fixed capacity, addressed by running sequence number
+// ============================================================================
+
+class Ring {
+public:
+    void attach(Sample* storage, uint32_t capacity) {
+        m_data = storage;
+        m_capacity = capacity;
+        m_written = 0;
+    }
+
+    [[nodiscard]] uint32_t capacity() const { return m_capacity; }
+
+    /** Sequence of the next push (= total pushed) */
+    [[nodiscard]] uint32_t end() const { return m_written; }
+
+    /** Oldest sequence still held */
+    [[nodiscard]] uint32_t begin() const { return m_written > m_capacity ? m_written - m_capacity : 0; }
+
+    void push(const Sample& sample) {
+        if (m_capacity == 0) return;
+        m_data[m_written % m_capacity] = sample;
+        ++m_written;
+    }
+
+    /** @return false (out = empty sample) if sequence was overwritten or not written yet */
+    bool read(uint32_t sequence, Sample& out) const {
+        if (sequence < begin() || sequence >= end()) {
+            out = Sample();
+            return false;
+        }
+        out = m_data[sequence % m_capacity];
+        return true;
+    }
+
+    /** First held sequence whose bucket starts after uptimeSec (end() if none) */
+    [[nodiscard]] uint32_t firstAfter(uint32_t uptimeSec) const {
+        uint32_t low = begin();
+        uint32_t high = end();
+        while (low < high) {
+            uint32_t mid = low + (high - low) / 2;
+            if (m_data[mid % m_capacity].uptimeSec <= uptimeSec) low = mid + 1;
+            else high = mid;
+        }
+        return low;
+    }
+
+private:
+    Sample* m_data = nullptr;
+    uint32_t m_capacity = 0;
+    uint32_t m_written = 0;
+};
+
+// ============================================================================
+// DOWNSAMPLER - 1s samples in, three resolutions out
+// ============================================================================
+
+class Downsampler {
+public:
+    std::array<Ring, RESOLUTION_COUNT> rings;
+
+    /** Record one 1s sample (count = 1), closing minute/hour buckets it moves past */
+    void push(const Sample& second) {
+        if (m_minute.closedBy(second.uptimeSec, BUCKET_SECONDS[MINUTES])) {
+            Sample minute = m_minute.take();
+            rings[MINUTES].push(minute);
+            if (m_hour.closedBy(minute.uptimeSec, BUCKET_SECONDS[HOURS])) {
+                rings[HOURS].push(m_hour.take());
+            }
+            m_hour.add(minute);
+        }
+        m_minute.add(second);
+        rings[SECONDS].push(second);
+    }
+
+private:
+    Accumulator m_minute;
+    Accumulator m_hour;
+};
+
+}  // namespace MetricsSeries
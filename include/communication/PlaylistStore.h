@@ -0,0 +1,128 @@
+// ============================================================================
+// PLAYLIST_STORE.H - Saved presets, one LittleFS record per preset
+// ============================================================================
+// Layout under PLAYLIST_DIR:
+//   index.json          [{"id","mode","name","size","timestamp"}, ...]
+//   <mode>/<id>.json    {"id","name","timestamp","config":{...}}
+//
+// The index is held in RAM (loaded at boot): listings, counts and ID
+// allocation never open a record, and an add/update/delete writes one
+// record plus the few-KB index. Both are written aside then renamed.
+//
+// Damage stays local: an unreadable record is dropped from listings (and
+// renamed *.corrupted), a missing or unreadable index is rebuilt from the
+// records. A legacy /playlists.json is split into records once at boot.
+//
+// Single-threaded: only called from HTTP handlers (async_tcp task).
+// ============================================================================
+
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <array>
+#include "core/Config.h"
+#include "core/Types.h"
+
+class PlaylistStore {
+public:
+    static PlaylistStore& getInstance();
+
+    /** Preset modes (directory names, keys of the full listing) */
+    static constexpr std::array<const char*, 4> MODES = {"simple", "oscillation", "chaos", "pursuit"};
+
+    enum class Result : uint8_t {
+        OK,
+        UNKNOWN_MODE,
+        NOT_FOUND,
+        FULL,           // MAX_PRESETS_PER_MODE reached
+        IO_ERROR
+    };
+
+    /**
+     * Load the index (rebuild or migrate if needed) - call once in setup()
+     * after LittleFS is mounted
+     */
+    void begin();
+
+    [[nodiscard]] bool isReady() const { return m_ready; }
+
+    /** Index in MODES, -1 if unknown */
+    [[nodiscard]] static int modeIndex(const char* mode);
+
+    /** Presets stored for a mode */
+    [[nodiscard]] size_t count(int mode) const;
+
+    // ========================================================================
+    // RECORDS
+    // ========================================================================
+
+    /**
+     * Store a new preset
+     * @param outId ID assigned (unique within the mode)
+     */
+    Result add(int mode, const char* name, JsonVariantConst config, int& outId);
+
+    /**
+     * Rename and/or replace the config of a preset
+     * @param name   New name, nullptr to keep
+     * @param config New config, null to keep
+     */
+    Result update(int mode, int id, const char* name, JsonVariantConst config);
+
+    Result remove(int mode, int id);
+
+    /** Write one preset record (JSON) to out */
+    Result writePreset(int mode, int id, Print& out);
+
+    // ========================================================================
+    // LISTINGS
+    // ========================================================================
+
+    /** Every preset with its config, grouped by mode: {"simple":[...], ...} */
+    void writeAll(Print& out);
+
+    /** Index entries only: {"mode","total","offset","presets":[{"id","name","size","timestamp"}]} */
+    void writePage(int mode, size_t offset, size_t limit, Print& out) const;
+
+private:
+    PlaylistStore() = default;
+    PlaylistStore(const PlaylistStore&) = delete;
+    PlaylistStore& operator=(const PlaylistStore&) = delete;
+
+    struct Entry {
+        uint16_t id = 0;
+        uint8_t mode = 0;
+        uint32_t size = 0;        // Record bytes
+        uint32_t timestamp = 0;   // Creation (epoch seconds)
+        String name;
+    };
+
+    static constexpr size_t MAX_ENTRIES = MODES.size() * MAX_PRESETS_PER_MODE;
+
+    [[nodiscard]] static String recordPath(int mode, int id);
+
+    /** Position in m_entries, -1 if absent */
+    [[nodiscard]] int find(int mode, int id) const;
+
+    /** Write a record aside then rename it over the old one, @return bytes written (0 on failure) */
+    static size_t writeRecord(int mode, int id, const JsonDocument& record);
+
+    /** Parse a record, renaming it *.corrupted if unreadable */
+    static bool readRecord(int mode, int id, JsonDocument& record);
+
+    bool loadIndex();
+    bool saveIndex() const;
+    void rebuildIndex();
+    void migrateLegacyFile();
+
+    /** Drop entry at position (shifts the rest, keeps insertion order) */
+    void eraseEntry(int position);
+
+    std::array<Entry, MAX_ENTRIES> m_entries;
+    size_t m_count = 0;
+    bool m_ready = false;
+};
+
+// Global accessor
+inline PlaylistStore& Playlists = PlaylistStore::getInstance();
@@ -17,6 +17,7 @@
 #include "core/Config.h"
 #include "core/UtilityEngine.h"
 #include "core/GlobalState.h"
+#include "communication/StatusSections.h"
 
 // ============================================================================
 // STATUS BROADCASTER CLASS
@@ -83,15 +84,25 @@ private:
     AsyncWebSocket* _webSocket = nullptr;
     uint32_t _lastBroadcastHash = 0;  // FNV-1a hash of last broadcast payload (dedup)
 
+    // Config sections, re-serialized only when their struct changes (see StatusSections.h)
+    using PauseSection = StatusSections::Cache<CyclePauseConfig, String>;
+    StatusSections::Cache<MotionConfig, String> _motionSection;
+    StatusSections::Cache<PendingMotionConfig, String> _pendingSection;
+    StatusSections::Cache<ZoneEffectConfig, String> _zoneSection;
+    StatusSections::Cache<OscillationConfig, String> _oscSection;
+    StatusSections::Cache<ChaosRuntimeConfig, String> _chaosSection;
+    PauseSection _motionPauseSection;
+    PauseSection _oscPauseSection;
+
     // ========================================================================
     // INTERNAL HELPERS
     // ========================================================================
 
     /**
-     * Add cycle pause config & state to a parent JSON object
+     * Cycle pause object: cached config + live state
      * DRY: shared between Va-et-Vient and Oscillation modes
      */
-    void addCyclePauseFields(JsonObject parentObj, const CyclePauseConfig& pauseConfig, const CyclePauseState& pauseState);
+    static String cyclePauseJson(PauseSection& section, const CyclePauseConfig& pauseConfig, const CyclePauseState& pauseState);
 
     /**
      * Add VA-ET-VIENT / Pursuit mode specific fields to JSON
@@ -108,6 +119,21 @@ private:
      */
     void addChaosFields(JsonDocument& doc);
 
+    /**
+     * Add closed-loop position verification (PEND) + governor fields to JSON
+     */
+    void addPositionVerifyFields(JsonDocument& doc);
+
+    /**
+     * Add motion timeline fields (scheduled start, phase lock) to JSON
+     */
+    void addTimelineFields(JsonDocument& doc);
+
+    /**
+     * Add trajectory buffer + playback fields to JSON
+     */
+    void addTrajectoryFields(JsonDocument& doc);
+
     /**
      * Add system stats fields to JSON (on-demand)
      */
@@ -0,0 +1,153 @@
+// ============================================================================
+// STATUS_EVENTS.H - Change events that trigger status broadcasts
+// ============================================================================
+// Modules post what changed (any core, any task, lock-free); networkTask
+// dispatches once per loop, so JSON and WebSocket work only ever runs there
+// and a burst of changes - a command that moves, reconfigures and restarts -
+// becomes one broadcast per subscriber instead of one per change.
+//
+// Events are bits: posting an event that is already pending is free, and a
+// subscriber is called once with every pending event it listens to.
+//
+// ERROR is the one event with a payload: postError() copies the message into
+// a small ring, and the ERROR subscriber drains it with takeError() on
+// networkTask. Motion and hardware code report every error this way - their
+// functions run on motorTask, on the command handler or on both, and the
+// motor core must never build JSON or touch the WebSocket. Each slot carries
+// a sequence number, so both cores can post without a lock.
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+enum class StatusEvent : uint8_t {
+    STATE = 0,     // Run state or movement mode changed (start, stop, pause, calibration)
+    CONFIG = 1,    // A setting changed (limits, zones, mode parameters, trajectory buffer)
+    REFRESH = 2,   // A client asked for the status: sent even if unchanged
+    SEQUENCE = 3,  // Sequencer progress (sequenceStatus message)
+    ERROR = 4,     // Error message queued (drain with takeError)
+    COUNT
+};
+
+class StatusEventBus {
+public:
+    static StatusEventBus& getInstance() {
+        static StatusEventBus instance; // NOSONAR(cpp:S6018)
+        return instance;
+    }
+
+    StatusEventBus() {
+        for (size_t idx = 0; idx < ERROR_SLOTS; ++idx) m_errors[idx].sequence.store(static_cast<uint32_t>(idx));
+    }
+
+    /** Called from dispatch() with the pending events it subscribed to */
+    using Handler = void (*)(uint32_t events);
+
+    static constexpr size_t MAX_SUBSCRIBERS = 4;
+
+    // Why 4 x 128 B? One safety stop usually raises one message (two if a
+    // calibration failure follows); the longest message is ~100 bytes
+    static constexpr size_t ERROR_SLOTS = 4;
+    static constexpr size_t ERROR_MESSAGE_SIZE = 128;
+
+    static constexpr uint32_t bit(StatusEvent event) { return 1u << static_cast<uint8_t>(event); }
+
+    /** Any core: mark event pending (coalesced until the next dispatch) */
+    void post(StatusEvent event) { m_pending.fetch_or(bit(event), std::memory_order_release); }
+
+    /**
+     * Any core: queue an error message (truncated to ERROR_MESSAGE_SIZE - 1
+     * bytes on a UTF-8 boundary) and post ERROR
+     * @return false (message dropped) if ERROR_SLOTS messages are still waiting
+     */
+    bool postError(const char* message) {
+        // Claim a slot: it is free when its sequence equals the claim position
+        uint32_t pos = m_errorHead.load(std::memory_order_relaxed);
+        ErrorSlot* slot;
+        while (true) {
+            slot = &m_errors[pos % ERROR_SLOTS];
+            auto lag = static_cast<int32_t>(slot->sequence.load(std::memory_order_acquire) - pos);
+            if (lag < 0) return false;  // Still holds a message from the previous lap
+            if (lag == 0 && m_errorHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            if (lag > 0) pos = m_errorHead.load(std::memory_order_relaxed);  // Another poster took it
+        }
+
+        size_t len = std::strlen(message);
+        if (len >= ERROR_MESSAGE_SIZE) {
+            len = ERROR_MESSAGE_SIZE - 1;
+            while (len > 0 && (static_cast<uint8_t>(message[len]) & 0xC0) == 0x80) --len;  // Never split a character
+        }
+        std::memcpy(slot->text.data(), message, len);
+        slot->text[len] = '\0';
+
+        slot->sequence.store(pos + 1, std::memory_order_release);  // Readable
+        post(StatusEvent::ERROR);
+        return true;
+    }
+
+    /**
+     * ERROR subscriber (networkTask only): move the oldest queued message to out
+     * @return false if none is left
+     */
+    bool takeError(std::array<char, ERROR_MESSAGE_SIZE>& out) {
+        uint32_t pos = m_errorTail.load(std::memory_order_relaxed);
+        ErrorSlot& slot = m_errors[pos % ERROR_SLOTS];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) return false;  // Empty or still being written
+        out = slot.text;
+        m_errorTail.store(pos + 1, std::memory_order_relaxed);
+        slot.sequence.store(pos + ERROR_SLOTS, std::memory_order_release);  // Free for the next lap
+        return true;
+    }
+
+    /**
+     * Listen to the events in mask (setup only, before dispatching starts)
+     * @return false if MAX_SUBSCRIBERS are already registered
+     */
+    bool subscribe(uint32_t mask, Handler handler) {
+        if (m_count >= MAX_SUBSCRIBERS || handler == nullptr) return false;
+        m_subscribers[m_count++] = {mask, handler};
+        return true;
+    }
+
+    /**
+     * networkTask: take every pending event and call each interested subscriber once
+     * @return Events taken
+     */
+    uint32_t dispatch() {
+        uint32_t events = m_pending.exchange(0, std::memory_order_acquire);
+        if (events == 0) return 0;
+        for (size_t idx = 0; idx < m_count; ++idx) {
+            if (uint32_t matched = events & m_subscribers[idx].mask; matched != 0) m_subscribers[idx].handler(matched);
+        }
+        return events;
+    }
+
+private:
+    struct Subscriber {
+        uint32_t mask = 0;
+        Handler handler = nullptr;
+    };
+
+    std::atomic<uint32_t> m_pending{0};
+    std::array<Subscriber, MAX_SUBSCRIBERS> m_subscribers{};
+    size_t m_count = 0;
+
+    static_assert((ERROR_SLOTS & (ERROR_SLOTS - 1)) == 0, "Slot index must survive the uint32_t wrap");
+
+    struct ErrorSlot {
+        std::atomic<uint32_t> sequence{0};  // pos: free for pos, pos + 1: holds the message of pos
+        std::array<char, ERROR_MESSAGE_SIZE> text{};
+    };
+
+    std::array<ErrorSlot, ERROR_SLOTS> m_errors{};
+    std::atomic<uint32_t> m_errorHead{0};  // Next position to claim
+    std::atomic<uint32_t> m_errorTail{0};  // Next position to take
+};
+
+// Global accessor
+inline StatusEventBus& Events = StatusEventBus::getInstance();
@@ -0,0 +1,51 @@
+// ============================================================================
+// STATUS_SECTIONS.H - Config sections of the status JSON, serialized once
+// ============================================================================
+// The status broadcast (10-20 Hz) carries the whole mode configuration -
+// motion, zone effects, oscillation, chaos - which only changes on commands,
+// sequencer lines or cycle-end applies. Formatting it again every tick costs
+// dozens of float → text conversions for the same bytes.
+//
+// A Cache keeps a snapshot of its config struct next to the text built from
+// that snapshot. A section is dirty exactly when the live struct's bytes
+// differ from the snapshot: no writer (command, sequencer, EEPROM restore,
+// Core 1 apply) has to remember to flag it, and a steady section costs one
+// memcmp per broadcast. The text is always built from the snapshot, so a
+// write racing the copy only shows up as one more rebuild on the next tick.
+//
+// StatusBroadcaster splices the cached text with the few live fields.
+// ============================================================================
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+namespace StatusSections {
+
+template <typename Config, typename Text>
+class Cache {
+    static_assert(std::is_trivially_copyable_v<Config>, "Sections are compared and copied bytewise");
+
+public:
+    /**
+     * Text of live, rebuilt only if live changed since the last call
+     * @param build Text build(const Config&)
+     */
+    template <typename Build>
+    const Text& get(const Config& live, Build build) {
+        if (!m_valid || std::memcmp(&m_snapshot, &live, sizeof(Config)) != 0) {
+            std::memcpy(&m_snapshot, &live, sizeof(Config));
+            m_text = build(m_snapshot);
+            m_valid = true;
+        }
+        return m_text;
+    }
+
+private:
+    Config m_snapshot{};
+    Text m_text{};
+    bool m_valid = false;
+};
+
+}  // namespace StatusSections
@@ -0,0 +1,105 @@
+// ============================================================================
+// STEP_SAMPLES.H - Decimated per-step samples behind TelemetryStream
+// ============================================================================
+// Core 1 records what the motor just did (when, where, the interval it was
+// asked for and the one it got); Core 0 drains and sends. The two only meet
+// in a single-producer / single-consumer Ring: no lock, no allocation, and a
+// full ring drops the new sample (counted) instead of ever waiting.
+//
+// The Decimator keeps at most one sample per period, so a 20 kHz step rate
+// costs the motor loop one compare per step and the ring a few hundred
+// samples per second.
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace StepSamples {
+
+/** One step - sent as-is (little-endian) in telemetry frames */
+struct Sample {
+    uint32_t timeUs = 0;         // micros() of the step pulse
+    int32_t step = 0;            // Position after the step
+    float commandedUs = 0.0f;    // Scheduled interval (0 = mode without a step schedule)
+    uint32_t actualUs = 0;       // Time since the previous pulse
+};
+static_assert(sizeof(Sample) == 16, "Sample layout is part of the telemetry frame format");
+
+// ============================================================================
+// RING - one producer (Core 1), one consumer (Core 0)
+// ============================================================================
+
+template <size_t N>
+class Ring {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Ring wraps with a mask");
+
+public:
+    /** Producer: false (and counted as dropped) if the consumer fell a ring behind */
+    bool push(const Sample& sample) {
+        uint32_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) >= N) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_slots[head & (N - 1)] = sample;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Consumer: move up to maxCount oldest samples to out, return how many */
+    size_t pop(Sample* out, size_t maxCount) {
+        uint32_t tail = m_tail.load(std::memory_order_relaxed);
+        uint32_t available = m_head.load(std::memory_order_acquire) - tail;
+        size_t count = available < maxCount ? available : maxCount;
+        for (size_t idx = 0; idx < count; ++idx) out[idx] = m_slots[(tail + idx) & (N - 1)];
+        m_tail.store(tail + static_cast<uint32_t>(count), std::memory_order_release);
+        return count;
+    }
+
+    /** Consumer: discard everything held (new subscription starts fresh) */
+    void clear() { m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release); }
+
+    /** Samples dropped since the last call */
+    uint32_t takeDropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+    [[nodiscard]] size_t size() const {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::array<Sample, N> m_slots{};
+    std::atomic<uint32_t> m_head{0};  // Running count written
+    std::atomic<uint32_t> m_tail{0};  // Running count read
+    std::atomic<uint32_t> m_dropped{0};
+};
+
+// ============================================================================
+// DECIMATOR - at most one sample per period
+// ============================================================================
+
+class Decimator {
+public:
+    /** Sample rate, 0 = never */
+    void setRate(uint32_t hz) { m_periodUs.store(hz > 0 ? 1000000u / hz : 0, std::memory_order_relaxed); }
+
+    /** Keep a step taken at nowUs? */
+    bool take(uint32_t nowUs) {
+        uint32_t period = m_periodUs.load(std::memory_order_relaxed);
+        if (period == 0) return false;
+        if (m_primed && nowUs - m_lastUs < period) return false;
+        m_lastUs = nowUs;
+        m_primed = true;
+        return true;
+    }
+
+private:
+    std::atomic<uint32_t> m_periodUs{0};  // Written by Core 0
+    uint32_t m_lastUs = 0;
+    bool m_primed = false;
+};
+
+}  // namespace StepSamples
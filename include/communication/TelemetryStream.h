@@ -0,0 +1,82 @@
+// ============================================================================
+// TELEMETRY_STREAM.H - Opt-in per-step motion telemetry over WebSocket
+// ============================================================================
+// The status broadcast shows the position 10-20 times a second; this stream
+// shows what happened between: one sample per decimation period (up to
+// TELEMETRY_MAX_RATE_HZ) of pulse time, position, commanded and actual step
+// interval.
+//
+// A client subscribes with {"cmd":"telemetry","enable":true[,"rate":Hz]}
+// and then receives binary frames every TELEMETRY_FLUSH_INTERVAL_MS:
+//   'S' (WS_BINARY_TELEMETRY) | WsTelemetryHeader | sampleCount x Sample
+// all little-endian. Nothing is recorded while nobody is subscribed.
+//
+// Core 1 (motorTask) only writes to the StepSamples ring; Core 0
+// (networkTask) drains it, so a slow client never touches step timing.
+// ============================================================================
+
+#pragma once
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <array>
+#include <atomic>
+#include "core/Config.h"
+#include "communication/StepSamples.h"
+
+class TelemetryStream {
+public:
+    static TelemetryStream& getInstance();
+
+    void begin(AsyncWebSocket* ws);
+
+    // ========================================================================
+    // CORE 1 (motorTask)
+    // ========================================================================
+
+    /** Interval (Q24.8 µs) the step about to be taken was scheduled at */
+    void command(uint32_t intervalFixed) { m_commandedFixed = intervalFixed; }
+
+    /** Record the latest step if one was taken since the last call (every loop) */
+    void sample();
+
+    // ========================================================================
+    // CORE 0 (command handler / networkTask)
+    // ========================================================================
+
+    /**
+     * Start or stop streaming to a client
+     * @param rateHz Samples per second (clamped to 1..TELEMETRY_MAX_RATE_HZ)
+     * @return false if all subscriber slots are taken
+     */
+    bool subscribe(uint32_t clientId, bool enable, uint32_t rateHz = TELEMETRY_MAX_RATE_HZ);
+
+    /** Forget a disconnected client */
+    void release(uint32_t clientId) { subscribe(clientId, false); }
+
+    /** Send the samples held when a frame is due (call from networkTask) */
+    void flush();
+
+private:
+    TelemetryStream() = default;
+    TelemetryStream(const TelemetryStream&) = delete;
+    TelemetryStream& operator=(const TelemetryStream&) = delete;
+
+    [[nodiscard]] bool hasSubscribers() const;
+
+    AsyncWebSocket* m_ws = nullptr;
+    std::array<std::atomic<uint32_t>, TELEMETRY_MAX_SUBSCRIBERS> m_clients{};  // 0 = free slot
+    std::atomic<bool> m_active{false};
+    std::atomic<bool> m_restart{false};  // New session: flush() discards what the last one left
+    unsigned long m_lastFlushMs = 0;
+
+    StepSamples::Ring<TELEMETRY_RING_SIZE> m_ring;
+    StepSamples::Decimator m_decimator;
+
+    // Core 1 only
+    uint32_t m_commandedFixed = 0;
+    uint32_t m_lastSteps = 0;
+};
+
+// Global accessor
+inline TelemetryStream& Telemetry = TelemetryStream::getInstance();
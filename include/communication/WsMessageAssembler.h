@@ -0,0 +1,74 @@
+// ============================================================================
+// WS_MESSAGE_ASSEMBLER.H - Reassembly of fragmented WebSocket messages
+// ============================================================================
+// AsyncWebSocket delivers a message as several WS_EVT_DATA events when it is
+// fragmented (continuation frames) or larger than one TCP segment. Those
+// chunks are copied into a per-client slot of one fixed arena (PSRAM,
+// allocated once at boot) until the message is complete.
+//
+// - Bounded: a message larger than its slot is dropped (error sent once)
+// - No heap traffic per message: slots are reused, never freed
+// - Single-threaded: only called from the async_tcp task (onWebSocketEvent)
+// ============================================================================
+
+#pragma once
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <array>
+#include "core/Config.h"
+
+class WsMessageAssembler {
+public:
+    static WsMessageAssembler& getInstance();
+
+    /** A complete message, valid until release() */
+    struct Message {
+        const uint8_t* data = nullptr;
+        size_t len = 0;
+        uint8_t opcode = 0;  // WS_TEXT or WS_BINARY
+    };
+
+    /**
+     * Allocate the arena (PSRAM preferred) - call once in setup()
+     */
+    void begin();
+
+    /**
+     * Append one WS_EVT_DATA chunk
+     * @return true when the message is complete (out filled, call release())
+     */
+    [[nodiscard]] bool feed(uint32_t clientId, const AwsFrameInfo& info, const uint8_t* data, size_t len, Message& out);
+
+    /** Free the client's slot once its message was handled */
+    void release(uint32_t clientId);
+
+    [[nodiscard]] size_t getMaxMessageSize() const { return m_slotSize; }
+
+private:
+    WsMessageAssembler() = default;
+    WsMessageAssembler(const WsMessageAssembler&) = delete;
+    WsMessageAssembler& operator=(const WsMessageAssembler&) = delete;
+
+    struct Slot {
+        bool inUse = false;
+        bool overflow = false;  // Too large: swallow chunks until the final one
+        uint32_t clientId = 0;
+        uint8_t opcode = 0;
+        size_t len = 0;
+        uint8_t* buffer = nullptr;
+    };
+
+    /** Slot holding clientId's partial message, nullptr if none */
+    Slot* findSlot(uint32_t clientId);
+
+    /** Claim a free slot for a new message, nullptr if all busy */
+    Slot* claimSlot(uint32_t clientId, uint8_t opcode);
+
+    uint8_t* m_arena = nullptr;
+    size_t m_slotSize = 0;
+    std::array<Slot, WS_REASSEMBLY_SLOTS> m_slots{};
+};
+
+// Global accessor (singleton reference)
+inline WsMessageAssembler& WsAssembler = WsMessageAssembler::getInstance();
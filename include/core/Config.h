@@ -128,16 +128,27 @@ constexpr float OSC_RAMP_START_DELAY_MS = 500.0f;  // Wait 500ms before starting
 // Step timing for oscillation phases
 constexpr unsigned long OSC_POSITIONING_STEP_DELAY_MICROS = 2000;  // Slow initial positioning (25mm/s)
 constexpr unsigned long OSC_MIN_STEP_DELAY_MICROS = 50;  // Minimum delay for oscillation (ultra-high resolution: 33kHz)
-constexpr int OSC_MAX_STEPS_PER_CATCH_UP = 2;  // Max steps per loop iteration (anti-jerk)
-
-// Sine wave lookup table (optional performance optimization)
-#define USE_SINE_LOOKUP_TABLE  // Enable pre-calculated sine table (saves ~13us per call)
-constexpr int SINE_TABLE_SIZE = 1024;  // 1024 points = 0.1% precision, 4KB RAM
-
-// Smooth transitions
-constexpr unsigned long OSC_FREQ_TRANSITION_DURATION_MS = 1000;  // Smooth 1000ms frequency interpolation
-constexpr unsigned long OSC_CENTER_TRANSITION_DURATION_MS = 1000;  // Smooth 1000ms center position interpolation
-constexpr unsigned long OSC_AMPLITUDE_TRANSITION_DURATION_MS = 1000;  // Smooth 1000ms amplitude interpolation
+constexpr int OSC_MAX_STEPS_PER_CATCH_UP = 2;  // Catch-up cadence: up to 2x the step rate, one governed step at a time
+
+// Waveform lookup tables (built-ins generated at compile time, see WaveformTable.h)
+#define USE_WAVEFORM_LOOKUP_TABLE  // Built-ins from tables too (sine: saves ~13us per call)
+constexpr uint32_t WAVEFORM_TABLE_SIZE = 1024;  // 1024 points = 0.1% precision, 4KB per table
+
+// User waveforms (WaveformLibrary)
+constexpr uint32_t WAVEFORM_MAX_POINTS = 1024;  // Points per uploaded period
+constexpr uint8_t WAVEFORM_MAX_COUNT = 32;      // Files kept in WAVEFORM_DIR
+constexpr uint8_t WAVEFORM_NAME_MAX = 24;       // [A-Za-z0-9_-], used as file name
+
+// Superposed oscillation (extra oscillators + center drift, see OscillatorBank.h)
+// Why 4? A fundamental plus a few harmonics or beat partners covers the
+// useful shapes; each one costs a table lookup per motor-loop pass.
+constexpr uint8_t OSC_MAX_HARMONICS = 4;
+constexpr float OSC_DRIFT_MIN_PERIOD_SEC = 2.0f;  // Drift wanders slowly; faster motion belongs in a partial
+
+// Smooth transitions (S-curve, see Transition.h)
+constexpr unsigned long OSC_FREQ_TRANSITION_DURATION_MS = 1000;  // Smooth 1000ms frequency blend
+constexpr unsigned long OSC_CENTER_TRANSITION_DURATION_MS = 1000;  // Smooth 1000ms center position blend
+constexpr unsigned long OSC_AMPLITUDE_TRANSITION_DURATION_MS = 1000;  // Smooth 1000ms amplitude blend
 constexpr float OSC_CATCH_UP_THRESHOLD_MM = 3.0f;  // Only trigger catch-up if position error > 3mm (prevents continuous jerks)
 
 // Debug logging intervals (reduce noise)
@@ -150,16 +161,21 @@ constexpr unsigned long OSC_TRANSITION_LOG_INTERVAL_MS = 200;  // Transition log
 // Why 50000us? Chaos mode: max step delay = 50ms = 20 steps/sec (minimum sane speed)
 constexpr unsigned long CHAOS_MAX_STEP_DELAY_MICROS = 50000;
 
-// Positioning speed for blocking moves (sequence repositioning, chaos center move)
+// Positioning speed for positioning moves (sequence repositioning, chaos center move)
 // Why 990µs? Corresponds to speed level 5.0 (~126 mm/s) — safe for all belt loads
 constexpr unsigned long POSITIONING_STEP_DELAY_MICROS = 990;
 
+// Fastest line-to-line transition move: the sequencer approaches the next line
+// at that line's own speed, never slower than POSITIONING_STEP_DELAY_MICROS.
+// Why 400µs? ~310 mm/s, 2.5x the fixed positioning speed; the step-rate
+// governor still ramps from rest and applies its learned floor on top.
+constexpr unsigned long SEQUENCE_TRANSITION_MIN_STEP_DELAY_MICROS = 400;
+
 // Why 500ms? Sequence status: update frequency during wait (balance responsiveness vs traffic)
 constexpr unsigned long SEQUENCE_STATUS_UPDATE_MS = 500;
 
-// Blocking move helper timings (used by SequenceExecutor::blockingMoveToStep)
-constexpr unsigned long BLOCKING_MOVE_WS_SERVICE_MS = 10;      // WebSocket service interval during blocking moves
-constexpr unsigned long BLOCKING_MOVE_STATUS_INTERVAL_MS = 250; // Status broadcast interval during blocking moves
+// Why 30s? Positioning move timeout — full travel at 990µs/step takes ~3s, so only a jammed axis hits it
+constexpr unsigned long POSITIONING_MOVE_TIMEOUT_MS = 30000;
 
 // Minimum pattern duration before allowing early pattern change in Chaos mode
 constexpr unsigned long CHAOS_MIN_PATTERN_DURATION_MS = 150;
@@ -218,6 +234,20 @@ constexpr unsigned long PEND_LAG_WARN_THRESHOLD_MS = 100;
 // PEND warning cooldown - don't spam logs
 constexpr unsigned long PEND_WARN_COOLDOWN_MS = 5000;  // Max 1 warning per 5 seconds
 
+// Closed-loop position verification (PositionVerifier)
+// A move ends once no pulse was sent for max(PEND_MOVE_END_GAP_MS, 4 × last step interval)
+// Why 20ms? Well above working-speed step intervals, well below a cycle pause
+constexpr unsigned long PEND_MOVE_END_GAP_MS = 20;
+
+// Why 250ms? HSS86 settles in a few ms when tracking; still LOW after this means
+// the driver could not close the loop (stall, slip, or belt skip)
+constexpr unsigned long PEND_SETTLE_TIMEOUT_MS = 250;
+
+// Soft recalibration triggers (return to START re-zeroes the position)
+// Why SAFETY_OFFSET_STEPS? Beyond that, accumulated slip reaches the opto buffer zone
+constexpr long PEND_RECAL_LOST_STEPS = SAFETY_OFFSET_STEPS;
+constexpr uint16_t PEND_RECAL_UNVERIFIED_MOVES = 3;  // Consecutive moves PEND never confirmed
+
 // ============================================================================
 // CONFIGURATION - Logging & Performance Monitoring
 // ============================================================================
@@ -269,6 +299,175 @@ constexpr float MIN_STEP_INTERVAL_US = 20.0f;           // Minimum step pulse in
 constexpr uint8_t DEFAULT_SPEED_LEVEL = 5;              // Default speed on startup
 constexpr float SPEED_LEVEL_TO_MM_S = 10.0f;            // speedLevel * 10 = mm/s
 
+// ============================================================================
+// CONFIGURATION - Live Parameter Transitions (S-curve, see Transition.h)
+// ============================================================================
+// Why 400ms? Long enough that even a jump from level 1 to MAX_SPEED_LEVEL
+// stays a gentle acceleration, short enough to feel immediate from the UI
+// (was: wait for the end of the cycle, up to several seconds on long strokes)
+constexpr unsigned long VAET_SPEED_TRANSITION_MS = 400;
+
+// Why 150ms? Same as CHAOS_MIN_PATTERN_DURATION_MS: the shortest pattern
+// still reaches its own speed, and the random character is kept
+constexpr unsigned long CHAOS_SPEED_TRANSITION_MS = 150;
+
+// ============================================================================
+// CONFIGURATION - Pursuit Tracking (see PursuitTracker.h)
+// ============================================================================
+// Why 1ms? 50 updates per 20 Hz target packet: the velocity ramp looks
+// continuous at any pursuit speed, and a tick costs a few float ops
+constexpr unsigned long PURSUIT_CONTROL_PERIOD_US = 1000;
+
+// Why 2000 mm/s²? Below GOVERNOR_MIN_ACCEL (2.5 m/s²), so the slowest ramp
+// ever learned still follows; 0 → 350 mm/s (MAX_SPEED_LEVEL) in 0.18s
+constexpr float PURSUIT_ACCEL_MM_S2 = 2000.0f;
+
+// Position correction on top of the target velocity: 8/s closes a 10mm lag
+// at 80 mm/s (capped so the correction can always stop at the target)
+constexpr float PURSUIT_POSITION_GAIN = 8.0f;
+
+// Why 200ms? 4-5 packets at the 20 Hz UI rate: enough for a steady slope,
+// short enough to follow a change of direction within a packet or two
+constexpr unsigned long PURSUIT_VELOCITY_WINDOW_MS = 200;
+
+// Missed packets: keep moving at the estimated velocity for up to 150ms
+// (2-3 packets), then hold the extrapolated point
+constexpr unsigned long PURSUIT_EXTRAPOLATE_MAX_MS = 150;
+
+// Last-steps crawl rate when the commanded velocity has ramped to ~0
+constexpr float PURSUIT_MIN_STEP_RATE = 30.0f;  // steps/s
+
+// ============================================================================
+// CONFIGURATION - Adaptive Step-Rate Governor
+// ============================================================================
+// Learned per rig from ALM/PEND feedback, persisted in NVS.
+// Defaults = hardware floor + unlimited acceleration → no behaviour change until a fault.
+constexpr unsigned long GOVERNOR_MIN_STEP_DELAY_US = (unsigned long)MIN_STEP_INTERVAL_US;
+// Why 2000µs? Even a badly loaded rig must keep 62 mm/s, the calibration seek speed
+constexpr unsigned long GOVERNOR_MAX_STEP_DELAY_US = 2000;
+
+// Pull-in rate: allowed instantly from rest or after a reversal (125 mm/s)
+constexpr float GOVERNOR_START_RATE_STEPS_S = 1000.0f;
+constexpr float GOVERNOR_MAX_ACCEL = 1000000.0f;  // steps/s², at or above = no ramp applied
+constexpr float GOVERNOR_MIN_ACCEL = 20000.0f;    // 2.5 m/s² - slowest ramp ever learned
+
+// Fault → 25% slower than the offending rate; clean streak → probe 5% faster
+constexpr float GOVERNOR_BACKOFF_FACTOR = 1.25f;
+constexpr float GOVERNOR_ACCEL_BACKOFF = 0.7f;
+constexpr float GOVERNOR_RELAX_FACTOR = 0.95f;
+constexpr float GOVERNOR_ACCEL_RELAX = 1.1f;
+constexpr uint16_t GOVERNOR_PROBE_CLEAN_MOVES = 20;  // Throttled moves PEND confirmed promptly
+
+// Why 60s? Faults come in bursts; coalesce NVS writes instead of wearing flash
+constexpr unsigned long GOVERNOR_SAVE_INTERVAL_MS = 60000;
+
+// ============================================================================
+// CONFIGURATION - Odometer (lifetime wear counters, see Odometer.h)
+// ============================================================================
+// Steps taken at or above this rate are also counted as high-speed wear
+constexpr float ODOMETER_HIGH_SPEED_MM_S = 200.0f;
+constexpr uint32_t ODOMETER_HIGH_SPEED_INTERVAL_US =
+    static_cast<uint32_t>(1000000.0f / (ODOMETER_HIGH_SPEED_MM_S * STEPS_PER_MM));  // 625 µs/step
+
+// Why 10 min? A power cut loses at most 10 min of wear out of months of belt
+// life, and NVS is not rewritten every few seconds on a 24/7 rig
+constexpr unsigned long ODOMETER_SAVE_INTERVAL_MS = 600000;
+
+// ============================================================================
+// CONFIGURATION - Metrics History (GET /api/metrics, see MetricsHistory.h)
+// ============================================================================
+// Why these depths? 1 h of seconds, 24 h of minutes, 30 days of hours at
+// 20 bytes a sample = ~115 KB of the 8 MB PSRAM. Without PSRAM the same
+// three resolutions are kept 10x shallower in ~11 KB of internal RAM.
+constexpr uint32_t METRICS_SECONDS_DEPTH = 3600;
+constexpr uint32_t METRICS_MINUTES_DEPTH = 1440;
+constexpr uint32_t METRICS_HOURS_DEPTH = 720;
+constexpr uint32_t METRICS_INTERNAL_DEPTH_DIVISOR = 10;
+constexpr unsigned long METRICS_SAMPLE_INTERVAL_MS = 1000;
+
+// ============================================================================
+// CONFIGURATION - Step Telemetry (opt-in WebSocket stream, see TelemetryStream.h)
+// ============================================================================
+// Why 500 Hz? Resolves every stroke of the fastest short oscillation with
+// ~20 points while the motor loop pays one compare per step.
+// Why 256 samples? Half a second at 500 Hz: a WiFi stall of that length
+// drops samples (counted in the frame) instead of blocking Core 1. 4 KB of
+// internal RAM - PSRAM writes would cost the motor loop more.
+// Why 20 ms frames? 50 frames/s of at most 10 samples (~170 B) each.
+constexpr uint32_t TELEMETRY_MAX_RATE_HZ = 500;
+constexpr size_t TELEMETRY_RING_SIZE = 256;
+constexpr unsigned long TELEMETRY_FLUSH_INTERVAL_MS = 20;
+constexpr size_t TELEMETRY_MAX_SUBSCRIBERS = 2;
+
+// ============================================================================
+// CONFIGURATION - Motion Timeline (scheduled start / wall-clock phase lock)
+// ============================================================================
+// Movement commands may carry "startAt" (epoch ms) and are replayed by
+// networkTask at that instant; "phaseAnchor" locks VAET/OSC phase to the
+// wall clock so several rigs synced by NTP/syncTime stay in step.
+
+// Why 10 min? Long enough to stage a multi-rig show, short enough that a
+// forgotten schedule does not surprise anyone hours later
+constexpr uint32_t TIMELINE_MAX_LEAD_MS = 600000;
+
+// Why 1s? A start this late is out of phase anyway; up to 1s it still starts
+// (immediately) and the phase lock pulls it back in
+constexpr uint32_t TIMELINE_MAX_LATE_MS = 1000;
+
+// Phase error (cycles) → speed trim. 0.5 corrects half the error per cycle;
+// ±5% speed is invisible to the eye but absorbs clock/timing drift
+constexpr float PHASE_LOCK_GAIN = 0.5f;
+constexpr float PHASE_LOCK_MAX_TRIM = 0.05f;
+constexpr unsigned long OSC_PHASE_LOCK_INTERVAL_MS = 100;  // Wall-clock read rate (Core 1)
+
+// VAET locks on the nominal cycle period, but real cycles run a few % off it
+// (accel, zone effects). The integral term learns that bias (up to ±10%)
+// so the proportional trim only has to handle drift.
+constexpr float VAET_PHASE_LOCK_INTEGRAL_GAIN = 0.1f;
+constexpr float VAET_PHASE_LOCK_MAX_BIAS = 0.10f;
+
+// ============================================================================
+// CONFIGURATION - Trajectory Playback
+// ============================================================================
+// Keyframe ring (TrajectoryKeyframe, 8 bytes) allocated once at boot.
+// Why 64k? 512KB of the 8MB PSRAM = 65s of motion at 1kHz keyframes;
+// without PSRAM fall back to 16KB of internal RAM (streaming still works)
+constexpr uint32_t TRAJECTORY_CAPACITY_PSRAM = 65536;      // Must be a power of 2
+constexpr uint32_t TRAJECTORY_CAPACITY_INTERNAL = 2048;    // Must be a power of 2
+
+constexpr float TRAJECTORY_MAX_SPEED_MM_S = OSC_MAX_SPEED_MM_S;       // Same mechanical limit as oscillation
+constexpr unsigned long TRAJECTORY_APPROACH_STEP_DELAY_US = OSC_POSITIONING_STEP_DELAY_MICROS;  // Move to first keyframe
+constexpr const char* TRAJECTORY_DIR = "/trajectories";    // LittleFS folder for .trj files
+
+// ============================================================================
+// CONFIGURATION - WebSocket Binary Protocol
+// ============================================================================
+// Binary frame = 1 opcode byte + fixed little-endian payload (Types.h Ws*Frame).
+// JSON text frames stay the general protocol; opcodes cover high-rate control
+// (joystick pursuit at 50-100Hz) and bulk data, decoded without heap use.
+// ASCII letters keep frames readable in a hex dump.
+constexpr uint8_t WS_BINARY_PURSUIT_MOVE = 0x50;  // 'P' + WsPursuitMoveFrame (8 B)
+constexpr uint8_t WS_BINARY_SET_SPEED = 0x56;     // 'V' + WsSetSpeedFrame (4 B), forward + backward
+constexpr uint8_t WS_BINARY_PAUSE = 0x48;         // 'H' (hold), no payload - toggles pause
+constexpr uint8_t WS_BINARY_STOP = 0x58;          // 'X', no payload
+constexpr uint8_t WS_BINARY_TRAJECTORY = 0x54;    // 'T' + N x TrajectoryKeyframe (appended)
+constexpr uint8_t WS_BINARY_TELEMETRY = 0x53;     // 'S' (server → client) + WsTelemetryHeader + N x StepSamples::Sample
+
+// ============================================================================
+// CONFIGURATION - WebSocket Message Reassembly
+// ============================================================================
+// Fragmented / multi-segment messages are rebuilt in one arena of fixed slots
+// (WsMessageAssembler), allocated once at boot.
+// Why 4 slots? One partial message per client at a time; more than 4
+// clients sending large messages simultaneously is not a real use case.
+// Why 64 KB? A 50-line sequence import is ~60 KB of JSON and a trajectory
+// burst is a few KB; 4 slots stay at 256 KB of the 8 MB PSRAM (larger
+// sequences go through POST /api/sequence/import). Without PSRAM, 8 KB
+// slots (32 KB internal).
+constexpr uint8_t WS_REASSEMBLY_SLOTS = 4;
+constexpr size_t WS_REASSEMBLY_MAX_MESSAGE_PSRAM = 64 * 1024;
+constexpr size_t WS_REASSEMBLY_MAX_MESSAGE_INTERNAL = 8 * 1024;
+
 // ============================================================================
 // CONFIGURATION - Chaos Mode Defaults
 // ============================================================================
@@ -284,9 +483,19 @@ constexpr uint16_t CHAOS_DEFAULT_DURATION_SEC = 30;     // Default duration
 // ============================================================================
 // CONFIGURATION - Sequencer Limits
 // ============================================================================
-constexpr uint8_t MAX_SEQUENCE_LINES = 20;              // Max lines in sequence
+constexpr uint8_t MAX_SEQUENCE_LINES = 20;              // Max lines in sequence without PSRAM
+// Why 1024? ~170 KB of the 8 MB PSRAM (SequenceLine is ~170 bytes): hundreds
+// of lines for long shift programs, allocated once at boot
+constexpr uint16_t SEQUENCE_CAPACITY_PSRAM = 1024;      // Max lines in sequence (PSRAM)
+constexpr const char* SEQUENCE_DIR = "/sequences";      // LittleFS folder for named sequences
+constexpr uint8_t SEQUENCE_NAME_MAX_LEN = 32;           // [A-Za-z0-9_-] only (used as file name)
 constexpr uint16_t MAX_CYCLES_PER_LINE = 9999;          // Max cycles per sequence line
 constexpr uint32_t MAX_PAUSE_AFTER_MS = 60000;          // Max pause between lines (60s)
+constexpr uint32_t SEQUENCE_MAX_WAIT_MS = 3600000;      // Max WAIT line (1h)
+constexpr uint8_t SEQUENCE_MAX_NESTING = 8;             // REPEAT blocks + CALLs open at once
+// Why 256? A transition walks control lines until the next movement; a
+// CALL cycle without movement would otherwise spin the motor task forever
+constexpr uint16_t SEQUENCE_MAX_CONTROL_STEPS = 256;
 constexpr uint8_t MAX_PLAYLISTS_PER_MODE = 20;          // Max saved presets per mode
 
 // ============================================================================
@@ -295,6 +504,9 @@ constexpr uint8_t MAX_PLAYLISTS_PER_MODE = 20;          // Max saved presets per
 constexpr float DECEL_DEFAULT_ZONE_MM = 20.0f;          // Default decel zone size
 constexpr uint8_t DECEL_DEFAULT_EFFECT_PERCENT = 50;    // Default decel effect
 // Decel mode constants removed — use SpeedCurve::CURVE_LINEAR/SpeedCurve::CURVE_SINE/etc. from Types.h
+// Why 1024? One baked factor per step up to a 127 mm zone (8 steps/mm) in
+// 2 KB of internal RAM per table; larger zones share an entry per 2-4 steps
+constexpr uint32_t ZONE_PROFILE_MAX_ENTRIES = 1024;
 
 // ============================================================================
 // CONFIGURATION - Cycle Pause Defaults
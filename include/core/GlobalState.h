@@ -12,7 +12,7 @@
  *   - pursuit                    → PursuitController.h
  *   - decelZone                  → BaseMovementController.h (integrated)
  *   - seqState, currentMovement  → SequenceExecutor.h
- *   - sequenceTable[]            → SequenceTableManager.h
+ *   - SeqTable (line storage)    → SequenceTableManager.h
  *
  * DUAL-CORE ARCHITECTURE (ESP32-S3):
  *   - Core 0 (APP_CPU): StepperNetwork tasks (WiFi, WebSocket, HTTP, OTA)
@@ -33,7 +33,7 @@
  * │ chaos, chaosState             │ ChaosController.cpp               │ stateMutex       │
  * │ oscillation, oscillationState │ OscillationController.cpp         │ stateMutex       │
  * │ pursuit                       │ PursuitController.cpp             │ —                │
- * │ seqState, sequenceTable[]     │ SequenceExecutor/TableManager.cpp │ —                │
+ * │ seqState, SeqTable            │ SequenceExecutor/TableManager.cpp │ —                │
  * │ currentMovement               │ SequenceExecutor.cpp              │ volatile 32-bit  │
  * │ engine                        │ StepperController.cpp             │ — (init in setup)│
  * └───────────────────────────────┴───────────────────────────────────┴──────────────────┘
@@ -93,14 +93,13 @@ private:
 // Atomic flags (no mutex needed - set from Core 0, read from Core 1)
 // Safe: bool and long are 32-bit on ESP32 Xtensa → single-instruction read/write
 extern volatile bool requestCalibration;    // Trigger calibration from motorTask
-extern volatile bool calibrationInProgress; // Cooperative flag for calibration mode
-extern volatile bool blockingMoveInProgress; // Cooperative flag for blocking moves
+extern volatile bool calibrationInProgress; // Set while CalibrationManager state machine is busy
+extern volatile bool blockingMoveInProgress; // Set while a SequenceExecutor positioning move is active
 
 // File upload tracking (Core 0 only — set by FilesystemManager HTTP handler)
 // Uses timestamp-based expiry: upload considered active if last activity < 5s ago
 extern volatile unsigned long lastUploadActivityTime;
 extern volatile bool uploadStopDone;         // Prevents repeated stop() calls during batch upload
-                                             // (blocking move loops service them from Core 1)
 
 // ============================================================================
 // CORE SYSTEM STATE
@@ -121,9 +120,9 @@ extern volatile long startStep;
 extern volatile long targetStep;
 extern volatile bool movingForward;
 extern bool hasReachedStartStep;            // Core 1 only — no cross-core access
-extern unsigned long lastStepMicros;        // Core 1 only — no cross-core access
-extern volatile unsigned long stepDelayMicrosForward;
-extern volatile unsigned long stepDelayMicrosBackward;
+extern StepScheduler stepClock;             // VAET + pursuit step deadlines — Core 1 only
+extern volatile uint32_t stepIntervalForward;   // VAET step interval, StepScheduler Q24.8 µs
+extern volatile uint32_t stepIntervalBackward;
 
 // ============================================================================
 // DISTANCE LIMITS (Core 0 writes via CommandDispatcher, Core 1 reads)
@@ -137,6 +136,7 @@ extern volatile float maxDistanceLimitPercent;
 // ============================================================================
 
 extern volatile bool sensorsInverted;  // false=normal (START=GPIO4, END=GPIO5), true=inverted
+extern volatile bool autoRecalibrate;  // PositionVerifier may return to START on suspected slip
 
 // ============================================================================
 // MOTION CONFIGURATIONS
@@ -171,7 +171,6 @@ extern AsyncWebSocket ws;
 // CALLBACK FUNCTIONS (defined in main, called by modules)
 // ============================================================================
 
-extern void sendStatus();
 extern void stopMovement();
 
 #endif // GLOBAL_STATE_H
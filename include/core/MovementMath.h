@@ -34,6 +34,9 @@ constexpr long mmToSteps(float mm) { return (long)(mm * STEPS_PER_MM); }
 /** Convert steps to millimeters */
 constexpr float stepsToMM(long steps) { return static_cast<float>(steps) / STEPS_PER_MM; }
 
+/** Convert a 64-bit step count (odometer, session) to millimeters without wrapping */
+constexpr double stepCountToMM(uint64_t steps) { return static_cast<double>(steps) / STEPS_PER_MM; }
+
 // ============================================================================
 // SPEED / DELAY
 // ============================================================================
@@ -41,15 +44,15 @@ constexpr float stepsToMM(long steps) { return static_cast<float>(steps) / STEPS
 /** Convert speed level (0–MAX_SPEED_LEVEL) to cycles per minute. */
 float speedLevelToCPM(float speedLevel);
 
-/** Step delay for va-et-vient mode (µs). Fallback 1000 on bad input. */
+/** Exact step interval for va-et-vient mode (µs, fractional). Fallback 1000 on bad input. */
+float vaetStepInterval(float speedLevel, float distanceMM);
+
+/** vaetStepInterval() truncated to whole µs (logs, look-ahead budgets) */
 unsigned long vaetStepDelay(float speedLevel, float distanceMM);
 
 /** Step delay for chaos mode (µs). Clamped to [20, CHAOS_MAX_STEP_DELAY_MICROS]. */
 unsigned long chaosStepDelay(float speedLevel);
 
-/** Step delay for pursuit mode (µs). Speed ramps by error distance. */
-unsigned long pursuitStepDelay(float errorMM, float maxSpeedLevel);
-
 // ============================================================================
 // ZONE EFFECTS
 // ============================================================================
@@ -82,4 +85,110 @@ float waveformValue(OscillationWaveform waveform, float phase);
  */
 float effectiveFrequency(float requestedHz, float amplitudeMM);
 
+/**
+ * Peak speed bound (mm/s) of the main oscillator plus superposed partials and
+ * drift: Σ 2π·f·A, the sine peak effectiveFrequency() also budgets with.
+ */
+float superposedPeakSpeed(float frequencyHz, float amplitudeMM, const OscillationHarmonics& harmonics);
+
+/** Farthest the superposed motion can get from the center (mm): Σ amplitudes. */
+float superposedExcursion(float amplitudeMM, const OscillationHarmonics& harmonics);
+
+// ============================================================================
+// CALIBRATION
+// ============================================================================
+
+/**
+ * State an aborted calibration / return to start falls back to.
+ * READY only if a previous calibration still holds (limits known and the rig
+ * was not waiting for a recalibration), else INIT: the start guards stay shut.
+ */
+SystemState calibrationAbortState(SystemState startedFrom, float calibratedDistanceMM);
+
+// ============================================================================
+// POSITION VERIFICATION (HSS86 PEND)
+// ============================================================================
+
+/**
+ * Following error implied by a PEND settle time.
+ * Steps the driver was still behind when the last pulse was sent,
+ * assuming it tracked at the final commanded step interval. 0 on bad input.
+ */
+long pendFollowingErrorSteps(unsigned long settleMicros, unsigned long stepIntervalMicros);
+
+/** True once estimated slip warrants a soft recalibration (return to START). */
+bool needsSoftRecalibration(long lostStepsEstimate, uint16_t consecutiveUnverifiedMoves);
+
+// ============================================================================
+// STEP-RATE GOVERNOR
+// ============================================================================
+
+/**
+ * Shortest step interval a governor profile allows (µs).
+ * Ramp from rest/reversal: v = sqrt(v0² + 2·a·n) after n steps,
+ * never faster than the learned floor.
+ */
+unsigned long governedMinDelay(unsigned long floorMicros, float accelStepsPerS2, uint32_t stepsSinceRest);
+
+/** Learned floor after a fault at faultIntervalMicros (never relaxes, clamped). */
+unsigned long governorBackoffFloor(unsigned long floorMicros, unsigned long faultIntervalMicros);
+
+/** Learned floor after a clean probing streak (5% faster, clamped). */
+unsigned long governorRelaxFloor(unsigned long floorMicros);
+
+// ============================================================================
+// WALL-CLOCK PHASE LOCK (multi-rig timeline)
+// ============================================================================
+
+/** Wrap a phase difference (cycles) into [-0.5, 0.5). */
+float wrapPhaseError(float phaseErrorCycles);
+
+/**
+ * Phase [0, 1) a reference oscillator started at the anchor would have now.
+ * elapsedMs may be negative (before the anchor). Computed in double: elapsed
+ * spans hours and float would lose the sub-cycle part.
+ */
+float anchoredPhase(int64_t elapsedMs, float frequencyHz);
+
+/** Speed trim from phase error (positive = behind → speed up), clamped. */
+float phaseLockTrim(float phaseErrorCycles);
+
+/**
+ * VAET speed trim, evaluated once per cycle: phaseLockTrim() plus an
+ * integral term (in/out) absorbing the nominal-vs-actual period bias.
+ */
+float vaetPhaseLockTrim(float phaseErrorCycles, float& integralTrim);
+
+/** Nominal VA-ET-VIENT cycle period (ms) = forward + backward half cycles. */
+float vaetCyclePeriodMs(float cpmForward, float cpmBackward);
+
+/** Step delay with a phase trim applied (trim > 0 → shorter delay). */
+unsigned long trimmedStepDelay(unsigned long delayMicros, float trim);
+
+// ============================================================================
+// TRAJECTORY PLAYBACK
+// ============================================================================
+
+/**
+ * Position (mm) at playback time playMicros on the segment from → to.
+ * Linear, clamped to the segment; zero-length segment → to.positionMM.
+ */
+float trajectoryInterpolate(const TrajectoryKeyframe& from, const TrajectoryKeyframe& to, uint64_t playMicros);
+
+/** Keyframe acceptable after one at prevTimeMs (finite position, time not going back). */
+bool trajectoryKeyframeValid(const TrajectoryKeyframe& keyframe, uint32_t prevTimeMs);
+
+/** Buffer fill level 0-100 (rounded down, 0 on zero capacity). */
+uint8_t fillPercent(uint32_t count, uint32_t capacity);
+
+// ============================================================================
+// SEQUENCER LOOK-AHEAD
+// ============================================================================
+
+/**
+ * Step delay (µs) of the move into the next sequence line: the line's own
+ * delay, clamped to [SEQUENCE_TRANSITION_MIN_STEP_DELAY_MICROS, POSITIONING_STEP_DELAY_MICROS].
+ */
+unsigned long transitionStepDelay(unsigned long lineDelayMicros);
+
 } // namespace MovementMath
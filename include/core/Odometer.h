@@ -0,0 +1,96 @@
+// ============================================================================
+// ODOMETER.H - Lifetime wear counters (64-bit, lock-free)
+// ============================================================================
+// Counts every step the motor takes over the rig's life: total, per movement
+// type, direction reversals and high-speed steps - the data belt/pulley
+// maintenance is scheduled from.
+//
+// Core 1 is the only writer (StatsTracking::trackDelta on every step); Core 0
+// reads (status, REST, NVS save). 64-bit stores are not atomic on Xtensa, so
+// the counters sit behind a sequence number (seqlock): the writer makes it
+// odd while updating and even when done, a reader retries if it saw an odd
+// value or the number changed under it. The writer never waits.
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include "core/Config.h"
+
+struct OdometerCounters {
+  static constexpr size_t MODE_COUNT = 6;  // MovementType values (checked in Types.h)
+
+  uint64_t totalSteps = 0;
+  std::array<uint64_t, MODE_COUNT> stepsByMode{};  // Indexed by MovementType
+  uint64_t reversals = 0;                          // Direction changes
+  uint64_t highSpeedSteps = 0;                     // Taken at >= ODOMETER_HIGH_SPEED_MM_S
+};
+
+class Odometer {
+public:
+  /**
+   * Count a displacement (Core 1 only - single writer)
+   * @param mode          MovementType index (out of range: total only)
+   * @param delta         Signed steps since the previous call
+   * @param elapsedMicros Time since the previous call
+   */
+  void record(uint8_t mode, int32_t delta, uint32_t elapsedMicros) {
+    if (delta == 0) return;
+    int8_t direction = delta > 0 ? 1 : -1;
+    auto steps = static_cast<uint32_t>(delta > 0 ? delta : -delta);
+
+    uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    m_counters.totalSteps += steps;
+    if (mode < OdometerCounters::MODE_COUNT) m_counters.stepsByMode[mode] += steps;
+    if (m_lastDirection != 0 && direction != m_lastDirection) ++m_counters.reversals;
+    if (elapsedMicros <= static_cast<uint64_t>(steps) * ODOMETER_HIGH_SPEED_INTERVAL_US) {
+      m_counters.highSpeedSteps += steps;
+    }
+
+    m_sequence.store(sequence + 2, std::memory_order_release);
+    m_lastDirection = direction;
+  }
+
+  /** Consistent copy of every counter (any core) */
+  [[nodiscard]] OdometerCounters snapshot() const {
+    OdometerCounters copy;
+    uint32_t before;
+    do {
+      before = m_sequence.load(std::memory_order_acquire);
+      copy = m_counters;
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((before & 1u) != 0 || before != m_sequence.load(std::memory_order_relaxed));
+    return copy;
+  }
+
+  /** Total steps only - cheaper than snapshot() (any core) */
+  [[nodiscard]] uint64_t totalSteps() const {
+    uint64_t total;
+    uint32_t before;
+    do {
+      before = m_sequence.load(std::memory_order_acquire);
+      total = m_counters.totalSteps;
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((before & 1u) != 0 || before != m_sequence.load(std::memory_order_relaxed));
+    return total;
+  }
+
+  /** Load persisted counters - call before the motor task starts */
+  void restore(const OdometerCounters& counters) {
+    uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_counters = counters;
+    m_sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+private:
+  OdometerCounters m_counters;
+  std::atomic<uint32_t> m_sequence{0};
+  int8_t m_lastDirection = 0;  // Writer-side only
+};
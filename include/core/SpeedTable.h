@@ -0,0 +1,114 @@
+// ============================================================================
+// SPEED_TABLE.H - Speed level → step timing lookup tables
+// ============================================================================
+// Speed levels (0..MAX_SPEED_LEVEL) are tabulated at 0.1 resolution into
+// the effective level and the chaos step delay, so a speed change costs an
+// index instead of the MovementMath formulas. The nominal table is built at
+// compile time and matches those formulas exactly at every 0.1 level (the
+// native tests check each entry).
+//
+// A rig calibration replaces the nominal straight line with measured points:
+// the effective level to drive at each whole level (linear in between). A
+// belt that slips at the top end, or a mechanism that needs more torque
+// margin low down, gets a non-linear curve without touching the formulas.
+// Pursuit uses the effective level for its speed cap, va-et-vient derives
+// its c/min from it.
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "core/Config.h"
+#include "core/MovementMath.h"
+
+class SpeedTable {
+public:
+  static constexpr size_t STEPS_PER_LEVEL = 10;  // 0.1 level resolution
+  static constexpr size_t POINTS = static_cast<size_t>(MAX_SPEED_LEVEL) + 1;  // Whole levels 0..MAX
+  static constexpr size_t ENTRIES = (POINTS - 1) * STEPS_PER_LEVEL + 1;
+
+  /** Effective level at each whole level */
+  using Points = std::array<float, POINTS>;
+
+  /** Straight line: every level drives at itself */
+  static constexpr Points nominal() {
+    Points points{};
+    for (size_t idx = 0; idx < POINTS; ++idx) points[idx] = static_cast<float>(idx);
+    return points;
+  }
+
+  /** Finite, within 0..MAX_SPEED_LEVEL, non-decreasing and not all zero */
+  static constexpr bool isValid(const Points& points) {
+    for (size_t idx = 0; idx < POINTS; ++idx) {
+      if (!(points[idx] >= 0.0f && points[idx] <= MAX_SPEED_LEVEL)) return false;  // Also rejects NaN
+      if (idx > 0 && points[idx] < points[idx - 1]) return false;
+    }
+    return points[POINTS - 1] > 0.0f;
+  }
+
+  constexpr SpeedTable() { build(nominal()); }
+
+  /** Tabulate a curve (points must be isValid) */
+  constexpr void build(const Points& points) {
+    for (size_t idx = 0; idx < ENTRIES; ++idx) {
+      size_t whole = idx / STEPS_PER_LEVEL;
+      size_t tenths = idx % STEPS_PER_LEVEL;
+      // Weighted sum over a single division: exact on the nominal line (53 / 10.0f == 5.3f)
+      float level = tenths == 0 ? points[whole]
+                                : (points[whole] * static_cast<float>(STEPS_PER_LEVEL - tenths) +
+                                   points[whole + 1] * static_cast<float>(tenths)) / static_cast<float>(STEPS_PER_LEVEL);
+      m_levels[idx] = level;
+      m_chaosDelays[idx] = chaosDelayFor(level);
+    }
+  }
+
+  /** Table index of a speed level (nearest 0.1, clamped) */
+  static constexpr size_t index(float speedLevel) {
+    if (!(speedLevel > 0.0f)) return 0;
+    float scaled = speedLevel * static_cast<float>(STEPS_PER_LEVEL) + 0.5f;
+    return scaled >= static_cast<float>(ENTRIES - 1) ? ENTRIES - 1 : static_cast<size_t>(scaled);
+  }
+
+  /** Level the motor is actually driven at for a requested level */
+  [[nodiscard]] constexpr float effectiveLevel(float speedLevel) const { return m_levels[index(speedLevel)]; }
+
+  /** Same contract as MovementMath::chaosStepDelay() */
+  [[nodiscard]] constexpr unsigned long chaosStepDelay(float speedLevel) const {
+    return m_chaosDelays[index(speedLevel)];
+  }
+
+  /** Same contract as MovementMath::vaetStepInterval() */
+  [[nodiscard]] constexpr float vaetStepInterval(float speedLevel, float distanceMM) const {
+    if (distanceMM <= 0 || speedLevel <= 0) return 1000.0f;
+
+    float cpm = effectiveLevel(speedLevel) * 10.0f;  // MovementMath::speedLevelToCPM, level already clamped
+    if (cpm <= 0.1f) cpm = 0.1f;
+
+    long stepsPerDirection = MovementMath::mmToSteps(distanceMM);
+    if (stepsPerDirection <= 0) return 1000.0f;
+
+    float halfCycleMs = (60000.0f / cpm) / 2.0f;
+    float delay = ((halfCycleMs * 1000.0f) / static_cast<float>(stepsPerDirection)) / SPEED_COMPENSATION_FACTOR;
+    return delay < 20.0f ? 20.0f : delay;
+  }
+
+private:
+  /** MovementMath::chaosStepDelay() in a constant expression */
+  static constexpr uint32_t chaosDelayFor(float speedLevel) {
+    float stepsPerSecond = speedLevel * 10.0f * STEPS_PER_MM;
+    unsigned long delay = stepsPerSecond > 0
+        ? static_cast<unsigned long>((1000000.0f / stepsPerSecond) / SPEED_COMPENSATION_FACTOR)
+        : 10000;
+    if (delay < 20) delay = 20;
+    if (delay > CHAOS_MAX_STEP_DELAY_MICROS) delay = CHAOS_MAX_STEP_DELAY_MICROS;
+    return static_cast<uint32_t>(delay);
+  }
+
+  std::array<float, ENTRIES> m_levels{};
+  std::array<uint32_t, ENTRIES> m_chaosDelays{};
+};
+
+// Compile-time nominal table (also the boot table until a calibration loads)
+inline constexpr SpeedTable NOMINAL_SPEED_TABLE{};
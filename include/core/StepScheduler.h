@@ -0,0 +1,76 @@
+// ============================================================================
+// STEP_SCHEDULER.H - Deadline step timing with sub-microsecond intervals
+// ============================================================================
+// The motor loop polls micros() and steps once the interval has elapsed.
+// Restarting the interval at the poll that stepped adds that poll's lateness
+// (loop time, pulse time, ISR/WiFi jitter) to every step, and whole-µs delays
+// lose up to 1 µs more - several percent at the 20-100 µs delays of short,
+// fast strokes.
+//
+// StepScheduler advances an ideal deadline by exactly one interval per step
+// instead: a late step shortens the next wait by the measured lateness, so
+// the per-step overhead is absorbed as it happens rather than estimated, and
+// the interval's 1/256 µs fraction carries into the next step (error
+// diffusion). The long-run rate is the commanded one to clock accuracy.
+// ============================================================================
+
+#pragma once
+
+#include <cstdint>
+
+class StepScheduler {
+public:
+  static constexpr uint8_t FRACTION_BITS = 8;  // Intervals in 1/256 µs (Q24.8)
+  static constexpr uint32_t FRACTION_MASK = (1u << FRACTION_BITS) - 1;
+
+  /** µs (fractional) → Q24.8 interval, saturated */
+  static constexpr uint32_t toFixed(float delayMicros) {
+    if (delayMicros <= 0.0f) return 0;
+    float fixed = delayMicros * static_cast<float>(1u << FRACTION_BITS) + 0.5f;
+    return fixed >= 4294967040.0f ? UINT32_MAX : static_cast<uint32_t>(fixed);
+  }
+
+  /** Whole µs → Q24.8 interval, saturated */
+  static constexpr uint32_t fromMicros(unsigned long delayMicros) {
+    return delayMicros > (UINT32_MAX >> FRACTION_BITS) ? UINT32_MAX
+                                                       : static_cast<uint32_t>(delayMicros << FRACTION_BITS);
+  }
+
+  /** Q24.8 interval → whole µs (truncated) */
+  static constexpr unsigned long wholeMicros(uint32_t fixed) { return fixed >> FRACTION_BITS; }
+
+  /** Next step becomes due one interval after nowMicros */
+  void restart(uint32_t nowMicros) {
+    m_deadlineMicros = nowMicros;
+    m_fraction = 0;
+  }
+
+  /**
+   * Step now? Call every loop iteration; true at most once per interval.
+   * The interval may change between calls (zone effects, ramps).
+   *
+   * A step later than a whole interval (pause, stall, first step after idle)
+   * restarts the schedule from now: catching up would fire a burst of steps
+   * faster than the motor can follow. So no gap is ever shorter than zero
+   * and no more than one step's worth of time is made up.
+   */
+  bool due(uint32_t nowMicros, uint32_t intervalFixed) {
+    uint32_t interval = intervalFixed + m_fraction;
+    if (interval < intervalFixed) interval = UINT32_MAX;  // Saturate
+    uint32_t whole = interval >> FRACTION_BITS;
+    uint32_t elapsed = nowMicros - m_deadlineMicros;
+    if (elapsed < whole) return false;
+
+    if (elapsed - whole > whole) {
+      restart(nowMicros);
+    } else {
+      m_deadlineMicros += whole;
+      m_fraction = interval & FRACTION_MASK;
+    }
+    return true;
+  }
+
+private:
+  uint32_t m_deadlineMicros = 0;  // Ideal time of the last step
+  uint32_t m_fraction = 0;        // Carried 1/256 µs
+};
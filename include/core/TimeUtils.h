@@ -9,6 +9,7 @@
 //   TimeUtils::format("%Y%m%d", epochSec)     → "20260221"
 //   TimeUtils::isSynchronized()               → true/false
 //   TimeUtils::epochSeconds()                 → time_t
+//   TimeUtils::epochMillis()                  → int64_t (multi-rig timeline)
 // ============================================================================
 
 #pragma once
@@ -28,6 +29,14 @@ inline time_t epochSeconds() {
     return std::chrono::system_clock::to_time_t(now);
 }
 
+/**
+ * Get current time as epoch milliseconds (same clock as epochSeconds)
+ */
+inline int64_t epochMillis() {
+    auto sinceEpoch = std::chrono::system_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count();
+}
+
 /**
  * Check if NTP time is synchronized (year > 2020)
  */
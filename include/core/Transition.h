@@ -0,0 +1,63 @@
+// ============================================================================
+// TRANSITION.H - Jerk-limited blends for live parameter changes
+// ============================================================================
+// A parameter changed while a movement runs (speed, frequency, center,
+// amplitude) moves from its old to its new value along an S-curve: the
+// quintic smootherstep 10p³ − 15p⁴ + 6p⁵. Its first and second derivatives
+// are zero at both ends, so the blend adds no step in acceleration, and its
+// jerk stays bounded (peak 60/T³ of the change). Linear ramps have a step
+// in velocity at each end, and an instant switch is a step in speed.
+//
+// Two ways to use it:
+//   - Transition::at(): stateless, for state that already records
+//     start/old/target (OscillationState)
+//   - a Transition member: owns from/to/start, and retarget() continues
+//     from the value being played, so a change mid-blend never jumps
+// ============================================================================
+
+#pragma once
+
+#include <cstdint>
+
+class Transition {
+public:
+  /** S-curve weight for progress 0..1 (clamped) */
+  static constexpr float sCurve(float progress) {
+    if (progress <= 0.0f) return 0.0f;
+    if (progress >= 1.0f) return 1.0f;
+    return progress * progress * progress * (progress * (progress * 6.0f - 15.0f) + 10.0f);
+  }
+
+  /** Value elapsedMs into a durationMs S-curve blend from → to */
+  static constexpr float at(float from, float to, uint32_t elapsedMs, uint32_t durationMs) {
+    if (elapsedMs >= durationMs) return to;
+    return from + (to - from) * sCurve(static_cast<float>(elapsedMs) / static_cast<float>(durationMs));
+  }
+
+  /** Blend from → to starting at nowMs (durationMs 0 = switch now) */
+  void start(float from, float to, uint32_t nowMs, uint32_t durationMs) {
+    m_from = from;
+    m_to = to;
+    m_startMs = nowMs;
+    m_durationMs = durationMs;
+  }
+
+  /** Head for a new target from the current value (same target: keep the running blend) */
+  void retarget(float to, uint32_t nowMs, uint32_t durationMs) {
+    if (to == m_to) return;
+    start(value(nowMs), to, nowMs, durationMs);
+  }
+
+  /** Settle on value immediately (fresh start, nothing to blend from) */
+  void jump(float value) { start(value, value, 0, 0); }
+
+  [[nodiscard]] float value(uint32_t nowMs) const { return at(m_from, m_to, nowMs - m_startMs, m_durationMs); }
+  [[nodiscard]] bool isActive(uint32_t nowMs) const { return nowMs - m_startMs < m_durationMs; }
+  [[nodiscard]] float target() const { return m_to; }
+
+private:
+  float m_from = 0.0f;
+  float m_to = 0.0f;
+  uint32_t m_startMs = 0;
+  uint32_t m_durationMs = 0;
+};
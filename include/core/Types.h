@@ -38,6 +38,9 @@
 #include <array>
 #include <cmath>    // For std::lerp
 #include <cstdint>  // For uint8_t
+#include "core/Config.h"
+#include "core/Odometer.h"
+#include "core/StepScheduler.h"
 
 // ============================================================================
 // CHAOS PATTERN COUNT (used by structs below and all chaos-related code)
@@ -67,7 +70,8 @@ enum class MovementType {
   MOVEMENT_OSC = 1,         // Oscillation
   MOVEMENT_CHAOS = 2,       // Chaos mode
   MOVEMENT_PURSUIT = 3,     // Real-time position tracking
-  MOVEMENT_CALIBRATION = 4  // Full calibration sequence
+  MOVEMENT_CALIBRATION = 4, // Full calibration sequence
+  MOVEMENT_TRAJECTORY = 5   // Keyframe playback (uploaded / streamed profile)
 };
 
 // ============================================================================
@@ -105,36 +109,51 @@ struct CyclePauseState {
 
 // ============================================================================
 // STATS TRACKING - Distance tracking encapsulation
-// volatile fields: written by Core 1 (trackDelta), read by Core 0 (StatusBroadcaster)
-// Compound operations (reset, save) must be protected by statsMutex
+// Steps are counted by the lifetime Odometer (Core 1 writes, lock-free reads);
+// the session distance is the odometer total minus its value at the last reset.
+// Session fields (sessionBaseSteps, lastSavedSteps) are Core 0 only and
+// protected by statsMutex.
 // ============================================================================
 
+static_assert(static_cast<size_t>(MovementType::MOVEMENT_TRAJECTORY) + 1 == OdometerCounters::MODE_COUNT,
+              "OdometerCounters::MODE_COUNT must match MovementType");
+
 struct StatsTracking {
-  volatile unsigned long totalDistanceTraveled = 0;  // Total steps traveled (session)
-  volatile unsigned long lastSavedDistance = 0;      // Last saved value (for increment calc)
-  volatile long lastStepForDistance = 0;             // Last step position (for delta calc)
+  Odometer odometer;                         // Lifetime wear counters (persisted to NVS)
+  uint64_t sessionBaseSteps = 0;             // Odometer total at last reset
+  uint64_t lastSavedSteps = 0;               // Odometer total at last daily-stats save
+  volatile long lastStepForDistance = 0;     // Last step position (for delta calc)
+  volatile uint32_t lastStepMicros = 0;      // Time of last tracked step (high-speed detection)
 
   StatsTracking() = default;
 
-  // Reset all counters — CALLER MUST HOLD statsMutex
-  void reset() {
-    totalDistanceTraveled = 0;
-    lastSavedDistance = 0;
+  // Start counting from persisted odometer values (setup, before motorTask)
+  void restoreOdometer(const OdometerCounters& counters) {
+    odometer.restore(counters);
+    sessionBaseSteps = counters.totalSteps;
+    lastSavedSteps = counters.totalSteps;
+  }
+
+  // Steps traveled since last reset (any core)
+  uint64_t sessionSteps() const {
+    return odometer.totalSteps() - sessionBaseSteps;
   }
 
-  // Add distance traveled (in steps)
-  void addDistance(long delta) {
-    if (delta > 0) totalDistanceTraveled = totalDistanceTraveled + delta;
+  // Reset session counters — CALLER MUST HOLD statsMutex
+  void reset() {
+    sessionBaseSteps = odometer.totalSteps();
+    lastSavedSteps = sessionBaseSteps;
   }
 
   // Get increment since last save (in steps) — CALLER MUST HOLD statsMutex
-  unsigned long getIncrementSteps() const {
-    return totalDistanceTraveled - lastSavedDistance;
+  uint64_t getIncrementSteps() const {
+    return odometer.totalSteps() - lastSavedSteps;
   }
 
-  // Mark current distance as saved — CALLER MUST HOLD statsMutex
-  void markSaved() {
-    lastSavedDistance = totalDistanceTraveled;
+  // Mark an increment from getIncrementSteps() as saved — CALLER MUST HOLD statsMutex
+  // (by amount: steps Core 1 adds in between are still pending next time)
+  void markSaved(uint64_t savedSteps) {
+    lastSavedSteps += savedSteps;
   }
 
   // Sync lastStepForDistance with current position (Core 1 only, no mutex needed)
@@ -143,11 +162,12 @@ struct StatsTracking {
   }
 
   // Track distance from last position to current (Core 1 hot path, no mutex needed)
-  // Individual 32-bit writes are atomic on Xtensa — safe without mutex
-  void trackDelta(long currentStep) {
-    long delta = abs(currentStep - lastStepForDistance);
-    addDistance(delta);
+  void trackDelta(long currentStep, MovementType mode) {
+    uint32_t now = micros();
+    odometer.record(static_cast<uint8_t>(mode), static_cast<int32_t>(currentStep - lastStepForDistance),
+                    now - lastStepMicros);
     lastStepForDistance = currentStep;
+    lastStepMicros = now;
   }
 };
 
@@ -239,17 +259,50 @@ struct ZoneEffectState {
 // ============================================================================
 
 struct PursuitState {
-  long targetStep = 0;
-  long lastTargetStep = 0;
+  long targetStep = 0;           // Predicted target (Core 1, see PursuitTracker)
   float maxSpeedLevel = 10.0f;
-  float lastMaxSpeedLevel = 10.0f;
-  unsigned long stepDelay = 1000;
+  float velocityMMS = 0.0f;      // Commanded velocity, signed (accel-limited)
+  unsigned long stepDelay = 1000;  // 0 = no step due (velocity ramping through 0)
   bool isMoving = false;
   bool direction = true;
 
   constexpr PursuitState() = default;
 };
 
+// ============================================================================
+// TRAJECTORY PLAYBACK
+// ============================================================================
+
+// Wire/file format: packed little-endian records, 8 bytes each (ESP32 is LE,
+// so buffers are copied verbatim). timeMs is relative to playback start and
+// must be non-decreasing.
+struct TrajectoryKeyframe {
+  uint32_t timeMs = 0;
+  float positionMM = 0.0f;
+};
+static_assert(sizeof(TrajectoryKeyframe) == 8, "TrajectoryKeyframe wire format is 8 bytes");
+
+// ============================================================================
+// WEBSOCKET BINARY FRAMES (payload after the opcode byte, see Config.h)
+// ============================================================================
+
+struct WsPursuitMoveFrame {
+  float targetMM = 0.0f;
+  float maxSpeedLevel = 0.0f;
+};
+static_assert(sizeof(WsPursuitMoveFrame) == 8, "WsPursuitMoveFrame wire format is 8 bytes");
+
+struct WsSetSpeedFrame {
+  float speedLevel = 0.0f;
+};
+static_assert(sizeof(WsSetSpeedFrame) == 4, "WsSetSpeedFrame wire format is 4 bytes");
+
+struct WsTelemetryHeader {
+  uint16_t sampleCount = 0;  // Samples following the header
+  uint16_t dropped = 0;      // Samples lost since the previous frame (ring full, saturated)
+};
+static_assert(sizeof(WsTelemetryHeader) == 4, "WsTelemetryHeader wire format is 4 bytes");
+
 // ============================================================================
 // OSCILLATION MODE
 // ============================================================================
@@ -257,13 +310,36 @@ struct PursuitState {
 enum class OscillationWaveform {
   OSC_SINE = 0,      // Smooth sinusoidal wave
   OSC_TRIANGLE = 1,  // Linear triangle wave
-  OSC_SQUARE = 2     // Square wave (instant direction change)
+  OSC_SQUARE = 2,    // Square wave (instant direction change)
+  OSC_CUSTOM = 3     // Selected user waveform (WaveformLibrary)
 };
 
 enum class RampType {
   RAMP_LINEAR = 0
 };
 
+// Extra oscillator summed onto the main one (see OscillatorBank.h)
+struct OscillationPartial {
+  float frequencyHz = 1.0f;
+  float amplitudeMM = 0.0f;         // ±mm, follows the main ramp in/out
+  float phase = 0.0f;               // Start phase (cycles, 0..1)
+  OscillationWaveform waveform = OscillationWaveform::OSC_SINE;
+
+  constexpr OscillationPartial() = default;
+};
+
+// Superposition on top of the main oscillator (count 0 + no drift = plain oscillation)
+struct OscillationHarmonics {
+  std::array<OscillationPartial, OSC_MAX_HARMONICS> partials{};
+  uint8_t count = 0;
+  float driftAmplitudeMM = 0.0f;    // Slow sine wander of the center (±mm, 0 = off)
+  float driftPeriodSec = 60.0f;
+
+  [[nodiscard]] constexpr bool isActive() const { return count > 0 || driftAmplitudeMM > 0.0f; }
+
+  constexpr OscillationHarmonics() = default;
+};
+
 struct OscillationConfig {
   float centerPositionMM = 0;       // Center position for oscillation
   float amplitudeMM = 20.0f;        // Amplitude (±amplitude from center)
@@ -284,6 +360,8 @@ struct OscillationConfig {
 
   CyclePauseConfig cyclePause;     // Inter-cycle pause
 
+  OscillationHarmonics harmonics;  // Cycles, ramps and pauses follow the main oscillator
+
   constexpr OscillationConfig() = default;
 };
 
@@ -318,6 +396,8 @@ struct OscillationState {  // NOSONAR(cpp:S1820) — domain state, fields are ti
   float oldAmplitudeMM = 0;         // Previous amplitude
   float targetAmplitudeMM = 0;      // Target amplitude
 
+  bool harmonicsChanged = false;    // Partials/drift edited live (Core 1 reloads its bank)
+
   constexpr OscillationState() = default;
 };
 
@@ -391,7 +471,7 @@ struct ChaosExecutionState {  // NOSONAR(cpp:S1820) — runtime state, all field
 
   // Timing control for non-blocking stepping
   unsigned long stepDelay = 1000;        // Microseconds between steps
-  unsigned long lastStepMicros = 0;      // Last step timestamp
+  StepScheduler stepClock;               // Step deadlines
 
   constexpr ChaosExecutionState() = default;
 };
@@ -400,6 +480,19 @@ struct ChaosExecutionState {  // NOSONAR(cpp:S1820) — runtime state, all field
 // SEQUENCER
 // ============================================================================
 
+// Line opcode: MOVE lines run movementType, the others steer the executor
+// (SequenceProgram resolves them; they never move the motor themselves)
+enum class SequenceOp : uint8_t {
+  SEQ_OP_MOVE = 0,        // Run movementType (cycleCount, pauseAfterMs)
+  SEQ_OP_REPEAT = 1,      // Run the block up to the matching END_REPEAT opArg times
+  SEQ_OP_END_REPEAT = 2,
+  SEQ_OP_CALL = 3,        // Run the lines from lineId opArg until RETURN (or table end), then continue
+  SEQ_OP_RETURN = 4,
+  SEQ_OP_RANDOM = 5,      // Run one of the next opArg lines, picked at random
+  SEQ_OP_WAIT = 6,        // Wait opArg ms
+  SEQ_OP_END = 7          // End of pass (subroutines may follow)
+};
+
 struct SequenceLine {  // NOSONAR(cpp:S1820) — multi-mode sequence line, fields map to 3 movement types + common
   bool enabled = true;
   MovementType movementType = MovementType::MOVEMENT_VAET;  // Type of movement for this line
@@ -444,6 +537,10 @@ struct SequenceLine {  // NOSONAR(cpp:S1820) — multi-mode sequence line, field
   int pauseAfterMs = 0;
   int lineId = 0;
 
+  // CONTROL FLOW (op != SEQ_OP_MOVE: movement fields unused)
+  SequenceOp op = SequenceOp::SEQ_OP_MOVE;
+  int32_t opArg = 0;                     // Repeat count / call target lineId / choice size / wait ms
+
   constexpr SequenceLine() = default;
 };
 
@@ -467,7 +564,9 @@ struct SequenceExecutionState {
 // ============================================================================
 
 constexpr int MAX_PRESETS_PER_MODE = 20;
-constexpr const char* PLAYLIST_FILE_PATH = "/playlists.json";
+constexpr const char* PLAYLIST_FILE_PATH = "/playlists.json";   // Legacy single file, migrated by PlaylistStore
+constexpr const char* PLAYLIST_DIR = "/playlists";             // One record per preset + index.json
+constexpr const char* WAVEFORM_DIR = "/waveforms";             // User waveforms, <name>.json + .active
 
 enum class PlaylistMode {
   PLAYLIST_SIMPLE = 0,
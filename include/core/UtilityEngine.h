@@ -152,6 +152,7 @@ public:
   void saveCurrentSessionStats()               { _stats.saveCurrentSessionStats(); }
   void resetTotalDistance()                     { _stats.resetTotalDistance(); }
   void updateEffectiveMaxDistance()             { _stats.updateEffectiveMaxDistance(); }
+  void persistOdometerIfDue()                   { _stats.persistOdometerIfDue(); }
 
   // ========================================================================
   // SENSORS NVS FACADE
@@ -159,6 +160,23 @@ public:
 
   void loadSensorsInverted();  // Implemented in .cpp (bridges NVS → global)
   void saveSensorsInverted();  // Implemented in .cpp (bridges global → NVS)
+  void loadAutoRecalibrate();  // Implemented in .cpp (bridges NVS → global)
+  void saveAutoRecalibrate();  // Implemented in .cpp (bridges global → NVS)
+
+  // ========================================================================
+  // GOVERNOR NVS FACADE
+  // ========================================================================
+
+  void loadGovernorProfile(uint32_t& floorMicros, float& accel) { _eeprom.loadGovernorProfile(floorMicros, accel); }
+  void saveGovernorProfile(uint32_t floorMicros, float accel)   { _eeprom.saveGovernorProfile(floorMicros, accel); }
+
+  // ========================================================================
+  // SPEED CALIBRATION NVS FACADE
+  // ========================================================================
+
+  bool loadSpeedCalibration(SpeedTable::Points& points)       { return _eeprom.loadSpeedCalibration(points); }
+  void saveSpeedCalibration(const SpeedTable::Points& points) { _eeprom.saveSpeedCalibration(points); }
+  void clearSpeedCalibration()                                { _eeprom.clearSpeedCalibration(); }
 
   // ========================================================================
   // TIME UTILITIES (kept here — tiny, no dedicated class needed)
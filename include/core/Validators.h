@@ -19,6 +19,7 @@
 #include <Arduino.h>
 #include "Config.h"
 #include "Types.h"
+#include "MovementMath.h"
 
 // Note: GlobalState.h provides all extern declarations
 // These are needed here because Validators.h may be included before GlobalState.h
@@ -277,6 +278,63 @@ namespace Validators {
   return true;
 }
 
+/**
+ * Validate the superposed partials and center drift of an oscillation
+ * (main oscillator already checked by oscillationParams). Partials are
+ * rejected, not slowed down: the sum of all components must fit the
+ * calibrated range and OSC_MAX_SPEED_MM_S at the same time.
+ * @param cfg Complete oscillation config
+ * @param errorMsg Output error message if validation fails
+ * @return true if valid, false otherwise
+ */
+[[nodiscard]] inline bool oscillationHarmonics(const OscillationConfig& cfg, String& errorMsg) {
+  const OscillationHarmonics& harmonics = cfg.harmonics;
+  if (!harmonics.isActive()) return true;
+
+  if (harmonics.count > OSC_MAX_HARMONICS) {
+    errorMsg = "Too many partials (max: " + String(OSC_MAX_HARMONICS) + ")";
+    return false;
+  }
+
+  for (uint8_t idx = 0; idx < harmonics.count; ++idx) {
+    const OscillationPartial& partial = harmonics.partials[idx];
+    if (partial.frequencyHz <= 0 || partial.frequencyHz > 10.0f) {
+      errorMsg = "Partial " + String(idx + 1) + ": frequency must be 0-10 Hz";
+      return false;
+    }
+    if (partial.amplitudeMM < 0) {
+      errorMsg = "Partial " + String(idx + 1) + ": amplitude must be >= 0 mm";
+      return false;
+    }
+  }
+
+  if (harmonics.driftAmplitudeMM < 0) {
+    errorMsg = "Drift amplitude must be >= 0 mm";
+    return false;
+  }
+  if (harmonics.driftAmplitudeMM > 0 && harmonics.driftPeriodSec < OSC_DRIFT_MIN_PERIOD_SEC) {
+    errorMsg = "Drift period must be >= " + String(OSC_DRIFT_MIN_PERIOD_SEC, 0) + " s";
+    return false;
+  }
+
+  // Envelope: every component at its extreme on the same side
+  float excursion = MovementMath::superposedExcursion(cfg.amplitudeMM, harmonics);
+  if (cfg.centerPositionMM - excursion < 0 || cfg.centerPositionMM + excursion > getMaxAllowedMM()) {
+    errorMsg = "Combined motion ±" + String(excursion, 1) + "mm around center " +
+               String(cfg.centerPositionMM, 1) + "mm exceeds the calibrated range";
+    return false;
+  }
+
+  if (float peakSpeed = MovementMath::superposedPeakSpeed(cfg.frequencyHz, cfg.amplitudeMM, harmonics);
+      peakSpeed > OSC_MAX_SPEED_MM_S) {
+    errorMsg = "Combined peak speed " + String(peakSpeed, 0) + " mm/s exceeds " +
+               String(OSC_MAX_SPEED_MM_S, 0) + " mm/s";
+    return false;
+  }
+
+  return true;
+}
+
 /**
  * Validate percentage value (0-100)
  * @param percent Value to validate
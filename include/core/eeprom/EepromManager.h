@@ -5,6 +5,10 @@
 // - Logging preferences (enabled + level)
 // - Stats recording preference
 // - Sensor inversion preference
+// - Auto soft recalibration preference
+// - Step-rate governor profile (learned floor + acceleration)
+// - Odometer (lifetime wear counters, one blob)
+// - Speed calibration (measured speed curve, one blob)
 //
 // Uses ESP32 Preferences (NVS) — no manual checksums needed.
 // ============================================================================
@@ -14,6 +18,8 @@
 
 #include <Arduino.h>
 #include <Preferences.h>
+#include "core/Odometer.h"
+#include "core/SpeedTable.h"
 
 // Forward declaration to avoid circular include
 enum class LogLevel : int;
@@ -85,6 +91,68 @@ public:
    */
   void loadSensorsInverted(bool& inverted);
 
+  // ========================================================================
+  // AUTO SOFT RECALIBRATION PREFERENCE
+  // ========================================================================
+
+  /** Save auto soft recalibration preference (PositionVerifier) */
+  void saveAutoRecalibrate(bool enabled);
+
+  /**
+   * Load auto soft recalibration preference
+   * @param[out] enabled Will be set to saved value (or default false)
+   */
+  void loadAutoRecalibrate(bool& enabled);
+
+  // ========================================================================
+  // STEP-RATE GOVERNOR PROFILE
+  // ========================================================================
+
+  /**
+   * Save learned governor limits
+   * @param floorMicros Shortest allowed step interval (µs)
+   * @param accel       Ramp acceleration (steps/s²)
+   */
+  void saveGovernorProfile(uint32_t floorMicros, float accel);
+
+  /**
+   * Load learned governor limits (left untouched if never saved)
+   * @param[in,out] floorMicros Default on input, saved value on output
+   * @param[in,out] accel       Default on input, saved value on output
+   */
+  void loadGovernorProfile(uint32_t& floorMicros, float& accel);
+
+  // ========================================================================
+  // ODOMETER
+  // ========================================================================
+
+  /** Save lifetime wear counters */
+  void saveOdometer(const OdometerCounters& counters);
+
+  /**
+   * Load lifetime wear counters
+   * @param[out] counters Saved values (left untouched if never saved or layout changed)
+   * @return true if counters were loaded
+   */
+  bool loadOdometer(OdometerCounters& counters);
+
+  // ========================================================================
+  // SPEED CALIBRATION
+  // ========================================================================
+
+  /** Save a measured speed curve */
+  void saveSpeedCalibration(const SpeedTable::Points& points);
+
+  /**
+   * Load the measured speed curve
+   * @param[out] points Saved curve (left untouched if never saved or MAX_SPEED_LEVEL changed)
+   * @return true if a curve was loaded
+   */
+  bool loadSpeedCalibration(SpeedTable::Points& points);
+
+  /** Forget the measured curve (back to nominal) */
+  void clearSpeedCalibration();
+
 private:
   Preferences _prefs;
   static constexpr const char* NVS_NAMESPACE = "stepper_cfg";
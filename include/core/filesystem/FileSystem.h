@@ -95,6 +95,29 @@ public:
    */
   bool saveJsonFile(const String& path, const JsonDocument& doc);
 
+  /**
+   * Replace a file so a power cut leaves either the old or the new contents:
+   * write to path + ".tmp", then rename over path (LittleFS swaps the entry
+   * in one commit - no remove first). A .tmp left by a cut is overwritten by
+   * the next write of the same path.
+   * @param path File path
+   * @param write bool write(File&) - returns false to abort
+   * @return true if path now holds the new contents
+   */
+  template <typename Write>
+  static bool writeAtomic(const String& path, Write write) {
+    String tmpPath = path + ".tmp";
+    File file = LittleFS.open(tmpPath, "w");
+    if (!file) return false;
+    bool complete = write(file) && !file.getWriteError();
+    file.close();
+    if (!complete || !LittleFS.rename(tmpPath, path)) {
+      LittleFS.remove(tmpPath);
+      return false;
+    }
+    return true;
+  }
+
 private:
   bool _mounted;
 };
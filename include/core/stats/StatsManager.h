@@ -6,6 +6,7 @@
 // - Session stats save (with mutex protection)
 // - Distance reset
 // - Effective max distance calculation
+// - Lifetime odometer restore / periodic NVS save
 // ============================================================================
 
 #ifndef STATS_MANAGER_H
@@ -31,7 +32,8 @@ public:
   StatsManager(FileSystem& fs, EepromManager& eeprom);
 
   /**
-   * Initialize: load stats recording preference from EEPROM
+   * Initialize: load stats recording preference and odometer from EEPROM
+   * (before motorTask starts - the odometer has a single writer)
    */
   void initialize();
 
@@ -88,10 +90,22 @@ public:
    */
   float getTodayDistance();
 
+  // ========================================================================
+  // ODOMETER
+  // ========================================================================
+
+  /**
+   * Write the odometer to NVS if it moved (call from networkTask)
+   * Rate-limited by ODOMETER_SAVE_INTERVAL_MS
+   */
+  void persistOdometerIfDue();
+
 private:
   FileSystem& _fs;
   EepromManager& _eeprom;
   bool _statsRecordingEnabled;
+  uint64_t _lastPersistedSteps = 0;
+  unsigned long _lastOdometerSaveMs = 0;
 };
 
 #endif // STATS_MANAGER_H
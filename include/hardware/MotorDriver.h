@@ -48,6 +48,12 @@ public:
      */
     void setDirection(bool forward);
 
+    /**
+     * Get current logical direction (as last set by setDirection)
+     * @return true = forward
+     */
+    bool getDirection() const { return m_direction; }
+
     /**
      * Enable motor driver (start holding torque)
      * HSS86 ENABLE is active LOW, but BSS138 level shifter inverts the signal
@@ -103,6 +109,29 @@ public:
      */
     unsigned long getPendInterruptCount() const;
 
+    /**
+     * Get total number of step pulses sent since boot (wraps at 2^32)
+     * Used by PositionVerifier to correlate PEND edges with commanded steps
+     */
+    uint32_t getCommandedSteps() const;
+
+    /**
+     * Get micros() timestamp of the last step pulse
+     */
+    unsigned long getLastStepMicros() const;
+
+    /**
+     * Get the time between the last two step pulses (µs, Core 1)
+     */
+    unsigned long getLastStepIntervalMicros() const;
+
+    /**
+     * Get the most recent PEND edge (either direction)
+     * @param[out] edgeMicros  micros() timestamp captured by the ISR
+     * @param[out] stepsAtEdge Commanded step count at the time of the edge
+     */
+    void getLastPendEdge(unsigned long& edgeMicros, uint32_t& stepsAtEdge) const;
+
 private:
     // Singleton pattern - prevent external construction
     MotorDriver() = default;
@@ -0,0 +1,100 @@
+// ============================================================================
+// POSITION_VERIFIER.H - Closed-loop position verification (HSS86 PEND)
+// ============================================================================
+// Correlates commanded step pulses with HSS86 PEND settling edges:
+// - Segments the pulse stream into moves (idle gap = end of move) and, in
+//   continuous runs, strokes (direction reversal = end of stroke)
+// - Measures settle time after the last pulse → following error estimate
+// - Flags moves PEND never confirmed → lost steps estimate
+// - Triggers a soft recalibration (return to START) when slip accumulates
+//
+// Runs entirely on Core 1 (update() from motorTask). Counters are 32-bit
+// single-writer values, read by StatusBroadcaster on Core 0.
+// ============================================================================
+
+#ifndef POSITION_VERIFIER_H
+#define POSITION_VERIFIER_H
+
+#include <Arduino.h>
+#include "core/Config.h"
+
+class PositionVerifier {
+public:
+    static PositionVerifier& getInstance();
+
+    /**
+     * Advance move segmentation and PEND correlation
+     * Call from motorTask on every iteration (cheap when idle)
+     */
+    void update();
+
+    /**
+     * Forget accumulated slip (position was re-synchronized on a contact)
+     * Called by CalibrationManager when the START contact re-zeroes currentStep
+     */
+    void resetTracking();
+
+    // ========================================================================
+    // RESULTS (read from Core 0 for status)
+    // ========================================================================
+
+    [[nodiscard]] uint32_t getVerifiedMoves() const { return m_verifiedMoves; }
+    [[nodiscard]] uint32_t getUnverifiedMoves() const { return m_unverifiedMoves; }
+    [[nodiscard]] unsigned long getLastSettleMicros() const { return m_lastSettleMicros; }
+    [[nodiscard]] long getLastFollowingError() const { return m_lastFollowingError; }
+    [[nodiscard]] long getMaxFollowingError() const { return m_maxFollowingError; }
+    [[nodiscard]] long getLostStepsEstimate() const { return m_lostStepsEstimate; }
+    [[nodiscard]] uint32_t getSoftRecalibrations() const { return m_softRecalibrations; }
+    [[nodiscard]] bool isRecalibrationDue() const { return m_recalibrationDue; }
+
+private:
+    PositionVerifier() = default;
+    PositionVerifier(const PositionVerifier&) = delete;
+    PositionVerifier& operator=(const PositionVerifier&) = delete;
+
+    /** Pulses of one move or stroke */
+    struct Segment {
+        uint32_t startSteps = 0;
+        uint32_t endSteps = 0;
+        unsigned long endMicros = 0;       // Final pulse
+        unsigned long intervalMicros = 0;  // Interval of the final pulses
+    };
+
+    /**
+     * PEND settled after the segment's last pulse (or timed out) → record it
+     * @return false while still inside the settle window
+     */
+    bool evaluate(const Segment& segment, unsigned long sinceEndMicros);
+
+    /** Recalibration threshold reached: auto soft recal or one-shot warning */
+    void handleRecalibrationDue();
+
+    // Move segmentation
+    bool m_moveActive = false;
+    uint32_t m_lastSeenSteps = 0;
+    uint32_t m_moveStartSteps = 0;
+    unsigned long m_lastPulseMicros = 0;
+    unsigned long m_stepIntervalMicros = 0;  // Interval of the final pulses
+    bool m_moveForward = true;
+
+    // Stroke closed by a reversal, awaiting PEND while the next one runs
+    Segment m_stroke;
+    bool m_strokePending = false;
+
+    // Results
+    uint32_t m_verifiedMoves = 0;
+    uint32_t m_unverifiedMoves = 0;
+    unsigned long m_lastSettleMicros = 0;
+    long m_lastFollowingError = 0;
+    long m_maxFollowingError = 0;
+    long m_lostStepsEstimate = 0;
+    uint16_t m_consecutiveUnverified = 0;
+    uint32_t m_softRecalibrations = 0;
+    volatile bool m_recalibrationDue = false;
+    bool m_dueReported = false;  // Manual mode: warn once per episode
+};
+
+// Global accessor (singleton reference)
+inline PositionVerifier& PosVerifier = PositionVerifier::getInstance();
+
+#endif // POSITION_VERIFIER_H
@@ -13,10 +13,14 @@
 #define BASE_MOVEMENT_CONTROLLER_H
 
 #include <Arduino.h>
+#include <array>
+#include <atomic>
 #include "core/Types.h"
 #include "core/Config.h"
 #include "core/GlobalState.h"
+#include "core/Transition.h"
 #include "core/UtilityEngine.h"
+#include "movement/ZoneProfile.h"
 
 // ============================================================================
 // BASE MOVEMENT CONTROLLER CLASS
@@ -58,14 +62,16 @@ public:
 
     /**
      * Set forward speed
-     * If running, queues change for end of cycle
+     * If running, applies now: the motor loop blends to the new rate
+     * over VAET_SPEED_TRANSITION_MS
      * @param speedLevel Speed level (0.1 - MAX_SPEED_LEVEL)
      */
     void setSpeedForward(float speedLevel);
 
     /**
      * Set backward speed
-     * If running, queues change for end of cycle
+     * If running, applies now: the motor loop blends to the new rate
+     * over VAET_SPEED_TRANSITION_MS
      * @param speedLevel Speed level (0.1 - MAX_SPEED_LEVEL)
      */
     void setSpeedBackward(float speedLevel);
@@ -76,7 +82,7 @@ public:
 
     /**
      * Calculate step delays based on current motion config
-     * Updates stepDelayMicrosForward and stepDelayMicrosBackward globals
+     * Updates stepIntervalForward and stepIntervalBackward globals
      */
     void calculateStepDelay();
 
@@ -86,6 +92,8 @@ public:
 
     /**
      * Calculate adjusted delay based on position within movement range
+     * Float reference path - the motor loop uses the baked zone profile and
+     * only falls back here while the profile is stale
      * @param currentPositionMM Current position in mm
      * @param movementStartMM Start position of current movement in mm
      * @param movementEndMM End position of current movement in mm
@@ -128,6 +136,13 @@ public:
      */
     void validateZoneEffect();
 
+    /**
+     * networkTask only (the single writer of the spare table): if the published
+     * zone profile no longer matches zoneEffect, bake it into the spare and
+     * publish. Until then the motor loop uses the float zone curve.
+     */
+    void refreshZoneProfile();
+
     // ========================================================================
     // PENDING CHANGES MANAGEMENT
     // ========================================================================
@@ -166,9 +181,19 @@ public:
      */
     void start(float distMM, float speedLevel);
 
+    /**
+     * Calibration finished (completion callback, Core 1): run the start that
+     * armed it, if the system reached READY and nothing else took over
+     */
+    void onCalibrationComplete();
+
+    /** Forget a start waiting on calibration (stop, calibration error) */
+    void cancelPendingStart() { pendingStart_.armed.store(false, std::memory_order_release); }
+
     /**
      * Return motor to start position
      * Recovery mechanism, works from ERROR state
+     * Non-blocking: arms CalibrationManager, completion is ticked from motorTask
      */
     void returnToStart();
 
@@ -223,7 +248,13 @@ public:
      */
     void measureCycleTime();
 
-    // trackDistance() removed — callers use stats.trackDelta(currentStep) directly
+    /**
+     * Wall-clock phase lock (MotionTimeline): compare this cycle boundary
+     * with the shared grid and set the speed trim for the next cycle
+     */
+    void updatePhaseLock();
+
+    // trackDistance() removed — callers use stats.trackDelta(currentStep, mode) directly
 
 private:
     /**
@@ -249,6 +280,40 @@ private:
 
     /** Apply zone speed effects and random turnback, returns adjusted delay */
     unsigned long applyZoneEffects(unsigned long baseDelay);
+
+    /**
+     * Step interval for a direction (0 forward, 1 backward), S-curve blended
+     * after a live speed change (Core 1 only)
+     */
+    uint32_t blendedInterval(uint8_t direction, uint32_t interval);
+
+    // Start requested before calibration: written by start(), taken by
+    // onCalibrationComplete() (armed published last)
+    struct PendingStart {
+        float distanceMM = 0.0f;
+        float speedLevel = 0.0f;
+        std::atomic<bool> armed{false};
+    };
+    PendingStart pendingStart_;
+
+    // Phase lock trims (Core 1 only): total speed trim + learned period bias
+    float phaseTrim_ = 0.0f;
+    float phaseBiasTrim_ = 0.0f;
+
+    // Baked zone profiles: rebuilt into the spare one by networkTask alone,
+    // published by index so Core 1 never reads a table being written
+    std::array<ZoneProfile, 2> zoneProfiles_;
+    std::atomic<uint8_t> activeZoneProfile_{0};
+
+    // Live speed blends per direction (Core 1 only), rate in steps/s.
+    // setSpeed*() raises the request flag before publishing the new interval
+    struct SpeedBlend {
+        Transition rate;
+        uint32_t interval = 0;  // Interval the blend heads for (Q24.8 µs)
+        bool blending = false;
+    };
+    std::array<SpeedBlend, 2> speedBlends_;
+    std::array<std::atomic<bool>, 2> speedBlendRequested_{};
 };
 
 // ============================================================================
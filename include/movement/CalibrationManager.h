@@ -10,6 +10,7 @@
 
 #include <Arduino.h>
 #include "core/Config.h"
+#include "core/Types.h"
 #include "hardware/MotorDriver.h"
 #include "hardware/ContactSensors.h"
 
@@ -28,10 +29,18 @@
  * 4. Release contact + safety offset → config.maxStep
  * 5. Return to START and validate accuracy
  *
+ * Execution model:
+ * startCalibration() / returnToStart() only arm the state machine; the work
+ * is done by process(), ticked from motorTask (Core 1). Each tick performs at
+ * most one step, so the motor loop never stalls and abort() is honoured on
+ * the next tick. Status broadcasting stays on Core 0 (networkTask polls
+ * config.currentState == STATE_CALIBRATING). Both callbacks run on Core 1
+ * inside process(): the error callback queues its message (Events.postError)
+ * rather than sending it.
+ *
  * Dependencies:
  * - MotorDriver: For motor control (step, direction, enable)
  * - ContactSensors: For debounced contact reading
- * - WebSocket/Server: For status updates during long operations
  */
 class CalibrationManager {
 public:
@@ -60,38 +69,52 @@ public:
     // ========================================================================
 
     /**
-     * Start full calibration sequence
+     * Request full calibration sequence
      * Finds START and END contacts, measures total distance, returns to position 0
      *
-     * This is a BLOCKING operation that may take several seconds.
-     * WebSocket is serviced during operation to maintain connection.
+     * Non-blocking: arms the state machine and sets STATE_CALIBRATING.
+     * Safe to call from either core; the work runs in process() on Core 1.
      *
-     * @return true if calibration successful, false on error
+     * @return true if request accepted, false if not initialized or already busy
      */
     bool startCalibration();
 
     /**
-     * Return to START position (position 0)
+     * Request return to START position (position 0)
      * Uses contact detection for precise repositioning (same as calibration)
      * Can be used to recover from ERROR state.
      *
-     * @return true if successful, false on error
+     * Non-blocking: ends in STATE_READY on success, STATE_ERROR on failure.
+     *
+     * @return true if request accepted, false if already busy
      */
     bool returnToStart();
 
-    // ========================================================================
-    // CALLBACKS (set by main code)
-    // ========================================================================
+    /**
+     * Advance the active operation by at most one step
+     * Called from motorTask on every iteration while isBusy()
+     */
+    void process();
+
+    /**
+     * Abort the active operation (takes effect on the next process() tick)
+     * Position tracking stays valid: the motor stops where it is, STATE_READY -
+     * or STATE_INIT if no previous calibration holds (MovementMath::calibrationAbortState).
+     */
+    void abort();
 
     /**
-     * Set callback for status updates
-     * Called to send WebSocket status messages during calibration
+     * Check if an operation is pending or running
      */
-    void setStatusCallback(void (*callback)());
+    [[nodiscard]] bool isBusy() const { return pendingOp_ != Operation::NONE || phase_ != Phase::IDLE; }
+
+    // ========================================================================
+    // CALLBACKS (set by main code)
+    // ========================================================================
 
     /**
      * Set callback for error messages
-     * Called when calibration encounters an error
+     * Called from process() (Core 1) when calibration encounters an error
      */
     void setErrorCallback(void (*callback)(const String& msg));
 
@@ -107,25 +130,74 @@ private:
     CalibrationManager(const CalibrationManager&) = delete;
     CalibrationManager& operator=(const CalibrationManager&) = delete;
 
+    // ========================================================================
+    // STATE MACHINE TYPES
+    // ========================================================================
+
+    enum class Operation : uint8_t {
+        NONE,
+        FULL_CALIBRATION,   // START → END → return → validate → 10% position
+        RETURN_TO_START     // Return leg only
+    };
+
+    // Which contact the current seek/release cycle targets
+    enum class Leg : uint8_t {
+        START,              // Calibration: find START moving backward
+        END,                // Calibration: find END moving forward
+        RETURN              // Return to START (bounded by CALIBRATION_ERROR_MARGIN_STEPS)
+    };
+
+    enum class Phase : uint8_t {
+        IDLE,
+        WAITING,            // Non-blocking delay, then resumes resumePhase_
+        ATTEMPT,            // (instant) Begin a calibration attempt
+        LEG_BEGIN,          // (instant) Choose backoff / decontact / seek for leg_
+        BACKOFF,            // Already on target contact: back off until clear
+        DECONTACT_END,      // Return leg: emergency release from END contact
+        SEEK,               // Move toward contact until detected
+        RELEASE,            // Move away slowly until contact clears
+        SAFETY_MARGIN,      // Add SAFETY_OFFSET_STEPS beyond release point
+        LEG_DONE,           // (instant) Evaluate leg result, pick next leg
+        POSITIONING         // Move to 10% start position
+    };
+
     // ========================================================================
     // INTERNAL METHODS
     // ========================================================================
 
-    /**
-     * Find a contact (START or END) by moving in specified direction
-     * @param moveForward Direction to move (true=forward, false=backward)
-     * @param contactPin GPIO pin for contact sensor
-     * @param contactName Name for logging ("START" or "END")
-     * @return true if contact found, false on timeout/error
-     */
-    bool findContact(bool moveForward, uint8_t contactPin, const char* contactName);
+    /** Consume a pending request (Core 1) */
+    void beginOperation(Operation op);
 
-    /**
-     * Release contact slowly and add safety margin
-     * @param contactPin GPIO pin to monitor
-     * @param moveForward Direction to move away from contact
-     */
-    void releaseContact(uint8_t contactPin, bool moveForward);
+    /** Start one full calibration attempt (retry entry point) */
+    void beginAttempt();
+
+    /** Select first phase for leg_ (backoff / decontact / seek) */
+    void beginLeg();
+
+    /** Evaluate the finished leg and chain to the next one */
+    void onLegComplete();
+
+    /** Non-blocking wait, then continue with next */
+    void waitThen(unsigned long durationMs, Phase next);
+
+    /** Step-timing gate: true if delayMicros elapsed since last step */
+    [[nodiscard]] bool stepDue(unsigned long delayMicros);
+
+    /** Single step in the given direction with position tracking */
+    void stepOnce(bool moveForward);
+
+    /** Per-phase tick handlers */
+    void tickBackoff();
+    void tickDecontactEnd();
+    void tickSeek();
+    void tickRelease();
+    void tickSafetyMargin();
+    void tickPositioning();
+
+    /** Contact pin / direction for the current leg */
+    [[nodiscard]] uint8_t legPin() const;
+    [[nodiscard]] bool legSeekForward() const;
+    [[nodiscard]] const char* legName() const;
 
     /**
      * Handle calibration failure (disable motor, update state)
@@ -133,13 +205,25 @@ private:
      */
     bool handleFailure();
 
+    /** Terminate the operation after a failure (counts retries for full calibration) */
+    void failOperation();
+
+    /** Return to IDLE and clear cooperative flags */
+    void finishOperation();
+
+    /** Record the state and limits a request starts from (before STATE_CALIBRATING) */
+    void rememberOrigin();
+
     /** Validate calibrated distance range. @return 0=OK, 1=retry, -1=fail */
     int validateDistance();
 
     /** Validate accuracy against tolerance. @return 0=OK, 1=retry, -1=fail */
     int validateCalibrationAccuracy();
 
-    /** Position at 10% and finalize calibrated state. */
+    /** Start the move to 10% of travel (finalizeCalibration() runs on arrival) */
+    void beginFinalPositioning();
+
+    /** Finalize calibrated state once positioned at 10%. */
     bool finalizeCalibration();
 
     /**
@@ -148,38 +232,11 @@ private:
      */
     float validateAccuracy();
 
-    /**
-     * Service delay during long operations (yield + status callback)
-     * @param durationMs How long to delay (in ms)
-     */
-    void serviceDelay(unsigned long durationMs);
-
-    /**
-     * Conditionally yield every N steps (reduces nesting in step loops)
-     * @param stepCount Current step counter
-     */
-    void yieldIfDue(unsigned long stepCount);
-
-    /**
-     * Position motor at a target step offset from current (with WS service)
-     * @param targetSteps Target step position
-     */
-    void positionAtOffset(long targetSteps);
-
-    /**
-     * Emergency decontact from END sensor
-     * @return true if successfully decontacted, false on failure
-     */
-    bool emergencyDecontactEnd();
-
     // ========================================================================
     // MEMBER VARIABLES
     // ========================================================================
 
-    // No external dependencies needed — async WebSocket handles itself
-
     // Callbacks
-    void (*statusCallback_)() = nullptr;
     void (*errorCallback_)(const String&) = nullptr;
     void (*completionCallback_)() = nullptr;
 
@@ -189,9 +246,29 @@ private:
     int attemptCount_ = 0;
     float lastErrorPercent_ = 0.0f;
 
+    // State machine (pendingOp_/abortRequested_ written from Core 0)
+    volatile Operation pendingOp_ = Operation::NONE;
+    volatile bool abortRequested_ = false;
+    Operation op_ = Operation::NONE;
+    Phase phase_ = Phase::IDLE;
+    Phase resumePhase_ = Phase::IDLE;
+    Leg leg_ = Leg::START;
+    unsigned long waitStartMs_ = 0;
+    unsigned long waitDurationMs_ = 0;
+    unsigned long phaseStartMs_ = 0;
+    unsigned long lastStepMicros_ = 0;
+    long phaseSteps_ = 0;              // Steps taken in current phase
+    long returnErrorSteps_ = 0;        // Position error measured at return-to-START
+    long positionTargetStep_ = 0;
+
     // Calibration results
     long maxStep_ = 0;
     float totalDistanceMM_ = 0.0f;
+
+    // What the running request started from (restored on abort)
+    SystemState originState_ = SystemState::STATE_INIT;
+    long originMaxStep_ = 0;
+    float originDistanceMM_ = 0.0f;
 };
 
 // ============================================================================
@@ -23,6 +23,7 @@
 #include <ESPAsyncWebServer.h>
 #include "core/Types.h"
 #include "core/Config.h"
+#include "core/Transition.h"
 #include "ChaosPatterns.h"
 #include "core/UtilityEngine.h"
 #include "core/GlobalState.h"
@@ -58,6 +59,13 @@ public:
      */
     void start();
 
+    /**
+     * Continuation of start() after the non-blocking move to center
+     * Called by SequenceExecutor on Core 1 when the positioning move ends
+     * @param reached true if center reached, false on timeout/abort
+     */
+    void onCenterReached(bool reached);
+
     /**
      * Stop chaos mode
      * Logs statistics and resets state
@@ -110,9 +118,15 @@ private:
 
     /**
      * Calculate step delay based on current speed level
+     * (the step rate blends to it over CHAOS_SPEED_TRANSITION_MS)
      */
     void calculateStepDelay();
 
+    /**
+     * Generate first pattern and switch to RUNNING (tail of start())
+     */
+    void beginPatterns();
+
     /**
      * Calculate effective limits for chaos mode
      * @param minLimit Output: effective minimum limit (mm)
@@ -223,6 +237,10 @@ private:
     void handleBruteForceAtTarget(float effectiveMinLimit, float effectiveMaxLimit);
     void handleLiberatorAtTarget(float effectiveMinLimit, float effectiveMaxLimit);
     void handleDiscreteAtTarget();
+
+    // Step rate (steps/s) blend between pattern speeds (Core 1 only)
+    Transition rateBlend_;
+    bool rateBlending_ = false;
 };
 
 // Global accessor
@@ -0,0 +1,106 @@
+// ============================================================================
+// MOTION_TIMELINE.H - Scheduled starts + wall-clock phase lock (multi-rig)
+// ============================================================================
+// Lets several rigs on the same network start together and stay in step
+// without a per-command round trip:
+// - A movement command carrying "startAt" (epoch ms) is parked here and
+//   replayed through CommandDispatcher by networkTask at that instant
+// - "phaseAnchor" (epoch ms, defaults to startAt) locks the VA-ET-VIENT cycle
+//   boundaries / oscillation phase to a grid on the wall clock; controllers
+//   compare their phase against it and trim speed by a few percent
+//
+// Both rely on the wall clock (NTP or syncTime) being shared by all rigs.
+// Scheduling runs on Core 0; the anchor is read by Core 1 controllers.
+// ============================================================================
+
+#ifndef MOTION_TIMELINE_H
+#define MOTION_TIMELINE_H
+
+#include <Arduino.h>
+#include "core/Config.h"
+
+class MotionTimeline {
+public:
+    static MotionTimeline& getInstance();
+
+    /**
+     * Create the pending-command mutex (call in setup before commands arrive)
+     */
+    void begin();
+
+    // ========================================================================
+    // SCHEDULED START (Core 0)
+    // ========================================================================
+
+    /**
+     * Park a command until startAtMs (replaces any pending one)
+     * @param cmd Command name (for logs)
+     * @param message JSON to replay, already stripped of "startAt"
+     * @param startAtMs Epoch milliseconds
+     * @return false if rejected (clock not synced / out of range, error sent)
+     */
+    bool schedule(const char* cmd, const String& message, int64_t startAtMs);
+
+    /**
+     * Hand out the pending command once its start time is reached
+     * Call from networkTask every iteration
+     * @param message Receives the JSON to dispatch
+     * @return true if a command is due now
+     */
+    bool takeDue(String& message);
+
+    /**
+     * Drop the pending start (if any) and release the phase lock
+     */
+    void cancel();
+
+    // ========================================================================
+    // PHASE LOCK
+    // ========================================================================
+
+    /**
+     * Anchor VAET/OSC phase to the wall clock (Core 0)
+     * @return false if the clock is not synchronized (lock not engaged)
+     */
+    bool lockPhase(int64_t anchorMs);
+
+    void unlockPhase() { m_phaseLocked = false; }
+
+    [[nodiscard]] bool isPhaseLocked() const { return m_phaseLocked; }
+
+    /** Milliseconds since the anchor on the wall clock (Core 1) */
+    [[nodiscard]] int64_t msSinceAnchor() const;
+
+    /** Controllers report their latest phase error for status (Core 1) */
+    void reportPhaseError(float errorMs) { m_lastPhaseErrorMs = errorMs; }
+
+    // ========================================================================
+    // STATUS (Core 0)
+    // ========================================================================
+
+    [[nodiscard]] bool hasPending() const { return m_pending; }
+    [[nodiscard]] int64_t getPendingStartAt() const { return m_pendingStartAtMs; }
+    [[nodiscard]] float getLastPhaseErrorMs() const { return m_lastPhaseErrorMs; }
+
+private:
+    MotionTimeline() = default;
+    MotionTimeline(const MotionTimeline&) = delete;
+    MotionTimeline& operator=(const MotionTimeline&) = delete;
+
+    // Pending command (async_tcp writes, networkTask reads → mutex)
+    SemaphoreHandle_t m_mutex = nullptr;
+    String m_pendingMessage;
+    String m_pendingCmd;
+    int64_t m_pendingStartAtMs = 0;
+    volatile bool m_pending = false;
+
+    // Phase anchor: 64-bit is not atomic → written only while unlocked
+    int64_t m_anchorMs = 0;
+    volatile bool m_phaseLocked = false;
+    volatile float m_lastPhaseErrorMs = 0.0f;
+};
+
+// Global accessor (singleton reference)
+inline MotionTimeline& Timeline = MotionTimeline::getInstance();
+
+#endif // MOTION_TIMELINE_H
@@ -5,7 +5,8 @@
  *
  * Handles all oscillation movement logic:
  * - Sinusoidal position calculation with phase accumulation
- * - Multiple waveforms: Sine, Triangle, Square
+ * - Multiple waveforms: Sine, Triangle, Square, Custom (WaveformLibrary)
+ * - Superposed partials + center drift (OscillatorBank)
  * - Smooth frequency/center/amplitude transitions
  * - Ramp in/out for smooth start/stop
  * - Cycle counting with inter-cycle pause support
@@ -30,6 +31,7 @@
 #include "core/Config.h"
 #include "core/UtilityEngine.h"
 #include "core/GlobalState.h"
+#include "movement/OscillatorBank.h"
 
 // ============================================================================
 // OSCILLATION STATE - Defined in OscillationController.cpp
@@ -146,6 +148,15 @@ private:
     unsigned long lastDebugLogMs_ = 0;
     unsigned long lastCenterTransitionLogMs_ = 0;
 
+    // Wall-clock phase lock (MotionTimeline)
+    unsigned long lastPhaseLockMs_ = 0;
+    float phaseTrim_ = 0.0f;
+
+    // Superposed partials and center drift (oscillation.harmonics)
+    OscillatorBank bank_;
+    float envelope_ = 1.0f;                  // Main ramp in/out progress, scales the partials
+    const float* customTable_ = nullptr;     // Custom table the bank resolved (reload on change)
+
     // ========================================================================
     // INTERNAL HELPERS
     // ========================================================================
@@ -157,6 +168,14 @@ private:
      */
     float advancePhase(unsigned long currentMs);
 
+    /**
+     * Compare local phase with the wall-clock anchor and update the
+     * frequency trim (rate-limited to OSC_PHASE_LOCK_INTERVAL_MS)
+     * @param currentMs Current timestamp in ms
+     * @param frequencyHz Frequency the phase is advancing at
+     */
+    void updatePhaseLock(unsigned long currentMs, float frequencyHz);
+
     /**
      * Calculate effective amplitude with transitions and ramping
      * Handles amplitude transition, ramp in/out, debug logging
@@ -185,11 +204,10 @@ private:
     bool handleCyclePause();
 
     /**
-     * Execute motor steps towards target
-     * @param targetStep Target position in steps
-     * @param isCatchUp true if in catch-up mode (multiple steps)
+     * Execute one motor step towards the target
+     * @param moveForward Direction of the step
      */
-    void executeSteps(long oscTargetStep, bool isCatchUp);
+    void executeStep(bool moveForward);
 
     /**
      * Check safety contacts near oscillation limits
@@ -0,0 +1,98 @@
+// ============================================================================
+// OSCILLATOR_BANK.H - Superposed oscillators for oscillation mode
+// ============================================================================
+// Plays OscillationHarmonics: up to OSC_MAX_HARMONICS extra oscillators
+// (frequency, amplitude, start phase, waveform) summed onto the main one,
+// plus a slow sine drift of the center.
+//
+// Each partial runs an integer phase accumulator in Q0.32 (one period =
+// 2^32, so overflow is the period wrap) advanced by a fixed per-ms
+// increment, and reads its waveform table with the top bits. No fmodf, no
+// float phase that loses resolution as it grows: a partial costs a
+// multiply-add and one interpolated table load per update.
+//
+// The main oscillator keeps its float phase (frequency transitions, phase
+// lock, cycle counting); the bank only adds offsets to its position.
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "core/Config.h"
+#include "core/Types.h"
+#include "movement/WaveformTable.h"
+
+class OscillatorBank {
+public:
+    /** cycles/s → Q0.32 phase increment per ms (10 Hz ≈ 4.3e7, fits easily) */
+    static constexpr uint32_t incrementPerMs(float frequencyHz) {
+        double increment = static_cast<double>(frequencyHz) * 4294967296.0 / 1000.0;
+        return increment <= 0.0 ? 0 : static_cast<uint32_t>(static_cast<uint64_t>(increment + 0.5));
+    }
+
+    /** Phase in cycles (any value, wraps) → Q0.32 */
+    static constexpr uint32_t phaseFixed(float cycles) {
+        double reduced = static_cast<double>(cycles) - static_cast<double>(static_cast<int64_t>(cycles));
+        if (reduced < 0.0) reduced += 1.0;
+        return static_cast<uint32_t>(static_cast<uint64_t>(reduced * 4294967296.0));  // 1.0 wraps to 0
+    }
+
+    /**
+     * Load partials and drift from cfg
+     * @param tableFor  OscillationWaveform → table (OSC_CUSTOM resolves to the library)
+     * @param keepPhase Live change: partials already playing continue from
+     *                  their current phase instead of jumping to their start phase
+     */
+    template <typename TableFn>
+    void configure(const OscillationHarmonics& cfg, TableFn tableFor, bool keepPhase) {
+        uint8_t count = cfg.count < OSC_MAX_HARMONICS ? cfg.count : OSC_MAX_HARMONICS;
+        for (uint8_t idx = 0; idx < count; ++idx) {
+            const OscillationPartial& source = cfg.partials[idx];
+            Partial& partial = m_partials[idx];
+            if (!keepPhase || idx >= m_count) partial.phase = phaseFixed(source.phase);
+            partial.increment = incrementPerMs(source.frequencyHz);
+            partial.amplitudeMM = source.amplitudeMM;
+            partial.table = tableFor(source.waveform);
+        }
+        m_count = count;
+
+        // Drift starts at the center, moving up (−cos convention: phase 1/4 = 0)
+        if (!keepPhase || m_drift.amplitudeMM == 0.0f) m_drift.phase = phaseFixed(0.25f);
+        m_drift.increment = cfg.driftPeriodSec > 0.0f ? incrementPerMs(1.0f / cfg.driftPeriodSec) : 0;
+        m_drift.amplitudeMM = cfg.driftAmplitudeMM;
+    }
+
+    /** Nothing to add (plain oscillation) */
+    [[nodiscard]] bool isIdle() const { return m_count == 0 && m_drift.amplitudeMM == 0.0f; }
+
+    /** Advance every phase by deltaMs (uint32 overflow = period wrap) */
+    void advance(uint32_t deltaMs) {
+        for (uint8_t idx = 0; idx < m_count; ++idx) m_partials[idx].phase += m_partials[idx].increment * deltaMs;
+        m_drift.phase += m_drift.increment * deltaMs;
+    }
+
+    /** Sum of the partials (mm), before the main ramp envelope */
+    [[nodiscard]] float partialsMM() const {
+        float sum = 0.0f;
+        for (uint8_t idx = 0; idx < m_count; ++idx) sum += m_partials[idx].value();
+        return sum;
+    }
+
+    /** Current center drift (mm) */
+    [[nodiscard]] float driftMM() const { return m_drift.amplitudeMM == 0.0f ? 0.0f : m_drift.value(); }
+
+private:
+    struct Partial {
+        uint32_t phase = 0;       // Q0.32 cycles
+        uint32_t increment = 0;   // Q0.32 cycles per ms
+        float amplitudeMM = 0.0f;
+        const float* table = Waveform::SINE.data();
+
+        [[nodiscard]] float value() const { return amplitudeMM * Waveform::lookupFixed(table, phase); }
+    };
+
+    std::array<Partial, OSC_MAX_HARMONICS> m_partials{};
+    uint8_t m_count = 0;
+    Partial m_drift{};
+};
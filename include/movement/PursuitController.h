@@ -4,19 +4,23 @@
  * ============================================================================
  *
  * Handles pursuit/tracking mode where motor follows a target position
- * in real-time with proportional speed control.
+ * in real-time with velocity control.
  *
  * Features:
- * - Real-time target tracking with proportional speed
- * - Speed ramping based on distance to target
+ * - Target velocity estimated from timestamped targets, extrapolated
+ *   between packets and across missed ones (PursuitTracker)
+ * - Accel-limited velocity command: target velocity (feedforward) plus a
+ *   position correction that can always brake in time
  * - Safety contact detection near limits
- * - Direction change handling for HSS86 driver
+ * - Direction changes on Core 1, at the low speed the ramp passes through
  *
- * Architecture: Singleton pattern with extern references to main globals
+ * Architecture: Singleton pattern with extern references to main globals.
+ * move() posts targets from Core 0; control() and process() run on Core 1.
  *
  * Dependencies:
  * - Types.h (PursuitState struct)
- * - Config.h (STEPS_PER_MM, HARD_DRIFT_TEST_ZONE_MM, etc.)
+ * - PursuitTracker.h (target prediction, velocity law)
+ * - Config.h (STEPS_PER_MM, PURSUIT_*, HARD_DRIFT_TEST_ZONE_MM, etc.)
  * - MotorDriver.h (Motor singleton)
  * - ContactSensors.h (Contacts singleton)
  * - UtilityEngine.h (engine singleton)
@@ -27,10 +31,12 @@
 #define PURSUIT_CONTROLLER_H
 
 #include <Arduino.h>
+#include <atomic>
 #include "core/Types.h"
 #include "core/Config.h"
 #include "core/UtilityEngine.h"
 #include "core/GlobalState.h"
+#include "movement/PursuitTracker.h"
 
 // ============================================================================
 // PURSUIT STATE - Defined in PursuitController.cpp
@@ -58,26 +64,35 @@ public:
     // ========================================================================
 
     /**
-     * Move to target position with real-time tracking
-     * Updates pursuit parameters and starts movement
+     * Post a new target (Core 0) and start tracking
+     * Clamped to the calibrated range; the motor loop picks it up
      *
      * @param targetPositionMM Target position in millimeters
      * @param maxSpeedLevel Maximum speed level (1-MAX_SPEED_LEVEL)
      */
-    void move(float targetPositionMM, float maxSpeedLevel) const;
+    void move(float targetPositionMM, float maxSpeedLevel);
 
     /**
-     * Process one pursuit step
-     * Called from main loop when MovementType::MOVEMENT_PURSUIT is active and pursuit.isMoving
+     * Control tick (Core 1, every loop while pursuit.isMoving or a request is pending)
+     * Takes posted targets - setting pursuit.isMoving, which only Core 1 does -
+     * and every PURSUIT_CONTROL_PERIOD_US updates the commanded velocity,
+     * direction and pursuit.stepDelay. Stops once on a still target.
+     */
+    void control();
+
+    /**
+     * Process one pursuit step in pursuit.direction
+     * Called from main loop when MovementType::MOVEMENT_PURSUIT is active and a step is due
      * Handles step execution, safety checks, distance tracking
      */
     void process() const;
 
     /**
      * Stop pursuit movement
-     * Called when stopping all movement or switching modes
+     * Called when stopping all movement or switching modes. Halts now and
+     * has the next control() tick drop targets posted before the stop.
      */
-    void stop() const;
+    void stop();
 
     // ========================================================================
     // STATE ACCESS
@@ -88,6 +103,15 @@ public:
      */
     bool isMoving() const { return pursuit.isMoving; }
 
+    /**
+     * A posted target or stop that control() has not taken yet
+     * motorTask runs control() for it even while pursuit is halted
+     */
+    bool hasPendingRequest() const {
+        return postedTargets_.load(std::memory_order_acquire) != observedTargets_ ||
+               stopRequested_.load(std::memory_order_acquire);
+    }
+
 private:
     // ========================================================================
     // INTERNAL HELPERS
@@ -99,6 +123,19 @@ private:
      * @return true if safe to continue, false if contact hit
      */
     bool checkSafetyContacts(bool moveForward) const;
+
+    /** Step rate and direction for the commanded velocity (crawls the last steps) */
+    void applyVelocity(float errorMM) const;
+
+    // Core 0 → Core 1 target handoff: value first, then the count
+    float postedTargetMM_ = 0.0f;
+    std::atomic<uint32_t> postedTargets_{0};
+    std::atomic<bool> stopRequested_{false};
+
+    // Core 1 only
+    uint32_t observedTargets_ = 0;
+    uint32_t lastControlUs_ = 0;
+    PursuitTracker tracker_;
 };
 
 // ============================================================================
@@ -0,0 +1,108 @@
+// ============================================================================
+// PURSUIT_TRACKER.H - Target prediction and velocity control for pursuit
+// ============================================================================
+// Pursuit targets stream in at ~20 Hz from a UI drag or a remote. Stepping
+// at a distance-banded rate until each target is reached stops and restarts
+// the motor on every packet, and lags a moving target by up to a packet.
+//
+// Instead:
+//   - observe() timestamps each target; targetVelocity() is the least-squares
+//     slope over the last PURSUIT_VELOCITY_WINDOW_MS
+//   - target() extrapolates at that velocity between packets and across
+//     missed ones (up to PURSUIT_EXTRAPOLATE_MAX_MS, then holds)
+//   - nextVelocity() commands target velocity (feedforward) plus a position
+//     correction capped by the braking distance, and limits the change to
+//     PURSUIT_ACCEL_MM_S2: no velocity steps, no overshoot from the correction
+// ============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include "core/Config.h"
+
+class PursuitTracker {
+public:
+    /** Record a target received at nowMs */
+    void observe(float targetMM, uint32_t nowMs) {
+        m_head = (m_head + 1) % m_samples.size();
+        m_samples[m_head] = {nowMs, targetMM};
+        if (m_count < m_samples.size()) ++m_count;
+        m_velocityMMS = slope(nowMs);
+    }
+
+    [[nodiscard]] bool hasTarget() const { return m_count > 0; }
+
+    /** Estimated target velocity (mm/s) as of the last packet */
+    [[nodiscard]] float targetVelocity() const { return m_velocityMMS; }
+
+    /** Target expected at nowMs, within [minMM, maxMM] */
+    [[nodiscard]] float target(uint32_t nowMs, float minMM, float maxMM) const {
+        if (m_count == 0) return minMM;
+        const Sample& last = m_samples[m_head];
+        uint32_t horizonMs = std::min<uint32_t>(nowMs - last.ms, PURSUIT_EXTRAPOLATE_MAX_MS);
+        return std::clamp(last.mm + m_velocityMMS * static_cast<float>(horizonMs) / 1000.0f, minMM, maxMM);
+    }
+
+    /** Velocity the target is expected to move at, at nowMs (0 once held or at a limit) */
+    [[nodiscard]] float feedforward(uint32_t nowMs, float minMM, float maxMM) const {
+        if (m_count == 0 || nowMs - m_samples[m_head].ms >= PURSUIT_EXTRAPOLATE_MAX_MS) return 0.0f;
+        float targetMM = target(nowMs, minMM, maxMM);
+        return (targetMM <= minMM || targetMM >= maxMM) ? 0.0f : m_velocityMMS;
+    }
+
+    /**
+     * One control tick
+     * @param velocityMMS Commanded velocity so far (signed)
+     * @param errorMM     Target − position
+     * @param feedforward Target velocity
+     * @return New commanded velocity, within ±maxSpeedMMS and one
+     *         PURSUIT_ACCEL_MM_S2 step of velocityMMS
+     */
+    static float nextVelocity(float velocityMMS, float errorMM, float feedforward, float dtSec, float maxSpeedMMS) {
+        // Fastest closing speed that can still brake to the target
+        float brakeMMS = std::sqrt(2.0f * PURSUIT_ACCEL_MM_S2 * std::fabs(errorMM));
+        float correction = std::clamp(PURSUIT_POSITION_GAIN * errorMM, -brakeMMS, brakeMMS);
+        float desired = std::clamp(feedforward + correction, -maxSpeedMMS, maxSpeedMMS);
+
+        float maxChange = PURSUIT_ACCEL_MM_S2 * dtSec;
+        return velocityMMS + std::clamp(desired - velocityMMS, -maxChange, maxChange);
+    }
+
+private:
+    struct Sample {
+        uint32_t ms = 0;
+        float mm = 0.0f;
+    };
+
+    /** Least-squares slope (mm/s) of the samples within the window before nowMs */
+    [[nodiscard]] float slope(uint32_t nowMs) const {
+        float sumT = 0.0f;
+        float sumX = 0.0f;
+        float sumTT = 0.0f;
+        float sumTX = 0.0f;
+        float count = 0.0f;
+        for (size_t back = 0; back < m_count; ++back) {
+            const Sample& sample = m_samples[(m_head + m_samples.size() - back) % m_samples.size()];
+            uint32_t ageMs = nowMs - sample.ms;
+            if (ageMs > PURSUIT_VELOCITY_WINDOW_MS) break;
+            // Relative to the newest sample: small numbers, no float cancellation
+            float t = -static_cast<float>(ageMs) / 1000.0f;
+            float x = sample.mm - m_samples[m_head].mm;
+            sumT += t;
+            sumX += x;
+            sumTT += t * t;
+            sumTX += t * x;
+            count += 1.0f;
+        }
+        float spread = count * sumTT - sumT * sumT;
+        return (count < 2.0f || spread <= 1e-9f) ? 0.0f : (count * sumTX - sumT * sumX) / spread;
+    }
+
+    std::array<Sample, 8> m_samples{};
+    size_t m_head = 0;
+    size_t m_count = 0;
+    float m_velocityMMS = 0.0f;
+};
@@ -0,0 +1,432 @@
+// ============================================================================
+// SEQUENCE_BINARY.H - Compact sequence import/export format
+// ============================================================================
+// Layout (all integers little-endian, floats IEEE-754 single):
+//
+//   preamble  "SQB" + format version (1 byte)
+//   record 0  header: u16 lineCount, u8 nameLength, name bytes
+//   record n  one SequenceLine (LINE_RECORD_SIZE bytes in version 1)
+//
+// Every record is prefixed by its u16 length, so a decoder can split the
+// stream without understanding the payload: RecordReader consumes an upload
+// in chunks of any size (HTTP onBody) holding at most one record.
+//
+// Compatibility: later versions only APPEND fields to a record. decodeLine()
+// keeps defaults for fields missing from a shorter (older) record and
+// ignores the tail of a longer (newer) one; VERSION changes only when a
+// field's meaning changes.
+//
+// Line records have a fixed size, which lets the exporter serve any byte
+// range of the file without building it (see SequenceTableManager).
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "core/Types.h"
+
+namespace SequenceBinary {
+
+constexpr std::array<uint8_t, 3> MAGIC = {'S', 'Q', 'B'};
+constexpr uint8_t VERSION = 1;
+constexpr size_t PREAMBLE_SIZE = MAGIC.size() + 1;
+constexpr size_t LENGTH_SIZE = 2;
+constexpr size_t LINE_RECORD_SIZE = 133;       // Version 1 field set (see encodeLine)
+constexpr size_t HEADER_RECORD_MAX = 3 + 255;  // lineCount + nameLength + name
+constexpr size_t MAX_RECORD = 512;             // Room for fields appended by later versions
+
+// ============================================================================
+// FIELD CODING
+// ============================================================================
+
+class Writer {
+public:
+    explicit Writer(uint8_t* out) : m_out(out) {}
+
+    void u8(uint8_t value) { m_out[m_size++] = value; }
+    void u16(uint16_t value) {
+        u8(static_cast<uint8_t>(value));
+        u8(static_cast<uint8_t>(value >> 8));
+    }
+    void u32(uint32_t value) {
+        u16(static_cast<uint16_t>(value));
+        u16(static_cast<uint16_t>(value >> 16));
+    }
+    void i32(int32_t value) { u32(static_cast<uint32_t>(value)); }
+    void f32(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        u32(bits);
+    }
+
+    [[nodiscard]] size_t size() const { return m_size; }
+
+private:
+    uint8_t* m_out;
+    size_t m_size = 0;
+};
+
+/** Reads fields in order; once the record runs out, targets keep their value */
+class Reader {
+public:
+    Reader(const uint8_t* data, size_t length) : m_data(data), m_left(length) {}
+
+    void u8(uint8_t& value) {
+        if (m_left < 1) return;
+        value = *m_data;
+        skip(1);
+    }
+    void u16(uint16_t& value) {
+        if (m_left < 2) return;
+        value = static_cast<uint16_t>(m_data[0] | (m_data[1] << 8));
+        skip(2);
+    }
+    void u32(uint32_t& value) {
+        if (m_left < 4) return;
+        value = static_cast<uint32_t>(m_data[0]) | (static_cast<uint32_t>(m_data[1]) << 8) |
+                (static_cast<uint32_t>(m_data[2]) << 16) | (static_cast<uint32_t>(m_data[3]) << 24);
+        skip(4);
+    }
+    void i32(int32_t& value) {
+        auto bits = static_cast<uint32_t>(value);
+        u32(bits);
+        value = static_cast<int32_t>(bits);
+    }
+    void f32(float& value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        u32(bits);
+        memcpy(&value, &bits, sizeof(value));
+    }
+    /** Single-byte enum */
+    template <typename Enum>
+    void e8(Enum& value) {
+        auto raw = static_cast<uint8_t>(value);
+        u8(raw);
+        value = static_cast<Enum>(raw);
+    }
+    /** Flag byte: bit n → *flags[n] */
+    template <size_t N>
+    void bits(const std::array<bool*, N>& flags) {
+        if (m_left < 1) return;
+        for (size_t bit = 0; bit < N; ++bit) *flags[bit] = (*m_data >> bit) & 1;
+        skip(1);
+    }
+
+    [[nodiscard]] size_t left() const { return m_left; }
+    [[nodiscard]] const uint8_t* data() const { return m_data; }
+
+private:
+    void skip(size_t count) {
+        m_data += count;
+        m_left -= count;
+    }
+
+    const uint8_t* m_data;
+    size_t m_left;
+};
+
+template <size_t N>
+inline uint8_t packBits(const std::array<bool, N>& flags) {
+    uint8_t packed = 0;
+    for (size_t bit = 0; bit < N; ++bit) packed |= static_cast<uint8_t>(flags[bit]) << bit;
+    return packed;
+}
+
+// ============================================================================
+// RECORDS
+// ============================================================================
+
+/** Preamble (magic + version) into out[PREAMBLE_SIZE] */
+inline void encodePreamble(uint8_t* out) {
+    memcpy(out, MAGIC.data(), MAGIC.size());
+    out[MAGIC.size()] = VERSION;
+}
+
+/** Header record payload, @return its size (name truncated to 255 bytes) */
+inline size_t encodeHeader(uint16_t lineCount, const char* name, size_t nameLength, uint8_t* out) {
+    if (nameLength > 255) nameLength = 255;
+    Writer writer(out);
+    writer.u16(lineCount);
+    writer.u8(static_cast<uint8_t>(nameLength));
+    memcpy(out + writer.size(), name, nameLength);
+    return writer.size() + nameLength;
+}
+
+/** Decode a header record, @return false if truncated */
+inline bool decodeHeader(const uint8_t* data, size_t length, uint16_t& lineCount, const char*& name, size_t& nameLength) {
+    if (length < 3) return false;
+    Reader reader(data, length);
+    uint8_t nameBytes = 0;
+    reader.u16(lineCount);
+    reader.u8(nameBytes);
+    if (reader.left() < nameBytes) return false;
+    name = reinterpret_cast<const char*>(reader.data());
+    nameLength = nameBytes;
+    return true;
+}
+
+/** Line record payload into out[LINE_RECORD_SIZE], @return its size */
+inline size_t encodeLine(const SequenceLine& line, uint8_t* out) {
+    Writer w(out);
+
+    // Common + control flow
+    w.i32(line.lineId);
+    w.u8(line.enabled ? 1 : 0);
+    w.u8(static_cast<uint8_t>(line.movementType));
+    w.u8(static_cast<uint8_t>(line.op));
+    w.i32(line.opArg);
+    w.i32(line.cycleCount);
+    w.i32(line.pauseAfterMs);
+
+    // VA-ET-VIENT
+    w.f32(line.startPositionMM);
+    w.f32(line.distanceMM);
+    w.f32(line.speedForward);
+    w.f32(line.speedBackward);
+
+    const ZoneEffectConfig& ze = line.vaetZoneEffect;
+    w.u8(packBits<7>({ze.enabled, ze.enableStart, ze.enableEnd, ze.mirrorOnReturn,
+                      ze.randomTurnbackEnabled, ze.endPauseEnabled, ze.endPauseIsRandom}));
+    w.f32(ze.zoneMM);
+    w.u8(static_cast<uint8_t>(ze.speedEffect));
+    w.u8(static_cast<uint8_t>(ze.speedCurve));
+    w.f32(ze.speedIntensity);
+    w.u8(ze.turnbackChance);
+    w.f32(ze.endPauseDurationSec);
+    w.f32(ze.endPauseMinSec);
+    w.f32(ze.endPauseMaxSec);
+
+    w.u8(packBits<2>({line.vaetCyclePause.enabled, line.vaetCyclePause.isRandom}));
+    w.f32(line.vaetCyclePause.pauseDurationSec);
+    w.f32(line.vaetCyclePause.minPauseSec);
+    w.f32(line.vaetCyclePause.maxPauseSec);
+
+    // OSCILLATION
+    w.f32(line.oscCenterPositionMM);
+    w.f32(line.oscAmplitudeMM);
+    w.u8(static_cast<uint8_t>(line.oscWaveform));
+    w.f32(line.oscFrequencyHz);
+    w.u8(packBits<2>({line.oscEnableRampIn, line.oscEnableRampOut}));
+    w.f32(line.oscRampInDurationMs);
+    w.f32(line.oscRampOutDurationMs);
+
+    w.u8(packBits<2>({line.oscCyclePause.enabled, line.oscCyclePause.isRandom}));
+    w.f32(line.oscCyclePause.pauseDurationSec);
+    w.f32(line.oscCyclePause.minPauseSec);
+    w.f32(line.oscCyclePause.maxPauseSec);
+
+    // CHAOS
+    w.f32(line.chaosCenterPositionMM);
+    w.f32(line.chaosAmplitudeMM);
+    w.f32(line.chaosMaxSpeedLevel);
+    w.f32(line.chaosCrazinessPercent);
+    w.u32(static_cast<uint32_t>(line.chaosDurationSeconds));
+    w.u32(static_cast<uint32_t>(line.chaosSeed));
+    uint16_t patterns = 0;
+    for (size_t idx = 0; idx < line.chaosPatternsEnabled.size(); ++idx) {
+        patterns |= static_cast<uint16_t>(line.chaosPatternsEnabled[idx]) << idx;
+    }
+    w.u16(patterns);
+
+    return w.size();
+}
+
+/** Decode a line record over defaults (see compatibility note above) */
+inline SequenceLine decodeLine(const uint8_t* data, size_t length) {
+    SequenceLine line;
+    Reader r(data, length);
+
+    uint8_t enabled = line.enabled ? 1 : 0;
+    r.i32(line.lineId);
+    r.u8(enabled);
+    line.enabled = enabled != 0;
+    r.e8(line.movementType);
+    r.e8(line.op);
+    if (line.op > SequenceOp::SEQ_OP_END) line.op = SequenceOp::SEQ_OP_MOVE;
+    r.i32(line.opArg);
+    r.i32(line.cycleCount);
+    r.i32(line.pauseAfterMs);
+
+    r.f32(line.startPositionMM);
+    r.f32(line.distanceMM);
+    r.f32(line.speedForward);
+    r.f32(line.speedBackward);
+
+    ZoneEffectConfig& ze = line.vaetZoneEffect;
+    r.bits<7>({&ze.enabled, &ze.enableStart, &ze.enableEnd, &ze.mirrorOnReturn,
+               &ze.randomTurnbackEnabled, &ze.endPauseEnabled, &ze.endPauseIsRandom});
+    r.f32(ze.zoneMM);
+    r.e8(ze.speedEffect);
+    r.e8(ze.speedCurve);
+    r.f32(ze.speedIntensity);
+    r.u8(ze.turnbackChance);
+    r.f32(ze.endPauseDurationSec);
+    r.f32(ze.endPauseMinSec);
+    r.f32(ze.endPauseMaxSec);
+
+    r.bits<2>({&line.vaetCyclePause.enabled, &line.vaetCyclePause.isRandom});
+    r.f32(line.vaetCyclePause.pauseDurationSec);
+    r.f32(line.vaetCyclePause.minPauseSec);
+    r.f32(line.vaetCyclePause.maxPauseSec);
+
+    r.f32(line.oscCenterPositionMM);
+    r.f32(line.oscAmplitudeMM);
+    r.e8(line.oscWaveform);
+    r.f32(line.oscFrequencyHz);
+    r.bits<2>({&line.oscEnableRampIn, &line.oscEnableRampOut});
+    r.f32(line.oscRampInDurationMs);
+    r.f32(line.oscRampOutDurationMs);
+
+    r.bits<2>({&line.oscCyclePause.enabled, &line.oscCyclePause.isRandom});
+    r.f32(line.oscCyclePause.pauseDurationSec);
+    r.f32(line.oscCyclePause.minPauseSec);
+    r.f32(line.oscCyclePause.maxPauseSec);
+
+    r.f32(line.chaosCenterPositionMM);
+    r.f32(line.chaosAmplitudeMM);
+    r.f32(line.chaosMaxSpeedLevel);
+    r.f32(line.chaosCrazinessPercent);
+    auto duration = static_cast<uint32_t>(line.chaosDurationSeconds);
+    auto seed = static_cast<uint32_t>(line.chaosSeed);
+    r.u32(duration);
+    r.u32(seed);
+    line.chaosDurationSeconds = duration;
+    line.chaosSeed = seed;
+    if (r.left() >= 2) {
+        uint16_t patterns = 0;
+        r.u16(patterns);
+        for (size_t idx = 0; idx < line.chaosPatternsEnabled.size(); ++idx) {
+            line.chaosPatternsEnabled[idx] = (patterns >> idx) & 1;
+        }
+    }
+
+    return line;
+}
+
+// ============================================================================
+// STREAM DECODER
+// ============================================================================
+
+/**
+ * Splits a byte stream into records, whatever the chunk boundaries.
+ * A record that arrives whole in one chunk is handed over in place;
+ * only records cut by a chunk boundary are copied into the buffer.
+ */
+class RecordReader {
+public:
+    enum class Status : uint8_t {
+        OK,
+        BAD_MAGIC,
+        BAD_VERSION,
+        RECORD_TOO_LARGE,
+        REJECTED            // onRecord returned false
+    };
+
+    void reset() {
+        m_state = State::PREAMBLE;
+        m_status = Status::OK;
+        m_filled = 0;
+        m_expected = PREAMBLE_SIZE;
+        m_records = 0;
+    }
+
+    /**
+     * Consume a chunk
+     * @param onRecord (const uint8_t* data, size_t length, uint32_t index) → bool, false stops decoding
+     * @return decoder status (sticky once not OK)
+     */
+    template <typename OnRecord>
+    Status feed(const uint8_t* data, size_t length, OnRecord onRecord) {
+        while (length > 0 && m_status == Status::OK) {
+            // Whole record in the chunk: no copy
+            if (m_state == State::PAYLOAD && m_filled == 0 && length >= m_expected) {
+                finishRecord(data, onRecord);
+                data += m_expected;
+                length -= m_expected;
+                expectLength();
+                continue;
+            }
+
+            size_t take = m_expected - m_filled;
+            if (take > length) take = length;
+            memcpy(m_buffer.data() + m_filled, data, take);
+            m_filled += take;
+            data += take;
+            length -= take;
+            if (m_filled < m_expected) break;
+
+            switch (m_state) {
+                case State::PREAMBLE:
+                    if (memcmp(m_buffer.data(), MAGIC.data(), MAGIC.size()) != 0) {
+                        m_status = Status::BAD_MAGIC;
+                    } else if (m_buffer[MAGIC.size()] != VERSION) {
+                        m_status = Status::BAD_VERSION;
+                    }
+                    expectLength();
+                    break;
+
+                case State::LENGTH: {
+                    auto recordLength = static_cast<uint16_t>(m_buffer[0] | (m_buffer[1] << 8));
+                    if (recordLength > MAX_RECORD) {
+                        m_status = Status::RECORD_TOO_LARGE;
+                    } else if (recordLength == 0) {
+                        finishRecord(m_buffer.data(), onRecord, 0);
+                        expectLength();
+                    } else {
+                        m_state = State::PAYLOAD;
+                        m_expected = recordLength;
+                        m_filled = 0;
+                    }
+                    break;
+                }
+
+                case State::PAYLOAD:
+                    finishRecord(m_buffer.data(), onRecord);
+                    expectLength();
+                    break;
+            }
+        }
+        return m_status;
+    }
+
+    [[nodiscard]] Status status() const { return m_status; }
+
+    /** Records handed over so far (header included) */
+    [[nodiscard]] uint32_t records() const { return m_records; }
+
+    /** True between records: the stream so far holds no partial record */
+    [[nodiscard]] bool atRecordBoundary() const { return m_state == State::LENGTH && m_filled == 0; }
+
+private:
+    enum class State : uint8_t { PREAMBLE, LENGTH, PAYLOAD };
+
+    void expectLength() {
+        m_state = State::LENGTH;
+        m_expected = LENGTH_SIZE;
+        m_filled = 0;
+    }
+
+    template <typename OnRecord>
+    void finishRecord(const uint8_t* data, OnRecord& onRecord) {
+        finishRecord(data, onRecord, m_expected);
+    }
+
+    template <typename OnRecord>
+    void finishRecord(const uint8_t* data, OnRecord& onRecord, size_t length) {
+        if (!onRecord(data, length, m_records)) m_status = Status::REJECTED;
+        ++m_records;
+    }
+
+    std::array<uint8_t, MAX_RECORD> m_buffer{};
+    State m_state = State::PREAMBLE;
+    Status m_status = Status::OK;
+    size_t m_filled = 0;
+    size_t m_expected = PREAMBLE_SIZE;
+    uint32_t m_records = 0;
+};
+
+}  // namespace SequenceBinary
@@ -5,6 +5,14 @@
  *
  * Manages the execution of sequence tables: starting, stopping, pausing,
  * advancing through lines, and coordinating with movement controllers.
+ *
+ * Look-ahead: while a line runs, the next one is compiled (PreparedLine:
+ * clamped entry position, speeds, step delays, transition speed), so the
+ * line change only copies ready state and moves on the same motor tick.
+ *
+ * Control flow: the table's control lines (REPEAT, CALL, RANDOM, WAIT...)
+ * are compiled into a SequenceProgram at start and after each table edit;
+ * the line change asks it for the next line to run.
  */
 
 #ifndef SEQUENCE_EXECUTOR_H
@@ -17,6 +25,7 @@
 #include "core/Config.h"
 #include "core/UtilityEngine.h"
 #include "core/GlobalState.h"
+#include "movement/SequenceProgram.h"
 
 // ============================================================================
 // FORWARD DECLARATIONS
@@ -41,6 +50,7 @@ public:
 
     /**
      * Initialize the executor with WebSocket reference
+     * (call after SeqTable.begin(): program storage follows the table's capacity)
      * @param ws Pointer to WebSocketsServer for status broadcasting
      */
     void begin(AsyncWebSocket* ws);
@@ -85,7 +95,7 @@ public:
     // ========================================================================
 
     /**
-     * Send sequence status via WebSocket
+     * Send sequence status via WebSocket (networkTask, on StatusEvent::SEQUENCE)
      */
     void sendStatus();
 
@@ -109,14 +119,50 @@ public:
      */
     void onMovementComplete();
 
+    // ========================================================================
+    // POSITIONING MOVE (non-blocking, ticked from motorTask)
+    // ========================================================================
+
+    /** What resumes when a positioning move ends */
+    enum class PositioningPurpose : uint8_t {
+        NEXT_LINE,      // Start current sequence line
+        SEQUENCE_END,   // Finish single-play cleanup after auto-return
+        CHAOS_CENTER    // Continue Chaos.start() at center
+    };
+
+    enum class PositioningResult : uint8_t {
+        REACHED,
+        TIMEOUT,
+        ABORTED
+    };
+
     /**
-     * Blocking move to a specific step position.
-     * Sets/clears blockingMoveInProgress flag. Broadcasts status every 250 ms.
+     * Arm a positioning move (POSITIONING_STEP_DELAY_MICROS by default).
+     * Sets blockingMoveInProgress until the move ends. The continuation
+     * selected by purpose runs on Core 1 when the move ends.
      * @param targetStepPos Target step position to reach
-     * @param timeoutMs Maximum time allowed for the move (default 30s)
-     * @return true if position reached, false if timeout
+     * @param purpose Continuation to run on completion
+     * @param timeoutMs Maximum time allowed for the move
+     * @param stepDelayMicros Cruise step interval (governed)
+     */
+    void beginPositioningMove(long targetStepPos, PositioningPurpose purpose,
+                              unsigned long timeoutMs = POSITIONING_MOVE_TIMEOUT_MS,
+                              unsigned long stepDelayMicros = POSITIONING_STEP_DELAY_MICROS);
+
+    /**
+     * Advance the positioning move by at most one step (motorTask, Core 1)
      */
-    [[nodiscard]] bool blockingMoveToStep(long targetStepPos, unsigned long timeoutMs = 30000);
+    void processPositioningMove();
+
+    /**
+     * Abort the positioning move (takes effect on the next tick)
+     */
+    void abortPositioningMove();
+
+    /**
+     * Check if a positioning move is in progress
+     */
+    bool isPositioning() const { return _positioning.active; }
 
 private:
     SequenceExecutor() = default;
@@ -126,14 +172,88 @@ private:
     AsyncWebSocket* _webSocket = nullptr;
     unsigned long _lastPauseStatusSend = 0;  // Rate-limit status during line pauses
 
+    struct PositioningMove {
+        volatile bool active = false;          // Set last when armed (may be armed from Core 0)
+        volatile bool abortRequested = false;
+        bool forward = true;
+        PositioningPurpose purpose = PositioningPurpose::NEXT_LINE;
+        long targetStep = 0;
+        long fromStep = 0;
+        unsigned long startMs = 0;
+        unsigned long timeoutMs = 0;
+        unsigned long stepDelayMicros = POSITIONING_STEP_DELAY_MICROS;
+        unsigned long lastStepMicros = 0;
+    };
+    PositioningMove _positioning;
+
+    /** A sequence line compiled ahead of its start (Core 1 only) */
+    struct PreparedLine {
+        bool valid = false;
+        int lineIndex = -1;
+        uint32_t tableRevision = 0;      // sequenceTableRevision when compiled
+        bool needsPositioning = false;   // VAET / OSC / CHAOS move to an entry point first
+        long entryStep = 0;              // Start / centre position, clamped to limits
+        unsigned long transitionDelayMicros = POSITIONING_STEP_DELAY_MICROS;
+        float speedForward = 1.0f;       // VAET speed levels, clamped
+        float speedBackward = 1.0f;
+        uint32_t stepIntervalForward = 0;   // StepScheduler Q24.8 µs
+        uint32_t stepIntervalBackward = 0;
+    };
+    PreparedLine _currentLine;  // Line being started / running
+    PreparedLine _nextLine;     // Look-ahead, promoted on the line change
+
+    SequenceProgram _program;             // Control flow of the table
+    uint32_t _programRevision = 0;        // sequenceTableRevision when compiled
+    SequenceProgram::Cursor _cursor;      // Open REPEAT blocks / CALL returns
+
+    // ========================================================================
+    // CONTROL FLOW
+    // ========================================================================
+
+    /** Compile the table's control flow (error sent on failure) */
+    bool compileProgram();
+
+    /** Recompile if the table was edited since; false if it no longer compiles */
+    bool refreshProgram();
+
+    /**
+     * Line that runs after the current one (END / FAULT as SequenceProgram::resolve)
+     * @param usedRandom set if a RANDOM choice was drawn on the way
+     * @param wrapped    set if loop mode restarted the table
+     */
+    int16_t resolveNextLine(SequenceProgram::Cursor& cursor, bool& usedRandom, bool& wrapped) const;
+
+    /**
+     * Make position the current line; a WAIT line starts its wait
+     * @return true if a movement line should start now
+     */
+    bool enterLine(int16_t position);
+
+    // ========================================================================
+    // LOOK-AHEAD
+    // ========================================================================
+
+    /** Index of the line that runs after the current one, -1 if the sequence ends */
+    int peekNextLineIndex() const;
+
+    /** Compiled for lineIndex against the current table contents */
+    static bool isFresh(const PreparedLine& prepared, int lineIndex);
+
+    /** Compile SeqTable.lineAt(lineIndex) (limits, speeds, delays, entry point) */
+    void compileLine(int lineIndex, PreparedLine& out) const;
+
+    /** Compiled state for lineIndex: look-ahead hit, or compiled now (first line, table edited) */
+    const PreparedLine& preparedLine(int lineIndex);
+
     // ========================================================================
     // INTERNAL HELPERS
     // ========================================================================
 
     /**
      * Position motor for next sequence line
+     * @return true if a positioning move was armed (line starts on arrival)
      */
-    void positionForNextLine();
+    bool positionForNextLine();
 
     /**
      * Complete sequence execution (cleanup, optional return to start)
@@ -141,16 +261,25 @@ private:
      */
     void completeSequence(bool autoReturnToStart);
 
+    /** Final cleanup once the sequence is complete (after optional auto-return) */
+    void finishSequenceCleanup();
+
+    /** End the positioning move and run its continuation */
+    void finishPositioningMove(PositioningResult result);
+
+    /** Start the movement for the current line (after optional positioning) */
+    void startCurrentLine();
+
     /**
-     * Check and handle sequence end logic
-     * @return true if sequence continues, false if ended
+     * Advance to the next line (control flow, loop restart or sequence end)
+     * @return true if the new line should start now, false if ended or waiting
      */
     bool checkAndHandleSequenceEnd();
 
     /**
      * Start VA-ET-VIENT movement for current line
      */
-    void startVaEtVientLine(const SequenceLine* line);
+    void startVaEtVientLine(const SequenceLine* line, const PreparedLine& prepared);
 
     /**
      * Start OSCILLATION movement for current line
@@ -0,0 +1,101 @@
+// ============================================================================
+// SEQUENCE_ID_INDEX.H - lineId → storage slot map for SequenceTableManager
+// ============================================================================
+// Open addressing with linear probing over caller-provided buckets (the
+// table's PSRAM arena): no allocation, O(1) average lookup by lineId.
+// Erase uses backward-shift deletion, so there are no tombstones and
+// lookups stay short after any number of edits.
+//
+// Bucket count must be a power of two and larger than the number of
+// entries (SequenceTableManager uses 2x its line capacity).
+// ============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class SequenceIdIndex {
+public:
+    static constexpr uint16_t NOT_FOUND = 0xFFFF;
+
+    /** Bind to bucket storage (keys + slots, bucketCount entries each) and empty it */
+    void attach(int32_t* keys, uint16_t* slots, uint32_t bucketCount) {
+        m_keys = keys;
+        m_slots = slots;
+        m_mask = bucketCount - 1;
+        clear();
+    }
+
+    void clear() {
+        if (m_keys == nullptr) return;
+        for (uint32_t idx = 0; idx <= m_mask; ++idx) m_keys[idx] = EMPTY;
+        m_size = 0;
+    }
+
+    [[nodiscard]] uint32_t size() const { return m_size; }
+
+    /** Slot stored for lineId, NOT_FOUND if absent */
+    [[nodiscard]] uint16_t find(int32_t lineId) const {
+        if (m_keys == nullptr || lineId <= 0) return NOT_FOUND;
+        for (uint32_t idx = bucket(lineId);; idx = (idx + 1) & m_mask) {
+            if (m_keys[idx] == lineId) return m_slots[idx];
+            if (m_keys[idx] == EMPTY) return NOT_FOUND;
+        }
+    }
+
+    /**
+     * Map lineId → slot
+     * @return false if lineId <= 0, already present, or no free bucket
+     */
+    bool insert(int32_t lineId, uint16_t slot) {
+        if (m_keys == nullptr || lineId <= 0 || m_size >= m_mask) return false;
+        uint32_t idx = bucket(lineId);
+        for (; m_keys[idx] != EMPTY; idx = (idx + 1) & m_mask) {
+            if (m_keys[idx] == lineId) return false;
+        }
+        m_keys[idx] = lineId;
+        m_slots[idx] = slot;
+        ++m_size;
+        return true;
+    }
+
+    /** Remove lineId, @return false if absent */
+    bool erase(int32_t lineId) {
+        if (m_keys == nullptr || lineId <= 0) return false;
+        uint32_t hole = bucket(lineId);
+        for (; m_keys[hole] != lineId; hole = (hole + 1) & m_mask) {
+            if (m_keys[hole] == EMPTY) return false;
+        }
+
+        // Backward shift: pull later entries of the probe run into the hole
+        // unless their home bucket lies cyclically in (hole, next]
+        for (uint32_t next = (hole + 1) & m_mask; m_keys[next] != EMPTY; next = (next + 1) & m_mask) {
+            uint32_t home = bucket(m_keys[next]);
+            bool staysPut = (hole <= next) ? (hole < home && home <= next)
+                                           : (hole < home || home <= next);
+            if (!staysPut) {
+                m_keys[hole] = m_keys[next];
+                m_slots[hole] = m_slots[next];
+                hole = next;
+            }
+        }
+        m_keys[hole] = EMPTY;
+        --m_size;
+        return true;
+    }
+
+private:
+    static constexpr int32_t EMPTY = 0;  // lineIds start at 1
+
+    /** Fibonacci hashing: sequential IDs spread over the whole table */
+    [[nodiscard]] uint32_t bucket(int32_t lineId) const {
+        uint32_t hash = static_cast<uint32_t>(lineId) * 2654435769u;
+        return (hash ^ (hash >> 16)) & m_mask;
+    }
+
+    int32_t* m_keys = nullptr;
+    uint16_t* m_slots = nullptr;
+    uint32_t m_mask = 0;
+    uint32_t m_size = 0;
+};
@@ -0,0 +1,277 @@
+// ============================================================================
+// SEQUENCE_PROGRAM.H - Control flow of a sequence table, compiled once
+// ============================================================================
+// SequenceExecutor runs a table whose lines are movements (SEQ_OP_MOVE) or
+// control instructions (REPEAT ... END_REPEAT, CALL / RETURN, RANDOM, WAIT,
+// END - see SequenceOp). compile() turns the table into one small
+// instruction per line with every jump resolved:
+// - next:   fall-through successor (disabled lines skipped, choice groups
+//           jump to their end)
+// - target: REPEAT <-> END_REPEAT partner, CALL entry, RANDOM first member
+// so a line change is a few array reads, whatever the table looks like.
+//
+// resolve() interprets control instructions from a position until the next
+// line that takes time (MOVE or WAIT), using a small frame stack (Cursor)
+// for open REPEAT blocks and CALL return points.
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "core/Config.h"
+#include "core/Types.h"
+
+class SequenceProgram {
+public:
+    static constexpr int16_t END = -1;    // End of pass
+    static constexpr int16_t FAULT = -2;  // Nesting overflow or control loop without movement
+
+    enum class Error : uint8_t {
+        NONE,
+        NO_ACTIVE_LINE,
+        UNMATCHED_REPEAT,
+        UNMATCHED_END_REPEAT,
+        NESTING_TOO_DEEP,
+        CALL_TARGET_MISSING,
+        BAD_CHOICE            // RANDOM past the table end, empty, or holding a block / jump
+    };
+
+    struct Instr {
+        SequenceOp op = SequenceOp::SEQ_OP_MOVE;
+        bool enabled = false;
+        int16_t next = END;
+        int16_t target = END;
+        int32_t arg = 0;      // REPEAT: count | RANDOM: enabled members | WAIT: ms
+    };
+
+    /** Interpreter state: open REPEAT blocks and CALL return points */
+    struct Cursor {
+        struct Frame {
+            int16_t index = END;     // REPEAT: its position | CALL: position to resume at
+            int16_t remaining = 0;   // REPEAT: passes left | CALL: CALL_FRAME
+        };
+        std::array<Frame, SEQUENCE_MAX_NESTING> frames{};
+        uint8_t depth = 0;
+    };
+
+    /** Bind to instruction storage (one per table line) */
+    void attach(Instr* code, uint16_t capacity) {
+        m_code = code;
+        m_capacity = capacity;
+        m_count = 0;
+        m_entry = END;
+    }
+
+    [[nodiscard]] int16_t entry() const { return m_entry; }
+    [[nodiscard]] const Instr& at(int16_t position) const { return m_code[position]; }
+
+    /** Table position the last compile() error refers to */
+    [[nodiscard]] int16_t errorPosition() const { return m_errorPosition; }
+
+    /**
+     * Compile count lines
+     * @param lineAt     position → const SequenceLine&
+     * @param positionOf lineId → position, -1 if absent
+     */
+    template <typename LineAt, typename PositionOf>
+    Error compile(int count, LineAt lineAt, PositionOf positionOf) {
+        using enum SequenceOp;
+        m_count = 0;
+        m_entry = END;
+        m_errorPosition = END;
+        if (m_code == nullptr || count > m_capacity) return fail(Error::NO_ACTIVE_LINE, END);
+
+        // Pass 1 (backward): copy opcodes, next = following enabled line
+        int16_t following = END;
+        for (int pos = count - 1; pos >= 0; --pos) {
+            const SequenceLine& line = lineAt(pos);
+            Instr& instr = m_code[pos];
+            instr.op = line.op;
+            instr.enabled = line.enabled;
+            instr.arg = line.opArg;
+            instr.next = following;
+            instr.target = END;
+            if (line.enabled) following = static_cast<int16_t>(pos);
+        }
+        m_count = static_cast<uint16_t>(count);
+        if (following == END) return fail(Error::NO_ACTIVE_LINE, END);
+
+        // Pass 2 (forward): pair blocks, resolve calls and choice groups
+        std::array<int16_t, SEQUENCE_MAX_NESTING> open{};
+        uint8_t openCount = 0;
+        for (int16_t pos = 0; pos < count; ++pos) {
+            Instr& instr = m_code[pos];
+            if (!instr.enabled) continue;
+
+            switch (instr.op) {
+                case SEQ_OP_REPEAT:
+                    if (openCount == open.size()) return fail(Error::NESTING_TOO_DEEP, pos);
+                    if (instr.arg > MAX_CYCLES_PER_LINE) instr.arg = MAX_CYCLES_PER_LINE;  // Frame counter is int16
+                    open[openCount++] = pos;
+                    break;
+
+                case SEQ_OP_END_REPEAT:
+                    if (openCount == 0) return fail(Error::UNMATCHED_END_REPEAT, pos);
+                    instr.target = open[--openCount];
+                    m_code[instr.target].target = pos;
+                    break;
+
+                case SEQ_OP_CALL: {
+                    int target = positionOf(instr.arg);
+                    if (target < 0 || target >= count) return fail(Error::CALL_TARGET_MISSING, pos);
+                    instr.target = enabledAtOrAfter(static_cast<int16_t>(target));
+                    break;
+                }
+
+                case SEQ_OP_RANDOM:
+                    if (!compileChoice(pos, count)) return fail(Error::BAD_CHOICE, pos);
+                    break;
+
+                default:
+                    break;
+            }
+        }
+        if (openCount > 0) return fail(Error::UNMATCHED_REPEAT, open[openCount - 1]);
+
+        m_entry = following;
+        return Error::NONE;
+    }
+
+    /**
+     * Walk control instructions from position to the next MOVE or WAIT line
+     * @param pick n → [0, n), draws RANDOM choices
+     * @return that line's position, END when the pass is over, FAULT on error
+     */
+    template <typename Pick>
+    int16_t resolve(int16_t position, Cursor& cursor, Pick pick) const {
+        using enum SequenceOp;
+        for (uint16_t budget = SEQUENCE_MAX_CONTROL_STEPS; budget > 0; --budget) {
+            if (position == END) {
+                // Table end inside a subroutine returns from it
+                if (!popCall(cursor, position)) return END;
+                continue;
+            }
+
+            const Instr& instr = m_code[position];
+            switch (instr.op) {
+                case SEQ_OP_REPEAT:
+                    if (instr.arg <= 0) {
+                        position = m_code[instr.target].next;  // Zero passes: skip the block
+                    } else if (!push(cursor, position, static_cast<int16_t>(instr.arg - 1))) {
+                        return FAULT;
+                    } else {
+                        position = instr.next;
+                    }
+                    break;
+
+                case SEQ_OP_END_REPEAT:
+                    if (cursor.depth > 0 && cursor.frames[cursor.depth - 1].index == instr.target &&
+                        cursor.frames[cursor.depth - 1].remaining != CALL_FRAME) {
+                        auto& frame = cursor.frames[cursor.depth - 1];
+                        if (frame.remaining > 0) {
+                            --frame.remaining;
+                            position = m_code[instr.target].next;  // Next pass
+                            break;
+                        }
+                        --cursor.depth;
+                    }
+                    position = instr.next;  // Done (or entered the block by a CALL)
+                    break;
+
+                case SEQ_OP_CALL:
+                    if (!push(cursor, instr.next, CALL_FRAME)) return FAULT;
+                    position = instr.target;
+                    break;
+
+                case SEQ_OP_RETURN:
+                    if (!popCall(cursor, position)) return END;  // RETURN outside a call ends the pass
+                    break;
+
+                case SEQ_OP_RANDOM:
+                    position = choiceMember(instr, static_cast<int32_t>(pick(instr.arg)));
+                    break;
+
+                case SEQ_OP_END:
+                    return END;
+
+                default:
+                    return position;  // MOVE / WAIT
+            }
+        }
+        return FAULT;
+    }
+
+private:
+    static constexpr int16_t CALL_FRAME = -1;
+
+    Error fail(Error error, int16_t position) {
+        m_errorPosition = position;
+        m_entry = END;
+        return error;
+    }
+
+    /** position itself if enabled, else the next enabled line (END if none) */
+    [[nodiscard]] int16_t enabledAtOrAfter(int16_t position) const {
+        return m_code[position].enabled ? position : m_code[position].next;
+    }
+
+    /** RANDOM at pos over the next arg lines: members then continue at the group end */
+    bool compileChoice(int16_t pos, int count) {
+        Instr& instr = m_code[pos];
+        if (instr.arg <= 0 || pos + instr.arg >= count) return false;
+
+        auto last = static_cast<int16_t>(pos + instr.arg);
+        int16_t groupEnd = m_code[last].next;
+        int32_t members = 0;
+        instr.target = END;
+        for (int16_t member = pos + 1; member <= last; ++member) {
+            Instr& candidate = m_code[member];
+            if (!candidate.enabled) continue;
+            if (candidate.op != SequenceOp::SEQ_OP_MOVE && candidate.op != SequenceOp::SEQ_OP_WAIT &&
+                candidate.op != SequenceOp::SEQ_OP_CALL) {
+                return false;  // A block or jump inside a group would be cut in half
+            }
+            if (instr.target == END) instr.target = member;
+            candidate.next = groupEnd;
+            ++members;
+        }
+        instr.arg = members;
+        return members > 0;
+    }
+
+    /** Enabled member index of a compiled RANDOM (clamped) */
+    [[nodiscard]] int16_t choiceMember(const Instr& choice, int32_t index) const {
+        if (index < 0 || index >= choice.arg) index = 0;
+        int16_t member = choice.target;
+        for (; index > 0; ++member) {
+            if (m_code[member + 1].enabled) --index;
+        }
+        return member;
+    }
+
+    static bool push(Cursor& cursor, int16_t index, int16_t remaining) {
+        if (cursor.depth >= cursor.frames.size()) return false;
+        cursor.frames[cursor.depth++] = {index, remaining};
+        return true;
+    }
+
+    /** Unwind to the innermost CALL (dropping blocks opened inside it) */
+    static bool popCall(Cursor& cursor, int16_t& position) {
+        while (cursor.depth > 0) {
+            const auto& frame = cursor.frames[--cursor.depth];
+            if (frame.remaining == CALL_FRAME) {
+                position = frame.index;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Instr* m_code = nullptr;
+    uint16_t m_capacity = 0;
+    uint16_t m_count = 0;
+    int16_t m_entry = END;
+    int16_t m_errorPosition = END;
+};
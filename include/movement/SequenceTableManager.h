@@ -7,11 +7,17 @@
  * Features:
  * - Add/Delete/Update sequence lines
  * - Move/Toggle/Duplicate lines
- * - Physics validation (distance limits)
- * - JSON import/export
+ * - Physics validation (distance limits), control line arguments
+ * - JSON import/export, compact binary import/export (SequenceBinary.h)
+ * - Named sequences on LittleFS (SEQUENCE_DIR, loaded on demand)
  * - WebSocket broadcasting
  *
- * Note: Execution logic remains in main (processSequenceExecution)
+ * Storage (allocated once in begin(), PSRAM preferred):
+ * - slot pool:  SequenceLine records, never moved once stored
+ * - play order: position → slot (reorder/delete shift 2-byte indices)
+ * - id index:   lineId → slot (SequenceIdIndex)
+ *
+ * Note: Execution logic lives in SequenceExecutor (reads lineAt()/count())
  */
 
 #ifndef SEQUENCE_TABLE_MANAGER_H
@@ -19,9 +25,12 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <atomic>
 #include "core/Types.h"
 #include "core/Config.h"
 #include "core/UtilityEngine.h"
+#include "movement/SequenceBinary.h"
+#include "movement/SequenceIdIndex.h"
 
 // ============================================================================
 // CONSTANTS
@@ -41,6 +50,11 @@ public:
     return instance;
   }
 
+  /**
+   * Allocate line storage (PSRAM preferred) - call once in setup()
+   */
+  void begin();
+
   // ========================================================================
   // CRUD OPERATIONS
   // ========================================================================
@@ -109,6 +123,7 @@ public:
 
   /**
    * Validate sequence line against physical constraints
+   * (control lines: their argument - repeat count, call target, wait...)
    * @param line Line to validate
    * @return error message if invalid, empty string if valid
    */
@@ -132,11 +147,82 @@ public:
   String exportToJson();
 
   /**
-   * Import sequence from JSON string
-   * @param jsonData JSON string
+   * Import sequence from JSON text (parsed in place, not copied)
+   * @param json JSON text
+   * @param length Text length in bytes
    * @return number of lines imported, -1 if error
    */
-  int importFromJson(String jsonData);
+  int importFromJson(const char* json, size_t length);
+
+  /** Stream the export document, one line object at a time */
+  void writeTable(Print& out) const;
+
+  // ========================================================================
+  // BINARY OPERATIONS (SequenceBinary format)
+  // ========================================================================
+
+  /** Size in bytes of the binary export of the current table */
+  [[nodiscard]] size_t binarySize() const;
+
+  /**
+   * Copy bytes [offset, offset + maxLen) of the binary export, encoding only
+   * the records they cover (serves a download without building the file)
+   * @return bytes copied, 0 past the end
+   */
+  size_t readBinary(uint8_t* out, size_t maxLen, size_t offset) const;
+
+  /**
+   * Start a chunked binary import (one upload at a time, refused while the
+   * sequence runs) - clears the table
+   * @param owner Upload identity (HTTP request)
+   * @return false if refused (error sent)
+   */
+  bool beginBinaryImport(const void* owner);
+
+  /**
+   * Decode the next chunk of the upload, any size
+   * @return false once the upload has failed (error sent)
+   */
+  bool feedBinaryImport(const void* owner, const uint8_t* data, size_t length);
+
+  /**
+   * Finish the upload
+   * @return number of lines imported, -1 if invalid or incomplete
+   */
+  int endBinaryImport(const void* owner);
+
+  /** Drop an unfinished upload (client disconnected) */
+  void abortBinaryImport(const void* owner);
+
+  // ========================================================================
+  // NAMED SEQUENCES (LittleFS, streamed line by line)
+  // ========================================================================
+
+  /**
+   * Save the current table as SEQUENCE_DIR/<name>.json and make it active
+   * @return false on error (error sent)
+   */
+  bool saveNamed(const String& name);
+
+  /**
+   * Replace the current table with a saved sequence (refused while running)
+   * @return number of lines loaded, -1 on error (error sent)
+   */
+  int loadNamed(const String& name);
+
+  /**
+   * Delete a saved sequence
+   * @return false if not found (error sent)
+   */
+  bool deleteNamed(const String& name);
+
+  /**
+   * Saved sequences as a JSON array: [{"name", "size"}, ...]
+   */
+  String listNamedJson();
+
+  /** Name of the last saved/loaded sequence, empty if unsaved */
+  [[nodiscard]] const String& getActiveName() const { return m_activeName; }
 
   // ========================================================================
   // BROADCASTING
@@ -153,7 +239,7 @@ public:
   void sendJsonResponse(const char* type, const String& data);
 
   // ========================================================================
-  // DATA ACCESS (uses extern globals from main)
+  // DATA ACCESS
   // ========================================================================
 
   /**
@@ -163,6 +249,15 @@ public:
    */
   int findLineIndex(int lineId);
 
+  /** Number of lines in play order */
+  [[nodiscard]] int count() const { return m_count; }
+
+  /** Maximum number of lines (0 if storage allocation failed) */
+  [[nodiscard]] int capacity() const { return m_capacity; }
+
+  /** Line at play position (0 <= position < count()) */
+  [[nodiscard]] const SequenceLine& lineAt(int position) const { return m_lines[m_order[position]]; }
+
 private:
   // Singleton - prevent construction/copying
   SequenceTableManager();
@@ -170,6 +265,42 @@ private:
   SequenceTableManager& operator=(const SequenceTableManager&) = delete;
 
   // Uses global 'engine' pointer for logging (extern UtilityEngine* engine)
+
+  /** Store a line at the end of the play order (lineId must be unused) */
+  bool appendLine(const SequenceLine& line);
+
+  /** Drop all lines (storage kept) */
+  void clearLines();
+
+  /** Serialize one line (export format) */
+  void lineToJson(const SequenceLine& line, JsonObject obj) const;
+
+  /** Append an imported line, re-IDing it if its lineId is missing or taken */
+  bool importLine(SequenceLine line, int& maxLineId);
+
+  /** Handle one decoded record of a binary import */
+  bool importBinaryRecord(const uint8_t* data, size_t length, uint32_t index);
+
+  /** SEQUENCE_DIR/<name>.json, empty if name is invalid (error sent) */
+  String namedPath(const String& name) const;
+
+  // Storage - carved out of one arena allocated in begin()
+  SequenceLine* m_lines = nullptr;   // Slot pool
+  uint16_t* m_order = nullptr;       // Play order: position → slot
+  uint16_t* m_freeSlots = nullptr;   // Stack of unused slots
+  uint16_t m_freeCount = 0;
+  uint16_t m_count = 0;
+  uint16_t m_capacity = 0;
+  SequenceIdIndex m_ids;             // lineId → slot
+
+  String m_activeName;
+
+  // Binary import in progress (fed from the HTTP body callback)
+  SequenceBinary::RecordReader m_binaryReader;
+  const void* m_binaryOwner = nullptr;
+  uint16_t m_binaryLineCount = 0;    // From the header record
+  int m_binaryMaxLineId = 0;
+  bool m_binaryFailed = false;
 };
 
 // Global singleton instance
@@ -178,8 +309,7 @@ inline SequenceTableManager& SeqTable = SequenceTableManager::getInstance();
 // ============================================================================
 // SEQUENCE DATA - Owned by SequenceTableManager
 // ============================================================================
-// Defined in SequenceTableManager.cpp, accessible via extern:
-extern std::array<SequenceLine, MAX_SEQUENCE_LINES> sequenceTable;
-extern int sequenceLineCount;
+// Bumped by every table edit: lets the executor's look-ahead detect stale lines
+extern std::atomic<uint32_t> sequenceTableRevision;
 
 #endif // SEQUENCE_TABLE_MANAGER_H
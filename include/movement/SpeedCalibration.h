@@ -0,0 +1,65 @@
+// ============================================================================
+// SPEED_CALIBRATION.H - Rig-specific speed curve (SpeedTable owner)
+// ============================================================================
+// Holds the SpeedTable every mode reads its speed-level timing from: the
+// compile-time nominal table, or one built from a measured curve stored in
+// NVS. A new curve is built into the table not in use and published with one
+// index store, so Core 1 never reads a table being rebuilt.
+//
+// Not thread-safe for writers: only called from setup() and HTTP handlers.
+// ============================================================================
+
+#ifndef SPEED_CALIBRATION_H
+#define SPEED_CALIBRATION_H
+
+#include <Arduino.h>
+#include <array>
+#include <atomic>
+#include "core/SpeedTable.h"
+
+class SpeedCalibration {
+public:
+    static SpeedCalibration& getInstance();
+
+    /**
+     * Load the measured curve from NVS (nominal if none)
+     * Call in setup() after the UtilityEngine is ready
+     */
+    void init();
+
+    /** Table in use (any core) */
+    [[nodiscard]] const SpeedTable& table() const {
+        return m_tables[m_active.load(std::memory_order_acquire)];
+    }
+
+    /** Curve the table was built from (nominal if not calibrated) */
+    [[nodiscard]] const SpeedTable::Points& points() const { return m_points; }
+    [[nodiscard]] bool isCalibrated() const { return m_calibrated; }
+
+    /**
+     * Use and persist a measured curve
+     * @return false if points are not SpeedTable::isValid (nothing changed)
+     */
+    bool apply(const SpeedTable::Points& points);
+
+    /** Back to the nominal curve and forget the stored one */
+    void reset();
+
+private:
+    SpeedCalibration() = default;
+    SpeedCalibration(const SpeedCalibration&) = delete;
+    SpeedCalibration& operator=(const SpeedCalibration&) = delete;
+
+    /** Build points into the spare table and publish it */
+    void publish(const SpeedTable::Points& points);
+
+    std::array<SpeedTable, 2> m_tables{NOMINAL_SPEED_TABLE, NOMINAL_SPEED_TABLE};
+    std::atomic<uint8_t> m_active{0};
+    SpeedTable::Points m_points = SpeedTable::nominal();
+    bool m_calibrated = false;
+};
+
+// Global accessor (singleton reference)
+inline SpeedCalibration& Speeds = SpeedCalibration::getInstance();
+
+#endif // SPEED_CALIBRATION_H
@@ -0,0 +1,114 @@
+// ============================================================================
+// STEP_RATE_GOVERNOR.H - Adaptive step-rate / acceleration limiter
+// ============================================================================
+// Learns how fast THIS rig can be driven from HSS86 feedback:
+// - ALM rising edge or a move PEND never confirmed → back off (slower floor,
+//   gentler ramp) relative to the fastest rate seen in that move
+// - A streak of throttled moves PEND confirmed promptly → probe 5% faster
+//
+// Every controller passes its step delay through govern() right before the
+// timing check - oscillation catch-up included - so the learned limits apply
+// to all movement modes.
+//
+// One profile for the rig, not one per load: the firmware cannot tell which
+// load is mounted, so a load change is announced with resetGovernor
+// (requestReset()) and the profile is relearned from the hardware limits.
+// The profile is persisted in NVS (written from Core 0, rate-limited).
+// ============================================================================
+
+#ifndef STEP_RATE_GOVERNOR_H
+#define STEP_RATE_GOVERNOR_H
+
+#include <Arduino.h>
+#include <climits>
+#include "core/Config.h"
+
+class StepRateGovernor {
+public:
+    static StepRateGovernor& getInstance();
+
+    /**
+     * Load the learned profile from NVS
+     * Call in setup() after the UtilityEngine is ready
+     */
+    void init();
+
+    /**
+     * Clamp a requested step delay to the learned limits (Core 1, hot path)
+     * @param requestedDelayMicros Delay the controller wants before the next step
+     * @return Delay to actually wait (>= requested)
+     */
+    unsigned long govern(unsigned long requestedDelayMicros);
+
+    /**
+     * Observe pulses and PositionVerifier outcomes (call from motorTask loop)
+     */
+    void update();
+
+    /**
+     * HSS86 ALM went active (call on the rising edge only)
+     */
+    void onAlarm();
+
+    /**
+     * Write the profile to NVS if it changed (call from networkTask)
+     * Rate-limited by GOVERNOR_SAVE_INTERVAL_MS
+     */
+    void persistIfDirty();
+
+    /**
+     * Forget the learned profile (load changed) - applied on next update()
+     */
+    void requestReset() { m_resetRequested = true; }
+
+    // ========================================================================
+    // PROFILE (read from Core 0 for status)
+    // ========================================================================
+
+    [[nodiscard]] unsigned long getFloorMicros() const { return m_floorMicros; }
+    [[nodiscard]] float getAccel() const { return m_accel; }
+    [[nodiscard]] uint32_t getFaultCount() const { return m_faults; }
+    [[nodiscard]] bool isThrottling() const { return m_throttled; }
+
+private:
+    StepRateGovernor() = default;
+    StepRateGovernor(const StepRateGovernor&) = delete;
+    StepRateGovernor& operator=(const StepRateGovernor&) = delete;
+
+    /** Pulse bookkeeping: ramp position + fastest interval of the current move */
+    void observePulses();
+
+    /** Tighten limits after a fault in the current move */
+    void backOff(const char* reason);
+
+    /** Loosen limits after a clean throttled streak */
+    void relax();
+
+    // Learned profile (32-bit, single writer Core 1)
+    volatile unsigned long m_floorMicros = GOVERNOR_MIN_STEP_DELAY_US;
+    volatile float m_accel = GOVERNOR_MAX_ACCEL;
+
+    // Ramp tracking
+    uint32_t m_lastSteps = 0;
+    uint32_t m_rampSteps = 0;
+    unsigned long m_lastPulseMicros = 0;
+    bool m_lastDirection = true;
+    unsigned long m_fastestInterval = ULONG_MAX;  // Since last verified move
+
+    // Outcome tracking
+    uint32_t m_lastEvaluatedMoves = 0;
+    uint32_t m_lastUnverifiedMoves = 0;
+    uint16_t m_cleanMoves = 0;
+    volatile bool m_throttled = false;
+    uint32_t m_faults = 0;
+
+    // Persistence
+    volatile bool m_dirty = false;
+    volatile bool m_resetRequested = false;
+    unsigned long m_lastSaveMs = 0;
+};
+
+// Global accessor (singleton reference)
+inline StepRateGovernor& Governor = StepRateGovernor::getInstance();
+
+#endif // STEP_RATE_GOVERNOR_H
@@ -0,0 +1,157 @@
+// ============================================================================
+// TRAJECTORY_PLAYER.H - Keyframe trajectory playback (MOVEMENT_TRAJECTORY)
+// ============================================================================
+// Plays externally generated motion profiles without per-point network
+// latency: timestamped position keyframes (TrajectoryKeyframe, 8 bytes) are
+// buffered in a PSRAM ring and interpolated on the motor core.
+//
+// Sources (all Core 0, producer side):
+// - HTTP POST /api/trajectory      (binary body, replace or ?append=1)
+// - WebSocket binary frame         ('T' + keyframes, appended)
+// - LittleFS .trj file             (loadTrajectory command)
+//
+// Modes:
+// - one-shot: play buffer once, stop on last keyframe (buffer kept for replay)
+// - loop:     restart from the first keyframe (close the loop in the data)
+// - stream:   keyframes are released once played; the play clock never runs
+//             past the newest keyframe (underrun = hold, then resume)
+//
+// Single producer / single consumer ring: head written by Core 0 (under
+// m_writeMutex), tail + cursor by Core 1 only.
+// ============================================================================
+
+#ifndef TRAJECTORY_PLAYER_H
+#define TRAJECTORY_PLAYER_H
+
+#include <Arduino.h>
+#include <array>
+#include <atomic>
+#include "core/Types.h"
+#include "core/Config.h"
+
+class TrajectoryPlayer {
+public:
+    static TrajectoryPlayer& getInstance();
+
+    /**
+     * Allocate the keyframe ring (PSRAM preferred) - call once in setup()
+     */
+    void begin();
+
+    // ========================================================================
+    // LOADING (Core 0)
+    // ========================================================================
+
+    /**
+     * Empty the buffer (refused while playing)
+     * @return false if playing
+     */
+    bool clear();
+
+    /**
+     * Append raw keyframe bytes (records may straddle calls)
+     * Invalid keyframes (time going back, NaN) and overflow are counted and dropped
+     * @return Number of keyframes accepted
+     */
+    uint32_t append(const uint8_t* data, size_t len);
+
+    /**
+     * Replace the buffer with a LittleFS .trj file
+     * @param name File name (relative to TRAJECTORY_DIR) or absolute path
+     * @return false on error (error sent)
+     */
+    bool loadFile(const String& name);
+
+    // ========================================================================
+    // PLAYBACK
+    // ========================================================================
+
+    /**
+     * Arm playback (Core 0) - moves to the first keyframe, then starts the clock
+     * @return false on error (error sent)
+     */
+    bool start(bool loop, bool stream);
+
+    /**
+     * Stop playback (buffer kept)
+     */
+    void stop();
+
+    /**
+     * Advance the play clock and step toward the interpolated target (Core 1)
+     * Call on every motorTask tick while MOVEMENT_TRAJECTORY is active
+     */
+    void process();
+
+    // ========================================================================
+    // STATUS (Core 0)
+    // ========================================================================
+
+    [[nodiscard]] bool isPlaying() const { return m_playing; }
+    [[nodiscard]] bool isStreaming() const { return m_stream; }
+    [[nodiscard]] bool isLooping() const { return m_loop; }
+    [[nodiscard]] bool isStarved() const { return m_starved; }
+    [[nodiscard]] uint32_t getCount() const;
+    [[nodiscard]] uint32_t getCapacity() const { return m_capacity; }
+    [[nodiscard]] uint32_t getPlayMs() const { return m_playMs; }
+    [[nodiscard]] uint32_t getEndMs() const { return m_lastAppendTimeMs; }
+    [[nodiscard]] uint32_t getUnderruns() const { return m_underruns; }
+    [[nodiscard]] uint32_t getRejected() const { return m_rejected; }
+
+private:
+    TrajectoryPlayer() = default;
+    TrajectoryPlayer(const TrajectoryPlayer&) = delete;
+    TrajectoryPlayer& operator=(const TrajectoryPlayer&) = delete;
+
+    /** Ring slot for a free-running index */
+    [[nodiscard]] const TrajectoryKeyframe& frame(uint32_t index) const { return m_frames[index & m_mask]; }
+
+    /** Store one decoded keyframe (validation + overflow), caller holds m_writeMutex */
+    bool push(const TrajectoryKeyframe& keyframe);
+
+    /** One step toward targetStep if minDelayMicros elapsed (limits + contacts) */
+    void stepToward(long targetStep, unsigned long minDelayMicros, unsigned long nowMicros);
+
+    /** mm → step, clamped to the range captured at start() */
+    [[nodiscard]] long clampedStep(float positionMM) const;
+
+    /** Hard drift check near the physical contacts */
+    bool checkSafetyContacts(bool moveForward);
+
+    /** One-shot playback reached its last keyframe */
+    void finish();
+
+    // Ring storage
+    TrajectoryKeyframe* m_frames = nullptr;
+    uint32_t m_capacity = 0;
+    uint32_t m_mask = 0;
+    std::atomic<uint32_t> m_head{0};  // Next write (Core 0)
+    std::atomic<uint32_t> m_tail{0};  // Oldest kept (Core 1 in stream mode)
+
+    // Producer state (under m_writeMutex)
+    SemaphoreHandle_t m_writeMutex = nullptr;
+    std::array<uint8_t, sizeof(TrajectoryKeyframe)> m_carry{};
+    size_t m_carryLen = 0;
+    volatile uint32_t m_lastAppendTimeMs = 0;
+    volatile uint32_t m_rejected = 0;
+
+    // Playback (Core 1)
+    volatile bool m_playing = false;
+    volatile bool m_loop = false;
+    volatile bool m_stream = false;
+    volatile bool m_starved = false;
+    bool m_approaching = false;
+    uint32_t m_cursor = 0;                // Segment start (free-running index)
+    uint64_t m_playMicros = 0;            // Play clock, keyframe time base
+    volatile uint32_t m_playMs = 0;       // Same, for status
+    unsigned long m_lastTickMicros = 0;
+    unsigned long m_lastStepMicros = 0;
+    volatile uint32_t m_underruns = 0;
+    long m_minStep = 0;
+    long m_maxStep = 0;
+};
+
+// Global accessor (singleton reference)
+inline TrajectoryPlayer& Trajectory = TrajectoryPlayer::getInstance();
+
+#endif // TRAJECTORY_PLAYER_H
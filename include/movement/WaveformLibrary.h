@@ -0,0 +1,85 @@
+// ============================================================================
+// WAVEFORM_LIBRARY.H - Uploadable oscillation waveforms
+// ============================================================================
+// Layout under WAVEFORM_DIR:
+//   <name>.json   {"name","kind":"samples"|"spline","points":[v0, v1, ...]}
+//   .active       name of the selected waveform (restored at boot)
+//
+// Points are equally spaced over one period starting at phase 0, values
+// −1..+1 (see Waveform::bake). The selected waveform is baked into a PSRAM
+// table that OSC_CUSTOM plays through the normal phase accumulator, so a new
+// motion shape needs an upload, not a firmware build.
+//
+// Two tables: a selection bakes into the one not playing, then publishes it
+// with one pointer store, so Core 1 never reads a half-baked table.
+//
+// Not thread-safe for writers: only called from HTTP handlers (async_tcp).
+// ============================================================================
+
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <array>
+#include <atomic>
+#include "core/Config.h"
+#include "movement/WaveformTable.h"
+
+class WaveformLibrary {
+public:
+    static WaveformLibrary& getInstance();
+
+    enum class Result : uint8_t {
+        OK,
+        INVALID_NAME,    // Empty, too long or not [A-Za-z0-9_-]
+        INVALID_POINTS,  // Unknown kind, not an array of 2..WAVEFORM_MAX_POINTS numbers
+        NOT_FOUND,
+        FULL,            // WAVEFORM_MAX_COUNT reached
+        IO_ERROR
+    };
+
+    /** Allocate the tables and restore the selected waveform - call in setup() after LittleFS */
+    void begin();
+
+    [[nodiscard]] bool isReady() const { return m_ready; }
+
+    /** Table OSC_CUSTOM plays (any core), nullptr if none selected */
+    [[nodiscard]] const float* activeTable() const { return m_active.load(std::memory_order_acquire); }
+
+    /** Name of the selected waveform, empty if none */
+    [[nodiscard]] const String& activeName() const { return m_activeName; }
+
+    /** Validate, store (replacing a same-name waveform) and select */
+    Result save(JsonVariantConst waveform, String& outName);
+
+    /** Load a stored waveform into the playing table */
+    Result select(const char* name);
+
+    /** Delete a stored waveform (a selected one keeps playing until the next selection) */
+    Result remove(const char* name);
+
+    /** {"active": name, "waveforms": [names]} */
+    void writeList(JsonDocument& doc) const;
+
+    [[nodiscard]] static const char* resultMessage(Result result);
+
+private:
+    WaveformLibrary() = default;
+    WaveformLibrary(const WaveformLibrary&) = delete;
+    WaveformLibrary& operator=(const WaveformLibrary&) = delete;
+
+    static bool isValidName(const char* name);
+    static String pathFor(const char* name);
+
+    /** Check and bake waveform into the spare table (not yet published) */
+    Result bakeSpare(JsonVariantConst waveform);
+    void publishSpare(const char* name);
+
+    std::array<float*, 2> m_tables{};
+    std::atomic<const float*> m_active{nullptr};
+    String m_activeName;
+    bool m_ready = false;
+};
+
+// Global accessor
+inline WaveformLibrary& Waveforms = WaveformLibrary::getInstance();
@@ -0,0 +1,148 @@
+// ============================================================================
+// WAVEFORM_TABLE.H - Oscillation waveforms as one-period lookup tables
+// ============================================================================
+// Every waveform the oscillation phase accumulator plays is a table of
+// WAVEFORM_TABLE_SIZE values (−1..+1) over one period, read with linear
+// interpolation: the same cost per step whatever the shape.
+//
+// Built-ins (SINE / TRIANGLE / SQUARE) are generated at compile time and live
+// in flash. User waveforms (WaveformLibrary) are baked at upload / selection
+// from equally spaced points over one period:
+//   SAMPLES  straight lines between points
+//   SPLINE   periodic Catmull-Rom curve through the points (smooth; an
+//            overshoot past ±1 is clamped)
+// ============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include "core/Config.h"
+#include "core/Types.h"
+
+namespace Waveform {
+
+static_assert((WAVEFORM_TABLE_SIZE & (WAVEFORM_TABLE_SIZE - 1)) == 0, "Waveform tables wrap with a mask");
+constexpr uint32_t TABLE_MASK = WAVEFORM_TABLE_SIZE - 1;
+constexpr int INDEX_BITS = std::countr_zero(WAVEFORM_TABLE_SIZE);
+
+using Table = std::array<float, WAVEFORM_TABLE_SIZE>;
+
+enum class Kind : uint8_t { SAMPLES = 0, SPLINE = 1 };
+
+// ============================================================================
+// COMPILE-TIME BUILT-INS
+// ============================================================================
+
+/** cos(2π·turns) usable in constant expressions (Taylor series on [−π, π]) */
+constexpr double cosTurns(double turns) {
+    double reduced = turns - static_cast<double>(static_cast<int64_t>(turns));
+    if (reduced < 0.0) reduced += 1.0;
+    if (reduced > 0.5) reduced -= 1.0;
+    double x2 = (reduced * 2.0 * std::numbers::pi) * (reduced * 2.0 * std::numbers::pi);
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n < 18; ++n) {
+        term *= -x2 / static_cast<double>((2 * n - 1) * (2 * n));
+        sum += term;
+    }
+    return sum;
+}
+
+/** One period of fn(phase), phase in [0, 1) */
+template <typename Fn>
+constexpr Table makeTable(Fn fn) {
+    Table table{};
+    for (size_t idx = 0; idx < table.size(); ++idx) {
+        table[idx] = static_cast<float>(fn(static_cast<double>(idx) / static_cast<double>(table.size())));
+    }
+    return table;
+}
+
+// Same shapes (and −cos phase convention) as MovementMath::waveformValue()
+inline constexpr Table SINE = makeTable([](double phase) { return -cosTurns(phase); });
+inline constexpr Table TRIANGLE = makeTable([](double phase) { return phase < 0.5 ? 1.0 - phase * 4.0 : -3.0 + phase * 4.0; });
+inline constexpr Table SQUARE = makeTable([](double phase) { return phase < 0.5 ? 1.0 : -1.0; });
+
+/** Table of a built-in waveform, nullptr for OSC_CUSTOM (see WaveformLibrary) */
+constexpr const float* builtin(OscillationWaveform waveform) {
+    switch (waveform) {
+        case OscillationWaveform::OSC_SINE:     return SINE.data();
+        case OscillationWaveform::OSC_TRIANGLE: return TRIANGLE.data();
+        case OscillationWaveform::OSC_SQUARE:   return SQUARE.data();
+        default:                                return nullptr;
+    }
+}
+
+// ============================================================================
+// PLAYBACK
+// ============================================================================
+
+/** Waveform value (−1..+1) at phase (cycles, wraps), interpolated */
+inline float lookup(const float* table, float phase) {
+    float position = phase * static_cast<float>(WAVEFORM_TABLE_SIZE);
+    float floored = std::floor(position);
+    float fraction = position - floored;
+    auto index = static_cast<uint32_t>(static_cast<int32_t>(floored)) & TABLE_MASK;
+    float current = table[index];
+    return current + (table[(index + 1) & TABLE_MASK] - current) * fraction;
+}
+
+/** Waveform value at a Q0.32 phase (one period = 2^32, wraps by overflow), interpolated */
+inline float lookupFixed(const float* table, uint32_t phase) {
+    uint32_t index = phase >> (32 - INDEX_BITS);
+    float fraction = static_cast<float>(phase << INDEX_BITS) * (1.0f / 4294967296.0f);
+    float current = table[index];
+    return current + (table[(index + 1) & TABLE_MASK] - current) * fraction;
+}
+
+/** First phase in [0, 1) whose value is closest to value (start a cycle where the motor is) */
+inline float phaseNearest(const float* table, float value) {
+    uint32_t best = 0;
+    for (uint32_t idx = 1; idx < WAVEFORM_TABLE_SIZE; ++idx) {
+        if (std::fabs(table[idx] - value) < std::fabs(table[best] - value)) best = idx;
+    }
+    return static_cast<float>(best) / static_cast<float>(WAVEFORM_TABLE_SIZE);
+}
+
+// ============================================================================
+// USER WAVEFORMS
+// ============================================================================
+
+/**
+ * Bake one period of user points into a table
+ * @param points Equally spaced values from phase 0 (clamped to ±1)
+ * @param count  2..WAVEFORM_MAX_POINTS
+ * @return false if count is out of range (out untouched)
+ */
+inline bool bake(Kind kind, const float* points, size_t count, float* out) {
+    if (count < 2 || count > WAVEFORM_MAX_POINTS) return false;
+    auto point = [points, count](size_t idx) { return std::clamp(points[idx % count], -1.0f, 1.0f); };
+
+    for (size_t idx = 0; idx < WAVEFORM_TABLE_SIZE; ++idx) {
+        double position = static_cast<double>(idx) * static_cast<double>(count) / WAVEFORM_TABLE_SIZE;
+        auto segment = static_cast<size_t>(position);
+        auto t = static_cast<float>(position - static_cast<double>(segment));
+        float p1 = point(segment);
+        float p2 = point(segment + 1);
+
+        float value;
+        if (kind == Kind::SPLINE) {
+            float p0 = point(segment + count - 1);
+            float p3 = point(segment + 2);
+            value = 0.5f * (2.0f * p1 + (p2 - p0) * t + (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t * t +
+                            (3.0f * p1 - p0 - 3.0f * p2 + p3) * t * t * t);
+        } else {
+            value = p1 + (p2 - p1) * t;
+        }
+        out[idx] = std::clamp(value, -1.0f, 1.0f);
+    }
+    return true;
+}
+
+}  // namespace Waveform
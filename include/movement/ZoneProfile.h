@@ -0,0 +1,109 @@
+// ============================================================================
+// ZONE_PROFILE.H - Baked zone speed profile for va-et-vient
+// ============================================================================
+// The zone speed curve (MovementMath::zoneSpeedFactor) depends only on the
+// zone config, as a function of the distance from the zone boundary. It is
+// sampled once into a table of Q4.12 delay factors indexed by steps, so the
+// motor loop does a shift, a load and a multiply per step instead of float
+// divisions and cosf/sinf. Any curve shape costs the same at runtime.
+//
+// One entry per step while the zone fits ZONE_PROFILE_MAX_ENTRIES, else one
+// per power-of-two stride.
+// ============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include "core/Config.h"
+#include "core/MovementMath.h"
+#include "core/Types.h"
+
+class ZoneProfile {
+public:
+    static constexpr uint8_t FRACTION_BITS = 12;
+    static constexpr uint32_t UNITY = 1u << FRACTION_BITS;  // Factor 1.0 (max 10.0 fits uint16)
+
+    /** Sample the zone curve of cfg (speed effect, curve, intensity, zone size) */
+    void build(const ZoneEffectConfig& cfg) {
+        build(cfg.zoneMM * STEPS_PER_MM, [&cfg](float progress) {
+            return MovementMath::zoneSpeedFactor(cfg.speedEffect, cfg.speedCurve, cfg.speedIntensity, progress);
+        });
+        m_effect = cfg.speedEffect;
+        m_curve = cfg.speedCurve;
+        m_intensity = cfg.speedIntensity;
+        m_zoneMM = cfg.zoneMM;
+        m_built = true;
+    }
+
+    /**
+     * Sample any curve over a zone
+     * @param zoneSteps Zone size in steps (fractional: same boundary as the mm check)
+     * @param factorAt  Delay factor for zone progress 0 (boundary) .. 1 (zone edge)
+     */
+    template <typename FactorFn>
+    void build(float zoneSteps, FactorFn factorAt) {
+        m_built = false;
+        m_zoneSteps = zoneSteps > 0.0f ? static_cast<uint32_t>(zoneSteps) : 0;
+        m_shift = 0;
+        while ((m_zoneSteps >> m_shift) >= ZONE_PROFILE_MAX_ENTRIES) ++m_shift;
+
+        if (m_zoneSteps == 0) {
+            m_entries[0] = UNITY;
+            return;
+        }
+        for (uint32_t idx = 0; idx <= (m_zoneSteps >> m_shift); ++idx) {
+            float progress = std::min(static_cast<float>(idx << m_shift) / zoneSteps, 1.0f);
+            long fixed = std::lround(factorAt(progress) * static_cast<float>(UNITY));
+            m_entries[idx] = static_cast<uint16_t>(std::clamp<long>(fixed, 1, UINT16_MAX));
+        }
+    }
+
+    /** true if built from exactly these curve settings (else the table is stale) */
+    [[nodiscard]] bool matches(const ZoneEffectConfig& cfg) const {
+        return m_built && m_effect == cfg.speedEffect && m_curve == cfg.speedCurve &&
+               m_intensity == cfg.speedIntensity && m_zoneMM == cfg.zoneMM;
+    }
+
+    [[nodiscard]] uint32_t zoneSteps() const { return m_zoneSteps; }
+
+    /** Q4.12 factor at a distance (steps) from the zone boundary, UNITY outside the zone */
+    [[nodiscard]] uint32_t factorAt(uint32_t steps) const {
+        return steps > m_zoneSteps ? UNITY : m_entries[steps >> m_shift];
+    }
+
+    /**
+     * Factor for a position in the pass, both zones combined
+     * (the stronger effect wins where the zones overlap)
+     */
+    [[nodiscard]] uint32_t factorFor(bool useStart, uint32_t fromStart, bool useEnd, uint32_t fromEnd) const {
+        uint32_t factor = useStart ? factorAt(fromStart) : UNITY;
+        if (useEnd) {
+            uint32_t endFactor = factorAt(fromEnd);
+            if (strength(endFactor) > strength(factor)) factor = endFactor;
+        }
+        return factor;
+    }
+
+    /** Apply a Q4.12 factor to a step delay or interval (any unit) */
+    [[nodiscard]] static unsigned long scale(unsigned long delayMicros, uint32_t factor) {
+        return static_cast<unsigned long>((static_cast<uint64_t>(delayMicros) * factor) >> FRACTION_BITS);
+    }
+
+private:
+    /** Distance from normal speed (slowdown and speedup alike) */
+    static uint32_t strength(uint32_t factor) { return factor > UNITY ? factor - UNITY : UNITY - factor; }
+
+    std::array<uint16_t, ZONE_PROFILE_MAX_ENTRIES> m_entries{};
+    uint32_t m_zoneSteps = 0;
+    uint8_t m_shift = 0;
+
+    // Settings the table was built from
+    bool m_built = false;
+    SpeedEffect m_effect = SpeedEffect::SPEED_NONE;
+    SpeedCurve m_curve = SpeedCurve::CURVE_LINEAR;
+    float m_intensity = 0.0f;
+    float m_zoneMM = 0.0f;
+};
@@ -25,12 +25,17 @@
 
 #include "hardware/MotorDriver.h"
 #include "hardware/ContactSensors.h"
+#include "hardware/PositionVerifier.h"
 
 #include "communication/CommandDispatcher.h"
 #include "communication/StatusBroadcaster.h"
+#include "communication/StatusEvents.h"
 #include "communication/NetworkManager.h"
 #include "communication/APIRoutes.h"
 #include "communication/FilesystemManager.h"
+#include "communication/PlaylistStore.h"
+#include "communication/MetricsHistory.h"
+#include "communication/TelemetryStream.h"
 
 #include "movement/ChaosController.h"
 #include "movement/OscillationController.h"
@@ -39,6 +44,11 @@
 #include "movement/CalibrationManager.h"
 #include "movement/SequenceTableManager.h"
 #include "movement/SequenceExecutor.h"
+#include "movement/StepRateGovernor.h"
+#include "movement/SpeedCalibration.h"
+#include "movement/MotionTimeline.h"
+#include "movement/TrajectoryPlayer.h"
+#include "movement/WaveformLibrary.h"
 
 // ============================================================================
 // LOGGING - Use engine->info(), engine->error(), engine->warn(), engine->debug()
@@ -81,11 +91,12 @@ volatile float effectiveMaxDistanceMM = 0.0;
 
 // Sensor configuration
 volatile bool sensorsInverted = false;  // Loaded from NVS
+volatile bool autoRecalibrate = false;  // Loaded from NVS
 
 // Timing
-unsigned long lastStepMicros = 0;
-volatile unsigned long stepDelayMicrosForward = 1000;
-volatile unsigned long stepDelayMicrosBackward = 1000;
+StepScheduler stepClock;
+volatile uint32_t stepIntervalForward = StepScheduler::fromMicros(1000);
+volatile uint32_t stepIntervalBackward = StepScheduler::fromMicros(1000);
 volatile unsigned long lastStartContactMillis = 0;
 volatile unsigned long cycleTimeMillis = 0;
 volatile float measuredCyclesPerMinute = 0;
@@ -111,7 +122,7 @@ SemaphoreHandle_t stateMutex = NULL;
 SemaphoreHandle_t statsMutex = NULL;
 volatile bool requestCalibration = false;  // Flag to trigger calibration from Core 1
 volatile bool calibrationInProgress = false;  // Cooperative flag for calibration mode
-volatile bool blockingMoveInProgress = false;  // Cooperative flag for blocking moves
+volatile bool blockingMoveInProgress = false;  // Set while a positioning move is active
 volatile unsigned long lastUploadActivityTime = 0;  // Timestamp of last upload activity (batch detection)
 volatile bool uploadStopDone = false;               // Prevents repeated stop() calls during batch upload
 
@@ -123,7 +134,6 @@ AsyncWebSocket ws("/ws");
 FilesystemManager filesystemManager(server);
 
 // Forward declarations (required for .cpp — functions used before definition)
-void sendStatus();
 void stopMovement();
 void motorTask(void* param);
 void networkTask(void* param);
@@ -183,7 +193,7 @@ void logDebugDiagnostics() {
 
   if (millis() - lastSummary > SUMMARY_LOG_INTERVAL_MS) {
     engine->debug("Status: " + String(cycleCounter) + " cycles | " +
-          String(stats.totalDistanceTraveled / (STEPS_PER_MM * 1000000.0), 2) + " km");
+          String(stats.sessionSteps() / (STEPS_PER_MM * 1000000.0), 2) + " km");
     lastSummary = millis();
   }
 }
@@ -199,10 +209,19 @@ static void initHardwareAndCalibration() {
   Motor.setDirection(false);
   engine->info("✅ Hardware initialized (Motor + Contacts)");
 
+  Governor.init();
+  Speeds.init();
+
   Calibration.init();
-  Calibration.setStatusCallback(sendStatus);
-  Calibration.setErrorCallback([](const String& msg) { Status.sendError(msg); });
-  Calibration.setCompletionCallback([]() { SeqExecutor.onMovementComplete(); });
+  // Both callbacks run on Core 1 (Calibration.process()): errors are queued for networkTask
+  Calibration.setErrorCallback([](const String& msg) {
+    BaseMovement.cancelPendingStart();
+    Events.postError(msg.c_str());
+  });
+  Calibration.setCompletionCallback([]() {
+    SeqExecutor.onMovementComplete();
+    BaseMovement.onCalibrationComplete();
+  });
   engine->info("✅ CalibrationManager ready");
 }
 
@@ -296,7 +315,14 @@ void setup() {
 
   Dispatcher.begin(&ws);
   Status.begin(&ws);
+  Telemetry.begin(&ws);
+  SeqTable.begin();
+  Playlists.begin();
+  Metrics.begin();
+  Waveforms.begin();
   SeqExecutor.begin(&ws);
+  Timeline.begin();
+  Trajectory.begin();
   engine->info("✅ Command dispatcher + Status broadcaster ready");
 
   // ── 6-7. Hardware + Calibration ──
@@ -323,6 +349,51 @@ void setup() {
   initDualCoreTasks();
 }
 
+// ============================================================================
+// MOTOR TASK HELPERS
+// ============================================================================
+
+/** Dispatch one motorTask tick to the active movement controller */
+static void processActiveMovement() {
+  using enum MovementType;
+  switch (currentMovement) {
+    case MOVEMENT_VAET:
+      BaseMovement.process();
+      break;
+
+    case MOVEMENT_PURSUIT: {
+      if (!pursuit.isMoving && !Pursuit.hasPendingRequest()) break;  // 🔧 FIX #22: Guard pursuit like other modes
+      Pursuit.control();  // Targets in, velocity command out (stepDelay 0 = no step due)
+      if (pursuit.stepDelay > 0) {
+        if (uint32_t interval = StepScheduler::fromMicros(Governor.govern(pursuit.stepDelay)); stepClock.due(micros(), interval)) {
+          Telemetry.command(interval);
+          Pursuit.process();
+        }
+      }
+      break;
+    }
+
+    case MOVEMENT_OSC:
+      if (config.currentState == SystemState::STATE_RUNNING) {
+        Osc.process();
+      }
+      break;
+
+    case MOVEMENT_CHAOS:
+      if (config.currentState == SystemState::STATE_RUNNING) {
+        Chaos.process();
+      }
+      break;
+
+    case MOVEMENT_TRAJECTORY:
+      Trajectory.process();  // Ticked while paused too: keeps its play clock frozen
+      break;
+
+    case MOVEMENT_CALIBRATION:
+      break;  // Calibration ticked by motorTask via Calibration.process()
+  }
+}
+
 // ============================================================================
 // MOTOR TASK - Core 1 (PRO_CPU) - Real-time stepping
 // ============================================================================
@@ -341,13 +412,10 @@ void motorTask(void* param) { // NOSONAR(cpp:S5008) FreeRTOS task signature requ
       requestCalibration = false;
       engine->info("=== Manual calibration requested ===");
 
-      // Cooperative flag: calibration in progress
-      calibrationInProgress = true;
-
+      // Arms the state machine (sets calibrationInProgress until it finishes).
+      // An explicit calibration never turns into a start queued by an earlier one
+      BaseMovement.cancelPendingStart();
       Calibration.startCalibration();
-
-      // Resume normal operation
-      calibrationInProgress = false;
     }
 
     // ═══════════════════════════════════════════════════════════════════════
@@ -363,51 +431,33 @@ void motorTask(void* param) { // NOSONAR(cpp:S5008) FreeRTOS task signature requ
         calibrationStarted = true;
         engine->info("=== Starting automatic calibration ===");
 
-        // Cooperative flag: calibration in progress
-        calibrationInProgress = true;
-
         Calibration.startCalibration();
         needsInitialCalibration = false;
-
-        // Resume normal operation
-        calibrationInProgress = false;
       }
     }
 
     // ═══════════════════════════════════════════════════════════════════════
     // MOVEMENT EXECUTION (timing-critical, runs on dedicated core)
+    // Positioning / calibration are resumable state machines (≤1 step per tick)
+    // and take precedence over the regular movement controllers.
     // ═══════════════════════════════════════════════════════════════════════
-    using enum MovementType;
-    switch (currentMovement) {
-      case MOVEMENT_VAET:
-        BaseMovement.process();
-        break;
-
-      case MOVEMENT_PURSUIT: {
-        if (config.currentState != SystemState::STATE_RUNNING && !pursuit.isMoving) break;  // 🔧 FIX #22: Guard pursuit like other modes
-        unsigned long currentMicros = micros();
-        if (pursuit.isMoving && currentMicros - lastStepMicros >= pursuit.stepDelay) {
-          lastStepMicros = currentMicros;
-          Pursuit.process();
-        }
-        break;
-      }
-
-      case MOVEMENT_OSC:
-        if (config.currentState == SystemState::STATE_RUNNING) {
-          Osc.process();
-        }
-        break;
+    bool motionOverride = true;
+    if (SeqExecutor.isPositioning()) {
+      SeqExecutor.processPositioningMove();
+    } else if (Calibration.isBusy()) {
+      Calibration.process();
+    } else {
+      motionOverride = false;
+      processActiveMovement();
+    }
 
-      case MOVEMENT_CHAOS:
-        if (config.currentState == SystemState::STATE_RUNNING) {
-          Chaos.process();
-        }
-        break;
+    // Closed-loop verification: correlate pulses sent above with PEND edges,
+    // then let the governor learn from the outcome
+    PosVerifier.update();
+    Governor.update();
 
-      case MOVEMENT_CALIBRATION:
-        break;  // Calibration handled via requestCalibration flag
-    }
+    // Decimated step sample for subscribed telemetry clients (ring write only)
+    Telemetry.sample();
 
     // ═══════════════════════════════════════════════════════════════════════
     // SEQUENCER (logic only, no network blocking)
@@ -422,6 +472,7 @@ void motorTask(void* param) { // NOSONAR(cpp:S5008) FreeRTOS task signature requ
 
     if (alarmActive && !lastAlarmState) {
       engine->warn("🚨 HSS86 ALARM ACTIVE - Check motor/mechanics!");
+      Governor.onAlarm();
     } else if (!alarmActive && lastAlarmState) {
       engine->info("✅ HSS86 Alarm cleared");
     }
@@ -433,8 +484,10 @@ void motorTask(void* param) { // NOSONAR(cpp:S5008) FreeRTOS task signature requ
     // ═══════════════════════════════════════════════════════════════════════
     // TASK YIELD - Adaptive based on motor state
     // ═══════════════════════════════════════════════════════════════════════
-    if (config.currentState == SystemState::STATE_RUNNING) {
-      // Motor running: minimal yield to maintain step timing
+    bool motorActive = config.currentState == SystemState::STATE_RUNNING || motionOverride;
+    Metrics.noteMotorLoop(motorActive);  // Worst loop gap = step jitter bound
+    if (motorActive) {
+      // Motor running (or positioning/calibrating): minimal yield to maintain step timing
       taskYIELD();
     } else {
       // Motor idle: longer delay to reduce CPU usage
@@ -467,6 +520,14 @@ void networkTask(void* param) { // NOSONAR(cpp:S5008) FreeRTOS task signature re
       ws.cleanupClients();
     }
 
+    // ═══════════════════════════════════════════════════════════════════════
+    // SCHEDULED START ("startAt"): replay the parked command on time
+    // Polled every ~1ms; residual start jitter is absorbed by the phase lock
+    // ═══════════════════════════════════════════════════════════════════════
+    if (String scheduled; Timeline.takeDue(scheduled)) {
+      Dispatcher.handleCommand(0, scheduled);
+    }
+
     // ═══════════════════════════════════════════════════════════════════════
     // UPLOAD: Stop motor between file uploads (not inside handler — would block TCP)
     // ═══════════════════════════════════════════════════════════════════════
@@ -478,13 +539,25 @@ void networkTask(void* param) { // NOSONAR(cpp:S5008) FreeRTOS task signature re
       uploadStopDone = true;
     }
 
+    // ═══════════════════════════════════════════════════════════════════════
+    // STATUS EVENTS: changes posted by any module / core since the last loop,
+    // one broadcast per subscriber however many were posted
+    // ═══════════════════════════════════════════════════════════════════════
+    Events.dispatch();
+
+    // ═══════════════════════════════════════════════════════════════════════
+    // ZONE PROFILE: bake a changed zone curve here, never on the motor core
+    // (sequence lines set zoneEffect on Core 1, commands on async_tcp)
+    // ═══════════════════════════════════════════════════════════════════════
+    BaseMovement.refreshZoneProfile();
+
     // ═══════════════════════════════════════════════════════════════════════
     // STATUS BROADCAST (adaptive rate: 10Hz active, 5Hz calibrating, 1Hz idle)
     // ═══════════════════════════════════════════════════════════════════════
     static unsigned long lastUpdate = 0;
     if (millis() - lastUpdate > Status.getAdaptiveBroadcastInterval()) {
       lastUpdate = millis();
-      sendStatus();  // Uses ws.textAll — async, no mutex needed
+      Status.send();  // Uses ws.textAll — async, no mutex needed
     }
 
     // ═══════════════════════════════════════════════════════════════════════
@@ -496,6 +569,18 @@ void networkTask(void* param) { // NOSONAR(cpp:S5008) FreeRTOS task signature re
       uploadStopDone = false;
     }
 
+    // Learned step-rate profile → NVS (flash writes stay off the motor core)
+    Governor.persistIfDirty();
+
+    // Lifetime wear counters → NVS (rate-limited, skipped while idle)
+    engine->persistOdometerIfDue();
+
+    // 1s metrics sample → 1s / 1min / 1h history (GET /api/metrics)
+    Metrics.update();
+
+    // Step telemetry ring → binary frames to subscribed clients
+    Telemetry.flush();
+
     { static unsigned long hwmTimer = 0; logStackHighWaterMark("NetworkTask", 12288, hwmTimer); }
 
     // Small delay to prevent watchdog and allow other tasks
@@ -542,10 +627,6 @@ void loop() {
 // GLOBAL CALLBACKS (called by modules)
 // ============================================================================
 
-void sendStatus() {
-  Status.send();
-}
-
 void stopMovement() {
   BaseMovement.stop();
 }
\ No newline at end of file
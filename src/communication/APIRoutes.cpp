@@ -4,8 +4,9 @@
 // HTTP server routes for ESP32 Stepper Controller.
 // Direct LittleFS access: Justified here because APIRoutes is the HTTP
 // layer responsible for serving static files and persisting JSON data
-// (playlists, stats). FilesystemManager handles upload/format operations;
-// this module handles read/write of specific data files as part of the API.
+// (stats). FilesystemManager handles upload/format operations; playlist
+// presets live in PlaylistStore, custom waveforms in WaveformLibrary; this
+// module handles read/write of specific data files as part of the API.
 // ============================================================================
 
 #include "communication/APIRoutes.h"
@@ -14,10 +15,17 @@
 #include <WiFi.h>
 #include "core/UtilityEngine.h"
 #include "core/TimeUtils.h"
+#include "core/GlobalState.h"
+#include "core/MovementMath.h"
 #include "movement/SequenceTableManager.h"
+#include "movement/TrajectoryPlayer.h"
+#include "movement/SpeedCalibration.h"
+#include "movement/WaveformLibrary.h"
 #include "communication/WiFiConfigManager.h"
 #include "communication/NetworkManager.h"
 #include "communication/FilesystemManager.h"
+#include "communication/PlaylistStore.h"
+#include "communication/MetricsHistory.h"
 
 // External globals
 extern AsyncWebServer server;
@@ -50,7 +58,7 @@ void collectBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size
 String getBody(AsyncWebServerRequest* request) {
   String body;
   if (request->_tempObject) {
-    body = *static_cast<String*>(request->_tempObject);
+    body = std::move(*static_cast<String*>(request->_tempObject));
     delete static_cast<String*>(request->_tempObject);
     request->_tempObject = nullptr;
   }
@@ -149,15 +157,6 @@ void sendJsonSuccessWithId(AsyncWebServerRequest* request, int id) {
   request->send(response);
 }
 
-void sendEmptyPlaylistStructure(AsyncWebServerRequest* request) {
-  JsonDocument doc;
-  doc["simple"] = JsonArray();
-  doc["oscillation"] = JsonArray();
-  doc["chaos"] = JsonArray();
-  doc["pursuit"] = JsonArray();
-  sendJsonDoc(request, doc);
-}
-
 bool parseJsonBody(AsyncWebServerRequest* request, JsonDocument& doc) {
   String body = getBody(request);
   if (body.isEmpty()) {
@@ -216,57 +215,41 @@ bool ensureFileExists(const char* path, const char* defaultContent) {
 }
 
 // ============================================================================
-// PLAYLIST FILE HELPERS (DRY)
+// PLAYLIST HELPERS
 // ============================================================================
 
 /**
- * Load and parse the playlist JSON file.
- * Sends appropriate error responses on failure.
- * @return true if playlistDoc is populated and ready to use
+ * Send the error matching a failed PlaylistStore operation.
+ * @return true if result is OK (nothing sent)
  */
-bool loadPlaylistDoc(AsyncWebServerRequest* request, JsonDocument& playlistDoc) {
-  if (!LittleFS.exists(PLAYLIST_FILE_PATH)) {
-    sendJsonError(request, 404, "No playlists found");
-    return false;
-  }
-
-  File file = LittleFS.open(PLAYLIST_FILE_PATH, "r");
-  if (!file) {
-    sendJsonError(request, 500, "Failed to read playlists");
-    return false;
+static bool checkPlaylistResult(AsyncWebServerRequest* request, PlaylistStore::Result result) {
+  switch (result) {
+    case PlaylistStore::Result::OK:
+      return true;
+    case PlaylistStore::Result::UNKNOWN_MODE:
+      sendJsonError(request, 400, "Unknown mode");
+      break;
+    case PlaylistStore::Result::NOT_FOUND:
+      sendJsonError(request, 404, "Preset not found");
+      break;
+    case PlaylistStore::Result::FULL:
+      sendJsonError(request, 400, "Maximum " + String(MAX_PRESETS_PER_MODE) + " presets reached");
+      break;
+    default:
+      sendJsonError(request, 500, "Failed to save");
+      break;
   }
-
-  deserializeJson(playlistDoc, file);
-  file.close();
-  return true;
+  return false;
 }
 
-/**
- * Find a preset by mode and id in a loaded playlist document.
- * Sends 404 error if mode or preset not found.
- * @param outArray  Populated with the mode's JsonArray on success
- * @param outIndex  Set to the index of the found preset (-1 if not applicable)
- * @return true if the preset was found
- */
-bool findPresetInMode(AsyncWebServerRequest* request, JsonDocument& playlistDoc, const char* mode, int id,
-                      JsonArray& outArray, int& outIndex) {
-  if (!playlistDoc[mode].is<JsonArray>()) {
-    sendJsonError(request, 404, "Mode not found");
+/** Playlist store mounted and loaded, else 500 */
+static bool requirePlaylists(AsyncWebServerRequest* request) {
+  if (!requireFilesystem(request)) return false;
+  if (!Playlists.isReady()) {
+    sendJsonError(request, 500, "Playlist store not initialized");
     return false;
   }
-
-  outArray = playlistDoc[mode].as<JsonArray>();
-
-  for (size_t i = 0; i < outArray.size(); i++) {
-    JsonObject preset = outArray[i];
-    if (preset["id"] == id) {
-      outIndex = (int)i;
-      return true;
-    }
-  }
-
-  sendJsonError(request, 404, "Preset not found");
-  return false;
+  return true;
 }
 
 // ============================================================================
@@ -335,6 +318,55 @@ static void handleGetStats(AsyncWebServerRequest* request) {
   request->send(200, "application/json", response);
 }
 
+static void handleGetOdometer(AsyncWebServerRequest* request) {
+  static constexpr std::array<const char*, OdometerCounters::MODE_COUNT> MODE_KEYS = {
+      "vaet", "oscillation", "chaos", "pursuit", "calibration", "trajectory"};
+
+  // Lock-free copy of the Core 1 counters (lifetime, restored from NVS at boot)
+  OdometerCounters counters = stats.odometer.snapshot();
+
+  JsonDocument doc;
+  doc["totalSteps"] = counters.totalSteps;
+  doc["totalKm"] = MovementMath::stepCountToMM(counters.totalSteps) / 1000000.0;
+  doc["reversals"] = counters.reversals;
+  doc["highSpeedSteps"] = counters.highSpeedSteps;
+  doc["highSpeedKm"] = MovementMath::stepCountToMM(counters.highSpeedSteps) / 1000000.0;
+  doc["highSpeedThresholdMMs"] = ODOMETER_HIGH_SPEED_MM_S;
+  JsonObject byMode = doc["stepsByMode"].to<JsonObject>();
+  for (size_t mode = 0; mode < MODE_KEYS.size(); ++mode) {
+    byMode[MODE_KEYS[mode]] = counters.stepsByMode[mode];
+  }
+  sendJsonDoc(request, doc);
+}
+
+static void handleGetMetrics(AsyncWebServerRequest* request) {
+  if (!Metrics.isReady()) {
+    sendJsonError(request, 500, "Metrics history not initialized");
+    return;
+  }
+
+  MetricsSeries::Resolution resolution = MetricsSeries::SECONDS;
+  if (request->hasParam("res")) {
+    String res = request->getParam("res")->value();
+    if (res == "m") resolution = MetricsSeries::MINUTES;
+    else if (res == "h") resolution = MetricsSeries::HOURS;
+    else if (res != "s") {
+      sendJsonError(request, 400, "res must be s, m or h");
+      return;
+    }
+  }
+  long since = request->hasParam("since") ? request->getParam("since")->value().toInt() : 0;
+
+  // Range frozen now; samples the sampler overwrites meanwhile go out empty
+  MetricsHistory::Range range = Metrics.openRange(resolution, static_cast<uint32_t>(max(since, 0L)));
+  AsyncWebServerResponse* response = request->beginResponse("application/octet-stream",
+      MetricsHistory::rangeBytes(range), [range](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+        return Metrics.readRange(range, buffer, maxLen, index);
+      });
+  sendCORSHeaders(response);
+  request->send(response);
+}
+
 static void handleIncrementStats(AsyncWebServerRequest* request) {
   JsonDocument requestDoc;
   if (!parseJsonBody(request, requestDoc)) return;
@@ -465,64 +497,50 @@ static void handleImportStats(AsyncWebServerRequest* request) {
 // --- Playlist handlers ---
 
 static void handleGetPlaylists(AsyncWebServerRequest* request) {
-  if (!engine) {
-    sendJsonError(request, 500, "Engine not initialized");
-    return;
-  }
-  if (!engine->isFilesystemReady()) {
-    engine->error("❌ GET /api/playlists: LittleFS not mounted");
-    sendJsonError(request, 500, "LittleFS not mounted");
-    return;
-  }
-
-  if (!LittleFS.exists(PLAYLIST_FILE_PATH)) {
-    // Create empty playlists file
-    const char* emptyPlaylists = R"({"simple":[],"oscillation":[],"chaos":[],"pursuit":[]})";
-    ensureFileExists(PLAYLIST_FILE_PATH, emptyPlaylists);
-    sendEmptyPlaylistStructure(request);
-    return;
-  }
-
-  File file = LittleFS.open(PLAYLIST_FILE_PATH, "r");
-  if (!file) {
-    engine->error("❌ GET /api/playlists: Failed to open file");
-    sendJsonError(request, 500, "Failed to open playlists file");
-    return;
+  if (!requirePlaylists(request)) return;
+
+  AsyncResponseStream* stream = request->beginResponseStream("application/json");
+  if (request->hasParam("mode")) {
+    // Paged index listing: ?mode=<mode>[&offset=N][&limit=N]
+    int mode = PlaylistStore::modeIndex(request->getParam("mode")->value().c_str());
+    if (mode < 0) {
+      delete stream;
+      sendJsonError(request, 400, "Unknown mode");
+      return;
+    }
+    long offset = request->hasParam("offset") ? request->getParam("offset")->value().toInt() : 0;
+    long limit = request->hasParam("limit") ? request->getParam("limit")->value().toInt() : MAX_PRESETS_PER_MODE;
+    Playlists.writePage(mode, static_cast<size_t>(max(offset, 0L)), static_cast<size_t>(max(limit, 0L)), *stream);
+  } else {
+    Playlists.writeAll(*stream);
   }
+  sendCORSHeaders(stream);
+  request->send(stream);
+}
 
-  String content = file.readString();
-  size_t fileSize = file.size();
-  file.close();
-
-  engine->debug("📋 GET /api/playlists: File size=" + String(fileSize) + ", content length=" + String(content.length()));
+static void handleGetPreset(AsyncWebServerRequest* request) {
+  if (!requirePlaylists(request)) return;
 
-  if (content.isEmpty()) {
-    engine->warn("⚠️ Playlist file exists but is empty");
-    sendEmptyPlaylistStructure(request);
+  if (!request->hasParam("mode") || !request->hasParam("id")) {
+    sendJsonError(request, 400, "Missing mode or id");
     return;
   }
-
-  // Validate JSON integrity
-  JsonDocument testDoc;
-  DeserializationError testError = deserializeJson(testDoc, content);
-  if (testError) {
-    engine->error("❌ Playlist JSON corrupted! Error: " + String(testError.c_str()));
-    engine->warn("🔧 Backing up corrupted file and resetting playlists");
-
-    // Backup corrupted file
-    String backupPath = String(PLAYLIST_FILE_PATH) + ".corrupted";
-    LittleFS.rename(PLAYLIST_FILE_PATH, backupPath.c_str());
-
-    sendEmptyPlaylistStructure(request);
+  int mode = PlaylistStore::modeIndex(request->getParam("mode")->value().c_str());
+  auto id = static_cast<int>(request->getParam("id")->value().toInt());
+
+  AsyncResponseStream* stream = request->beginResponseStream("application/json");
+  PlaylistStore::Result result = Playlists.writePreset(mode, id, *stream);
+  if (result != PlaylistStore::Result::OK) {
+    delete stream;
+    checkPlaylistResult(request, result);
     return;
   }
-
-  engine->debug("✅ Returning playlist content: " + content.substring(0, 100) + "...");
-  request->send(200, "application/json", content);
+  sendCORSHeaders(stream);
+  request->send(stream);
 }
 
 static void handleAddPreset(AsyncWebServerRequest* request) {
-  if (!requireFilesystem(request)) return;
+  if (!requirePlaylists(request)) return;
 
   JsonDocument reqDoc;
   if (!parseJsonBody(request, reqDoc)) return;
@@ -551,143 +569,262 @@ static void handleAddPreset(AsyncWebServerRequest* request) {
     }
   }
 
-  // Load existing playlists
-  JsonDocument playlistDoc;
-  bool fileLoaded = engine->loadJsonFile(PLAYLIST_FILE_PATH, playlistDoc);
+  int newId = 0;
+  if (!checkPlaylistResult(request, Playlists.add(PlaylistStore::modeIndex(mode), name, configData, newId))) return;
 
-  // If file doesn't exist or is empty, initialize empty structure
-  if (!fileLoaded) {
-    engine->info("📋 Playlist file not found, creating new structure");
-    // Create empty arrays properly attached to document
-    playlistDoc["simple"].to<JsonArray>();
-    playlistDoc["oscillation"].to<JsonArray>();
-    playlistDoc["chaos"].to<JsonArray>();
+  engine->info("📋 Preset added: " + String(name) + " (mode: " + String(mode) + ")");
+  sendJsonSuccessWithId(request, newId);
+}
+
+static void handleDeletePreset(AsyncWebServerRequest* request) {
+  if (!requirePlaylists(request)) return;
+
+  JsonDocument reqDoc;
+  if (!parseJsonBody(request, reqDoc)) return;
+
+  const char* mode = reqDoc["mode"];
+  int id = reqDoc["id"] | 0;
+
+  if (!mode || id == 0) {
+    sendJsonError(request, 400, "Missing mode or id");
+    return;
   }
 
-  // Debug: Check what's in the loaded document
-  auto jsonTypeOf = [](JsonVariant v) {
-    if (v.isNull()) return "null";
-    if (v.is<JsonArray>()) return "array";
-    return "other";
-  };
-  engine->debug("📋 Loaded doc - simple: " + String(jsonTypeOf(playlistDoc["simple"])));
-  engine->debug("📋 Loaded doc - oscillation: " + String(jsonTypeOf(playlistDoc["oscillation"])));
-  engine->debug("📋 Loaded doc - chaos: " + String(jsonTypeOf(playlistDoc["chaos"])));
-
-  // Get or create mode array
-  JsonArray modeArray;
-  if (playlistDoc[mode].isNull() || !playlistDoc[mode].is<JsonArray>()) {
-    // Mode doesn't exist yet, create it
-    modeArray = playlistDoc[mode].to<JsonArray>();
-    engine->debug("📋 Created new array for mode: " + String(mode));
-  } else {
-    // Mode exists, use it
-    modeArray = playlistDoc[mode].as<JsonArray>();
-    engine->debug("📋 Using existing array for mode: " + String(mode) + ", size: " + String(modeArray.size()));
+  int modeIdx = PlaylistStore::modeIndex(mode);
+  if (!checkPlaylistResult(request, Playlists.remove(modeIdx, id))) return;
+
+  engine->info("🗑️ Preset deleted: ID " + String(id) + " (mode: " + String(mode) + "), " +
+               String(Playlists.count(modeIdx)) + " remaining");
+  sendJsonSuccess(request);
+}
+
+static void handleUpdatePreset(AsyncWebServerRequest* request) {
+  if (!requirePlaylists(request)) return;
+
+  JsonDocument reqDoc;
+  if (!parseJsonBody(request, reqDoc)) return;
+
+  const char* mode = reqDoc["mode"];
+  int id = reqDoc["id"] | 0;
+  const char* newName = reqDoc["name"];
+  JsonVariantConst newConfig = reqDoc["config"];
+
+  if (!mode || id == 0 || (!newName && newConfig.isNull())) {
+    sendJsonError(request, 400, "Missing required fields");
+    return;
   }
 
-  // Check limit
-  if (modeArray.size() >= MAX_PRESETS_PER_MODE) {
-    sendJsonError(request, 400, "Maximum 20 presets reached");
+  if (!checkPlaylistResult(request, Playlists.update(PlaylistStore::modeIndex(mode), id, newName, newConfig))) return;
+
+  engine->info("✏️ Preset updated: ID " + String(id) + (newName ? " -> " + String(newName) : String()));
+  sendJsonSuccess(request);
+}
+
+// --- Sequence import/export handlers ---
+
+static bool isBinaryUpload(AsyncWebServerRequest* request) {
+  return request->contentType() == "application/octet-stream";
+}
+
+/**
+ * onBody callback for POST /api/sequence/import: binary uploads are decoded
+ * chunk by chunk into the table (one record buffered at most), JSON bodies
+ * are collected for a single parse.
+ */
+static void collectSequenceBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+  if (!isBinaryUpload(request)) {
+    collectBody(request, data, len, index, total);
     return;
   }
 
-  // Find next available ID
-  int nextId = 1;
-  for (JsonObject preset : modeArray) {
-    int id = preset["id"] | 0;
-    if (id >= nextId) {
-      nextId = id + 1;
+  if (index == 0) {
+    if (!SeqTable.beginBinaryImport(request)) return;  // Refused: later chunks are ignored
+    request->onDisconnect([request]() { SeqTable.abortBinaryImport(request); });
+  }
+  SeqTable.feedBinaryImport(request, data, len);
+}
+
+static void handleImportSequence(AsyncWebServerRequest* request) {
+  if (isBinaryUpload(request)) {
+    int imported = SeqTable.endBinaryImport(request);
+    if (imported < 0) {
+      sendJsonError(request, 400, "Invalid or incomplete binary sequence");
+      return;
     }
+    sendJsonSuccess(request, String(imported) + " lines imported");
+    return;
   }
 
-  // Create new preset
-  JsonObject newPreset = modeArray.add<JsonObject>();
-  newPreset["id"] = nextId;
-  newPreset["name"] = name;
-  newPreset["timestamp"] = static_cast<unsigned long>(TimeUtils::epochSeconds());
-  newPreset["config"] = configData;
+  String jsonData = getBody(request);
+  if (jsonData.isEmpty()) {
+    sendJsonError(request, 400, "No JSON body provided");
+    return;
+  }
 
-  engine->debug("📋 Adding preset: mode=" + String(mode) + ", id=" + String(nextId) + ", name=" + String(name));
-  engine->debug("📋 Array size after add: " + String(modeArray.size()));
+  engine->info("📥 HTTP Import received: " + String(jsonData.length()) + " bytes");
 
-  // Save to file
-  if (!engine->saveJsonFile(PLAYLIST_FILE_PATH, playlistDoc)) {
-    engine->error("❌ Failed to save playlist");
-    sendJsonError(request, 500, "Failed to save");
+  if (SeqTable.importFromJson(jsonData.c_str(), jsonData.length()) < 0) {
+    sendJsonError(request, 400, "Invalid sequence JSON");
     return;
   }
+  sendJsonSuccess(request, "Sequence imported successfully");
+}
 
-  engine->info("📋 Preset added: " + String(name) + " (mode: " + String(mode) + ")");
-  sendJsonSuccessWithId(request, nextId);
+static void handleExportSequence(AsyncWebServerRequest* request) {
+  bool binary = request->hasParam("format") && request->getParam("format")->value() == "bin";
+
+  AsyncWebServerResponse* response;
+  if (binary) {
+    // Served straight from the table, one record at a time
+    response = request->beginResponse("application/octet-stream", SeqTable.binarySize(),
+        [](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+          return SeqTable.readBinary(buffer, maxLen, index);
+        });
+    response->addHeader("Content-Disposition", "attachment; filename=\"sequence.seqb\"");
+  } else {
+    AsyncResponseStream* stream = request->beginResponseStream("application/json");
+    SeqTable.writeTable(*stream);
+    response = stream;
+  }
+  sendCORSHeaders(response);
+  request->send(response);
 }
 
-static void handleDeletePreset(AsyncWebServerRequest* request) {
+// --- Trajectory handlers ---
+
+/**
+ * onBody callback for POST /api/trajectory: keyframes go straight into the
+ * trajectory ring, chunk by chunk (no String copy of a multi-MB body).
+ * Replaces the buffer unless ?append=1 (append works during stream playback).
+ */
+static void collectTrajectoryBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, [[maybe_unused]] size_t total) {
+  bool append = request->hasParam("append");
+  if (!append && Trajectory.isPlaying()) return;  // Rejected in handleUploadTrajectory
+  if (index == 0 && !append) {
+    Trajectory.clear();
+  }
+  Trajectory.append(data, len);
+}
+
+static void handleUploadTrajectory(AsyncWebServerRequest* request) {
+  if (!request->hasParam("append") && Trajectory.isPlaying()) {
+    sendJsonError(request, 409, "Trajectory is playing - stop it or use ?append=1");
+    return;
+  }
+
+  JsonDocument doc;
+  doc["success"] = true;
+  doc["count"] = Trajectory.getCount();
+  doc["capacity"] = Trajectory.getCapacity();
+  doc["rejected"] = Trajectory.getRejected();
+  sendJsonDoc(request, doc);
+}
+
+// --- Waveform handlers ---
+
+/** Map a WaveformLibrary result to an HTTP error; true if OK */
+static bool checkWaveformResult(AsyncWebServerRequest* request, WaveformLibrary::Result result) {
+  using Result = WaveformLibrary::Result;
+  switch (result) {
+    case Result::OK:
+      return true;
+    case Result::INVALID_NAME:
+    case Result::INVALID_POINTS:
+    case Result::FULL:
+      sendJsonError(request, 400, WaveformLibrary::resultMessage(result));
+      break;
+    case Result::NOT_FOUND:
+      sendJsonError(request, 404, WaveformLibrary::resultMessage(result));
+      break;
+    default:
+      sendJsonError(request, 500, WaveformLibrary::resultMessage(result));
+      break;
+  }
+  return false;
+}
+
+static void handleGetWaveforms(AsyncWebServerRequest* request) {
+  if (!requireFilesystem(request)) return;
+
+  JsonDocument doc;
+  Waveforms.writeList(doc);
+  sendJsonDoc(request, doc);
+}
+
+static void handleSaveWaveform(AsyncWebServerRequest* request) {
   if (!requireFilesystem(request)) return;
 
   JsonDocument reqDoc;
   if (!parseJsonBody(request, reqDoc)) return;
 
-  const char* mode = reqDoc["mode"];
-  int id = reqDoc["id"] | 0;
-
-  if (!mode || id == 0) {
-    sendJsonError(request, 400, "Missing mode or id");
-    return;
-  }
+  String name;
+  if (!checkWaveformResult(request, Waveforms.save(reqDoc.as<JsonVariantConst>(), name))) return;
 
-  // Load and find preset using shared helpers
-  JsonDocument playlistDoc;
-  if (!loadPlaylistDoc(request, playlistDoc)) return;
+  engine->info("🌊 Custom waveform saved and selected: " + name);
+  sendJsonSuccess(request);
+}
 
-  JsonArray modeArray;
-  int index = -1;
-  if (!findPresetInMode(request, playlistDoc, mode, id, modeArray, index)) return;
+static void handleSelectWaveform(AsyncWebServerRequest* request) {
+  if (!requireFilesystem(request)) return;
 
-  modeArray.remove(index);
+  JsonDocument reqDoc;
+  if (!parseJsonBody(request, reqDoc)) return;
 
-  if (!engine->saveJsonFile(PLAYLIST_FILE_PATH, playlistDoc)) {
-    engine->error("❌ Failed to save playlist after delete");
-    sendJsonError(request, 500, "Failed to save");
-    return;
-  }
+  const char* name = reqDoc["name"];
+  if (!checkWaveformResult(request, Waveforms.select(name))) return;
 
-  engine->info("🗑️ Preset deleted: ID " + String(id) + " (mode: " + String(mode) + "), " + String(modeArray.size()) + " remaining");
+  engine->info("🌊 Custom waveform selected: " + String(name));
   sendJsonSuccess(request);
 }
 
-static void handleUpdatePreset(AsyncWebServerRequest* request) {
+static void handleDeleteWaveform(AsyncWebServerRequest* request) {
   if (!requireFilesystem(request)) return;
 
   JsonDocument reqDoc;
   if (!parseJsonBody(request, reqDoc)) return;
 
-  const char* mode = reqDoc["mode"];
-  int id = reqDoc["id"] | 0;
-  const char* newName = reqDoc["name"];
+  const char* name = reqDoc["name"];
+  if (!checkWaveformResult(request, Waveforms.remove(name))) return;
 
-  if (!mode || id == 0 || !newName) {
-    sendJsonError(request, 400, "Missing required fields");
-    return;
-  }
+  engine->info("🗑️ Custom waveform deleted: " + String(name));
+  sendJsonSuccess(request);
+}
 
-  // Load and find preset using shared helpers
-  JsonDocument playlistDoc;
-  if (!loadPlaylistDoc(request, playlistDoc)) return;
+// --- Speed calibration handlers ---
 
-  JsonArray modeArray;
-  int index = -1;
-  if (!findPresetInMode(request, playlistDoc, mode, id, modeArray, index)) return;
+static void handleGetSpeedCurve(AsyncWebServerRequest* request) {
+  JsonDocument doc;
+  doc["calibrated"] = Speeds.isCalibrated();
+  JsonArray levels = doc["levels"].to<JsonArray>();
+  for (float level : Speeds.points()) levels.add(level);
+  sendJsonDoc(request, doc);
+}
 
-  modeArray[index]["name"] = newName;
+static void handleSetSpeedCurve(AsyncWebServerRequest* request) {
+  JsonDocument reqDoc;
+  if (!parseJsonBody(request, reqDoc)) return;
 
-  if (!engine->saveJsonFile(PLAYLIST_FILE_PATH, playlistDoc)) {
-    engine->error("❌ Failed to save playlist after rename");
-    sendJsonError(request, 500, "Failed to save");
+  if (reqDoc["reset"] | false) {
+    Speeds.reset();
+    sendJsonSuccess(request);
     return;
   }
 
-  engine->info("✏️ Preset renamed: ID " + String(id) + " -> " + String(newName));
+  JsonArrayConst levels = reqDoc["levels"];
+  SpeedTable::Points points;
+  if (levels.size() != points.size()) {
+    sendJsonError(request, 400, "levels: " + String(points.size()) + " numbers expected (speed levels 0-" +
+                                String(MAX_SPEED_LEVEL, 0) + ")");
+    return;
+  }
+  size_t idx = 0;
+  for (JsonVariantConst level : levels) {
+    points[idx++] = level.is<float>() ? level.as<float>() : -1.0f;
+  }
+  if (!Speeds.apply(points)) {
+    sendJsonError(request, 400, "levels must be numbers 0-" + String(MAX_SPEED_LEVEL, 0) + ", non-decreasing");
+    return;
+  }
   sendJsonSuccess(request);
 }
 
@@ -984,6 +1121,9 @@ void setupAPIRoutes() {  // NOSONAR(cpp:S3776) — sequential route registration
   server.on("/api/stats/import", HTTP_OPTIONS, handleCORSPreflight);
   server.on("/api/playlists", HTTP_OPTIONS, handleCORSPreflight);
   server.on("/api/command", HTTP_OPTIONS, handleCORSPreflight);
+  server.on("/api/trajectory", HTTP_OPTIONS, handleCORSPreflight);
+  server.on("/api/waveforms", HTTP_OPTIONS, handleCORSPreflight);
+  server.on("/api/speed-curve", HTTP_OPTIONS, handleCORSPreflight);
 
   // ============================================================================
   // AUTOMATIC STATIC FILE SERVING
@@ -1036,6 +1176,12 @@ void setupAPIRoutes() {  // NOSONAR(cpp:S3776) — sequential route registration
   // STATISTICS API ROUTES
   // ========================================================================
 
+  // GET /api/metrics?res=s|m|h&since=<uptimeSec> - Binary time series (see MetricsHistory.h)
+  server.on("/api/metrics", HTTP_GET, handleGetMetrics);
+
+  // GET /api/stats/odometer - Lifetime wear counters (registered before the "/api/stats" prefix)
+  server.on("/api/stats/odometer", HTTP_GET, handleGetOdometer);
+
   // GET /api/stats - Retrieve all daily stats
   server.on("/api/stats", HTTP_GET, handleGetStats);
 
@@ -1066,7 +1212,11 @@ void setupAPIRoutes() {  // NOSONAR(cpp:S3776) — sequential route registration
   // PLAYLIST API ENDPOINTS
   // ============================================================================
 
-  // GET /api/playlists - Get all playlists
+  // GET /api/playlists/preset?mode=&id= - One preset with its config
+  // (registered first: "/api/playlists" also matches its sub-paths)
+  server.on("/api/playlists/preset", HTTP_GET, handleGetPreset);
+
+  // GET /api/playlists - All presets, or ?mode=&offset=&limit= for a page of the index
   server.on("/api/playlists", HTTP_GET, handleGetPlaylists);
 
   // POST /api/playlists/add - Add a preset to playlist
@@ -1075,9 +1225,43 @@ void setupAPIRoutes() {  // NOSONAR(cpp:S3776) — sequential route registration
   // POST /api/playlists/delete - Delete a preset
   server.on("/api/playlists/delete", HTTP_POST, handleDeletePreset, NULL, collectBody);
 
-  // POST /api/playlists/update - Update (rename) a preset
+  // POST /api/playlists/update - Rename a preset and/or replace its config
   server.on("/api/playlists/update", HTTP_POST, handleUpdatePreset, NULL, collectBody);
 
+  // ============================================================================
+  // TRAJECTORY API ENDPOINTS
+  // ============================================================================
+
+  // POST /api/trajectory - Upload binary keyframes (8 bytes: uint32 timeMs + float mm, LE)
+  //   ?append=1 keeps the current buffer (streaming top-up)
+  server.on("/api/trajectory", HTTP_POST, handleUploadTrajectory, NULL, collectTrajectoryBody);
+
+  // ============================================================================
+  // WAVEFORM API ENDPOINTS (custom oscillation shapes)
+  // ============================================================================
+
+  // GET /api/waveforms - {active, waveforms: [names]}
+  server.on("/api/waveforms", HTTP_GET, handleGetWaveforms);
+
+  // POST /api/waveforms/save - {name, kind: samples|spline, points: [-1..1]}: store and select
+  server.on("/api/waveforms/save", HTTP_POST, handleSaveWaveform, NULL, collectBody);
+
+  // POST /api/waveforms/select - {name}: play a stored waveform as OSC_CUSTOM
+  server.on("/api/waveforms/select", HTTP_POST, handleSelectWaveform, NULL, collectBody);
+
+  // POST /api/waveforms/delete - {name}
+  server.on("/api/waveforms/delete", HTTP_POST, handleDeleteWaveform, NULL, collectBody);
+
+  // ============================================================================
+  // SPEED CALIBRATION API ENDPOINTS (rig-specific speed curve)
+  // ============================================================================
+
+  // GET /api/speed-curve - {calibrated, levels: [effective level at each whole level 0..MAX_SPEED_LEVEL]}
+  server.on("/api/speed-curve", HTTP_GET, handleGetSpeedCurve);
+
+  // POST /api/speed-curve - {levels: [...]} measured curve (persisted), or {reset: true} for nominal
+  server.on("/api/speed-curve", HTTP_POST, handleSetSpeedCurve, NULL, collectBody);
+
   // ============================================================================
   // LOGS MANAGEMENT ROUTES
   // ============================================================================
@@ -1243,21 +1427,12 @@ void setupAPIRoutes() {  // NOSONAR(cpp:S3776) — sequential route registration
     ESP.restart();
   });
 
-  // ===== IMPORT SEQUENCE VIA HTTP POST (Bypass WebSocket size limit) =====
-  server.on("/api/sequence/import", HTTP_POST, [](AsyncWebServerRequest* request) {
-    String jsonData = getBody(request);
-    if (jsonData.isEmpty()) {
-      sendJsonError(request, 400, "No JSON body provided");
-      return;
-    }
-
-    engine->info("📥 HTTP Import received: " + String(jsonData.length()) + " bytes");
-
-    // Call the SequenceTableManager import function
-    SeqTable.importFromJson(jsonData);
+  // ===== SEQUENCE IMPORT / EXPORT VIA HTTP (Bypass WebSocket size limit) =====
+  // POST /api/sequence/import - JSON body, or binary (application/octet-stream)
+  server.on("/api/sequence/import", HTTP_POST, handleImportSequence, NULL, collectSequenceBody);
 
-    sendJsonSuccess(request, "Sequence imported successfully");
-  }, NULL, collectBody);
+  // GET /api/sequence/export?format=bin|json
+  server.on("/api/sequence/export", HTTP_GET, handleExportSequence);
 
   // ========================================================================
   // CAPTIVE PORTAL DETECTION - Handle standard connectivity check URLs
@@ -3,18 +3,27 @@
  * CommandDispatcher.cpp - WebSocket Command Routing Implementation
  * ============================================================================
  *
- * Implements all WebSocket command handlers.
+ * Implements all WebSocket command handlers and the constexpr command table.
  */
 
 #include "communication/CommandDispatcher.h"
 #include "communication/StatusBroadcaster.h"
+#include "communication/StatusEvents.h"
 #include "communication/NetworkManager.h"
+#include "communication/CommandTable.h"
+#include "communication/WsMessageAssembler.h"
+#include "communication/TelemetryStream.h"
 #include "core/UtilityEngine.h"
 #include "movement/CalibrationManager.h"
 #include "movement/SequenceTableManager.h"
 #include "movement/OscillationController.h"
+#include "core/Transition.h"
 #include "movement/PursuitController.h"
 #include "movement/ChaosController.h"
+#include "movement/StepRateGovernor.h"
+#include "movement/MotionTimeline.h"
+#include "movement/TrajectoryPlayer.h"
+#include "movement/WaveformLibrary.h"
 
 using enum SystemState;
 using enum MovementType;
@@ -35,6 +44,7 @@ CommandDispatcher& CommandDispatcher::getInstance() {
 
 void CommandDispatcher::begin(AsyncWebSocket* ws) {
     _webSocket = ws;
+    WsAssembler.begin();
     engine->info("CommandDispatcher initialized");
 }
 
@@ -48,7 +58,7 @@ void CommandDispatcher::onWebSocketEvent(AsyncWebSocket* server, AsyncWebSocketC
         IPAddress ip = client->remoteIP();
         engine->info(String("WebSocket client #") + String(client->id()) + " connected from " +
               String(ip[0]) + "." + String(ip[1]) + "." + String(ip[2]) + "." + String(ip[3]));
-        // Reset broadcast dedup hash so the next sendStatus() is guaranteed to
+        // Reset broadcast dedup hash so the next broadcast is guaranteed to
         // transmit even if the payload hasn't changed since the last broadcast.
         Status.resetHash();
     }
@@ -56,28 +66,161 @@ void CommandDispatcher::onWebSocketEvent(AsyncWebSocket* server, AsyncWebSocketC
     // Client disconnected
     if (type == WS_EVT_DISCONNECT) {
         engine->info(String("WebSocket client #") + String(client->id()) + " disconnected");
+        WsAssembler.release(client->id());  // Drop any half-received message
+        Telemetry.release(client->id());
         engine->saveCurrentSessionStats();
     }
 
-    // Text message received
+    // Text (JSON command) or binary (typed payload) message received
     if (type == WS_EVT_DATA) {
-        AwsFrameInfo* info = (AwsFrameInfo*)arg;
-        if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT) {
-            data[len] = 0;  // Null-terminate
-            auto message = String((char*)data);
-            handleCommand(client->id(), message);
+        const auto* info = static_cast<const AwsFrameInfo*>(arg);
+
+        // Fast path: whole message in one event, parsed in place (no copy)
+        if (info->num == 0 && info->final && info->index == 0 && info->len == len) [[likely]] {
+            dispatchMessage(client->id(), info->opcode, data, len);
+            return;
+        }
+
+        // Fragmented or split across TCP segments: rebuild in the arena
+        if (WsMessageAssembler::Message message; WsAssembler.feed(client->id(), *info, data, len, message)) {
+            dispatchMessage(client->id(), message.opcode, message.data, message.len);
+            WsAssembler.release(client->id());
         }
     }
 }
 
+void CommandDispatcher::dispatchMessage(uint32_t clientId, uint8_t opcode, const uint8_t* data, size_t len) {
+    if (len == 0) return;
+
+    if (opcode == WS_TEXT) {
+        _commandClientId = clientId;
+        handleCommand(static_cast<uint8_t>(clientId), reinterpret_cast<const char*>(data), len);
+        _commandClientId = 0;
+    } else if (opcode == WS_BINARY) {
+        handleBinaryFrame(data, len);
+    }
+}
+
+// ============================================================================
+// COMMAND TABLE
+// ============================================================================
+// One row per command: name, handler, timeline flags, argument schema.
+// Required arguments have no meaningful default; optional ones are only
+// type-checked when present (the handler keeps its historical default).
+// The perfect-hash index over the names is computed by the compiler.
+// ============================================================================
+
+const CommandDispatcher::CommandSpec* CommandDispatcher::findCommand(const char* cmd) {
+    using CommandTable::ArgType;
+    using CommandTable::req;
+    using CommandTable::opt;
+    using D = CommandDispatcher;
+
+    static constexpr std::array<CommandSpec, 58> COMMANDS = {{
+        // 1/9 Basic system
+        {"calibrate",             &D::cmdCalibrate,            CMD_NONE, {}},
+        {"start",                 &D::cmdStart,                CMD_SCHEDULABLE | CMD_PHASE_LOCKABLE,
+                                  {opt("distance", ArgType::NUMBER), opt("speed", ArgType::NUMBER)}},
+        {"pause",                 &D::cmdPause,                CMD_CANCELS_TIMELINE, {}},
+        {"stop",                  &D::cmdStop,                 CMD_CANCELS_TIMELINE, {}},
+        {"getStatus",             &D::cmdGetStatus,            CMD_NONE, {}},
+        {"syncTime",              &D::cmdSyncTime,             CMD_NONE, {req("time", ArgType::INTEGER)}},
+        {"returnToStart",         &D::cmdReturnToStart,        CMD_NONE, {}},
+        {"resetTotalDistance",    &D::cmdResetTotalDistance,   CMD_NONE, {}},
+        {"saveStats",             &D::cmdSaveStats,            CMD_NONE, {}},
+        {"setStatsRecording",     &D::cmdSetStatsRecording,    CMD_NONE, {opt("enabled", ArgType::BOOL)}},
+        {"setMaxDistanceLimit",   &D::cmdSetMaxDistanceLimit,  CMD_NONE, {opt("percent", ArgType::NUMBER)}},
+        {"setSensorsInverted",    &D::cmdSetSensorsInverted,   CMD_NONE, {req("inverted", ArgType::BOOL)}},
+        {"setAutoRecalibrate",    &D::cmdSetAutoRecalibrate,   CMD_NONE, {opt("enabled", ArgType::BOOL)}},
+        {"resetGovernor",         &D::cmdResetGovernor,        CMD_NONE, {}},
+        {"toggleDebug",           &D::cmdToggleDebug,          CMD_NONE, {}},
+        {"requestStats",          &D::cmdRequestStats,         CMD_NONE, {opt("enable", ArgType::BOOL)}},
+        {"telemetry",             &D::cmdTelemetry,            CMD_NONE,
+                                  {req("enable", ArgType::BOOL), opt("rate", ArgType::NUMBER)}},
+
+        // 2/9 Configuration
+        {"setDistance",           &D::cmdSetDistance,          CMD_NONE, {req("distance", ArgType::NUMBER)}},
+        {"setStartPosition",      &D::cmdSetStartPosition,     CMD_NONE, {req("startPosition", ArgType::NUMBER)}},
+        {"setSpeedForward",       &D::cmdSetSpeedForward,      CMD_NONE, {req("speed", ArgType::NUMBER)}},
+        {"setSpeedBackward",      &D::cmdSetSpeedBackward,     CMD_NONE, {req("speed", ArgType::NUMBER)}},
+
+        // 3/9 Zone effects
+        {"setZoneEffect",         &D::cmdSetZoneEffect,        CMD_NONE, {}},
+        {"setDecelZone",          &D::cmdSetZoneEffect,        CMD_NONE, {}},
+
+        // 4/9 Cycle pause
+        {"updateCyclePause",      &D::cmdUpdateCyclePause,     CMD_NONE, {}},
+        {"updateCyclePauseOsc",   &D::cmdUpdateCyclePauseOsc,  CMD_NONE, {}},
+
+        // 5/9 Pursuit (pursuitMove arrives at UI drag rate)
+        {"enablePursuitMode",     &D::cmdEnablePursuitMode,    CMD_NONE, {}},
+        {"disablePursuitMode",    &D::cmdDisablePursuitMode,   CMD_NONE, {}},
+        {"pursuitMove",           &D::cmdPursuitMove,          CMD_NONE,
+                                  {req("targetPosition", ArgType::NUMBER), opt("maxSpeed", ArgType::NUMBER)}},
+
+        // 6/9 Chaos
+        {"startChaos",            &D::cmdStartChaos,           CMD_SCHEDULABLE, {opt("patternsEnabled", ArgType::ARRAY)}},
+        {"stopChaos",             &D::cmdStopChaos,            CMD_CANCELS_TIMELINE, {}},
+        {"setChaosConfig",        &D::cmdSetChaosConfig,       CMD_NONE, {opt("patternsEnabled", ArgType::ARRAY)}},
+
+        // 7/9 Oscillation
+        {"setOscillation",        &D::cmdSetOscillation,       CMD_NONE, {}},
+        {"startOscillation",      &D::cmdStartOscillation,     CMD_SCHEDULABLE | CMD_PHASE_LOCKABLE, {}},
+        {"stopOscillation",       &D::cmdStopOscillation,      CMD_CANCELS_TIMELINE, {}},
+
+        // 8/9 Sequencer
+        {"addSequenceLine",       &D::cmdAddSequenceLine,      CMD_NONE, {}},
+        {"getSequenceTable",      &D::cmdGetSequenceTable,     CMD_NONE, {}},
+        {"clearSequence",         &D::cmdClearSequence,        CMD_NONE, {}},
+        {"deleteSequenceLine",    &D::cmdDeleteSequenceLine,   CMD_NONE, {req("lineId", ArgType::INTEGER)}},
+        {"updateSequenceLine",    &D::cmdUpdateSequenceLine,   CMD_NONE, {req("lineId", ArgType::INTEGER)}},
+        {"moveSequenceLine",      &D::cmdMoveSequenceLine,     CMD_NONE,
+                                  {req("lineId", ArgType::INTEGER), req("direction", ArgType::INTEGER)}},
+        {"reorderSequenceLine",   &D::cmdReorderSequenceLine,  CMD_NONE,
+                                  {req("lineId", ArgType::INTEGER), req("newIndex", ArgType::INTEGER)}},
+        {"duplicateSequenceLine", &D::cmdDuplicateSequenceLine, CMD_NONE, {req("lineId", ArgType::INTEGER)}},
+        {"toggleSequenceLine",    &D::cmdToggleSequenceLine,   CMD_NONE,
+                                  {req("lineId", ArgType::INTEGER), opt("enabled", ArgType::BOOL)}},
+        {"startSequence",         &D::cmdStartSequence,        CMD_SCHEDULABLE, {}},
+        {"loopSequence",          &D::cmdLoopSequence,         CMD_SCHEDULABLE, {}},
+        {"stopSequence",          &D::cmdStopSequence,         CMD_CANCELS_TIMELINE, {}},
+        {"toggleSequencePause",   &D::cmdToggleSequencePause,  CMD_NONE, {}},
+        {"skipSequenceLine",      &D::cmdSkipSequenceLine,     CMD_NONE, {}},
+        {"exportSequence",        &D::cmdExportSequence,       CMD_NONE, {}},
+        {"importSequence",        &D::cmdImportSequence,       CMD_NONE, {req("jsonData", ArgType::STRING)}},
+        {"saveSequence",          &D::cmdSaveSequence,         CMD_NONE, {req("name", ArgType::STRING)}},
+        {"loadSequence",          &D::cmdLoadSequence,         CMD_NONE, {req("name", ArgType::STRING)}},
+        {"deleteSavedSequence",   &D::cmdDeleteSavedSequence,  CMD_NONE, {req("name", ArgType::STRING)}},
+        {"listSequences",         &D::cmdListSequences,        CMD_NONE, {}},
+
+        // 9/9 Trajectory playback
+        {"startTrajectory",       &D::cmdStartTrajectory,      CMD_SCHEDULABLE,
+                                  {opt("loop", ArgType::BOOL), opt("stream", ArgType::BOOL)}},
+        {"stopTrajectory",        &D::cmdStopTrajectory,       CMD_CANCELS_TIMELINE, {}},
+        {"loadTrajectory",        &D::cmdLoadTrajectory,       CMD_NONE, {req("file", ArgType::STRING)}},
+        {"clearTrajectory",       &D::cmdClearTrajectory,      CMD_NONE, {}},
+    }};
+
+    // Why 512 slots? Load factor ≤ 1/8 up to 64 commands: a collision-free seed
+    // is found in a few dozen tries at compile time; costs 512 bytes of flash.
+    static constexpr auto INDEX = CommandTable::buildPerfectHash<512>(COMMANDS);
+    static_assert(INDEX.valid, "Duplicate command name (or command table outgrew 512 slots)");
+
+    return CommandTable::find(COMMANDS, INDEX, cmd);
+}
+
 // ============================================================================
 // MAIN COMMAND ROUTER
 // ============================================================================
 
-void CommandDispatcher::handleCommand([[maybe_unused]] uint8_t clientNum, const String& message) {
-    // Parse JSON
+void CommandDispatcher::handleCommand(uint8_t clientNum, const String& message) {
+    handleCommand(clientNum, message.c_str(), message.length());
+}
+
+void CommandDispatcher::handleCommand([[maybe_unused]] uint8_t clientNum, const char* json, size_t len) {
+    // Parse JSON (length-bounded: WebSocket payloads are not NUL-terminated)
     JsonDocument doc;
-    if (!parseJsonCommand(message, doc)) {
+    if (!parseJsonCommand(json, len, doc)) {
         return;  // Error already logged
     }
 
@@ -87,26 +230,85 @@ void CommandDispatcher::handleCommand([[maybe_unused]] uint8_t clientNum, const
         return;
     }
 
-    // Route to handlers - first match wins
-    if (handleBasicCommands(cmd, doc)) return;
-    if (handleConfigCommands(cmd, doc)) return;
-    if (handleDecelZoneCommands(cmd, doc, message)) return;
-    if (handleCyclePauseCommands(cmd, doc)) return;
-    if (handlePursuitCommands(cmd, doc)) return;
-    if (handleChaosCommands(cmd, doc, message)) return;
-    if (handleOscillationCommands(cmd, doc, message)) return;
-    if (handleSequencerCommands(cmd, doc, message)) return;
+    const CommandSpec* spec = findCommand(cmd);
+    if (!spec) [[unlikely]] {
+        engine->warn(String("Unknown command: ") + cmd);
+        return;
+    }
+
+    if (!checkArguments(*spec, doc)) return;
+
+    // Scheduled starts are parked and replayed later by networkTask
+    if (handleTimelineCommands(*spec, doc)) return;
 
-    // Unknown command
-    engine->warn(String("Unknown command: ") + cmd);
+    (this->*spec->handler)(doc);
+}
+
+// ============================================================================
+// BINARY FRAME ROUTER
+// ============================================================================
+
+/**
+ * Copy a fixed-size payload out of the frame (memcpy: frame data is unaligned)
+ * @return false on size mismatch (frame dropped)
+ */
+template <typename Frame>
+static bool readBinaryPayload(uint8_t opcode, const uint8_t* payload, size_t len, Frame& frame) {
+    if (len != sizeof(Frame)) [[unlikely]] {
+        engine->warn("Binary frame 0x" + String(opcode, HEX) + ": " + String(len) +
+                     " payload bytes, expected " + String(sizeof(Frame)));
+        return false;
+    }
+    memcpy(&frame, payload, sizeof(Frame));
+    return true;
+}
+
+void CommandDispatcher::handleBinaryFrame(const uint8_t* data, size_t len) {
+    uint8_t opcode = data[0];
+    const uint8_t* payload = data + 1;
+    size_t payloadLen = len - 1;
+
+    switch (opcode) {
+        case WS_BINARY_PURSUIT_MOVE: {
+            WsPursuitMoveFrame frame;
+            if (readBinaryPayload(opcode, payload, payloadLen, frame)) {
+                pursuitMove(frame.targetMM, frame.maxSpeedLevel);
+            }
+            break;
+        }
+        case WS_BINARY_SET_SPEED: {
+            WsSetSpeedFrame frame;
+            String errorMsg;
+            if (readBinaryPayload(opcode, payload, payloadLen, frame) && std::isfinite(frame.speedLevel) &&
+                validateAndReport(Validators::speed(frame.speedLevel, errorMsg), errorMsg)) {
+                BaseMovement.setSpeedForward(frame.speedLevel);
+                BaseMovement.setSpeedBackward(frame.speedLevel);
+            }
+            break;
+        }
+        case WS_BINARY_PAUSE:
+            Timeline.cancel();  // Same timeline semantics as the JSON command
+            BaseMovement.togglePause();
+            break;
+        case WS_BINARY_STOP:
+            Timeline.cancel();
+            BaseMovement.stop();
+            break;
+        case WS_BINARY_TRAJECTORY:
+            Trajectory.append(payload, payloadLen);
+            break;
+        default:
+            engine->warn("Unknown binary frame type 0x" + String(opcode, HEX));
+            break;
+    }
 }
 
 // ============================================================================
 // HELPER METHODS
 // ============================================================================
 
-bool CommandDispatcher::parseJsonCommand(const String& jsonStr, JsonDocument& doc) {
-    if (auto error = deserializeJson(doc, jsonStr); error) {
+bool CommandDispatcher::parseJsonCommand(const char* json, size_t len, JsonDocument& doc) {
+    if (auto error = deserializeJson(doc, json, len); error) {
         engine->error("JSON parse error: " + String(error.c_str()));
         Status.sendError("❌ Invalid JSON command: " + String(error.c_str()));
         return false;
@@ -123,212 +325,281 @@ bool CommandDispatcher::validateAndReport(bool isValid, const String& errorMsg)
     return isValid;
 }
 
-// ============================================================================
-// HANDLER 1/8: BASIC COMMANDS
-// ============================================================================
-
-bool CommandDispatcher::handleBasicCommands(const char* cmd, JsonDocument& doc) {
-    if (strcmp(cmd, "calibrate") == 0) {
-        engine->info("Command: Calibration (delegating to Core 1)");
-        // Don't call Calibration.startCalibration() directly from Core 0!
-        // Set flag to trigger calibration from motorTask (Core 1)
-        requestCalibration = true;
-        return true;
+static bool argTypeMatches(CommandTable::ArgType type, JsonVariantConst value) {
+    using enum CommandTable::ArgType;
+    switch (type) {
+        case NUMBER:  return value.is<float>();
+        case INTEGER: return value.is<int64_t>();
+        case BOOL:    return value.is<bool>();
+        case STRING:  return value.is<const char*>();
+        case ARRAY:   return value.is<JsonArrayConst>();
     }
+    return false;
+}
 
-    if (strcmp(cmd, "start") == 0) {
-        return cmdStart(doc);
-    }
+bool CommandDispatcher::checkArguments(const CommandSpec& spec, const JsonDocument& doc) {
+    for (const auto& arg : spec.args) {
+        if (!arg.name) break;
 
-    if (strcmp(cmd, "pause") == 0) {
-        engine->debug("Command: Pause/Resume");
-        BaseMovement.togglePause();  // Direct call to BaseMovement singleton
-        return true;
+        JsonVariantConst value = doc[arg.name];
+        if (value.isNull()) {
+            if (!arg.required) continue;
+            Status.sendError(String("❌ ") + spec.name + ": missing '" + arg.name + "'");
+            return false;
+        }
+        if (!argTypeMatches(arg.type, value)) {
+            Status.sendError(String("❌ ") + spec.name + ": '" + arg.name + "' must be " +
+                             CommandTable::argTypeName(arg.type));
+            return false;
+        }
     }
+    return true;
+}
 
-    if (strcmp(cmd, "stop") == 0) {
-        engine->info("Command: Stop");
-        BaseMovement.stop();  // Direct call to BaseMovement singleton
-        return true;
-    }
+// ============================================================================
+// PRE-HANDLER: MOTION TIMELINE (scheduled start / phase lock)
+// ============================================================================
 
-    if (strcmp(cmd, "getStatus") == 0) {
-        sendStatus();
-        return true;
+bool CommandDispatcher::handleTimelineCommands(const CommandSpec& spec, JsonDocument& doc) {
+    if (!(spec.flags & CMD_SCHEDULABLE)) {
+        if (spec.flags & CMD_CANCELS_TIMELINE) {
+            Timeline.cancel();
+        }
+        return false;
     }
 
-    if (strcmp(cmd, "syncTime") == 0) {
-        uint64_t epochMs = doc["time"] | (uint64_t)0;
-        if (epochMs > 0) {
-            StepperNetwork.syncTimeFromClient(epochMs);
+    bool phaseLockable = spec.flags & CMD_PHASE_LOCKABLE;
+
+    if (doc["startAt"].is<int64_t>()) {
+        auto startAtMs = doc["startAt"].as<int64_t>();
+        doc.remove("startAt");
+        if (phaseLockable && (doc["phaseLock"] | true) && !doc["phaseAnchor"].is<int64_t>()) {
+            doc["phaseAnchor"] = startAtMs;
         }
-        return true;
-    }
+        doc.remove("phaseLock");
 
-    if (strcmp(cmd, "returnToStart") == 0) {
-        engine->debug("Command: Return to start");
-        BaseMovement.returnToStart();  // Direct call to BaseMovement singleton
+        String deferred;
+        serializeJson(doc, deferred);
+        Timeline.schedule(spec.name, deferred, startAtMs);
         return true;
     }
 
-    if (strcmp(cmd, "resetTotalDistance") == 0) {
-        engine->debug("Command: Reset total distance");
-        engine->resetTotalDistance();
-        return true;
+    // Starting now: supersedes any pending start; follow an anchor if given
+    Timeline.cancel();
+    if (phaseLockable && doc["phaseAnchor"].is<int64_t>()) {
+        Timeline.lockPhase(doc["phaseAnchor"].as<int64_t>());
     }
+    return false;
+}
 
-    if (strcmp(cmd, "saveStats") == 0) {
-        engine->debug("Command: Save stats");
-        engine->saveCurrentSessionStats();
-        return true;
+// ============================================================================
+// HANDLERS 1/9: BASIC COMMANDS
+// ============================================================================
+
+void CommandDispatcher::cmdCalibrate(JsonDocument&) {
+    engine->info("Command: Calibration (delegating to Core 1)");
+    // Don't call Calibration.startCalibration() directly from Core 0!
+    // Set flag to trigger calibration from motorTask (Core 1)
+    requestCalibration = true;
+}
+
+void CommandDispatcher::cmdStart(JsonDocument& doc) {
+    // Guard: reject if calibration is pending or in progress
+    if (requestCalibration || calibrationInProgress) {
+        Status.sendError("⚠️ Calibration pending - cannot start movement");
+        return;
+    }
+    if (blockingMoveInProgress) {
+        Status.sendError("⚠️ Positioning in progress - cannot start movement");
+        return;
     }
 
-    if (strcmp(cmd, "setStatsRecording") == 0) {
-        bool enabled = doc["enabled"] | true;
-        if(!enabled) {
-            engine->saveCurrentSessionStats();
-        }
-        engine->resetTotalDistance();
-        engine->setStatsRecordingEnabled(enabled);
-        sendStatus();  // Update UI with new state
-        return true;
+    float dist = doc["distance"] | motion.targetDistanceMM;
+    float spd = doc["speed"] | motion.speedLevelForward;
+
+    String errorMsg;
+    if (!validateAndReport(Validators::motionRange(motion.startPositionMM, dist, errorMsg), errorMsg)) return;
+    if (!validateAndReport(Validators::speed(spd, errorMsg), errorMsg)) return;
+
+    engine->info("Command: Start movement (" + String(dist, 1) + "mm @ speed " + String(spd, 1) + ")");
+    BaseMovement.start(dist, spd);
+}
+
+void CommandDispatcher::cmdPause(JsonDocument&) {
+    engine->debug("Command: Pause/Resume");
+    BaseMovement.togglePause();  // Direct call to BaseMovement singleton
+}
+
+void CommandDispatcher::cmdStop(JsonDocument&) {
+    engine->info("Command: Stop");
+    BaseMovement.stop();  // Direct call to BaseMovement singleton
+}
+
+void CommandDispatcher::cmdGetStatus(JsonDocument&) {
+    Events.post(StatusEvent::REFRESH);
+}
+
+void CommandDispatcher::cmdSyncTime(JsonDocument& doc) {
+    if (uint64_t epochMs = doc["time"] | (uint64_t)0; epochMs > 0) {
+        StepperNetwork.syncTimeFromClient(epochMs);
     }
+}
 
-    if (handleSystemSettingsCommands(cmd, doc)) return true;
+void CommandDispatcher::cmdReturnToStart(JsonDocument&) {
+    engine->debug("Command: Return to start");
+    BaseMovement.returnToStart();  // Direct call to BaseMovement singleton
+}
 
-    return handleDebugAndStatsCommands(cmd, doc);
+void CommandDispatcher::cmdResetTotalDistance(JsonDocument&) {
+    engine->debug("Command: Reset total distance");
+    engine->resetTotalDistance();
 }
 
-bool CommandDispatcher::handleSystemSettingsCommands(const char* cmd, JsonDocument& doc) {
-    if (strcmp(cmd, "setMaxDistanceLimit") == 0) {
-        float percent = doc["percent"] | 100.0f;
-        if (percent < 50.0f || percent > 100.0f) {
-            Status.sendError("⚠️ Limit must be between 50% and 100% (received: " + String(percent, 0) + "%)");
-            return true;
-        }
-        if (config.currentState != STATE_READY) {
-            Status.sendError("⚠️ Cannot change limit - System must be in READY state");
-            return true;
-        }
-        maxDistanceLimitPercent = percent;
-        engine->updateEffectiveMaxDistance();
-        engine->info(String("✅ Travel limit: ") + String(percent, 0) + "% (" +
-              String(effectiveMaxDistanceMM, 1) + " mm / " + String(config.totalDistanceMM, 1) + " mm)");
-        sendStatus();
-        return true;
+void CommandDispatcher::cmdSaveStats(JsonDocument&) {
+    engine->debug("Command: Save stats");
+    engine->saveCurrentSessionStats();
+}
+
+void CommandDispatcher::cmdSetStatsRecording(JsonDocument& doc) {
+    bool enabled = doc["enabled"] | true;
+    if(!enabled) {
+        engine->saveCurrentSessionStats();
     }
+    engine->resetTotalDistance();
+    engine->setStatsRecordingEnabled(enabled);
+    Events.post(StatusEvent::CONFIG);  // Update UI with new state
+}
 
-    if (strcmp(cmd, "setSensorsInverted") == 0) {
-        bool inverted = doc["inverted"] | false;
-        if (config.currentState == STATE_RUNNING || config.currentState == STATE_CALIBRATING) {
-            Status.sendError("⚠️ Stop movement before changing sensor mode");
-            return true;
-        }
-        sensorsInverted = inverted;
-        engine->saveSensorsInverted();
-        config.currentState = STATE_INIT;
-        engine->info(String("🔄 Sensor mode: ") + (inverted ? "INVERTED (START↔END)" : "NORMAL"));
-        engine->warn("⚠️ Recalibration required after sensor mode change");
-        sendStatus();
-        return true;
+void CommandDispatcher::cmdSetMaxDistanceLimit(JsonDocument& doc) {
+    float percent = doc["percent"] | 100.0f;
+    if (percent < 50.0f || percent > 100.0f) {
+        Status.sendError("⚠️ Limit must be between 50% and 100% (received: " + String(percent, 0) + "%)");
+        return;
+    }
+    if (config.currentState != STATE_READY) {
+        Status.sendError("⚠️ Cannot change limit - System must be in READY state");
+        return;
     }
+    maxDistanceLimitPercent = percent;
+    engine->updateEffectiveMaxDistance();
+    engine->info(String("✅ Travel limit: ") + String(percent, 0) + "% (" +
+          String(effectiveMaxDistanceMM, 1) + " mm / " + String(config.totalDistanceMM, 1) + " mm)");
+    Events.post(StatusEvent::CONFIG);
+}
 
-    return false;
+void CommandDispatcher::cmdSetSensorsInverted(JsonDocument& doc) {
+    bool inverted = doc["inverted"] | false;
+    if (config.currentState == STATE_RUNNING || config.currentState == STATE_CALIBRATING) {
+        Status.sendError("⚠️ Stop movement before changing sensor mode");
+        return;
+    }
+    sensorsInverted = inverted;
+    engine->saveSensorsInverted();
+    config.currentState = STATE_INIT;
+    engine->info(String("🔄 Sensor mode: ") + (inverted ? "INVERTED (START↔END)" : "NORMAL"));
+    engine->warn("⚠️ Recalibration required after sensor mode change");
+    Events.post(StatusEvent::CONFIG);
 }
 
-bool CommandDispatcher::handleDebugAndStatsCommands(const char* cmd, JsonDocument& doc) {
-    if (strcmp(cmd, "toggleDebug") == 0) {
-        if (engine) {
-            using enum LogLevel;
-            LogLevel current = engine->getLogLevel();
-            LogLevel next = (current == LOG_DEBUG) ? LOG_INFO : LOG_DEBUG;
-            engine->setLogLevel(next);
-            engine->info(String("Log level set to: ") + (next == LOG_DEBUG ? "DEBUG" : "INFO"));
-        }
-        return true;
+void CommandDispatcher::cmdSetAutoRecalibrate(JsonDocument& doc) {
+    autoRecalibrate = doc["enabled"] | false;
+    engine->saveAutoRecalibrate();
+    Events.post(StatusEvent::CONFIG);
+}
+
+void CommandDispatcher::cmdResetGovernor(JsonDocument&) {
+    // Mechanics/load changed: relearn from hardware limits
+    Governor.requestReset();
+    Events.post(StatusEvent::CONFIG);
+}
+
+void CommandDispatcher::cmdToggleDebug(JsonDocument&) {
+    if (engine) {
+        using enum LogLevel;
+        LogLevel current = engine->getLogLevel();
+        LogLevel next = (current == LOG_DEBUG) ? LOG_INFO : LOG_DEBUG;
+        engine->setLogLevel(next);
+        engine->info(String("Log level set to: ") + (next == LOG_DEBUG ? "DEBUG" : "INFO"));
     }
+}
 
-    if (strcmp(cmd, "requestStats") == 0) {
-        bool enable = doc["enable"] | false;
-        statsRequested = enable;
-        engine->debug(String("📊 Stats tracking: ") + (enable ? "ENABLED" : "DISABLED"));
-        if (enable) {
-            engine->saveCurrentSessionStats();
-            sendStatus();
-        }
-        return true;
+void CommandDispatcher::cmdRequestStats(JsonDocument& doc) {
+    bool enable = doc["enable"] | false;
+    statsRequested = enable;
+    engine->debug(String("📊 Stats tracking: ") + (enable ? "ENABLED" : "DISABLED"));
+    if (enable) {
+        engine->saveCurrentSessionStats();
+        Events.post(StatusEvent::REFRESH);
     }
+}
 
-    return false;
+void CommandDispatcher::cmdTelemetry(JsonDocument& doc) {
+    bool enable = doc["enable"];
+    float rate = doc["rate"] | static_cast<float>(TELEMETRY_MAX_RATE_HZ);
+    auto rateHz = static_cast<uint32_t>(constrain(rate, 1.0f, static_cast<float>(TELEMETRY_MAX_RATE_HZ)));
+
+    if (!Telemetry.subscribe(_commandClientId, enable, rateHz)) {
+        Status.sendError("❌ Telemetry: " + String(TELEMETRY_MAX_SUBSCRIBERS) + " clients already subscribed");
+        return;
+    }
+    engine->debug(String("📡 Telemetry ") + (enable ? "on at " + String(rateHz) + " Hz" : String("off")) +
+                  " for client #" + String(_commandClientId));
 }
 
 // ============================================================================
-// HANDLER 2/8: CONFIG COMMANDS
+// HANDLERS 2/9: CONFIG COMMANDS
 // ============================================================================
 
-bool CommandDispatcher::handleConfigCommands(const char* cmd, JsonDocument& doc) {
-    if (strcmp(cmd, "setDistance") == 0) {
-        float dist = doc["distance"] | 0.0f;
-
-        if (String errorMsg; !validateAndReport(Validators::distance(dist, errorMsg), errorMsg)) return true;
+void CommandDispatcher::cmdSetDistance(JsonDocument& doc) {
+    float dist = doc["distance"] | 0.0f;
 
-        engine->debug("Command: Set distance (" + String(dist, 1) + "mm)");
-        BaseMovement.setDistance(dist);  // Direct call to BaseMovement singleton
-        return true;
-    }
+    if (String errorMsg; !validateAndReport(Validators::distance(dist, errorMsg), errorMsg)) return;
 
-    if (strcmp(cmd, "setStartPosition") == 0) {
-        float startPos = doc["startPosition"] | 0.0f;
+    engine->debug("Command: Set distance (" + String(dist, 1) + "mm)");
+    BaseMovement.setDistance(dist);  // Direct call to BaseMovement singleton
+}
 
-        if (String errorMsg; !validateAndReport(Validators::position(startPos, errorMsg), errorMsg)) return true;
+void CommandDispatcher::cmdSetStartPosition(JsonDocument& doc) {
+    float startPos = doc["startPosition"] | 0.0f;
 
-        engine->debug("Command: Set start position (" + String(startPos, 1) + "mm)");
-        BaseMovement.setStartPosition(startPos);  // Direct call to BaseMovement singleton
-        return true;
-    }
+    if (String errorMsg; !validateAndReport(Validators::position(startPos, errorMsg), errorMsg)) return;
 
-    if (strcmp(cmd, "setSpeedForward") == 0) {
-        float spd = doc["speed"] | 5.0f;
+    engine->debug("Command: Set start position (" + String(startPos, 1) + "mm)");
+    BaseMovement.setStartPosition(startPos);  // Direct call to BaseMovement singleton
+}
 
-        if (String errorMsg; !validateAndReport(Validators::speed(spd, errorMsg), errorMsg)) return true;
+void CommandDispatcher::cmdSetSpeedForward(JsonDocument& doc) {
+    float spd = doc["speed"] | 5.0f;
 
-        engine->debug("Command: Set forward speed (" + String(spd, 1) + ")");
-        BaseMovement.setSpeedForward(spd);  // Direct call to BaseMovement singleton
-        return true;
-    }
+    if (String errorMsg; !validateAndReport(Validators::speed(spd, errorMsg), errorMsg)) return;
 
-    if (strcmp(cmd, "setSpeedBackward") == 0) {
-        float spd = doc["speed"] | 5.0f;
+    engine->debug("Command: Set forward speed (" + String(spd, 1) + ")");
+    BaseMovement.setSpeedForward(spd);  // Direct call to BaseMovement singleton
+}
 
-        if (String errorMsg; !validateAndReport(Validators::speed(spd, errorMsg), errorMsg)) return true;
+void CommandDispatcher::cmdSetSpeedBackward(JsonDocument& doc) {
+    float spd = doc["speed"] | 5.0f;
 
-        engine->debug("Command: Set backward speed (" + String(spd, 1) + ")");
-        BaseMovement.setSpeedBackward(spd);  // Direct call to BaseMovement singleton
-        return true;
-    }
+    if (String errorMsg; !validateAndReport(Validators::speed(spd, errorMsg), errorMsg)) return;
 
-    return false;
+    engine->debug("Command: Set backward speed (" + String(spd, 1) + ")");
+    BaseMovement.setSpeedBackward(spd);  // Direct call to BaseMovement singleton
 }
 
 // ============================================================================
-// HANDLER 3/8: ZONE EFFECT COMMANDS (Speed + Special Effects)
+// HANDLERS 3/9: ZONE EFFECT COMMANDS (Speed + Special Effects)
 // ============================================================================
 
-bool CommandDispatcher::handleDecelZoneCommands(const char* cmd, JsonDocument& doc, const String& message) {
-    if (strcmp(cmd, "setDecelZone") == 0 || strcmp(cmd, "setZoneEffect") == 0) {
-        // motionMutex: zoneEffect is read by Core 1 (BaseMovement.process())
-        MutexGuard guard(motionMutex);
-        if (!guard) {
-            engine->warn("handleDecelZoneCommands: mutex timeout");
-            return true;
-        }
-
-        applyZoneEffectConfig(doc);
-        sendStatus();
-        return true;
+void CommandDispatcher::cmdSetZoneEffect(JsonDocument& doc) {
+    // motionMutex: zoneEffect is read by Core 1 (BaseMovement.process())
+    MutexGuard guard(motionMutex);
+    if (!guard) {
+        engine->warn("cmdSetZoneEffect: mutex timeout");
+        return;
     }
 
-    return false;
+    applyZoneEffectConfig(doc);
+    Events.post(StatusEvent::CONFIG);
 }
 
 void CommandDispatcher::applyZoneSettings(JsonDocument& doc) {
@@ -426,29 +697,23 @@ void CommandDispatcher::applyZoneEffectConfig(JsonDocument& doc) {
 }
 
 // ============================================================================
-// HANDLER 4/8: CYCLE PAUSE COMMANDS
+// HANDLERS 4/9: CYCLE PAUSE COMMANDS
 // ============================================================================
 
-bool CommandDispatcher::handleCyclePauseCommands(const char* cmd, JsonDocument& doc) {
-    if (strcmp(cmd, "updateCyclePause") == 0) {
-        // motionMutex: motion.cyclePause is read by Core 1 (BaseMovement.process())
-        MutexGuard guard(motionMutex);
-        if (!guard) { engine->warn("handleCyclePauseCommands: motionMutex timeout"); return true; }
-        applyCyclePauseConfig(motion.cyclePause, doc, "VAET");
-        sendStatus();
-        return true;
-    }
-
-    if (strcmp(cmd, "updateCyclePauseOsc") == 0) {
-        // stateMutex: oscillation.cyclePause is read by Core 1 (Osc.process())
-        MutexGuard guard(stateMutex);
-        if (!guard) { engine->warn("handleCyclePauseCommands: stateMutex timeout"); return true; }
-        applyCyclePauseConfig(oscillation.cyclePause, doc, "OSC");
-        sendStatus();
-        return true;
-    }
+void CommandDispatcher::cmdUpdateCyclePause(JsonDocument& doc) {
+    // motionMutex: motion.cyclePause is read by Core 1 (BaseMovement.process())
+    MutexGuard guard(motionMutex);
+    if (!guard) { engine->warn("cmdUpdateCyclePause: motionMutex timeout"); return; }
+    applyCyclePauseConfig(motion.cyclePause, doc, "VAET");
+    Events.post(StatusEvent::CONFIG);
+}
 
-    return false;
+void CommandDispatcher::cmdUpdateCyclePauseOsc(JsonDocument& doc) {
+    // stateMutex: oscillation.cyclePause is read by Core 1 (Osc.process())
+    MutexGuard guard(stateMutex);
+    if (!guard) { engine->warn("cmdUpdateCyclePauseOsc: stateMutex timeout"); return; }
+    applyCyclePauseConfig(oscillation.cyclePause, doc, "OSC");
+    Events.post(StatusEvent::CONFIG);
 }
 
 /**
@@ -478,112 +743,94 @@ void CommandDispatcher::applyCyclePauseConfig(CyclePauseConfig& target, JsonDocu
 }
 
 // ============================================================================
-// HANDLER 5/8: PURSUIT COMMANDS
+// HANDLERS 5/9: PURSUIT COMMANDS
 // ============================================================================
 
-bool CommandDispatcher::handlePursuitCommands(const char* cmd, JsonDocument& doc) {
-    if (strcmp(cmd, "enablePursuitMode") == 0) {
-        if (config.currentState == STATE_CALIBRATING) {
-            Status.sendError("⚠️ Cannot enable Pursuit mode: calibration in progress");
-            return true;
-        }
-        if (config.currentState == STATE_ERROR) {
-            Status.sendError("⚠️ Cannot enable Pursuit mode: system in error state");
-            return true;
-        }
+void CommandDispatcher::cmdEnablePursuitMode(JsonDocument&) {
+    if (config.currentState == STATE_CALIBRATING) {
+        Status.sendError("⚠️ Cannot enable Pursuit mode: calibration in progress");
+        return;
+    }
+    if (config.currentState == STATE_ERROR) {
+        Status.sendError("⚠️ Cannot enable Pursuit mode: system in error state");
+        return;
+    }
 
-        if (seqState.isRunning) {
-            SeqExecutor.stop();
-        }
+    if (seqState.isRunning) {
+        SeqExecutor.stop();
+    }
 
-        currentMovement = MOVEMENT_PURSUIT;
-        config.executionContext = CONTEXT_STANDALONE;
+    currentMovement = MOVEMENT_PURSUIT;
+    config.executionContext = CONTEXT_STANDALONE;
 
-        // Protected state change (Core 0 → Core 1 safety)
-        {
-            MutexGuard guard(stateMutex);
-            if (guard && config.currentState == STATE_RUNNING) {
-                config.currentState = STATE_READY;
-            }
+    // Protected state change (Core 0 → Core 1 safety)
+    {
+        MutexGuard guard(stateMutex);
+        if (guard && config.currentState == STATE_RUNNING) {
+            config.currentState = STATE_READY;
         }
-
-        engine->debug("✅ Pursuit mode enabled");
-        sendStatus();
-        return true;
     }
 
-    if (strcmp(cmd, "disablePursuitMode") == 0) {
-        Pursuit.stop();
-        if (currentMovement == MOVEMENT_PURSUIT) {
-            currentMovement = MOVEMENT_VAET;
-        }
-
-        // Protected state change (Core 0 → Core 1 safety)
-        {
-            MutexGuard guard(stateMutex);
-            if (guard && config.currentState == STATE_RUNNING) {
-                config.currentState = STATE_READY;
-            }
-        }
+    engine->debug("✅ Pursuit mode enabled");
+    Events.post(StatusEvent::STATE);
+}
 
-        engine->debug("✅ Pursuit mode disabled");
-        sendStatus();
-        return true;
+void CommandDispatcher::cmdDisablePursuitMode(JsonDocument&) {
+    Pursuit.stop();
+    if (currentMovement == MOVEMENT_PURSUIT) {
+        currentMovement = MOVEMENT_VAET;
     }
 
-    if (strcmp(cmd, "pursuitMove") == 0) {
-        if (currentMovement != MOVEMENT_PURSUIT) {
-            engine->warn("pursuitMove ignored: not in PURSUIT mode");
-            return true;
-        }
-        if (config.currentState == STATE_CALIBRATING) {
-            engine->warn("pursuitMove ignored: calibration in progress");
-            return true;
+    // Protected state change (Core 0 → Core 1 safety)
+    {
+        MutexGuard guard(stateMutex);
+        if (guard && config.currentState == STATE_RUNNING) {
+            config.currentState = STATE_READY;
         }
+    }
 
-        float targetPos = doc["targetPosition"] | 0.0f;
-        float maxSpd = doc["maxSpeed"] | 10.0f;
+    engine->debug("✅ Pursuit mode disabled");
+    Events.post(StatusEvent::STATE);
+}
 
-        String errorMsg;
-        if (!validateAndReport(Validators::speed(maxSpd, errorMsg), errorMsg)) return true;
+void CommandDispatcher::cmdPursuitMove(JsonDocument& doc) {
+    pursuitMove(doc["targetPosition"] | 0.0f, doc["maxSpeed"] | 10.0f);
+}
 
-        Pursuit.move(targetPos, maxSpd);
-        return true;
+void CommandDispatcher::pursuitMove(float targetMM, float maxSpeedLevel) {
+    if (currentMovement != MOVEMENT_PURSUIT) {
+        engine->warn("pursuitMove ignored: not in PURSUIT mode");
+        return;
+    }
+    if (config.currentState == STATE_CALIBRATING) {
+        engine->warn("pursuitMove ignored: calibration in progress");
+        return;
+    }
+    if (!std::isfinite(targetMM)) [[unlikely]] {
+        engine->warn("pursuitMove ignored: invalid target");
+        return;
     }
 
-    return false;
+    String errorMsg;  // Empty String: no allocation unless validation fails
+    if (!validateAndReport(Validators::speed(maxSpeedLevel, errorMsg), errorMsg)) return;
+
+    Pursuit.move(targetMM, maxSpeedLevel);
 }
 
 // ============================================================================
-// HANDLER 6/8: CHAOS COMMANDS
+// HANDLERS 6/9: CHAOS COMMANDS
 // ============================================================================
 
-bool CommandDispatcher::handleChaosCommands(const char* cmd, JsonDocument& doc, [[maybe_unused]] const String& message) {
-    if (strcmp(cmd, "startChaos") == 0) {
-        if (config.currentState == STATE_CALIBRATING) {
-            Status.sendError("⚠️ Cannot start Chaos mode: calibration in progress");
-            return true;
-        }
-        if (config.currentState == STATE_ERROR) {
-            Status.sendError("⚠️ Cannot start Chaos mode: system in error state");
-            return true;
-        }
-        return cmdStartChaos(doc);
-    }
-
-    if (strcmp(cmd, "stopChaos") == 0) {
-        Chaos.stop();
-        return true;
+void CommandDispatcher::cmdStartChaos(JsonDocument& doc) {
+    if (config.currentState == STATE_CALIBRATING) {
+        Status.sendError("⚠️ Cannot start Chaos mode: calibration in progress");
+        return;
     }
-
-    if (strcmp(cmd, "setChaosConfig") == 0) {
-        return cmdSetChaosConfig(doc);
+    if (config.currentState == STATE_ERROR) {
+        Status.sendError("⚠️ Cannot start Chaos mode: system in error state");
+        return;
     }
 
-    return false;
-}
-
-bool CommandDispatcher::cmdStartChaos(JsonDocument& doc) {
     float effectiveMax = Validators::getMaxAllowedMM();
     chaos.centerPositionMM = doc["centerPositionMM"] | (effectiveMax / 2.0f);
     chaos.amplitudeMM = doc["amplitudeMM"] | 50.0f;
@@ -599,7 +846,7 @@ bool CommandDispatcher::cmdStartChaos(JsonDocument& doc) {
 
     if (String errorMsg; !validateAndReport(Validators::chaosParams(chaos.centerPositionMM, chaos.amplitudeMM,
         chaos.maxSpeedLevel, chaos.crazinessPercent, errorMsg), errorMsg)) {
-        return true;
+        return;
     }
 
     // Parse patterns array
@@ -615,10 +862,13 @@ bool CommandDispatcher::cmdStartChaos(JsonDocument& doc) {
           String(chaos.maxSpeedLevel, 1) + ", craziness=" + String(chaos.crazinessPercent, 0) + "%");
 
     Chaos.start();
-    return true;
 }
 
-bool CommandDispatcher::cmdSetChaosConfig(JsonDocument& doc) {
+void CommandDispatcher::cmdStopChaos(JsonDocument&) {
+    Chaos.stop();
+}
+
+void CommandDispatcher::cmdSetChaosConfig(JsonDocument& doc) {
     chaos.centerPositionMM = doc["centerPositionMM"] | chaos.centerPositionMM;
     chaos.amplitudeMM = doc["amplitudeMM"] | chaos.amplitudeMM;
     chaos.maxSpeedLevel = doc["maxSpeedLevel"] | chaos.maxSpeedLevel;
@@ -630,7 +880,7 @@ bool CommandDispatcher::cmdSetChaosConfig(JsonDocument& doc) {
 
     if (String errorMsg; !validateAndReport(Validators::chaosParams(chaos.centerPositionMM, chaos.amplitudeMM,
         chaos.maxSpeedLevel, chaos.crazinessPercent, errorMsg), errorMsg)) {
-        return true;
+        return;
     }
 
     if (!chaosState.isRunning) {
@@ -656,182 +906,68 @@ bool CommandDispatcher::cmdSetChaosConfig(JsonDocument& doc) {
         chaosState.nextPatternChangeTime = millis();
     }
 
-    sendStatus();
-    return true;
+    Events.post(StatusEvent::CONFIG);
 }
 
 // ============================================================================
-// HANDLER 7/8: OSCILLATION COMMANDS
+// HANDLERS 7/9: OSCILLATION COMMANDS
 // ============================================================================
 
-bool CommandDispatcher::handleOscillationCommands(const char* cmd, JsonDocument& doc, [[maybe_unused]] const String& message) {
-    if (strcmp(cmd, "setOscillation") == 0) {
-        return applyOscillationConfig(doc);
-    }
-
-    if (strcmp(cmd, "startOscillation") == 0) {
-        if (config.currentState == STATE_INIT || config.currentState == STATE_CALIBRATING) {
-            Status.sendError("⚠️ Calibration required before starting oscillation");
-            return true;
-        }
-
-        if (seqState.isRunning) {
-            SeqExecutor.stop();
-        }
-
-        if (config.currentState == STATE_RUNNING) {
-            stopMovement();
-        }
-
-        Osc.start();
-        sendStatus();
-        return true;
-    }
-
-    if (strcmp(cmd, "stopOscillation") == 0) {
-        if (currentMovement == MOVEMENT_OSC) {
-            stopMovement();
-            currentMovement = MOVEMENT_VAET;
-        }
-
-        if (seqState.isRunning) {
-            SeqExecutor.stop();
+/**
+ * Superposed partials / center drift keys of setOscillation (all optional):
+ *   harmonics: [{frequencyHz, amplitudeMM, phase, waveform}, ...] replaces the list ([] clears)
+ *   driftAmplitudeMM, driftPeriodSec
+ */
+static bool parseOscillationHarmonics(const JsonDocument& doc, OscillationHarmonics& harmonics, String& errorMsg) {
+    if (JsonArrayConst partials = doc["harmonics"]; !partials.isNull()) {
+        if (partials.size() > OSC_MAX_HARMONICS) {
+            errorMsg = "Too many partials (max: " + String(OSC_MAX_HARMONICS) + ")";
+            return false;
         }
-
-        sendStatus();
-        return true;
-    }
-
-    return false;
-}
-
-// ============================================================================
-// HANDLER 8/8: SEQUENCER COMMANDS
-// ============================================================================
-
-bool CommandDispatcher::handleSequencerCommands(const char* cmd, JsonDocument& doc, [[maybe_unused]] const String& message) {
-    if (handleSequencerCRUD(cmd, doc)) return true;
-    if (handleSequencerControl(cmd)) return true;
-    if (handleSequencerIO(cmd, doc)) return true;
-    return false;
-}
-
-bool CommandDispatcher::handleSequencerCRUD(const char* cmd, JsonDocument& doc) {
-    if (strcmp(cmd, "addSequenceLine") == 0)       return cmdAddSequenceLine(doc);
-    if (strcmp(cmd, "getSequenceTable") == 0)       { SeqTable.broadcast(); return true; }
-    if (strcmp(cmd, "clearSequence") == 0)           { SeqTable.clear(); SeqTable.broadcast(); return true; }
-
-    if (strcmp(cmd, "deleteSequenceLine") == 0) {
-        int lineId = doc["lineId"] | -1;
-        if (lineId < 0) { Status.sendError("❌ Invalid Line ID"); return true; }
-        SeqTable.deleteLine(lineId);
-        SeqTable.broadcast();
-        return true;
-    }
-
-    if (strcmp(cmd, "updateSequenceLine") == 0) {
-        int lineId = doc["lineId"] | -1;
-        SequenceLine updatedLine = SeqTable.parseFromJson(doc);
-        if (auto err = SeqTable.validatePhysics(updatedLine); !err.isEmpty()) {
-            Status.sendError("❌ Invalid line: " + err);
-            return true;
+        harmonics.count = 0;
+        for (JsonObjectConst source : partials) {
+            OscillationPartial& partial = harmonics.partials[harmonics.count++];
+            partial.frequencyHz = source["frequencyHz"] | 1.0f;
+            partial.amplitudeMM = source["amplitudeMM"] | 0.0f;
+            partial.phase = source["phase"] | 0.0f;
+            int waveform = source["waveform"] | 0;
+            if (waveform < 0 || waveform > (int)OscillationWaveform::OSC_CUSTOM) {
+                errorMsg = "Partial " + String(harmonics.count) + ": unknown waveform " + String(waveform);
+                return false;
+            }
+            partial.waveform = (OscillationWaveform)waveform;
         }
-        SeqTable.updateLine(lineId, updatedLine);
-        SeqTable.broadcast();
-        return true;
-    }
-
-    if (strcmp(cmd, "moveSequenceLine") == 0) {
-        SeqTable.moveLine(doc["lineId"] | -1, doc["direction"] | 0);
-        SeqTable.broadcast();
-        return true;
     }
-
-    if (strcmp(cmd, "reorderSequenceLine") == 0) {
-        SeqTable.reorderLine(doc["lineId"] | -1, doc["newIndex"] | -1);
-        SeqTable.broadcast();
-        return true;
-    }
-
-    if (strcmp(cmd, "duplicateSequenceLine") == 0) {
-        SeqTable.duplicateLine(doc["lineId"] | -1);
-        SeqTable.broadcast();
-        return true;
-    }
-
-    if (strcmp(cmd, "toggleSequenceLine") == 0) {
-        SeqTable.toggleLine(doc["lineId"] | -1, doc["enabled"] | false);
-        SeqTable.broadcast();
-        return true;
-    }
-
-    return false;
-}
-
-bool CommandDispatcher::handleSequencerControl(const char* cmd) {
-    if (strcmp(cmd, "startSequence") == 0)       { SeqExecutor.start(false); SeqExecutor.sendStatus(); return true; }
-    if (strcmp(cmd, "loopSequence") == 0)        { SeqExecutor.start(true);  SeqExecutor.sendStatus(); return true; }
-    if (strcmp(cmd, "stopSequence") == 0)        { SeqExecutor.stop();        SeqExecutor.sendStatus(); return true; }
-    if (strcmp(cmd, "toggleSequencePause") == 0) { SeqExecutor.togglePause(); SeqExecutor.sendStatus(); return true; }
-    if (strcmp(cmd, "skipSequenceLine") == 0)    { SeqExecutor.skipToNextLine(); SeqExecutor.sendStatus(); return true; }
-    return false;
+    harmonics.driftAmplitudeMM = doc["driftAmplitudeMM"] | harmonics.driftAmplitudeMM;
+    harmonics.driftPeriodSec = doc["driftPeriodSec"] | harmonics.driftPeriodSec;
+    return true;
 }
 
-bool CommandDispatcher::handleSequencerIO(const char* cmd, JsonDocument& doc) {
-    if (strcmp(cmd, "exportSequence") == 0) {
-        SeqTable.sendJsonResponse("exportData", SeqTable.exportToJson());
-        return true;
-    }
-
-    if (strcmp(cmd, "importSequence") == 0) {
-        if (const char* jsonData = doc["jsonData"]; jsonData) {
-            SeqTable.importFromJson(String(jsonData));
-            SeqTable.broadcast();
-        } else {
-            Status.sendError("❌ Import error: missing jsonData field");
-        }
-        return true;
+/** true if the config plays OSC_CUSTOM (main or a partial) */
+static bool usesCustomWaveform(const OscillationConfig& cfg) {
+    if (cfg.waveform == OscillationWaveform::OSC_CUSTOM) return true;
+    for (uint8_t idx = 0; idx < cfg.harmonics.count; ++idx) {
+        if (cfg.harmonics.partials[idx].waveform == OscillationWaveform::OSC_CUSTOM) return true;
     }
-
     return false;
 }
 
-// ============================================================================
-// EXTRACTED COMMAND BODIES (reduce cognitive complexity of handlers)
-// ============================================================================
-
-bool CommandDispatcher::cmdStart(JsonDocument& doc) {
-    // Guard: reject if calibration is pending or in progress
-    if (requestCalibration || calibrationInProgress) {
-        Status.sendError("⚠️ Calibration pending - cannot start movement");
-        return true;
-    }
-
-    float dist = doc["distance"] | motion.targetDistanceMM;
-    float spd = doc["speed"] | motion.speedLevelForward;
-
-    String errorMsg;
-    if (!validateAndReport(Validators::motionRange(motion.startPositionMM, dist, errorMsg), errorMsg)) return true;
-    if (!validateAndReport(Validators::speed(spd, errorMsg), errorMsg)) return true;
-
-    engine->info("Command: Start movement (" + String(dist, 1) + "mm @ speed " + String(spd, 1) + ")");
-    BaseMovement.start(dist, spd);
-    return true;
-}
-
-bool CommandDispatcher::applyOscillationConfig(JsonDocument& doc) {
+void CommandDispatcher::cmdSetOscillation(JsonDocument& doc) {
     // stateMutex: oscillation/oscillationState are read by Core 1 (Osc.process())
     MutexGuard guard(stateMutex);
-    if (!guard) { engine->warn("applyOscillationConfig: stateMutex timeout"); return true; }
+    if (!guard) { engine->warn("cmdSetOscillation: stateMutex timeout"); return; }
 
     float oldCenter = oscillation.centerPositionMM;
     float oldAmplitude = oscillation.amplitudeMM;
     float oldFrequency = oscillation.frequencyHz;
     OscillationWaveform oldWaveform = oscillation.waveform;
+    OscillationHarmonics oldHarmonics = oscillation.harmonics;
 
     oscillation.centerPositionMM = doc["centerPositionMM"] | oscillation.centerPositionMM;
     oscillation.amplitudeMM = doc["amplitudeMM"] | oscillation.amplitudeMM;
-    oscillation.waveform = (OscillationWaveform)(doc["waveform"] | (int)oscillation.waveform);
+    if (int waveform = doc["waveform"] | (int)oscillation.waveform; waveform >= 0 && waveform <= (int)OscillationWaveform::OSC_CUSTOM) {
+        oscillation.waveform = (OscillationWaveform)waveform;
+    }
     oscillation.frequencyHz = doc["frequencyHz"] | oscillation.frequencyHz;
 
     oscillation.enableRampIn = doc["enableRampIn"] | oscillation.enableRampIn;
@@ -857,20 +993,28 @@ bool CommandDispatcher::applyOscillationConfig(JsonDocument& doc) {
         oscillation.cyclePause.maxPauseSec = doc["cyclePauseMaxSec"] | 3.0f;
     }
 
+    String errorMsg;
+    bool harmonicsParsed = parseOscillationHarmonics(doc, oscillation.harmonics, errorMsg);
+
     // Validate BEFORE applying transitions (rollback on failure)
-    if (String errorMsg; !validateAndReport(Validators::oscillationParams(oscillation.centerPositionMM,
-        oscillation.amplitudeMM, oscillation.frequencyHz, errorMsg), errorMsg)) {
+    bool customMissing = usesCustomWaveform(oscillation) && Waveforms.activeTable() == nullptr;
+    if (customMissing) Status.sendError("❌ No custom waveform selected - upload one first");
+    if (customMissing || !validateAndReport(harmonicsParsed &&
+            Validators::oscillationParams(oscillation.centerPositionMM, oscillation.amplitudeMM,
+                                          oscillation.frequencyHz, errorMsg) &&
+            Validators::oscillationHarmonics(oscillation, errorMsg), errorMsg)) {
         oscillation.centerPositionMM = oldCenter;
         oscillation.amplitudeMM = oldAmplitude;
         oscillation.frequencyHz = oldFrequency;
         oscillation.waveform = oldWaveform;
-        return true;
+        oscillation.harmonics = oldHarmonics;
+        return;
     }
 
     applyOscillationLiveTransitions(oldCenter, oldAmplitude, oldFrequency, oldWaveform);
+    oscillationState.harmonicsChanged = true;  // Core 1 reloads partials, keeping their phase
 
-    sendStatus();
-    return true;
+    Events.post(StatusEvent::CONFIG);
 }
 
 void CommandDispatcher::applyOscillationLiveTransitions(float oldCenter, float oldAmplitude,
@@ -889,55 +1033,236 @@ void CommandDispatcher::applyOscillationLiveTransitions(float oldCenter, float o
 
     if (!isOscRunning) return;
 
+    // S-curve blends (Core 1 plays them); a change mid-blend starts from the value being played
+    unsigned long nowMs = millis();
+    auto blendFrom = [nowMs](bool active, unsigned long startMs, float from, float to,
+                             unsigned long durationMs, float previous) {
+        return active ? Transition::at(from, to, nowMs - startMs, durationMs) : previous;
+    };
+
+    if (oldFrequency != oscillation.frequencyHz) {
+        oscillationState.oldFrequencyHz = blendFrom(oscillationState.isTransitioning, oscillationState.transitionStartMs,
+                                                    oscillationState.oldFrequencyHz, oscillationState.targetFrequencyHz,
+                                                    OSC_FREQ_TRANSITION_DURATION_MS, oldFrequency);
+        oscillationState.targetFrequencyHz = oscillation.frequencyHz;
+        oscillationState.transitionStartMs = nowMs;
+        oscillationState.isTransitioning = true;
+    }
+
     if (oldCenter != oscillation.centerPositionMM) {
-        oscillationState.isCenterTransitioning = true;
-        oscillationState.centerTransitionStartMs = millis();
-        oscillationState.oldCenterMM = oldCenter;
+        oscillationState.oldCenterMM = blendFrom(oscillationState.isCenterTransitioning, oscillationState.centerTransitionStartMs,
+                                                 oscillationState.oldCenterMM, oscillationState.targetCenterMM,
+                                                 OSC_CENTER_TRANSITION_DURATION_MS, oldCenter);
         oscillationState.targetCenterMM = oscillation.centerPositionMM;
+        oscillationState.centerTransitionStartMs = nowMs;
+        oscillationState.isCenterTransitioning = true;
     }
 
     if (oldAmplitude != oscillation.amplitudeMM) {
-        oscillationState.isAmplitudeTransitioning = true;
-        oscillationState.amplitudeTransitionStartMs = millis();
-        oscillationState.oldAmplitudeMM = oldAmplitude;
+        oscillationState.oldAmplitudeMM = blendFrom(oscillationState.isAmplitudeTransitioning, oscillationState.amplitudeTransitionStartMs,
+                                                    oscillationState.oldAmplitudeMM, oscillationState.targetAmplitudeMM,
+                                                    OSC_AMPLITUDE_TRANSITION_DURATION_MS, oldAmplitude);
         oscillationState.targetAmplitudeMM = oscillation.amplitudeMM;
+        oscillationState.amplitudeTransitionStartMs = nowMs;
+        oscillationState.isAmplitudeTransitioning = true;
     }
 
     oscillationState.isRampingIn = false;
     oscillationState.isRampingOut = false;
 }
 
-bool CommandDispatcher::cmdAddSequenceLine(const JsonDocument& doc) {
+void CommandDispatcher::cmdStartOscillation(JsonDocument&) {
+    if (config.currentState == STATE_INIT || config.currentState == STATE_CALIBRATING) {
+        Status.sendError("⚠️ Calibration required before starting oscillation");
+        return;
+    }
+
+    if (seqState.isRunning) {
+        SeqExecutor.stop();
+    }
+
+    if (config.currentState == STATE_RUNNING) {
+        stopMovement();
+    }
+
+    Osc.start();
+    Events.post(StatusEvent::STATE);
+}
+
+void CommandDispatcher::cmdStopOscillation(JsonDocument&) {
+    if (currentMovement == MOVEMENT_OSC) {
+        stopMovement();
+        currentMovement = MOVEMENT_VAET;
+    }
+
+    if (seqState.isRunning) {
+        SeqExecutor.stop();
+    }
+
+    Events.post(StatusEvent::STATE);
+}
+
+// ============================================================================
+// HANDLERS 8/9: SEQUENCER COMMANDS
+// ============================================================================
+
+void CommandDispatcher::cmdAddSequenceLine(JsonDocument& doc) {
     SequenceLine newLine = SeqTable.parseFromJson(doc);
 
     if (auto validationError = SeqTable.validatePhysics(newLine); !validationError.isEmpty()) {
         Status.sendError("❌ Invalid line: " + validationError);
-        return true;
+        return;
     }
 
     String errorMsg;
     if (newLine.movementType == MOVEMENT_VAET) {
-        if (!validateAndReport(Validators::speed(newLine.speedForward, errorMsg), errorMsg)) return true;
-        if (!validateAndReport(Validators::speed(newLine.speedBackward, errorMsg), errorMsg)) return true;
+        if (!validateAndReport(Validators::speed(newLine.speedForward, errorMsg), errorMsg)) return;
+        if (!validateAndReport(Validators::speed(newLine.speedBackward, errorMsg), errorMsg)) return;
     } else if (newLine.movementType == MOVEMENT_OSC) {
         if (newLine.oscFrequencyHz <= 0 || newLine.oscFrequencyHz > 10.0f) {
             Status.sendError("❌ Frequency must be 0.01-10 Hz");
-            return true;
+            return;
         }
     } else if (newLine.movementType == MOVEMENT_CHAOS) {
-        if (!validateAndReport(Validators::speed(newLine.chaosMaxSpeedLevel, errorMsg), errorMsg)) return true;
+        if (!validateAndReport(Validators::speed(newLine.chaosMaxSpeedLevel, errorMsg), errorMsg)) return;
         if (newLine.chaosDurationSeconds < 1 || newLine.chaosDurationSeconds > 3600) {
             Status.sendError("❌ Duration must be 1-3600 seconds");
-            return true;
+            return;
         }
     }
 
     if (newLine.cycleCount < 1 || newLine.cycleCount > 9999) {
         Status.sendError("❌ Cycle count must be 1-9999 (received: " + String(newLine.cycleCount) + ")");
-        return true;
+        return;
     }
 
     SeqTable.addLine(newLine);
     SeqTable.broadcast();
-    return true;
-}
\ No newline at end of file
+}
+
+void CommandDispatcher::cmdGetSequenceTable(JsonDocument&) {
+    SeqTable.broadcast();
+}
+
+void CommandDispatcher::cmdClearSequence(JsonDocument&) {
+    SeqTable.clear();
+    SeqTable.broadcast();
+}
+
+void CommandDispatcher::cmdDeleteSequenceLine(JsonDocument& doc) {
+    int lineId = doc["lineId"] | -1;
+    if (lineId < 0) { Status.sendError("❌ Invalid Line ID"); return; }
+    SeqTable.deleteLine(lineId);
+    SeqTable.broadcast();
+}
+
+void CommandDispatcher::cmdUpdateSequenceLine(JsonDocument& doc) {
+    int lineId = doc["lineId"] | -1;
+    SequenceLine updatedLine = SeqTable.parseFromJson(doc);
+    if (auto err = SeqTable.validatePhysics(updatedLine); !err.isEmpty()) {
+        Status.sendError("❌ Invalid line: " + err);
+        return;
+    }
+    SeqTable.updateLine(lineId, updatedLine);
+    SeqTable.broadcast();
+}
+
+void CommandDispatcher::cmdMoveSequenceLine(JsonDocument& doc) {
+    SeqTable.moveLine(doc["lineId"] | -1, doc["direction"] | 0);
+    SeqTable.broadcast();
+}
+
+void CommandDispatcher::cmdReorderSequenceLine(JsonDocument& doc) {
+    SeqTable.reorderLine(doc["lineId"] | -1, doc["newIndex"] | -1);
+    SeqTable.broadcast();
+}
+
+void CommandDispatcher::cmdDuplicateSequenceLine(JsonDocument& doc) {
+    SeqTable.duplicateLine(doc["lineId"] | -1);
+    SeqTable.broadcast();
+}
+
+void CommandDispatcher::cmdToggleSequenceLine(JsonDocument& doc) {
+    SeqTable.toggleLine(doc["lineId"] | -1, doc["enabled"] | false);
+    SeqTable.broadcast();
+}
+
+void CommandDispatcher::cmdStartSequence(JsonDocument&)       { SeqExecutor.start(false);      Events.post(StatusEvent::SEQUENCE); }
+void CommandDispatcher::cmdLoopSequence(JsonDocument&)        { SeqExecutor.start(true);       Events.post(StatusEvent::SEQUENCE); }
+void CommandDispatcher::cmdStopSequence(JsonDocument&)        { SeqExecutor.stop();            Events.post(StatusEvent::SEQUENCE); }
+void CommandDispatcher::cmdToggleSequencePause(JsonDocument&) { SeqExecutor.togglePause();     Events.post(StatusEvent::SEQUENCE); }
+void CommandDispatcher::cmdSkipSequenceLine(JsonDocument&)    { SeqExecutor.skipToNextLine();  Events.post(StatusEvent::SEQUENCE); }
+
+void CommandDispatcher::cmdExportSequence(JsonDocument&) {
+    SeqTable.sendJsonResponse("exportData", SeqTable.exportToJson());
+}
+
+void CommandDispatcher::cmdImportSequence(JsonDocument& doc) {
+    const char* jsonData = doc["jsonData"];
+    SeqTable.importFromJson(jsonData, strlen(jsonData));
+    SeqTable.broadcast();
+}
+
+void CommandDispatcher::cmdSaveSequence(JsonDocument& doc) {
+    if (SeqTable.saveNamed(doc["name"].as<String>())) {
+        SeqTable.broadcast();  // Table now carries its name
+        SeqTable.sendJsonResponse("sequenceList", SeqTable.listNamedJson());
+    }
+}
+
+void CommandDispatcher::cmdLoadSequence(JsonDocument& doc) {
+    if (SeqTable.loadNamed(doc["name"].as<String>()) >= 0) {
+        SeqTable.broadcast();
+    }
+}
+
+void CommandDispatcher::cmdDeleteSavedSequence(JsonDocument& doc) {
+    if (SeqTable.deleteNamed(doc["name"].as<String>())) {
+        SeqTable.sendJsonResponse("sequenceList", SeqTable.listNamedJson());
+    }
+}
+
+void CommandDispatcher::cmdListSequences(JsonDocument&) {
+    SeqTable.sendJsonResponse("sequenceList", SeqTable.listNamedJson());
+}
+
+// ============================================================================
+// HANDLERS 9/9: TRAJECTORY COMMANDS
+// ============================================================================
+
+void CommandDispatcher::cmdStartTrajectory(JsonDocument& doc) {
+    if (config.currentState == STATE_INIT || config.currentState == STATE_CALIBRATING) {
+        Status.sendError("⚠️ Calibration required before starting trajectory playback");
+        return;
+    }
+
+    if (seqState.isRunning) {
+        SeqExecutor.stop();
+    }
+
+    if (config.currentState == STATE_RUNNING) {
+        stopMovement();
+    }
+
+    Trajectory.start(doc["loop"] | false, doc["stream"] | false);
+    Events.post(StatusEvent::STATE);
+}
+
+void CommandDispatcher::cmdStopTrajectory(JsonDocument&) {
+    if (currentMovement == MOVEMENT_TRAJECTORY) {
+        stopMovement();  // BaseMovement.stop() ends playback, buffer kept
+    }
+    Events.post(StatusEvent::STATE);
+}
+
+void CommandDispatcher::cmdLoadTrajectory(JsonDocument& doc) {
+    Trajectory.loadFile(doc["file"].as<const char*>());
+    Events.post(StatusEvent::CONFIG);
+}
+
+void CommandDispatcher::cmdClearTrajectory(JsonDocument&) {
+    if (!Trajectory.clear()) {
+        Status.sendError("❌ Stop trajectory playback before clearing the buffer");
+    }
+    Events.post(StatusEvent::CONFIG);
+}
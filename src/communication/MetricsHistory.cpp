@@ -0,0 +1,179 @@
+// ============================================================================
+// METRICS_HISTORY.CPP - On-device time series for long-run dashboards
+// ============================================================================
+
+#include "communication/MetricsHistory.h"
+#include <WiFi.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include "core/GlobalState.h"
+#include "core/MovementMath.h"
+#include "core/TimeUtils.h"
+#include "core/UtilityEngine.h"
+
+using MetricsSeries::Sample;
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+MetricsHistory& MetricsHistory::getInstance() {
+    static MetricsHistory instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+/** Seconds since boot from the 64-bit timer: millis() / 1000 wraps after 49.7 days */
+static uint32_t uptimeSeconds() {
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000000);
+}
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+void MetricsHistory::begin() {
+    std::array<uint32_t, MetricsSeries::RESOLUTION_COUNT> depths = {
+        METRICS_SECONDS_DEPTH, METRICS_MINUTES_DEPTH, METRICS_HOURS_DEPTH};
+    size_t total = 0;
+    for (uint32_t depth : depths) total += depth;
+
+    // Allocated once and never freed
+    auto* storage = static_cast<Sample*>(heap_caps_malloc(total * sizeof(Sample), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    if (storage == nullptr) {
+        total = 0;
+        for (uint32_t& depth : depths) {
+            depth /= METRICS_INTERNAL_DEPTH_DIVISOR;
+            total += depth;
+        }
+        storage = static_cast<Sample*>(malloc(total * sizeof(Sample)));
+        engine->warn("⚠️ Metrics history: no PSRAM, using internal RAM (" + String(depths[0]) + "s of 1s samples)");
+    }
+
+    m_mutex = xSemaphoreCreateMutex();
+    if (storage == nullptr || m_mutex == nullptr) {
+        engine->error("❌ Metrics history allocation failed - /api/metrics disabled");
+        return;
+    }
+
+    for (size_t res = 0; res < depths.size(); ++res) {
+        m_series.rings[res].attach(storage, depths[res]);
+        storage += depths[res];
+    }
+
+    OdometerCounters counters = stats.odometer.snapshot();
+    m_lastSteps = counters.totalSteps;
+    m_lastReversals = counters.reversals;
+    m_lastSampleMs = millis();
+    m_ready = true;
+    engine->info("📈 Metrics history ready (" + String(total * sizeof(Sample) / 1024) + " KB)");
+}
+
+// ============================================================================
+// SAMPLING
+// ============================================================================
+
+void MetricsHistory::noteMotorLoop(bool active) {
+    uint32_t now = micros();
+    if (!active) {
+        m_loopPrevMicros = 0;
+        return;
+    }
+    if (m_loopPrevMicros != 0) {
+        uint32_t gap = now - m_loopPrevMicros;
+        uint32_t seen = m_loopMaxGapUs.load(std::memory_order_relaxed);
+        while (gap > seen && !m_loopMaxGapUs.compare_exchange_weak(seen, gap, std::memory_order_relaxed)) {
+            // seen reloaded by compare_exchange_weak
+        }
+    }
+    m_loopPrevMicros = now;
+}
+
+void MetricsHistory::update() {
+    if (!m_ready) return;
+    unsigned long nowMs = millis();
+    unsigned long elapsedMs = nowMs - m_lastSampleMs;
+    if (elapsedMs < METRICS_SAMPLE_INTERVAL_MS) return;
+    m_lastSampleMs = nowMs;
+
+    Sample sample = takeSample(uptimeSeconds(), elapsedMs);
+
+    MutexGuard guard(m_mutex);
+    if (guard) m_series.push(sample);
+}
+
+Sample MetricsHistory::takeSample(uint32_t uptimeSec, uint32_t elapsedMs) {
+    using MetricsSeries::clampTo;
+
+    // Motion rates from the odometer: steps → mm/s, reversals / 2 → cycles
+    OdometerCounters counters = stats.odometer.snapshot();
+    uint64_t steps = counters.totalSteps - m_lastSteps;
+    uint64_t reversals = counters.reversals - m_lastReversals;
+    m_lastSteps = counters.totalSteps;
+    m_lastReversals = counters.reversals;
+
+    Sample sample;
+    sample.uptimeSec = uptimeSec;
+    sample.count = 1;
+    sample.speedDmmS = clampTo<uint16_t>(
+        static_cast<int64_t>(MovementMath::stepCountToMM(steps) * 10000.0 / elapsedMs));
+    sample.cpmX10 = clampTo<uint16_t>(static_cast<int64_t>(reversals * 300000 / elapsedMs));
+    sample.heapFreeKB = clampTo<uint16_t>(ESP.getFreeHeap() / 1024);
+    sample.psramFreeKB = clampTo<uint16_t>(ESP.getFreePsram() / 1024);
+    sample.jitterUs = clampTo<uint16_t>(m_loopMaxGapUs.exchange(0, std::memory_order_relaxed));
+    sample.tempDeciC = clampTo<int16_t>(lroundf(temperatureRead() * 10.0f));
+    sample.rssi = WiFi.status() == WL_CONNECTED ? clampTo<int8_t>(WiFi.RSSI()) : 0;
+    return sample;
+}
+
+// ============================================================================
+// DOWNLOAD
+// ============================================================================
+
+MetricsHistory::Range MetricsHistory::openRange(MetricsSeries::Resolution resolution, uint32_t sinceUptimeSec) {
+    Range range;
+    range.resolution = resolution;
+    range.uptimeSec = uptimeSeconds();
+    range.epochSec = TimeUtils::isSynchronized() ? static_cast<uint32_t>(TimeUtils::epochSeconds()) : 0;
+    if (!m_ready) return range;
+
+    MutexGuard guard(m_mutex);
+    if (!guard) return range;
+    const MetricsSeries::Ring& ring = m_series.rings[resolution];
+    range.first = sinceUptimeSec > 0 ? ring.firstAfter(sinceUptimeSec) : ring.begin();
+    range.count = MetricsSeries::clampTo<uint16_t>(static_cast<int64_t>(ring.end()) - range.first);
+    return range;
+}
+
+size_t MetricsHistory::readRange(const Range& range, uint8_t* out, size_t maxLen, size_t offset) {
+    size_t total = rangeBytes(range);
+    if (offset >= total) return 0;
+    size_t length = std::min(maxLen, total - offset);
+    size_t written = 0;
+
+    if (offset < HEADER_SIZE) {
+        uint8_t header[HEADER_SIZE] = {'M', 'T', 'R', VERSION};
+        memcpy(header + 4, &range.uptimeSec, 4);
+        memcpy(header + 8, &range.epochSec, 4);
+        auto sampleSize = static_cast<uint16_t>(sizeof(Sample));
+        memcpy(header + 12, &sampleSize, 2);
+        memcpy(header + 14, &range.count, 2);
+
+        written = std::min(length, HEADER_SIZE - offset);
+        memcpy(out, header + offset, written);
+    }
+
+    MutexGuard guard(m_mutex);
+    const MetricsSeries::Ring& ring = m_series.rings[range.resolution];
+    while (written < length) {
+        size_t position = offset + written - HEADER_SIZE;
+        size_t index = position / sizeof(Sample);
+        size_t within = position % sizeof(Sample);
+
+        Sample sample;
+        if (guard) ring.read(range.first + index, sample);  // Overwritten: empty sample
+        size_t chunk = std::min(sizeof(Sample) - within, length - written);
+        memcpy(out + written, reinterpret_cast<const uint8_t*>(&sample) + within, chunk);
+        written += chunk;
+    }
+    return written;
+}
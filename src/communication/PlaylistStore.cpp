@@ -0,0 +1,398 @@
+// ============================================================================
+// PLAYLIST_STORE.CPP - Saved presets, one LittleFS record per preset
+// ============================================================================
+
+#include "communication/PlaylistStore.h"
+#include "core/TimeUtils.h"
+#include "core/UtilityEngine.h"
+#include "core/filesystem/FileSystem.h"
+#include <LittleFS.h>
+#include <algorithm>
+#include <vector>
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+PlaylistStore& PlaylistStore::getInstance() {
+    static PlaylistStore instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+static String indexPath() {
+    return String(PLAYLIST_DIR) + "/index.json";
+}
+
+/** Replace path with doc (FileSystem::writeAtomic), @return bytes written (0 on failure) */
+static size_t writeAside(const String& path, const JsonDocument& doc) {
+    size_t written = 0;
+    bool saved = FileSystem::writeAtomic(path, [&doc, &written](File& file) {
+        written = serializeJson(doc, file);
+        return written > 0;
+    });
+    return saved ? written : 0;
+}
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+void PlaylistStore::begin() {
+    if (!engine->isFilesystemReady()) {
+        engine->error("❌ Playlist store: LittleFS not mounted");
+        return;
+    }
+
+    if (!LittleFS.exists(PLAYLIST_DIR)) LittleFS.mkdir(PLAYLIST_DIR);
+    for (const char* mode : MODES) {
+        String dir = String(PLAYLIST_DIR) + "/" + mode;
+        if (!LittleFS.exists(dir)) LittleFS.mkdir(dir);
+    }
+
+    bool indexLoaded = loadIndex();
+    if (!indexLoaded) {
+        if (LittleFS.exists(indexPath())) engine->warn("⚠️ Playlist index unreadable - rebuilding from records");
+        rebuildIndex();
+    }
+    migrateLegacyFile();
+    if (!indexLoaded) saveIndex();
+
+    m_ready = true;
+    engine->info("📋 Playlist store ready (" + String(m_count) + " presets)");
+}
+
+int PlaylistStore::modeIndex(const char* mode) {
+    if (mode == nullptr) return -1;
+    for (size_t idx = 0; idx < MODES.size(); ++idx) {
+        if (strcmp(mode, MODES[idx]) == 0) return static_cast<int>(idx);
+    }
+    return -1;
+}
+
+size_t PlaylistStore::count(int mode) const {
+    size_t total = 0;
+    for (size_t pos = 0; pos < m_count; ++pos) {
+        if (m_entries[pos].mode == mode) ++total;
+    }
+    return total;
+}
+
+// ============================================================================
+// RECORDS
+// ============================================================================
+
+String PlaylistStore::recordPath(int mode, int id) {
+    return String(PLAYLIST_DIR) + "/" + MODES[mode] + "/" + String(id) + ".json";
+}
+
+int PlaylistStore::find(int mode, int id) const {
+    for (size_t pos = 0; pos < m_count; ++pos) {
+        if (m_entries[pos].mode == mode && m_entries[pos].id == id) return static_cast<int>(pos);
+    }
+    return -1;
+}
+
+size_t PlaylistStore::writeRecord(int mode, int id, const JsonDocument& record) {
+    size_t written = writeAside(recordPath(mode, id), record);
+    if (written == 0) engine->error("❌ Failed to write preset " + recordPath(mode, id));
+    return written;
+}
+
+bool PlaylistStore::readRecord(int mode, int id, JsonDocument& record) {
+    String path = recordPath(mode, id);
+    File file = LittleFS.open(path, "r");
+    if (!file) {
+        engine->warn("⚠️ Preset record missing: " + path);
+        return false;
+    }
+
+    DeserializationError error = deserializeJson(record, file);
+    file.close();
+    if (error) {
+        // Keep the bytes for inspection, out of the way of later listings
+        engine->error("❌ Preset record corrupted (" + String(error.c_str()) + "): " + path);
+        LittleFS.rename(path, path + ".corrupted");
+        return false;
+    }
+    return true;
+}
+
+void PlaylistStore::eraseEntry(int position) {
+    for (size_t pos = position; pos + 1 < m_count; ++pos) {
+        m_entries[pos] = std::move(m_entries[pos + 1]);
+    }
+    --m_count;
+}
+
+PlaylistStore::Result PlaylistStore::add(int mode, const char* name, JsonVariantConst config, int& outId) {
+    if (mode < 0 || mode >= static_cast<int>(MODES.size())) return Result::UNKNOWN_MODE;
+    if (count(mode) >= MAX_PRESETS_PER_MODE || m_count >= MAX_ENTRIES) return Result::FULL;
+
+    int nextId = 1;
+    for (size_t pos = 0; pos < m_count; ++pos) {
+        if (m_entries[pos].mode == mode && m_entries[pos].id >= nextId) nextId = m_entries[pos].id + 1;
+    }
+
+    auto timestamp = static_cast<uint32_t>(TimeUtils::epochSeconds());
+    JsonDocument record;
+    record["id"] = nextId;
+    record["name"] = name;
+    record["timestamp"] = timestamp;
+    record["config"] = config;
+
+    size_t size = writeRecord(mode, nextId, record);
+    if (size == 0) return Result::IO_ERROR;
+
+    Entry& entry = m_entries[m_count++];
+    entry.id = static_cast<uint16_t>(nextId);
+    entry.mode = static_cast<uint8_t>(mode);
+    entry.size = size;
+    entry.timestamp = timestamp;
+    entry.name = name;
+
+    if (!saveIndex()) {
+        LittleFS.remove(recordPath(mode, nextId));
+        --m_count;
+        return Result::IO_ERROR;
+    }
+
+    outId = nextId;
+    return Result::OK;
+}
+
+PlaylistStore::Result PlaylistStore::update(int mode, int id, const char* name, JsonVariantConst config) {
+    if (mode < 0 || mode >= static_cast<int>(MODES.size())) return Result::UNKNOWN_MODE;
+    int position = find(mode, id);
+    if (position < 0) return Result::NOT_FOUND;
+
+    JsonDocument record;
+    if (!readRecord(mode, id, record)) {
+        eraseEntry(position);
+        saveIndex();
+        return Result::NOT_FOUND;
+    }
+
+    if (name != nullptr) record["name"] = name;
+    if (!config.isNull()) record["config"] = config;
+
+    size_t size = writeRecord(mode, id, record);
+    if (size == 0) return Result::IO_ERROR;
+
+    Entry& entry = m_entries[position];
+    entry.size = size;
+    if (name != nullptr) entry.name = name;
+    return saveIndex() ? Result::OK : Result::IO_ERROR;
+}
+
+PlaylistStore::Result PlaylistStore::remove(int mode, int id) {
+    if (mode < 0 || mode >= static_cast<int>(MODES.size())) return Result::UNKNOWN_MODE;
+    int position = find(mode, id);
+    if (position < 0) return Result::NOT_FOUND;
+
+    String path = recordPath(mode, id);
+    if (LittleFS.exists(path) && !LittleFS.remove(path)) return Result::IO_ERROR;
+
+    eraseEntry(position);
+    return saveIndex() ? Result::OK : Result::IO_ERROR;
+}
+
+PlaylistStore::Result PlaylistStore::writePreset(int mode, int id, Print& out) {
+    if (mode < 0 || mode >= static_cast<int>(MODES.size())) return Result::UNKNOWN_MODE;
+    int position = find(mode, id);
+    if (position < 0) return Result::NOT_FOUND;
+
+    JsonDocument record;
+    if (!readRecord(mode, id, record)) {
+        eraseEntry(position);
+        saveIndex();
+        return Result::NOT_FOUND;
+    }
+
+    serializeJson(record, out);
+    return Result::OK;
+}
+
+// ============================================================================
+// LISTINGS
+// ============================================================================
+
+void PlaylistStore::writeAll(Print& out) {
+    bool indexChanged = false;
+    JsonDocument record;
+
+    out.print('{');
+    for (size_t mode = 0; mode < MODES.size(); ++mode) {
+        if (mode > 0) out.print(',');
+        out.print('"');
+        out.print(MODES[mode]);
+        out.print("\":[");
+
+        bool first = true;
+        for (size_t pos = 0; pos < m_count;) {
+            const Entry& entry = m_entries[pos];
+            if (entry.mode != mode) {
+                ++pos;
+                continue;
+            }
+            record.clear();
+            if (!readRecord(static_cast<int>(mode), entry.id, record)) {
+                eraseEntry(static_cast<int>(pos));  // Only this preset is lost
+                indexChanged = true;
+                continue;
+            }
+            if (!first) out.print(',');
+            serializeJson(record, out);
+            first = false;
+            ++pos;
+        }
+        out.print(']');
+    }
+    out.print('}');
+
+    if (indexChanged) saveIndex();
+}
+
+void PlaylistStore::writePage(int mode, size_t offset, size_t limit, Print& out) const {
+    JsonDocument doc;
+    doc["mode"] = MODES[mode];
+    doc["total"] = count(mode);
+    doc["offset"] = offset;
+    JsonArray presets = doc["presets"].to<JsonArray>();
+
+    size_t seen = 0;
+    for (size_t pos = 0; pos < m_count && presets.size() < limit; ++pos) {
+        const Entry& entry = m_entries[pos];
+        if (entry.mode != mode || seen++ < offset) continue;
+        JsonObject item = presets.add<JsonObject>();
+        item["id"] = entry.id;
+        item["name"] = entry.name;
+        item["size"] = entry.size;
+        item["timestamp"] = entry.timestamp;
+    }
+
+    serializeJson(doc, out);
+}
+
+// ============================================================================
+// INDEX
+// ============================================================================
+
+bool PlaylistStore::loadIndex() {
+    File file = LittleFS.open(indexPath(), "r");
+    if (!file) return false;
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+    if (error || !doc.is<JsonArray>()) return false;
+
+    m_count = 0;
+    for (JsonObjectConst item : doc.as<JsonArrayConst>()) {
+        int mode = modeIndex(item["mode"]);
+        int id = item["id"] | 0;
+        if (mode < 0 || id <= 0 || m_count >= MAX_ENTRIES) continue;
+
+        Entry& entry = m_entries[m_count++];
+        entry.id = static_cast<uint16_t>(id);
+        entry.mode = static_cast<uint8_t>(mode);
+        entry.size = item["size"] | 0;
+        entry.timestamp = item["timestamp"] | 0;
+        entry.name = item["name"] | "";
+    }
+    return true;
+}
+
+bool PlaylistStore::saveIndex() const {
+    JsonDocument doc;
+    JsonArray list = doc.to<JsonArray>();
+    for (size_t pos = 0; pos < m_count; ++pos) {
+        const Entry& entry = m_entries[pos];
+        JsonObject item = list.add<JsonObject>();
+        item["id"] = entry.id;
+        item["mode"] = MODES[entry.mode];
+        item["name"] = entry.name;
+        item["size"] = entry.size;
+        item["timestamp"] = entry.timestamp;
+    }
+
+    if (writeAside(indexPath(), doc) == 0) {
+        engine->error("❌ Failed to write playlist index");
+        return false;
+    }
+    return true;
+}
+
+void PlaylistStore::rebuildIndex() {
+    m_count = 0;
+    JsonDocument record;
+
+    for (size_t mode = 0; mode < MODES.size(); ++mode) {
+        // Collect IDs first: readRecord() may rename files while we iterate
+        std::vector<int> ids;
+        File dir = LittleFS.open(String(PLAYLIST_DIR) + "/" + MODES[mode]);
+        if (dir && dir.isDirectory()) {
+            for (File file = dir.openNextFile(); file; file = dir.openNextFile()) {
+                String fileName = file.name();
+                file.close();
+                if (fileName.endsWith(".json") && fileName.toInt() > 0) ids.push_back(fileName.toInt());
+            }
+        }
+        std::sort(ids.begin(), ids.end());
+
+        for (int id : ids) {
+            if (m_count >= MAX_ENTRIES || count(static_cast<int>(mode)) >= MAX_PRESETS_PER_MODE) break;
+            record.clear();
+            if (!readRecord(static_cast<int>(mode), id, record)) continue;
+
+            Entry& entry = m_entries[m_count++];
+            entry.id = static_cast<uint16_t>(id);
+            entry.mode = static_cast<uint8_t>(mode);
+            entry.size = measureJson(record);
+            entry.timestamp = record["timestamp"] | 0;
+            entry.name = record["name"] | "";
+        }
+    }
+    engine->info("📋 Playlist index rebuilt (" + String(m_count) + " presets)");
+}
+
+void PlaylistStore::migrateLegacyFile() {
+    if (!LittleFS.exists(PLAYLIST_FILE_PATH)) return;
+
+    JsonDocument legacy;
+    if (!engine->loadJsonFile(PLAYLIST_FILE_PATH, legacy)) {
+        LittleFS.rename(PLAYLIST_FILE_PATH, String(PLAYLIST_FILE_PATH) + ".corrupted");
+        engine->warn("⚠️ Legacy playlist file unreadable - kept as .corrupted");
+        return;
+    }
+
+    size_t migrated = 0;
+    JsonDocument record;
+    for (size_t mode = 0; mode < MODES.size(); ++mode) {
+        for (JsonObjectConst preset : legacy[MODES[mode]].as<JsonArrayConst>()) {
+            if (m_count >= MAX_ENTRIES || count(static_cast<int>(mode)) >= MAX_PRESETS_PER_MODE) break;
+            int id = preset["id"] | 0;
+            if (id <= 0 || find(static_cast<int>(mode), id) >= 0) continue;
+
+            record.clear();
+            record["id"] = id;
+            record["name"] = preset["name"] | "";
+            record["timestamp"] = preset["timestamp"] | 0;
+            record["config"] = preset["config"];
+            size_t size = writeRecord(static_cast<int>(mode), id, record);
+            if (size == 0) continue;
+
+            Entry& entry = m_entries[m_count++];
+            entry.id = static_cast<uint16_t>(id);
+            entry.mode = static_cast<uint8_t>(mode);
+            entry.size = size;
+            entry.timestamp = record["timestamp"];
+            entry.name = record["name"].as<String>();
+            ++migrated;
+        }
+    }
+
+    if (saveIndex()) {
+        LittleFS.rename(PLAYLIST_FILE_PATH, String(PLAYLIST_FILE_PATH) + ".migrated");
+        engine->info("📋 Migrated " + String(migrated) + " presets from " + String(PLAYLIST_FILE_PATH));
+    }
+}
@@ -8,6 +8,7 @@
 
 #include "communication/StatusBroadcaster.h"
 #include "communication/NetworkManager.h"
+#include "communication/StatusEvents.h"
 #include "core/MovementMath.h"
 #include "movement/ChaosController.h"
 #include "movement/OscillationController.h"
@@ -15,6 +16,11 @@
 #include "movement/BaseMovementController.h"
 #include "movement/SequenceExecutor.h"
 #include "core/UtilityEngine.h"
+#include "hardware/PositionVerifier.h"
+#include "movement/StepRateGovernor.h"
+#include "movement/MotionTimeline.h"
+#include "movement/TrajectoryPlayer.h"
+#include "core/TimeUtils.h"
 #include <WiFi.h>
 
 using enum SystemState;
@@ -33,22 +39,49 @@ StatusBroadcaster& StatusBroadcaster::getInstance() {
 // DRY HELPERS
 // ============================================================================
 
-void StatusBroadcaster::addCyclePauseFields(JsonObject parentObj, const CyclePauseConfig& pauseConfig, const CyclePauseState& pauseState) {
-    JsonObject pauseObj = parentObj["cyclePause"].to<JsonObject>();
-    pauseObj["enabled"] = pauseConfig.enabled;
-    pauseObj["isRandom"] = pauseConfig.isRandom;
-    pauseObj["pauseDurationSec"] = serialized(String(pauseConfig.pauseDurationSec, 1));
-    pauseObj["minPauseSec"] = serialized(String(pauseConfig.minPauseSec, 1));
-    pauseObj["maxPauseSec"] = serialized(String(pauseConfig.maxPauseSec, 1));
-    pauseObj["isPausing"] = pauseState.isPausing;
-
-    if (pauseState.isPausing) {
-        unsigned long elapsedMs = millis() - pauseState.pauseStartMs;
-        long remainingMs = (long)pauseState.currentPauseDuration - (long)elapsedMs;
-        pauseObj["remainingMs"] = max(0L, remainingMs);
-    } else {
-        pauseObj["remainingMs"] = 0;
-    }
+/** Serialize a document filled by fill(doc) */
+template <typename Fill>
+static String toJson(Fill fill) {
+    JsonDocument doc;
+    fill(doc);
+    String text;
+    serializeJson(doc, text);
+    return text;
+}
+
+/** Splice two serialized objects: {"a":1} + {"b":2} → {"a":1,"b":2} */
+static String mergeObjects(const String& cached, const String& live) {
+    if (cached.length() <= 2) return live;
+    if (live.length() <= 2) return cached;
+    String merged;
+    merged.reserve(cached.length() + live.length());
+    merged.concat(cached.c_str(), cached.length() - 1);
+    merged += ',';
+    merged += live.c_str() + 1;
+    return merged;
+}
+
+String StatusBroadcaster::cyclePauseJson(PauseSection& section, const CyclePauseConfig& pauseConfig, const CyclePauseState& pauseState) {
+    const String& configText = section.get(pauseConfig, [](const CyclePauseConfig& config) {
+        return toJson([&config](JsonDocument& pauseObj) {
+            pauseObj["enabled"] = config.enabled;
+            pauseObj["isRandom"] = config.isRandom;
+            pauseObj["pauseDurationSec"] = serialized(String(config.pauseDurationSec, 1));
+            pauseObj["minPauseSec"] = serialized(String(config.minPauseSec, 1));
+            pauseObj["maxPauseSec"] = serialized(String(config.maxPauseSec, 1));
+        });
+    });
+
+    return mergeObjects(configText, toJson([&pauseState](JsonDocument& pauseObj) {
+        pauseObj["isPausing"] = pauseState.isPausing;
+        if (pauseState.isPausing) {
+            unsigned long elapsedMs = millis() - pauseState.pauseStartMs;
+            long remainingMs = (long)pauseState.currentPauseDuration - (long)elapsedMs;
+            pauseObj["remainingMs"] = max(0L, remainingMs);
+        } else {
+            pauseObj["remainingMs"] = 0;
+        }
+    }));
 }
 
 // ============================================================================
@@ -57,6 +90,19 @@ void StatusBroadcaster::addCyclePauseFields(JsonObject parentObj, const CyclePau
 
 void StatusBroadcaster::begin(AsyncWebSocket* ws) {
     _webSocket = ws;
+
+    // Every change event except sequencer progress (its own message) means a new status
+    constexpr uint32_t STATUS_EVENTS = StatusEventBus::bit(StatusEvent::STATE) | StatusEventBus::bit(StatusEvent::CONFIG) |
+                                       StatusEventBus::bit(StatusEvent::REFRESH);
+    Events.subscribe(STATUS_EVENTS, [](uint32_t events) {
+        if (events & StatusEventBus::bit(StatusEvent::REFRESH)) Status.resetHash();
+        Status.send();
+    });
+    // Errors queued by motion and hardware code (either core) are sent from here
+    Events.subscribe(StatusEventBus::bit(StatusEvent::ERROR), [](uint32_t) {
+        std::array<char, StatusEventBus::ERROR_MESSAGE_SIZE> message;
+        while (Events.takeError(message)) Status.sendError(String(message.data()));
+    });
     engine->info("StatusBroadcaster initialized");
 }
 
@@ -70,6 +116,11 @@ unsigned long StatusBroadcaster::getAdaptiveBroadcastInterval() const {
         return STATUS_UPLOAD_INTERVAL_MS;     // 2000ms (0.5 Hz) - reduce load during upload
     }
 
+    // Positioning moves run in READY state: keep position feedback live
+    if (blockingMoveInProgress) {
+        return STATUS_UPDATE_INTERVAL_MS;
+    }
+
     // Pursuit mode gets highest priority for fast feedback
     if (currentMovement == MOVEMENT_PURSUIT) {
         return STATUS_PURSUIT_INTERVAL_MS;       // 50ms (20 Hz) - real-time gauge tracking
@@ -136,7 +187,7 @@ void StatusBroadcaster::send() {
 
     // Calculate derived values
     float positionMM = MovementMath::stepsToMM(currentStep);
-    float totalTraveledMM = MovementMath::stepsToMM(stats.totalDistanceTraveled);
+    double totalTraveledMM = MovementMath::stepCountToMM(stats.sessionSteps());
 
     // Validation state - canStart controls UI visibility (tabs shown after calibration)
     bool canStart = (config.totalDistanceMM > 0);  // Show UI after calibration
@@ -176,6 +227,9 @@ void StatusBroadcaster::send() {
     doc["apClients"] = StepperNetwork.getAPClientCount();  // Number of AP clients
     doc["wdState"] = (int)StepperNetwork.getWatchdogState();  // Watchdog: 0=healthy, 1=soft, 2=hard, 3=reboot
 
+    addPositionVerifyFields(doc);
+    addTimelineFields(doc);
+
     // ============================================================================
     // MODE-SPECIFIC FIELDS
     // ============================================================================
@@ -190,6 +244,11 @@ void StatusBroadcaster::send() {
         addChaosFields(doc);
     }
 
+    // Buffer state stays visible after playback (upload progress, replay)
+    if (currentMovement == MOVEMENT_TRAJECTORY || Trajectory.getCount() > 0) {
+        addTrajectoryFields(doc);
+    }
+
     // ============================================================================
     // SYSTEM STATS (On-Demand)
     // ============================================================================
@@ -259,58 +318,60 @@ void StatusBroadcaster::sendError(const String& message) {
 // ============================================================================
 
 void StatusBroadcaster::addVaEtVientFields(JsonDocument& doc) {
-    // Motion-specific derived values
-    float cyclesPerMinForward = MovementMath::speedLevelToCPM(motion.speedLevelForward);
-    float cyclesPerMinBackward = MovementMath::speedLevelToCPM(motion.speedLevelBackward);
-
-    // Motion object (nested)
-    JsonObject motionObj = doc["motion"].to<JsonObject>();
-    motionObj["startPositionMM"] = serialized(String(motion.startPositionMM, 2));
-    motionObj["targetDistanceMM"] = serialized(String(motion.targetDistanceMM, 2));
-    motionObj["speedLevelForward"] = serialized(String(motion.speedLevelForward, 1));
-    motionObj["speedLevelBackward"] = serialized(String(motion.speedLevelBackward, 1));
-    motionObj["cyclesPerMinForward"] = serialized(String(cyclesPerMinForward, 1));
-    motionObj["cyclesPerMinBackward"] = serialized(String(cyclesPerMinBackward, 1));
-
-    // Cycle pause config & state (DRY helper)
-    addCyclePauseFields(motionObj, motion.cyclePause, motionPauseState);
+    // Motion object (nested): cached config + live cycle pause
+    const String& motionText = _motionSection.get(motion, [](const MotionConfig& config) {
+        return toJson([&config](JsonDocument& motionObj) {
+            motionObj["startPositionMM"] = serialized(String(config.startPositionMM, 2));
+            motionObj["targetDistanceMM"] = serialized(String(config.targetDistanceMM, 2));
+            motionObj["speedLevelForward"] = serialized(String(config.speedLevelForward, 1));
+            motionObj["speedLevelBackward"] = serialized(String(config.speedLevelBackward, 1));
+            motionObj["cyclesPerMinForward"] = serialized(String(MovementMath::speedLevelToCPM(config.speedLevelForward), 1));
+            motionObj["cyclesPerMinBackward"] = serialized(String(MovementMath::speedLevelToCPM(config.speedLevelBackward), 1));
+        });
+    });
+    String pauseText = cyclePauseJson(_motionPauseSection, motion.cyclePause, motionPauseState);
+    doc["motion"] = serialized(mergeObjects(motionText, "{\"cyclePause\":" + pauseText + "}"));
 
     // Pending motion
     doc["hasPending"] = pendingMotion.hasChanges;
     if (pendingMotion.hasChanges) {
-        JsonObject pendingObj = doc["pendingMotion"].to<JsonObject>();
-        pendingObj["startPositionMM"] = serialized(String(pendingMotion.startPositionMM, 2));
-        pendingObj["distanceMM"] = serialized(String(pendingMotion.distanceMM, 2));
-        pendingObj["speedLevelForward"] = serialized(String(pendingMotion.speedLevelForward, 1));
-        pendingObj["speedLevelBackward"] = serialized(String(pendingMotion.speedLevelBackward, 1));
-    } else {
-        doc["hasPending"] = false;
+        doc["pendingMotion"] = serialized(_pendingSection.get(pendingMotion, [](const PendingMotionConfig& config) {
+            return toJson([&config](JsonDocument& pendingObj) {
+                pendingObj["startPositionMM"] = serialized(String(config.startPositionMM, 2));
+                pendingObj["distanceMM"] = serialized(String(config.distanceMM, 2));
+                pendingObj["speedLevelForward"] = serialized(String(config.speedLevelForward, 1));
+                pendingObj["speedLevelBackward"] = serialized(String(config.speedLevelBackward, 1));
+            });
+        }));
     }
 
     // Zone effects (always send, even if disabled, for UI sync)
     // Keep "decelZone" key for backward compatibility with existing frontend
-    JsonObject zoneObj = doc["decelZone"].to<JsonObject>();
-    zoneObj["enabled"] = zoneEffect.enabled;
-    zoneObj["enableStart"] = zoneEffect.enableStart;
-    zoneObj["enableEnd"] = zoneEffect.enableEnd;
-    zoneObj["mirrorOnReturn"] = zoneEffect.mirrorOnReturn;
-    zoneObj["zoneMM"] = serialized(String(zoneEffect.zoneMM, 1));
-
-    // Speed effect
-    zoneObj["speedEffect"] = (int)zoneEffect.speedEffect;
-    zoneObj["speedCurve"] = (int)zoneEffect.speedCurve;
-    zoneObj["speedIntensity"] = serialized(String(zoneEffect.speedIntensity, 0));
-
-    // Random turnback
-    zoneObj["randomTurnbackEnabled"] = zoneEffect.randomTurnbackEnabled;
-    zoneObj["turnbackChance"] = zoneEffect.turnbackChance;
-
-    // End pause
-    zoneObj["endPauseEnabled"] = zoneEffect.endPauseEnabled;
-    zoneObj["endPauseIsRandom"] = zoneEffect.endPauseIsRandom;
-    zoneObj["endPauseDurationSec"] = serialized(String(zoneEffect.endPauseDurationSec, 1));
-    zoneObj["endPauseMinSec"] = serialized(String(zoneEffect.endPauseMinSec, 1));
-    zoneObj["endPauseMaxSec"] = serialized(String(zoneEffect.endPauseMaxSec, 1));
+    doc["decelZone"] = serialized(_zoneSection.get(zoneEffect, [](const ZoneEffectConfig& config) {
+        return toJson([&config](JsonDocument& zoneObj) {
+            zoneObj["enabled"] = config.enabled;
+            zoneObj["enableStart"] = config.enableStart;
+            zoneObj["enableEnd"] = config.enableEnd;
+            zoneObj["mirrorOnReturn"] = config.mirrorOnReturn;
+            zoneObj["zoneMM"] = serialized(String(config.zoneMM, 1));
+
+            // Speed effect
+            zoneObj["speedEffect"] = (int)config.speedEffect;
+            zoneObj["speedCurve"] = (int)config.speedCurve;
+            zoneObj["speedIntensity"] = serialized(String(config.speedIntensity, 0));
+
+            // Random turnback
+            zoneObj["randomTurnbackEnabled"] = config.randomTurnbackEnabled;
+            zoneObj["turnbackChance"] = config.turnbackChance;
+
+            // End pause
+            zoneObj["endPauseEnabled"] = config.endPauseEnabled;
+            zoneObj["endPauseIsRandom"] = config.endPauseIsRandom;
+            zoneObj["endPauseDurationSec"] = serialized(String(config.endPauseDurationSec, 1));
+            zoneObj["endPauseMinSec"] = serialized(String(config.endPauseMinSec, 1));
+            zoneObj["endPauseMaxSec"] = serialized(String(config.endPauseMaxSec, 1));
+        });
+    }));
 }
 
 // ============================================================================
@@ -318,27 +379,43 @@ void StatusBroadcaster::addVaEtVientFields(JsonDocument& doc) {
 // ============================================================================
 
 void StatusBroadcaster::addOscillationFields(JsonDocument& doc) {
-    // Oscillation config
-    JsonObject oscObj = doc["oscillation"].to<JsonObject>();
-    oscObj["centerPositionMM"] = serialized(String(oscillation.centerPositionMM, 2));
-    oscObj["amplitudeMM"] = serialized(String(oscillation.amplitudeMM, 2));
-    oscObj["waveform"] = (int)oscillation.waveform;
-    oscObj["frequencyHz"] = serialized(String(oscillation.frequencyHz, 3));
-
-    // Effective frequency (capped by hardware speed limit) — DRY: uses shared helper
-    float effectiveFrequencyHz = MovementMath::effectiveFrequency(
-        oscillation.frequencyHz, oscillation.amplitudeMM);
-    oscObj["effectiveFrequencyHz"] = serialized(String(effectiveFrequencyHz, 3));
-    oscObj["actualSpeedMMS"] = serialized(String(actualOscillationSpeedMMS, 1));
-    oscObj["enableRampIn"] = oscillation.enableRampIn;
-    oscObj["rampInDurationMs"] = serialized(String(oscillation.rampInDurationMs, 0));
-    oscObj["enableRampOut"] = oscillation.enableRampOut;
-    oscObj["rampOutDurationMs"] = serialized(String(oscillation.rampOutDurationMs, 0));
-    oscObj["cycleCount"] = oscillation.cycleCount;
-    oscObj["returnToCenter"] = oscillation.returnToCenter;
-
-    // Cycle pause config & state (DRY helper)
-    addCyclePauseFields(oscObj, oscillation.cyclePause, oscPauseState);
+    // Oscillation config (cached) + live speed and cycle pause
+    const String& oscText = _oscSection.get(oscillation, [](const OscillationConfig& config) {
+        return toJson([&config](JsonDocument& oscObj) {
+            oscObj["centerPositionMM"] = serialized(String(config.centerPositionMM, 2));
+            oscObj["amplitudeMM"] = serialized(String(config.amplitudeMM, 2));
+            oscObj["waveform"] = (int)config.waveform;
+            oscObj["frequencyHz"] = serialized(String(config.frequencyHz, 3));
+
+            // Effective frequency (capped by hardware speed limit) — DRY: uses shared helper
+            float effectiveFrequencyHz = MovementMath::effectiveFrequency(config.frequencyHz, config.amplitudeMM);
+            oscObj["effectiveFrequencyHz"] = serialized(String(effectiveFrequencyHz, 3));
+            oscObj["enableRampIn"] = config.enableRampIn;
+            oscObj["rampInDurationMs"] = serialized(String(config.rampInDurationMs, 0));
+            oscObj["enableRampOut"] = config.enableRampOut;
+            oscObj["rampOutDurationMs"] = serialized(String(config.rampOutDurationMs, 0));
+            oscObj["cycleCount"] = config.cycleCount;
+            oscObj["returnToCenter"] = config.returnToCenter;
+
+            // Superposed partials + drift (only when used: keeps the common status small)
+            if (const OscillationHarmonics& harmonics = config.harmonics; harmonics.isActive()) {
+                JsonArray partials = oscObj["harmonics"].to<JsonArray>();
+                for (uint8_t idx = 0; idx < harmonics.count; ++idx) {
+                    const OscillationPartial& partial = harmonics.partials[idx];
+                    JsonObject partialObj = partials.add<JsonObject>();
+                    partialObj["frequencyHz"] = serialized(String(partial.frequencyHz, 3));
+                    partialObj["amplitudeMM"] = serialized(String(partial.amplitudeMM, 2));
+                    partialObj["phase"] = serialized(String(partial.phase, 3));
+                    partialObj["waveform"] = (int)partial.waveform;
+                }
+                oscObj["driftAmplitudeMM"] = serialized(String(harmonics.driftAmplitudeMM, 2));
+                oscObj["driftPeriodSec"] = serialized(String(harmonics.driftPeriodSec, 1));
+            }
+        });
+    });
+    String pauseText = cyclePauseJson(_oscPauseSection, oscillation.cyclePause, oscPauseState);
+    doc["oscillation"] = serialized(mergeObjects(oscText, "{\"actualSpeedMMS\":" + String(actualOscillationSpeedMMS, 1) +
+                                                          ",\"cyclePause\":" + pauseText + "}"));
 
     // Oscillation state (minimal if no ramping, full if ramping)
     JsonObject oscStateObj = doc["oscillationState"].to<JsonObject>();
@@ -357,19 +434,22 @@ void StatusBroadcaster::addOscillationFields(JsonDocument& doc) {
 // ============================================================================
 
 void StatusBroadcaster::addChaosFields(JsonDocument& doc) {
-    // Chaos config
-    JsonObject chaosObj = doc["chaos"].to<JsonObject>();
-    chaosObj["centerPositionMM"] = serialized(String(chaos.centerPositionMM, 2));
-    chaosObj["amplitudeMM"] = serialized(String(chaos.amplitudeMM, 2));
-    chaosObj["maxSpeedLevel"] = serialized(String(chaos.maxSpeedLevel, 1));
-    chaosObj["crazinessPercent"] = serialized(String(chaos.crazinessPercent, 0));
-    chaosObj["durationSeconds"] = chaos.durationSeconds;
-    chaosObj["seed"] = chaos.seed;
-
-    JsonArray patternsArray = chaosObj["patternsEnabled"].to<JsonArray>();
-    for (bool enabled : chaos.patternsEnabled) {
-        patternsArray.add(enabled);
-    }
+    // Chaos config (cached)
+    doc["chaos"] = serialized(_chaosSection.get(chaos, [](const ChaosRuntimeConfig& config) {
+        return toJson([&config](JsonDocument& chaosObj) {
+            chaosObj["centerPositionMM"] = serialized(String(config.centerPositionMM, 2));
+            chaosObj["amplitudeMM"] = serialized(String(config.amplitudeMM, 2));
+            chaosObj["maxSpeedLevel"] = serialized(String(config.maxSpeedLevel, 1));
+            chaosObj["crazinessPercent"] = serialized(String(config.crazinessPercent, 0));
+            chaosObj["durationSeconds"] = config.durationSeconds;
+            chaosObj["seed"] = config.seed;
+
+            JsonArray patternsArray = chaosObj["patternsEnabled"].to<JsonArray>();
+            for (bool enabled : config.patternsEnabled) {
+                patternsArray.add(enabled);
+            }
+        });
+    }));
 
     // Chaos state
     JsonObject chaosStateObj = doc["chaosState"].to<JsonObject>();
@@ -390,6 +470,62 @@ void StatusBroadcaster::addChaosFields(JsonDocument& doc) {
     }
 }
 
+// ============================================================================
+// POSITION VERIFICATION (HSS86 PEND)
+// ============================================================================
+
+void StatusBroadcaster::addPositionVerifyFields(JsonDocument& doc) {
+    JsonObject pvObj = doc["posVerify"].to<JsonObject>();
+    pvObj["verified"] = PosVerifier.getVerifiedMoves();
+    pvObj["unverified"] = PosVerifier.getUnverifiedMoves();
+    pvObj["settleMs"] = serialized(String(PosVerifier.getLastSettleMicros() / 1000.0f, 1));
+    pvObj["followErr"] = PosVerifier.getLastFollowingError();
+    pvObj["maxFollowErr"] = PosVerifier.getMaxFollowingError();
+    pvObj["lostSteps"] = PosVerifier.getLostStepsEstimate();
+    pvObj["recalDue"] = PosVerifier.isRecalibrationDue();
+    pvObj["softRecals"] = PosVerifier.getSoftRecalibrations();
+    pvObj["autoRecal"] = autoRecalibrate;
+
+    // Learned step-rate limits (governor)
+    JsonObject govObj = doc["governor"].to<JsonObject>();
+    unsigned long floorMicros = Governor.getFloorMicros();
+    govObj["floorUs"] = floorMicros;
+    govObj["maxMMs"] = serialized(String(1000000.0f / (static_cast<float>(floorMicros) * STEPS_PER_MM), 0));
+    govObj["accel"] = (Governor.getAccel() >= GOVERNOR_MAX_ACCEL) ? 0.0f : Governor.getAccel();  // 0 = unlimited
+    govObj["faults"] = Governor.getFaultCount();
+    govObj["throttling"] = Governor.isThrottling();
+}
+
+void StatusBroadcaster::addTimelineFields(JsonDocument& doc) {
+    JsonObject tlObj = doc["timeline"].to<JsonObject>();
+    tlObj["clockSynced"] = TimeUtils::isSynchronized();
+    tlObj["pending"] = Timeline.hasPending();
+    if (Timeline.hasPending()) {
+        tlObj["startAt"] = Timeline.getPendingStartAt();
+        tlObj["startInMs"] = Timeline.getPendingStartAt() - TimeUtils::epochMillis();
+    }
+    tlObj["phaseLocked"] = Timeline.isPhaseLocked();
+    if (Timeline.isPhaseLocked()) {
+        tlObj["phaseErrMs"] = serialized(String(Timeline.getLastPhaseErrorMs(), 0));
+    }
+}
+
+void StatusBroadcaster::addTrajectoryFields(JsonDocument& doc) {
+    JsonObject trjObj = doc["trajectory"].to<JsonObject>();
+    uint32_t count = Trajectory.getCount();
+    trjObj["count"] = count;
+    trjObj["capacity"] = Trajectory.getCapacity();
+    trjObj["fill"] = MovementMath::fillPercent(count, Trajectory.getCapacity());
+    trjObj["playing"] = Trajectory.isPlaying();
+    trjObj["stream"] = Trajectory.isStreaming();
+    trjObj["loop"] = Trajectory.isLooping();
+    trjObj["starved"] = Trajectory.isStarved();
+    trjObj["tMs"] = Trajectory.getPlayMs();
+    trjObj["endMs"] = Trajectory.getEndMs();
+    trjObj["underruns"] = Trajectory.getUnderruns();
+    trjObj["rejected"] = Trajectory.getRejected();
+}
+
 // ============================================================================
 // SYSTEM STATS (ON-DEMAND)
 // ============================================================================
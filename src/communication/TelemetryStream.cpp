@@ -0,0 +1,127 @@
+// ============================================================================
+// TELEMETRY_STREAM.CPP - Opt-in per-step motion telemetry over WebSocket
+// ============================================================================
+
+#include "communication/TelemetryStream.h"
+#include "core/GlobalState.h"
+#include "core/StepScheduler.h"
+#include "core/Types.h"
+#include "core/UtilityEngine.h"
+#include "hardware/MotorDriver.h"
+
+using StepSamples::Sample;
+
+// Why 16? 500 Hz x 20 ms = 10 samples a frame; the rest absorbs a late flush
+static constexpr size_t MAX_SAMPLES_PER_FRAME = 16;
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+TelemetryStream& TelemetryStream::getInstance() {
+    static TelemetryStream instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+void TelemetryStream::begin(AsyncWebSocket* ws) {
+    m_ws = ws;
+}
+
+// ============================================================================
+// RECORDING (Core 1)
+// ============================================================================
+
+void TelemetryStream::sample() {
+    uint32_t steps = Motor.getCommandedSteps();
+    if (steps == m_lastSteps) return;
+    m_lastSteps = steps;
+
+    // The schedule belongs to this step only: modes that step without one report 0
+    uint32_t commandedFixed = m_commandedFixed;
+    m_commandedFixed = 0;
+
+    if (!m_active.load(std::memory_order_relaxed)) return;
+    auto timeUs = static_cast<uint32_t>(Motor.getLastStepMicros());
+    if (!m_decimator.take(timeUs)) return;
+
+    m_ring.push({timeUs, static_cast<int32_t>(currentStep),
+                 static_cast<float>(commandedFixed) / static_cast<float>(1u << StepScheduler::FRACTION_BITS),
+                 static_cast<uint32_t>(Motor.getLastStepIntervalMicros())});
+}
+
+// ============================================================================
+// SUBSCRIPTIONS (Core 0)
+// ============================================================================
+
+bool TelemetryStream::hasSubscribers() const {
+    for (const auto& client : m_clients) {
+        if (client.load(std::memory_order_relaxed) != 0) return true;
+    }
+    return false;
+}
+
+bool TelemetryStream::subscribe(uint32_t clientId, bool enable, uint32_t rateHz) {
+    if (clientId == 0) return false;
+
+    bool listed = false;
+    for (auto& client : m_clients) {
+        if (client.load(std::memory_order_relaxed) != clientId) continue;
+        if (!enable) client.store(0, std::memory_order_relaxed);
+        listed = true;
+    }
+    if (enable && !listed) {
+        for (auto& client : m_clients) {
+            uint32_t expected = 0;
+            if (client.compare_exchange_strong(expected, clientId, std::memory_order_relaxed)) {
+                listed = true;
+                break;
+            }
+        }
+        if (!listed) return false;
+    }
+
+    // One stream shared by all subscribers: the latest rate applies to all
+    if (enable) m_decimator.setRate(constrain(rateHz, 1u, TELEMETRY_MAX_RATE_HZ));
+
+    bool active = hasSubscribers();
+    if (active && !m_active.load(std::memory_order_relaxed)) {
+        m_restart.store(true, std::memory_order_relaxed);  // Ring belongs to flush(): it drops the old session
+    }
+    m_active.store(active, std::memory_order_relaxed);
+    return true;
+}
+
+// ============================================================================
+// SENDING (networkTask)
+// ============================================================================
+
+void TelemetryStream::flush() {
+    if (m_ws == nullptr || !m_active.load(std::memory_order_relaxed)) return;
+    if (millis() - m_lastFlushMs < TELEMETRY_FLUSH_INTERVAL_MS) return;
+    m_lastFlushMs = millis();
+
+    if (m_restart.exchange(false, std::memory_order_relaxed)) {
+        m_ring.clear();
+        m_ring.takeDropped();
+    }
+
+    std::array<Sample, MAX_SAMPLES_PER_FRAME> samples;
+    uint8_t frame[1 + sizeof(WsTelemetryHeader) + sizeof(samples)];
+    while (m_ring.size() > 0) {
+        WsTelemetryHeader header;
+        header.sampleCount = static_cast<uint16_t>(m_ring.pop(samples.data(), samples.size()));
+        header.dropped = static_cast<uint16_t>(min(m_ring.takeDropped(), static_cast<uint32_t>(UINT16_MAX)));
+
+        // memcpy: the payload after the opcode byte is unaligned
+        frame[0] = WS_BINARY_TELEMETRY;
+        memcpy(frame + 1, &header, sizeof(header));
+        memcpy(frame + 1 + sizeof(header), samples.data(), header.sampleCount * sizeof(Sample));
+        size_t len = 1 + sizeof(header) + header.sampleCount * sizeof(Sample);
+
+        for (const auto& client : m_clients) {
+            uint32_t clientId = client.load(std::memory_order_relaxed);
+            // A client that cannot keep up misses frames rather than growing its queue
+            if (clientId != 0 && m_ws->availableForWrite(clientId)) m_ws->binary(clientId, frame, len);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+// ============================================================================
+// WS_MESSAGE_ASSEMBLER.CPP - Reassembly of fragmented WebSocket messages
+// ============================================================================
+
+#include "communication/WsMessageAssembler.h"
+#include "communication/StatusBroadcaster.h"
+#include "core/UtilityEngine.h"
+#include <esp_heap_caps.h>
+#include <cstring>
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+WsMessageAssembler& WsMessageAssembler::getInstance() {
+    static WsMessageAssembler instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+void WsMessageAssembler::begin() {
+    // One arena for all slots, never freed: large messages cause no heap churn
+    m_arena = static_cast<uint8_t*>(heap_caps_malloc(
+        WS_REASSEMBLY_SLOTS * WS_REASSEMBLY_MAX_MESSAGE_PSRAM, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    m_slotSize = WS_REASSEMBLY_MAX_MESSAGE_PSRAM;
+
+    if (m_arena == nullptr) {
+        m_arena = static_cast<uint8_t*>(malloc(WS_REASSEMBLY_SLOTS * WS_REASSEMBLY_MAX_MESSAGE_INTERNAL));
+        m_slotSize = WS_REASSEMBLY_MAX_MESSAGE_INTERNAL;
+        engine->warn("⚠️ WebSocket reassembly: no PSRAM, using internal RAM (" + String(m_slotSize / 1024) + " KB/message)");
+    }
+
+    if (m_arena == nullptr) {
+        m_slotSize = 0;
+        engine->error("❌ WebSocket reassembly arena allocation failed - fragmented messages dropped");
+        return;
+    }
+
+    for (size_t idx = 0; idx < m_slots.size(); ++idx) {
+        m_slots[idx] = Slot{};
+        m_slots[idx].buffer = m_arena + idx * m_slotSize;
+    }
+
+    engine->info("🧩 WsMessageAssembler ready (" + String(WS_REASSEMBLY_SLOTS) + " x " +
+                 String(m_slotSize / 1024) + " KB)");
+}
+
+// ============================================================================
+// REASSEMBLY
+// ============================================================================
+
+bool WsMessageAssembler::feed(uint32_t clientId, const AwsFrameInfo& info, const uint8_t* data, size_t len, Message& out) {
+    bool messageStart = info.num == 0 && info.index == 0;
+    bool messageEnd = info.final && info.index + len == info.len;
+
+    Slot* slot = findSlot(clientId);
+    if (messageStart) {
+        if (slot != nullptr) {
+            // Client started over without finishing (should not happen on one TCP stream)
+            engine->warn("WebSocket client #" + String(clientId) + ": incomplete message discarded");
+            slot->inUse = false;
+        }
+        slot = claimSlot(clientId, info.message_opcode);
+        if (slot == nullptr) {
+            engine->warn("WebSocket client #" + String(clientId) + ": no reassembly slot free, message dropped");
+            return false;
+        }
+        // Unfragmented frame announces its full size up front: reject before copying
+        slot->overflow = info.final && info.len > m_slotSize;
+    } else if (slot == nullptr) {
+        return false;  // Rest of a message already dropped
+    }
+
+    if (!slot->overflow) {
+        if (len > m_slotSize - slot->len) {
+            slot->overflow = true;
+        } else {
+            memcpy(slot->buffer + slot->len, data, len);
+            slot->len += len;
+        }
+    }
+
+    if (!messageEnd) return false;
+
+    if (slot->overflow) {
+        slot->inUse = false;
+        Status.sendError("❌ WebSocket message too large (max " + String(m_slotSize / 1024) + " KB)");
+        return false;
+    }
+
+    out.data = slot->buffer;
+    out.len = slot->len;
+    out.opcode = slot->opcode;
+    return true;
+}
+
+void WsMessageAssembler::release(uint32_t clientId) {
+    if (Slot* slot = findSlot(clientId); slot != nullptr) {
+        slot->inUse = false;
+    }
+}
+
+// ============================================================================
+// SLOTS
+// ============================================================================
+
+WsMessageAssembler::Slot* WsMessageAssembler::findSlot(uint32_t clientId) {
+    for (auto& slot : m_slots) {
+        if (slot.inUse && slot.clientId == clientId) return &slot;
+    }
+    return nullptr;
+}
+
+WsMessageAssembler::Slot* WsMessageAssembler::claimSlot(uint32_t clientId, uint8_t opcode) {
+    for (auto& slot : m_slots) {
+        if (!slot.inUse && slot.buffer != nullptr) {
+            slot.inUse = true;
+            slot.overflow = false;
+            slot.clientId = clientId;
+            slot.opcode = opcode;
+            slot.len = 0;
+            return &slot;
+        }
+    }
+    return nullptr;
+}
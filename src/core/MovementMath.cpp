@@ -20,21 +20,26 @@ float speedLevelToCPM(float speedLevel) {
     return cpm;
 }
 
-unsigned long vaetStepDelay(float speedLevel, float distanceMM) {
-    if (distanceMM <= 0 || speedLevel <= 0) return 1000;
+float vaetStepInterval(float speedLevel, float distanceMM) {
+    if (distanceMM <= 0 || speedLevel <= 0) return 1000.0f;
 
     float cpm = speedLevelToCPM(speedLevel);
     if (cpm <= 0.1f) cpm = 0.1f;
 
     long stepsPerDirection = mmToSteps(distanceMM);
-    if (stepsPerDirection <= 0) return 1000;
+    if (stepsPerDirection <= 0) return 1000.0f;
 
+    // Step pulse and loop time are not subtracted: StepScheduler absorbs them
     float halfCycleMs   = (60000.0f / cpm) / 2.0f;
     float rawDelay      = (halfCycleMs * 1000.0f) / (float)stepsPerDirection;
-    float delay         = (rawDelay - static_cast<float>(STEP_EXECUTION_TIME_MICROS)) / SPEED_COMPENSATION_FACTOR;
+    float delay         = rawDelay / SPEED_COMPENSATION_FACTOR;
 
     if (delay < 20) delay = 20.0f;
-    return (unsigned long)delay;
+    return delay;
+}
+
+unsigned long vaetStepDelay(float speedLevel, float distanceMM) {
+    return (unsigned long)vaetStepInterval(speedLevel, distanceMM);
 }
 
 unsigned long chaosStepDelay(float speedLevel) {
@@ -52,27 +57,6 @@ unsigned long chaosStepDelay(float speedLevel) {
     return delay;
 }
 
-unsigned long pursuitStepDelay(float errorMM, float maxSpeedLevel) {
-    float speedLevel;
-    if (errorMM > 5.0f) {
-        speedLevel = maxSpeedLevel;
-    } else if (errorMM > 1.0f) {
-        float ratio = (errorMM - 1.0f) / (5.0f - 1.0f);
-        speedLevel  = maxSpeedLevel * (0.6f + ratio * 0.4f);
-    } else {
-        speedLevel  = maxSpeedLevel * 0.6f;
-    }
-
-    float mmPerSecond    = speedLevel * 10.0f;
-    float stepsPerSecond = mmPerSecond * STEPS_PER_MM;
-    if (stepsPerSecond < 30)   stepsPerSecond = 30.0f;
-    if (stepsPerSecond > 6000) stepsPerSecond = 6000.0f;
-
-    float delayMicros = ((1000000.0f / stepsPerSecond) - static_cast<float>(STEP_EXECUTION_TIME_MICROS)) / SPEED_COMPENSATION_FACTOR;
-    if (delayMicros < 20) delayMicros = 20.0f;
-    return (unsigned long)delayMicros;
-}
-
 // ============================================================================
 // ZONE EFFECTS
 // ============================================================================
@@ -170,4 +154,136 @@ float effectiveFrequency(float requestedHz, float amplitudeMM) {
     return requestedHz;
 }
 
+float superposedPeakSpeed(float frequencyHz, float amplitudeMM, const OscillationHarmonics& harmonics) {
+    float peak = frequencyHz * amplitudeMM;
+    for (uint8_t idx = 0; idx < harmonics.count && idx < OSC_MAX_HARMONICS; ++idx) {
+        peak += harmonics.partials[idx].frequencyHz * harmonics.partials[idx].amplitudeMM;
+    }
+    if (harmonics.driftAmplitudeMM > 0.0f && harmonics.driftPeriodSec > 0.0f) {
+        peak += harmonics.driftAmplitudeMM / harmonics.driftPeriodSec;
+    }
+    return 2.0f * PI_F * peak;
+}
+
+float superposedExcursion(float amplitudeMM, const OscillationHarmonics& harmonics) {
+    float excursion = amplitudeMM + max(harmonics.driftAmplitudeMM, 0.0f);
+    for (uint8_t idx = 0; idx < harmonics.count && idx < OSC_MAX_HARMONICS; ++idx) {
+        excursion += fabsf(harmonics.partials[idx].amplitudeMM);
+    }
+    return excursion;
+}
+
+// ============================================================================
+// CALIBRATION
+// ============================================================================
+
+SystemState calibrationAbortState(SystemState startedFrom, float calibratedDistanceMM) {
+    if (startedFrom == SystemState::STATE_INIT || calibratedDistanceMM <= 0.0f) return SystemState::STATE_INIT;
+    return SystemState::STATE_READY;
+}
+
+// ============================================================================
+// POSITION VERIFICATION (HSS86 PEND)
+// ============================================================================
+
+long pendFollowingErrorSteps(unsigned long settleMicros, unsigned long stepIntervalMicros) {
+    if (stepIntervalMicros == 0) return 0;
+    // Rounded to nearest step
+    return (long)((settleMicros + stepIntervalMicros / 2) / stepIntervalMicros);
+}
+
+bool needsSoftRecalibration(long lostStepsEstimate, uint16_t consecutiveUnverifiedMoves) {
+    return lostStepsEstimate >= PEND_RECAL_LOST_STEPS ||
+           consecutiveUnverifiedMoves >= PEND_RECAL_UNVERIFIED_MOVES;
+}
+
+// ============================================================================
+// STEP-RATE GOVERNOR
+// ============================================================================
+
+unsigned long governedMinDelay(unsigned long floorMicros, float accelStepsPerS2, uint32_t stepsSinceRest) {
+    if (accelStepsPerS2 >= GOVERNOR_MAX_ACCEL) return floorMicros;  // Unlimited: floor only
+
+    float v0 = GOVERNOR_START_RATE_STEPS_S;
+    float rate = sqrtf(v0 * v0 + 2.0f * accelStepsPerS2 * static_cast<float>(stepsSinceRest));
+    auto rampDelay = (unsigned long)(1000000.0f / rate);
+    return max(floorMicros, rampDelay);
+}
+
+unsigned long governorBackoffFloor(unsigned long floorMicros, unsigned long faultIntervalMicros) {
+    auto slower = (unsigned long)(static_cast<float>(faultIntervalMicros) * GOVERNOR_BACKOFF_FACTOR);
+    unsigned long result = max(floorMicros, slower);
+    return constrain(result, GOVERNOR_MIN_STEP_DELAY_US, GOVERNOR_MAX_STEP_DELAY_US);
+}
+
+unsigned long governorRelaxFloor(unsigned long floorMicros) {
+    auto faster = (unsigned long)(static_cast<float>(floorMicros) * GOVERNOR_RELAX_FACTOR);
+    return constrain(faster, GOVERNOR_MIN_STEP_DELAY_US, GOVERNOR_MAX_STEP_DELAY_US);
+}
+
+// ============================================================================
+// WALL-CLOCK PHASE LOCK
+// ============================================================================
+
+float wrapPhaseError(float phaseErrorCycles) {
+    return phaseErrorCycles - floorf(phaseErrorCycles + 0.5f);
+}
+
+float anchoredPhase(int64_t elapsedMs, float frequencyHz) {
+    double cycles = static_cast<double>(frequencyHz) * static_cast<double>(elapsedMs) / 1000.0;
+    return static_cast<float>(cycles - floor(cycles));
+}
+
+float phaseLockTrim(float phaseErrorCycles) {
+    return constrain(phaseErrorCycles * PHASE_LOCK_GAIN, -PHASE_LOCK_MAX_TRIM, PHASE_LOCK_MAX_TRIM);
+}
+
+float vaetPhaseLockTrim(float phaseErrorCycles, float& integralTrim) {
+    integralTrim = constrain(integralTrim + phaseErrorCycles * VAET_PHASE_LOCK_INTEGRAL_GAIN,
+                             -VAET_PHASE_LOCK_MAX_BIAS, VAET_PHASE_LOCK_MAX_BIAS);
+    return integralTrim + phaseLockTrim(phaseErrorCycles);
+}
+
+float vaetCyclePeriodMs(float cpmForward, float cpmBackward) {
+    return 30000.0f / max(cpmForward, 0.1f) + 30000.0f / max(cpmBackward, 0.1f);
+}
+
+unsigned long trimmedStepDelay(unsigned long delayMicros, float trim) {
+    return (unsigned long)(static_cast<float>(delayMicros) / (1.0f + trim));
+}
+
+// ============================================================================
+// TRAJECTORY PLAYBACK
+// ============================================================================
+
+float trajectoryInterpolate(const TrajectoryKeyframe& from, const TrajectoryKeyframe& to, uint64_t playMicros) {
+    uint64_t startMicros = static_cast<uint64_t>(from.timeMs) * 1000ULL;
+    uint64_t endMicros = static_cast<uint64_t>(to.timeMs) * 1000ULL;
+    if (playMicros <= startMicros) return (endMicros == startMicros) ? to.positionMM : from.positionMM;
+    if (playMicros >= endMicros) return to.positionMM;
+
+    float progress = static_cast<float>(playMicros - startMicros) / static_cast<float>(endMicros - startMicros);
+    return from.positionMM + (to.positionMM - from.positionMM) * progress;
+}
+
+bool trajectoryKeyframeValid(const TrajectoryKeyframe& keyframe, uint32_t prevTimeMs) {
+    return std::isfinite(keyframe.positionMM) && keyframe.timeMs >= prevTimeMs;
+}
+
+uint8_t fillPercent(uint32_t count, uint32_t capacity) {
+    if (capacity == 0) return 0;
+    uint64_t percent = static_cast<uint64_t>(count) * 100 / capacity;
+    return static_cast<uint8_t>(min(percent, static_cast<uint64_t>(100)));
+}
+
+// ============================================================================
+// SEQUENCER LOOK-AHEAD
+// ============================================================================
+
+unsigned long transitionStepDelay(unsigned long lineDelayMicros) {
+    if (lineDelayMicros < SEQUENCE_TRANSITION_MIN_STEP_DELAY_MICROS) return SEQUENCE_TRANSITION_MIN_STEP_DELAY_MICROS;
+    if (lineDelayMicros > POSITIONING_STEP_DELAY_MICROS) return POSITIONING_STEP_DELAY_MICROS;
+    return lineDelayMicros;
+}
+
 } // namespace MovementMath
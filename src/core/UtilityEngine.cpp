@@ -66,8 +66,9 @@ bool UtilityEngine::initialize() {
   // STEP 4: Initialize StatsManager (load stats recording pref)
   _stats.initialize();
 
-  // STEP 5: Restore sensors inversion from NVS → global state
+  // STEP 5: Restore sensors inversion + auto recalibration from NVS → global state
   loadSensorsInverted();
+  loadAutoRecalibrate();
 
   info(String("[UtilityEngine] Initialization complete (degraded mode = ") + String(!_fs.isReady() ? "YES" : "NO") + ")");
   return true;
@@ -103,6 +104,21 @@ void UtilityEngine::saveSensorsInverted() {
   info(String("Sensors mode: ") + (sensorsInverted ? "INVERTED" : "NORMAL") + " (saved to NVS)");
 }
 
+// ============================================================================
+// NVS BRIDGE: AUTO SOFT RECALIBRATION
+// ============================================================================
+
+void UtilityEngine::loadAutoRecalibrate() {
+  bool enabled = false;
+  _eeprom.loadAutoRecalibrate(enabled);
+  autoRecalibrate = enabled;
+}
+
+void UtilityEngine::saveAutoRecalibrate() {
+  _eeprom.saveAutoRecalibrate(autoRecalibrate);
+  info(String("Auto recalibration: ") + (autoRecalibrate ? "ENABLED" : "DISABLED") + " (saved to NVS)");
+}
+
 // ============================================================================
 // TIME UTILITIES
 // ============================================================================
@@ -85,3 +85,69 @@ void EepromManager::loadSensorsInverted(bool& inverted) {
   if (engine) engine->info(String("Sensors mode loaded: ") + (inverted ? "INVERTED" : "NORMAL"));
   else Serial.println(String("[EepromManager] Sensors mode: ") + (inverted ? "INVERTED" : "NORMAL"));
 }
+
+// ============================================================================
+// AUTO SOFT RECALIBRATION
+// ============================================================================
+
+void EepromManager::saveAutoRecalibrate(bool enabled) {
+  _prefs.putBool("autoRecal", enabled);
+}
+
+void EepromManager::loadAutoRecalibrate(bool& enabled) {
+  enabled = _prefs.getBool("autoRecal", false);  // Default: report only
+  if (engine) engine->info(String("Auto recalibration loaded: ") + (enabled ? "ENABLED" : "DISABLED"));
+  else Serial.println(String("[EepromManager] Auto recalibration: ") + (enabled ? "ENABLED" : "DISABLED"));
+}
+
+// ============================================================================
+// STEP-RATE GOVERNOR PROFILE
+// ============================================================================
+
+void EepromManager::saveGovernorProfile(uint32_t floorMicros, float accel) {
+  _prefs.putULong("govFloorUs", floorMicros);
+  _prefs.putFloat("govAccel", accel);
+}
+
+void EepromManager::loadGovernorProfile(uint32_t& floorMicros, float& accel) {
+  floorMicros = _prefs.getULong("govFloorUs", floorMicros);
+  accel = _prefs.getFloat("govAccel", accel);
+}
+
+// ============================================================================
+// ODOMETER
+// ============================================================================
+
+void EepromManager::saveOdometer(const OdometerCounters& counters) {
+  _prefs.putBytes("odometer", &counters, sizeof(counters));
+}
+
+bool EepromManager::loadOdometer(OdometerCounters& counters) {
+  // A blob of another size was written by a different counter layout
+  if (_prefs.getBytesLength("odometer") != sizeof(counters)) return false;
+  OdometerCounters loaded;
+  if (_prefs.getBytes("odometer", &loaded, sizeof(loaded)) != sizeof(loaded)) return false;
+  counters = loaded;
+  return true;
+}
+
+// ============================================================================
+// SPEED CALIBRATION
+// ============================================================================
+
+void EepromManager::saveSpeedCalibration(const SpeedTable::Points& points) {
+  _prefs.putBytes("speedCurve", points.data(), sizeof(points));
+}
+
+bool EepromManager::loadSpeedCalibration(SpeedTable::Points& points) {
+  // A blob of another size was written for another MAX_SPEED_LEVEL
+  if (_prefs.getBytesLength("speedCurve") != sizeof(points)) return false;
+  SpeedTable::Points loaded;
+  if (_prefs.getBytes("speedCurve", loaded.data(), sizeof(loaded)) != sizeof(loaded)) return false;
+  points = loaded;
+  return true;
+}
+
+void EepromManager::clearSpeedCalibration() {
+  _prefs.remove("speedCurve");
+}
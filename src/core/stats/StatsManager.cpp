@@ -27,6 +27,15 @@ StatsManager::StatsManager(FileSystem& fs, EepromManager& eeprom)
 
 void StatsManager::initialize() {
   _eeprom.loadStatsRecording(_statsRecordingEnabled);
+
+  OdometerCounters counters;
+  if (_eeprom.loadOdometer(counters)) {
+    stats.restoreOdometer(counters);
+    _lastPersistedSteps = counters.totalSteps;
+    if (engine) {
+      engine->info("🛞 Odometer: " + String(MovementMath::stepCountToMM(counters.totalSteps) / 1000000.0, 3) + " km lifetime");
+    }
+  }
 }
 
 // ============================================================================
@@ -50,10 +59,10 @@ void StatsManager::saveCurrentSessionStats() {
   MutexGuard guard(statsMutex);
 
   // Calculate distance increment since last save (in steps)
-  unsigned long incrementSteps = stats.getIncrementSteps();
+  uint64_t incrementSteps = stats.getIncrementSteps();
 
   // Convert to millimeters
-  float incrementMM = MovementMath::stepsToMM(incrementSteps);
+  auto incrementMM = static_cast<float>(MovementMath::stepCountToMM(incrementSteps));
 
   if (incrementMM <= 0) {
     if (engine) engine->debug("📊 No new distance to save (no increment since last save)");
@@ -65,11 +74,11 @@ void StatsManager::saveCurrentSessionStats() {
 
   if (engine) {
     engine->debug(String("💾 Session stats saved: +") + String(incrementMM, 1) +
-      "mm (total session: " + String(MovementMath::stepsToMM(stats.totalDistanceTraveled), 1) + "mm)");
+      "mm (total session: " + String(MovementMath::stepCountToMM(stats.sessionSteps()), 1) + "mm)");
   }
 
   // Mark as saved
-  stats.markSaved();
+  stats.markSaved(incrementSteps);
 }
 
 void StatsManager::resetTotalDistance() {
@@ -167,4 +176,19 @@ float StatsManager::getTodayDistance() {
   }
 
   return 0.0f;
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// ODOMETER
+// ============================================================================
+
+void StatsManager::persistOdometerIfDue() {
+  if (millis() - _lastOdometerSaveMs < ODOMETER_SAVE_INTERVAL_MS) return;
+  _lastOdometerSaveMs = millis();
+
+  OdometerCounters counters = stats.odometer.snapshot();
+  if (counters.totalSteps == _lastPersistedSteps) return;  // Idle rig: no NVS write
+
+  _eeprom.saveOdometer(counters);
+  _lastPersistedSteps = counters.totalSteps;
+}
@@ -9,7 +9,7 @@
 #include "hardware/ContactSensors.h"
 #include "hardware/MotorDriver.h"
 #include "core/MovementMath.h"
-#include "communication/StatusBroadcaster.h"
+#include "communication/StatusEvents.h"  // For Events.postError()
 #include "core/GlobalState.h"
 #include "core/UtilityEngine.h"
 
@@ -154,7 +154,7 @@ bool ContactSensors::checkHardDriftEnd() const {
               String(currentPos, 1) + "mm (currentStep: " + String(currentStep) +
               " | " + String(distanceToLimitMM, 1) + "mm from limit)");
 
-        Status.sendError("❌ CRITICAL ERROR: Opto END triggered - Position drifted beyond safety buffer");
+        Events.postError("❌ CRITICAL ERROR: Opto END triggered - Position drifted beyond safety buffer");
 
         stopMovement();
         config.currentState = SystemState::STATE_ERROR;
@@ -178,7 +178,7 @@ bool ContactSensors::checkHardDriftStart() const {
               String(currentPos, 1) + "mm (currentStep: " + String(currentStep) +
               " | " + String(distanceToStartMM, 1) + "mm from start)");
 
-        Status.sendError("❌ CRITICAL ERROR: Opto START triggered - Position drifted beyond safety buffer");
+        Events.postError("❌ CRITICAL ERROR: Opto START triggered - Position drifted beyond safety buffer");
 
         stopMovement();
         config.currentState = SystemState::STATE_ERROR;
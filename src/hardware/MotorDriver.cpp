@@ -7,12 +7,23 @@
 #include "core/GlobalState.h"  // For sensorsInverted
 
 // ============================================================================
-// ISR FOR PEND SIGNAL (counts all transitions for debugging)
+// ISR FOR PEND SIGNAL (transition count + step correlation)
 // ============================================================================
 static volatile unsigned long pendInterruptCount = 0;
 
+// Commanded pulses (written by step() on Core 1, snapshotted by the ISR)
+static volatile uint32_t commandedStepCount = 0;
+static volatile unsigned long lastStepPulseMicros = 0;
+static volatile unsigned long lastStepIntervalMicros = 0;  // Pulse to pulse (telemetry)
+
+// Last PEND edge: when it happened and how many pulses had been sent by then
+static volatile unsigned long pendEdgeMicros = 0;
+static volatile uint32_t pendEdgeStepCount = 0;
+
 void IRAM_ATTR pendISR() {
     pendInterruptCount = pendInterruptCount + 1;
+    pendEdgeMicros = micros();
+    pendEdgeStepCount = commandedStepCount;
 }
 
 // ============================================================================
@@ -42,7 +53,7 @@ void MotorDriver::init() {
     pinMode(PIN_ALM, INPUT_PULLUP);
     pinMode(PIN_PEND, INPUT_PULLUP);
 
-    // Attach ISR on PEND for debugging (detect ANY change)
+    // Attach ISR on PEND (detect ANY change) - timestamps settle edges for PositionVerifier
     attachInterrupt(digitalPinToInterrupt(PIN_PEND), pendISR, CHANGE);
 
     // Set initial state for PULSE pin (no wrapper method needed)
@@ -72,6 +83,12 @@ void MotorDriver::step() {
     delayMicroseconds(STEP_PULSE_MICROS);
     digitalWrite(PIN_PULSE, LOW);
     delayMicroseconds(STEP_PULSE_MICROS);
+
+    // Single writer (Core 1) - ISR and PositionVerifier only read
+    unsigned long now = micros();
+    lastStepIntervalMicros = now - lastStepPulseMicros;
+    lastStepPulseMicros = now;
+    commandedStepCount = commandedStepCount + 1;
 }
 
 // ============================================================================
@@ -161,3 +178,23 @@ void MotorDriver::resetPendTracking() {
 unsigned long MotorDriver::getPendInterruptCount() const {
     return pendInterruptCount;
 }
+
+uint32_t MotorDriver::getCommandedSteps() const {
+    return commandedStepCount;
+}
+
+unsigned long MotorDriver::getLastStepMicros() const {
+    return lastStepPulseMicros;
+}
+
+unsigned long MotorDriver::getLastStepIntervalMicros() const {
+    return lastStepIntervalMicros;
+}
+
+void MotorDriver::getLastPendEdge(unsigned long& edgeMicros, uint32_t& stepsAtEdge) const {
+    // ISR may fire between the two reads: re-read until the pair is consistent
+    do {
+        edgeMicros = pendEdgeMicros;
+        stepsAtEdge = pendEdgeStepCount;
+    } while (edgeMicros != pendEdgeMicros);
+}
@@ -0,0 +1,178 @@
+// ============================================================================
+// POSITION_VERIFIER.CPP - Closed-loop position verification (HSS86 PEND)
+// ============================================================================
+// HSS86 raises PEND once its encoder agrees with the commanded position.
+// After the last pulse of a move, the time PEND takes to rise tells how far
+// behind the driver was; PEND never rising means the loop could not close.
+// ============================================================================
+
+#include "hardware/PositionVerifier.h"
+#include "hardware/MotorDriver.h"
+#include "core/MovementMath.h"
+#include "core/GlobalState.h"
+#include "core/UtilityEngine.h"
+#include "movement/CalibrationManager.h"
+#include "movement/SequenceExecutor.h"
+
+using enum SystemState;
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+PositionVerifier& PositionVerifier::getInstance() {
+    static PositionVerifier instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+// ============================================================================
+// MOVE SEGMENTATION (Core 1 - motorTask)
+// ============================================================================
+
+void PositionVerifier::update() {
+    if (m_recalibrationDue) [[unlikely]] {
+        handleRecalibrationDue();
+    }
+
+    // A stroke closed by a reversal is confirmed while the next one runs
+    if (m_strokePending && evaluate(m_stroke, micros() - m_stroke.endMicros)) {
+        m_strokePending = false;
+    }
+
+    // step() and update() both run in motorTask → count and timestamp are consistent
+    uint32_t stepsNow = Motor.getCommandedSteps();
+    unsigned long lastPulse = Motor.getLastStepMicros();
+
+    if (stepsNow != m_lastSeenSteps) {
+        bool forward = Motor.getDirection();
+        if (m_moveActive) {
+            // Continuous runs (va-et-vient, oscillation) never pause: close each
+            // stroke at its reversal instead of waiting for the user to stop
+            if (forward != m_moveForward && !m_strokePending) {
+                m_stroke = {m_moveStartSteps, m_lastSeenSteps, m_lastPulseMicros, m_stepIntervalMicros};
+                m_strokePending = true;
+                m_moveStartSteps = m_lastSeenSteps;
+            }
+            // Average interval since previous tick (usually exactly one pulse)
+            m_stepIntervalMicros = (lastPulse - m_lastPulseMicros) / (stepsNow - m_lastSeenSteps);
+        } else {
+            m_moveActive = true;
+            m_moveStartSteps = m_lastSeenSteps;
+            m_stepIntervalMicros = 0;
+        }
+        m_moveForward = forward;
+        m_lastSeenSteps = stepsNow;
+        m_lastPulseMicros = lastPulse;
+        return;
+    }
+
+    if (!m_moveActive) return;
+
+    // Slow moves: a pause of a few step intervals is still the same move
+    unsigned long idleMicros = micros() - m_lastPulseMicros;
+    unsigned long endGapMicros = max(PEND_MOVE_END_GAP_MS * 1000UL, 4UL * m_stepIntervalMicros);
+    if (idleMicros < endGapMicros) return;
+
+    if (evaluate({m_moveStartSteps, m_lastSeenSteps, m_lastPulseMicros, m_stepIntervalMicros}, idleMicros)) {
+        m_moveActive = false;
+    }
+}
+
+// ============================================================================
+// PEND CORRELATION
+// ============================================================================
+
+bool PositionVerifier::evaluate(const Segment& segment, unsigned long sinceEndMicros) {
+    unsigned long edgeMicros = 0;
+    uint32_t stepsAtEdge = 0;
+    Motor.getLastPendEdge(edgeMicros, stepsAtEdge);
+
+    if (Motor.isPositionReached()) {
+        // Edge captured after the segment's final pulse = settle event for it.
+        // No such edge: PEND never dropped, driver tracked within its band.
+        unsigned long settleMicros = 0;
+        if ((long)(edgeMicros - segment.endMicros) > 0) {
+            settleMicros = edgeMicros - segment.endMicros;
+        }
+
+        m_lastSettleMicros = settleMicros;
+        m_lastFollowingError = MovementMath::pendFollowingErrorSteps(settleMicros, segment.intervalMicros);
+        if (m_lastFollowingError > m_maxFollowingError) {
+            m_maxFollowingError = m_lastFollowingError;
+        }
+        m_verifiedMoves = m_verifiedMoves + 1;
+        m_consecutiveUnverified = 0;
+
+        if (settleMicros > PEND_LAG_WARN_THRESHOLD_MS * 1000UL) {
+            engine->debug("🐢 PEND slow settle: " + String(settleMicros / 1000.0f, 1) + "ms (~" +
+                          String(m_lastFollowingError) + " steps behind)");
+        }
+    } else if (sinceEndMicros >= PEND_SETTLE_TIMEOUT_MS * 1000UL) {
+        // Driver still chasing its target: whatever it owed is presumed lost
+        long moveSteps = (long)(segment.endSteps - segment.startSteps);
+        long owed = MovementMath::pendFollowingErrorSteps(sinceEndMicros, segment.intervalMicros);
+        m_lastSettleMicros = sinceEndMicros;
+        m_lastFollowingError = min(owed, moveSteps);
+        m_lostStepsEstimate = m_lostStepsEstimate + m_lastFollowingError;
+        m_unverifiedMoves = m_unverifiedMoves + 1;
+        m_consecutiveUnverified = m_consecutiveUnverified + 1;
+
+        static unsigned long lastWarnMs = 0;
+        if (millis() - lastWarnMs > PEND_WARN_COOLDOWN_MS) {
+            lastWarnMs = millis();
+            engine->warn("⚠️ PEND not confirmed " + String(PEND_SETTLE_TIMEOUT_MS) + "ms after move (" +
+                         String(moveSteps) + " steps) - ~" + String(m_lostStepsEstimate) + " steps lost since last homing");
+        }
+    } else {
+        return false;  // Still within settle window
+    }
+
+    if (!m_recalibrationDue &&
+        MovementMath::needsSoftRecalibration(m_lostStepsEstimate, m_consecutiveUnverified)) {
+        m_recalibrationDue = true;
+    }
+    return true;
+}
+
+// ============================================================================
+// SOFT RECALIBRATION
+// ============================================================================
+
+void PositionVerifier::handleRecalibrationDue() {
+    if (!autoRecalibrate) {
+        if (!m_dueReported) {
+            m_dueReported = true;
+            engine->warn("⚠️ Slip suspected (~" + String(m_lostStepsEstimate) + " steps) - return to start recommended");
+        }
+        return;
+    }
+
+    // Wait for the current homing/positioning to finish; never move out of ERROR/INIT
+    if (Calibration.isBusy() || SeqExecutor.isPositioning()) return;
+    if (config.currentState != STATE_READY && config.currentState != STATE_RUNNING &&
+        config.currentState != STATE_PAUSED) return;
+
+    engine->warn("🔁 Slip suspected (~" + String(m_lostStepsEstimate) + " steps, " +
+                 String(m_consecutiveUnverified) + " unconfirmed moves) - soft recalibration");
+
+    if (seqState.isRunning) {
+        SeqExecutor.stop();  // Also stops the active movement
+    } else {
+        stopMovement();
+    }
+
+    if (Calibration.returnToStart()) {
+        m_softRecalibrations = m_softRecalibrations + 1;
+    }
+
+    // New episode starts now - a failed return must not re-trigger in a loop
+    resetTracking();
+}
+
+void PositionVerifier::resetTracking() {
+    m_lostStepsEstimate = 0;
+    m_consecutiveUnverified = 0;
+    m_recalibrationDue = false;
+    m_dueReported = false;
+    m_strokePending = false;
+}
@@ -3,7 +3,8 @@
 // ============================================================================
 
 #include "movement/BaseMovementController.h"
-#include "communication/StatusBroadcaster.h"  // For Status.sendError()
+#include "communication/StatusEvents.h"
+#include "communication/TelemetryStream.h"
 #include "core/GlobalState.h"
 #include "core/MovementMath.h"
 #include "core/UtilityEngine.h"
@@ -14,6 +15,10 @@
 #include "movement/OscillationController.h"
 #include "movement/SequenceExecutor.h"
 #include "movement/CalibrationManager.h"
+#include "movement/SpeedCalibration.h"
+#include "movement/StepRateGovernor.h"
+#include "movement/MotionTimeline.h"
+#include "movement/TrajectoryPlayer.h"
 
 using enum SystemState;
 using enum MovementType;
@@ -122,7 +127,7 @@ void BaseMovementControllerClass::setStartPosition(float startMM) {
 
         // If distance was auto-adjusted, send immediate status update to sync UI
         if (distanceWasAdjusted) {
-            sendStatus();
+            Events.post(StatusEvent::CONFIG);
         }
     }
 }
@@ -149,14 +154,18 @@ void BaseMovementControllerClass::setSpeedInternal(float speedLevel, bool isForw
     bool wasRunning = (config.currentState == STATE_RUNNING);
 
     if (wasRunning) {
-        if (!pendingMotion.hasChanges) {
-            initPendingFromCurrent();
+        // Live: Core 1 blends to the new rate (S-curve) instead of waiting for the cycle end.
+        // Flag first, so the new interval is never seen without it (that would switch, not blend)
+        if (pendingMotion.hasChanges) {
+            pendingLevel = speedLevel;  // Keep it when the queued geometry change applies
         }
-        pendingLevel = speedLevel;
-        pendingMotion.hasChanges = true;
+        currentLevel = speedLevel;
+        speedBlendRequested_[isForward ? 0 : 1].store(true);
+        calculateStepDelay();
 
-        engine->debug(String("⏳ ") + dirName + " speed queued: " + String(oldSpeedLevel, 1) + "/" + String(MAX_SPEED_LEVEL, 0) + " → " +
-              String(speedLevel, 1) + "/" + String(MAX_SPEED_LEVEL, 0) + " (" + String(MovementMath::speedLevelToCPM(speedLevel), 0) + " c/min)");
+        engine->debug(String("⚡ ") + dirName + " speed: " + String(oldSpeedLevel, 1) + "/" + String(MAX_SPEED_LEVEL, 0) + " → " +
+              String(speedLevel, 1) + "/" + String(MAX_SPEED_LEVEL, 0) + " (" + String(MovementMath::speedLevelToCPM(speedLevel), 0) +
+              " c/min, " + String(VAET_SPEED_TRANSITION_MS) + " ms blend)");
     } else {
         currentLevel = speedLevel;
         engine->debug(String("✓ ") + dirName + " speed: " + String(speedLevel, 1) + "/" + String(MAX_SPEED_LEVEL, 0) + " (" +
@@ -170,18 +179,21 @@ void BaseMovementControllerClass::setSpeedInternal(float speedLevel, bool isForw
 // ============================================================================
 
 void BaseMovementControllerClass::calculateStepDelay() {
-    // Delegate core math to MovementMath (testable pure functions)
-    stepDelayMicrosForward  = MovementMath::vaetStepDelay(motion.speedLevelForward,  motion.targetDistanceMM);
-    stepDelayMicrosBackward = MovementMath::vaetStepDelay(motion.speedLevelBackward, motion.targetDistanceMM);
-
-    // Early exit guard — bad input already handled by vaetStepDelay (returns 1000)
+    // Speed table lookup (nominal = MovementMath::vaetStepInterval, or the rig's calibrated curve)
+    const SpeedTable& speeds = Speeds.table();
+    float intervalForward  = speeds.vaetStepInterval(motion.speedLevelForward,  motion.targetDistanceMM);
+    float intervalBackward = speeds.vaetStepInterval(motion.speedLevelBackward, motion.targetDistanceMM);
+    stepIntervalForward  = StepScheduler::toFixed(intervalForward);
+    stepIntervalBackward = StepScheduler::toFixed(intervalBackward);
+
+    // Early exit guard — bad input already handled by vaetStepInterval (returns 1000)
     if (motion.targetDistanceMM <= 0 || motion.speedLevelForward <= 0 || motion.speedLevelBackward <= 0) {
         return;
     }
 
     long stepsPerDirection = MovementMath::mmToSteps(motion.targetDistanceMM);
 
-    // 🛡️ CRITICAL SAFETY: Log if stepsPerDirection was zero (vaetStepDelay already returned 1000)
+    // 🛡️ CRITICAL SAFETY: Log if stepsPerDirection was zero (vaetStepInterval already returned 1000)
     if (stepsPerDirection <= 0) {
         engine->error("⚠️ DIVISION BY ZERO PREVENTED! stepsPerDirection=" + String(stepsPerDirection) +
               " (distance=" + String(motion.targetDistanceMM, 3) + "mm)");
@@ -192,12 +204,12 @@ void BaseMovementControllerClass::calculateStepDelay() {
     float cyclesPerMinuteForward  = MovementMath::speedLevelToCPM(motion.speedLevelForward);
     float cyclesPerMinuteBackward = MovementMath::speedLevelToCPM(motion.speedLevelBackward);
 
-    if (stepDelayMicrosForward <= 20) {
+    if (intervalForward <= 20.0f) {
         engine->warn("⚠️ Forward speed limited! Distance " + String(motion.targetDistanceMM, 0) +
               "mm too long for speed " + String(motion.speedLevelForward, 1) + "/" + String(MAX_SPEED_LEVEL, 0) + " (" +
               String(cyclesPerMinuteForward, 0) + " c/min)");
     }
-    if (stepDelayMicrosBackward <= 20) {
+    if (intervalBackward <= 20.0f) {
         engine->warn("⚠️ Backward speed limited! Distance " + String(motion.targetDistanceMM, 0) +
               "mm too long for speed " + String(motion.speedLevelBackward, 1) + "/" + String(MAX_SPEED_LEVEL, 0) + " (" +
               String(cyclesPerMinuteBackward, 0) + " c/min)");
@@ -210,7 +222,7 @@ void BaseMovementControllerClass::calculateStepDelay() {
           String(stepsPerDirection) + " steps | speed=" + String(motion.speedLevelForward, 1) +
           " → " + String(cyclesPerMinuteForward, 0) + " c/min | halfCycle=" +
           String(halfCycleForwardMs, 1) + "ms | rawDelay=" + String(rawDelayForward, 1) +
-          "µs → final=" + String(stepDelayMicrosForward) + "µs");
+          "µs → final=" + String(intervalForward, 2) + "µs");
 }
 
 // ============================================================================
@@ -424,6 +436,16 @@ void BaseMovementControllerClass::validateZoneEffect() {
     if (zoneEffect.endPauseDurationSec < 0.1f) zoneEffect.endPauseDurationSec = 0.1f;
 }
 
+void BaseMovementControllerClass::refreshZoneProfile() {
+    if (zoneProfiles_[activeZoneProfile_.load(std::memory_order_relaxed)].matches(zoneEffect)) return;
+
+    // Bake from a snapshot: a write racing the copy only means another bake next loop
+    ZoneEffectConfig snapshot = zoneEffect;
+    uint8_t spare = activeZoneProfile_.load(std::memory_order_relaxed) ^ 1;
+    zoneProfiles_[spare].build(snapshot);
+    activeZoneProfile_.store(spare, std::memory_order_release);
+}
+
 // ============================================================================
 // PENDING CHANGES MANAGEMENT
 // ============================================================================
@@ -494,7 +516,30 @@ void BaseMovementControllerClass::togglePause() {
     }
 }
 
+void BaseMovementControllerClass::onCalibrationComplete() {
+    if (!pendingStart_.armed.exchange(false, std::memory_order_acquire)) return;
+
+    // A sequence or another mode armed since: the queued start no longer applies
+    if (config.currentState != STATE_READY || seqState.isRunning || currentMovement != MOVEMENT_VAET) {
+        engine->debug("Calibration complete - queued start dropped");
+        return;
+    }
+    start(pendingStart_.distanceMM, pendingStart_.speedLevel);
+}
+
 void BaseMovementControllerClass::stop() {
+    cancelPendingStart();
+
+    // Calibration / positioning moves: abort on next motorTask tick.
+    // A sequence waiting on them would immediately re-issue the move, so stop it too.
+    if (Calibration.isBusy() || SeqExecutor.isPositioning()) {
+        Calibration.abort();
+        SeqExecutor.abortPositioningMove();
+        if (seqState.isRunning) {
+            SeqExecutor.stop();
+        }
+    }
+
     MutexGuard guard(stateMutex);
     if (!guard) {
         engine->warn("stop: mutex timeout");
@@ -516,6 +561,13 @@ void BaseMovementControllerClass::stop() {
         engine->debug("🌊 Oscillation stopped by stop()");
     }
 
+    // Stop trajectory playback (keyframe buffer kept for replay)
+    if (currentMovement == MOVEMENT_TRAJECTORY) {
+        Trajectory.stop();
+        currentMovement = MOVEMENT_VAET;
+        engine->debug("📈 Trajectory stopped by stop()");
+    }
+
     // Stop chaos if running (important for sequence stop)
     if (chaosState.isRunning) {
         chaosState.isRunning = false;
@@ -555,16 +607,19 @@ void BaseMovementControllerClass::start(float distMM, float speedLevel) {
         SeqExecutor.stop();
     }
 
-    // Auto-calibrate if not yet done
+    // Auto-calibrate if not yet done (non-blocking: onCalibrationComplete() starts once READY)
     if (config.totalDistanceMM == 0) {
         engine->warn("Not calibrated - auto-calibrating...");
-        Calibration.startCalibration();
-        if (config.totalDistanceMM == 0) return;
+        pendingStart_.distanceMM = distMM;
+        pendingStart_.speedLevel = speedLevel;
+        pendingStart_.armed.store(true, std::memory_order_release);
+        if (!Calibration.startCalibration() && !Calibration.isBusy()) cancelPendingStart();
+        return;
     }
 
     // State guard
     if (config.currentState == STATE_ERROR) {
-        Status.sendError("❌ Cannot start: System in ERROR state - Use 'Return to Start' or recalibrate");
+        Events.postError("❌ Cannot start: System in ERROR state - Use 'Return to Start' or recalibrate");
         return;
     }
     if (config.currentState != STATE_READY && config.currentState != STATE_PAUSED && config.currentState != STATE_RUNNING) {
@@ -574,7 +629,7 @@ void BaseMovementControllerClass::start(float distMM, float speedLevel) {
     // Validate and limit distance
     if (motion.startPositionMM + distMM > config.totalDistanceMM) {
         if (motion.startPositionMM >= config.totalDistanceMM) {
-            Status.sendError("❌ ERROR: Start position exceeds maximum");
+            Events.postError("❌ ERROR: Start position exceeds maximum");
             return;
         }
         distMM = config.totalDistanceMM - motion.startPositionMM;
@@ -599,8 +654,12 @@ void BaseMovementControllerClass::start(float distMM, float speedLevel) {
           String(speedLevel, 1) + " (" + String(MovementMath::speedLevelToCPM(speedLevel), 0) + " c/min)");
 
     calculateStepDelay();
-    lastStepMicros = micros();
+    stepClock.restart(micros());
     recalcStepPositions();
+    speedBlendRequested_[0].store(false);  // A fresh start switches to its speed
+    speedBlendRequested_[1].store(false);
+    phaseTrim_ = 0.0f;
+    phaseBiasTrim_ = 0.0f;
 
     config.currentState = STATE_RUNNING;
     currentMovement = MOVEMENT_VAET;
@@ -631,7 +690,7 @@ void BaseMovementControllerClass::start(float distMM, float speedLevel) {
 void BaseMovementControllerClass::returnToStart() {
     engine->info("🔄 Returning to start...");
 
-    if (config.currentState == STATE_RUNNING || config.currentState == STATE_PAUSED) {
+    if (config.currentState == STATE_RUNNING || config.currentState == STATE_PAUSED || SeqExecutor.isPositioning()) {
         stop();
         delay(100);
     }
@@ -641,30 +700,18 @@ void BaseMovementControllerClass::returnToStart() {
         engine->info("   → Recovering from ERROR state");
     }
 
-    Motor.enable();  // Enable motor
-    config.currentState = STATE_CALIBRATING;
-    sendStatus();  // Show calibration overlay
-    delay(50);
-
     // ============================================================================
     // Use Calibration.returnToStart() for precise positioning
     // This ensures position 0 is IDENTICAL to calibration position 0
     // (contact + decontact + SAFETY_OFFSET_STEPS)
+    // Non-blocking: runs from motorTask, ends in READY (or ERROR on failure)
     // ============================================================================
 
-    if (auto success = Calibration.returnToStart(); !success) {
-        // Error already logged by CalibrationManager
-        return;
+    if (!Calibration.returnToStart()) {
+        return;  // Already busy - logged by CalibrationManager
     }
 
-    // Reset position variables (already done in returnToStart, but explicit here)
-    currentStep = 0;
-    config.minStep = 0;
-
-    engine->info("✓ Return to start complete - Position synchronized with calibration");
-
-    // Keep motor enabled - HSS86 needs to stay synchronized
-    config.currentState = STATE_READY;
+    Events.post(StatusEvent::STATE);  // Show calibration overlay
 }
 
 // ============================================================================
@@ -672,7 +719,11 @@ void BaseMovementControllerClass::returnToStart() {
 // ============================================================================
 
 unsigned long BaseMovementControllerClass::applyZoneEffects(unsigned long baseDelay) {
-    float currentPositionMM = MovementMath::stepsToMM(currentStep - startStep);
+    // Distances (steps) to the start and end of the current pass
+    long amplitudeSteps = targetStep - startStep;
+    long travelledSteps = movingForward ? currentStep - startStep : targetStep - currentStep;
+    auto stepsFromStart = static_cast<uint32_t>(labs(travelledSteps));
+    auto stepsFromEnd = static_cast<uint32_t>(labs(amplitudeSteps - travelledSteps));
 
     // Mirror mode: swap enableStart/enableEnd on return trip (spatial effect only)
     bool effectiveEnableStart = zoneEffect.enableStart;
@@ -682,31 +733,26 @@ unsigned long BaseMovementControllerClass::applyZoneEffects(unsigned long baseDe
         effectiveEnableEnd = zoneEffect.enableStart;
     }
 
-    float movementStartMM;
-    float movementEndMM;
-    if (movingForward) {
-        movementStartMM = 0.0f;
-        movementEndMM = motion.targetDistanceMM;
-    } else {
-        movementStartMM = motion.targetDistanceMM;
-        movementEndMM = 0.0f;
+    // Random turnback: START zone when going backward, END zone when going forward
+    if (zoneEffect.randomTurnbackEnabled) {
+        float distanceFromEnd = MovementMath::stepsToMM(stepsFromEnd);
+        bool endZoneActive = movingForward ? effectiveEnableEnd : effectiveEnableStart;
+        if (endZoneActive && distanceFromEnd <= zoneEffect.zoneMM) {
+            checkAndTriggerRandomTurnback(zoneEffect.zoneMM - distanceFromEnd, movingForward);
+            if (zoneEffectState.isPausing) return baseDelay;
+        }
     }
 
-    float distanceFromEnd = abs(movementEndMM - currentPositionMM);
-
-    // Check random turnback in START zone (backward)
-    if (!movingForward && effectiveEnableStart && distanceFromEnd <= zoneEffect.zoneMM) {
-        checkAndTriggerRandomTurnback(zoneEffect.zoneMM - distanceFromEnd, false);
-        if (zoneEffectState.isPausing) return baseDelay;
-    }
+    if (zoneEffect.speedEffect == SPEED_NONE) return baseDelay;
 
-    // Check random turnback in END zone (forward)
-    if (movingForward && effectiveEnableEnd && distanceFromEnd <= zoneEffect.zoneMM) {
-        checkAndTriggerRandomTurnback(zoneEffect.zoneMM - distanceFromEnd, true);
-        if (zoneEffectState.isPausing) return baseDelay;
+    const ZoneProfile& profile = zoneProfiles_[activeZoneProfile_.load(std::memory_order_acquire)];
+    if (!profile.matches(zoneEffect)) [[unlikely]] {
+        return calculateAdjustedDelay(MovementMath::stepsToMM(travelledSteps), 0.0f,
+                                      MovementMath::stepsToMM(amplitudeSteps), baseDelay,
+                                      effectiveEnableStart, effectiveEnableEnd);
     }
-
-    return calculateAdjustedDelay(currentPositionMM, movementStartMM, movementEndMM, baseDelay, effectiveEnableStart, effectiveEnableEnd);
+    return ZoneProfile::scale(baseDelay, profile.factorFor(effectiveEnableStart, stepsFromStart,
+                                                           effectiveEnableEnd, stepsFromEnd));
 }
 
 void BaseMovementControllerClass::process() {
@@ -730,9 +776,14 @@ void BaseMovementControllerClass::process() {
         return;
     }
 
-    // Calculate current step delay
-    unsigned long currentMicros = micros();
-    unsigned long currentDelay = movingForward ? stepDelayMicrosForward : stepDelayMicrosBackward;
+    // Current step interval (StepScheduler Q24.8 µs - zone factor and phase trim are unit-free)
+    unsigned long currentDelay = movingForward ? blendedInterval(0, stepIntervalForward)
+                                               : blendedInterval(1, stepIntervalBackward);
+
+    // Wall-clock phase lock (multi-rig): trim decided at the last cycle boundary
+    if (Timeline.isPhaseLocked()) [[unlikely]] {
+        currentDelay = MovementMath::trimmedStepDelay(currentDelay, phaseTrim_);
+    }
 
     // Apply zone effects if enabled
     if (zoneEffect.enabled && hasReachedStartStep) {
@@ -740,9 +791,14 @@ void BaseMovementControllerClass::process() {
         if (zoneEffectState.isPausing) return;  // Turnback triggered pause
     }
 
-    // Check if enough time has passed for next step
-    if (currentMicros - lastStepMicros >= currentDelay) [[unlikely]] {
-        lastStepMicros = currentMicros;
+    // Learned rig limits (max rate + ramp after reversal)
+    unsigned long requestedMicros = StepScheduler::wholeMicros(currentDelay);
+    if (unsigned long governedMicros = Governor.govern(requestedMicros); governedMicros != requestedMicros) {
+        currentDelay = StepScheduler::fromMicros(governedMicros);
+    }
+
+    if (stepClock.due(micros(), currentDelay)) [[unlikely]] {
+        Telemetry.command(currentDelay);
         doStep();
     }
 }
@@ -751,6 +807,32 @@ void BaseMovementControllerClass::process() {
 // PRIVATE METHODS
 // ============================================================================
 
+uint32_t BaseMovementControllerClass::blendedInterval(uint8_t direction, uint32_t interval) {
+    constexpr float MICROS_FIXED = 1e6f * static_cast<float>(1u << StepScheduler::FRACTION_BITS);
+    SpeedBlend& blend = speedBlends_[direction];
+
+    if (interval != blend.interval) [[unlikely]] {
+        // Live speed change: blend the rate (steps/s); any other writer (start, cycle end, sequencer) switches
+        float rate = interval > 0 ? MICROS_FIXED / static_cast<float>(interval) : 0.0f;
+        if (speedBlendRequested_[direction].exchange(false) && blend.interval > 0 && rate > 0.0f) {
+            blend.rate.retarget(rate, millis(), VAET_SPEED_TRANSITION_MS);
+            blend.blending = true;
+        } else {
+            blend.rate.jump(rate);
+            blend.blending = false;
+        }
+        blend.interval = interval;
+    }
+    if (!blend.blending) [[likely]] return interval;
+
+    uint32_t nowMs = millis();
+    if (!blend.rate.isActive(nowMs)) {
+        blend.blending = false;
+        return interval;
+    }
+    return StepScheduler::toFixed(1e6f / blend.rate.value(nowMs));
+}
+
 void BaseMovementControllerClass::initPendingFromCurrent() {
     pendingMotion.startPositionMM = motion.startPositionMM;
     pendingMotion.distanceMM = motion.targetDistanceMM;
@@ -808,7 +890,7 @@ void BaseMovementControllerClass::doStepForward() {
     // Execute step (direction set once, not on every step)
     Motor.step();
     currentStep = currentStep + 1;
-    stats.trackDelta(currentStep);
+    stats.trackDelta(currentStep, currentMovement);
 }
 
 void BaseMovementControllerClass::doStepBackward() {
@@ -830,7 +912,7 @@ void BaseMovementControllerClass::doStepBackward() {
     // Execute step (direction set once, not on every step)
     Motor.step();
     currentStep = currentStep - 1;
-    stats.trackDelta(currentStep);
+    stats.trackDelta(currentStep, currentMovement);
 
     // Check if reached startStep (end of backward movement)
     if (currentStep <= startStep && hasReachedStartStep) [[unlikely]] {
@@ -866,6 +948,7 @@ void BaseMovementControllerClass::processCycleCompletion() {
 
     // Measure cycle timing
     measureCycleTime();
+    updatePhaseLock();
 
     // Prepare for next forward movement
     Motor.setDirection(true);
@@ -920,4 +1003,26 @@ void BaseMovementControllerClass::measureCycleTime() {
     wasAtStart = true;
 }
 
-// trackDistance() removed — callers use stats.trackDelta(currentStep) directly
\ No newline at end of file
+void BaseMovementControllerClass::updatePhaseLock() {
+    if (!Timeline.isPhaseLocked() || config.executionContext == CONTEXT_SEQUENCER) {
+        phaseTrim_ = 0.0f;
+        phaseBiasTrim_ = 0.0f;
+        return;
+    }
+
+    // Cycle boundaries belong on the grid anchor + k·T (T = nominal period)
+    float periodMs = MovementMath::vaetCyclePeriodMs(MovementMath::speedLevelToCPM(motion.speedLevelForward),
+                                                     MovementMath::speedLevelToCPM(motion.speedLevelBackward));
+    float wallPhase = MovementMath::anchoredPhase(Timeline.msSinceAnchor(), 1000.0f / periodMs);
+    float phaseError = MovementMath::wrapPhaseError(wallPhase);  // Boundary = local phase 0
+
+    phaseTrim_ = MovementMath::vaetPhaseLockTrim(phaseError, phaseBiasTrim_);
+    Timeline.reportPhaseError(phaseError * periodMs);
+
+    if (engine->isDebugEnabled()) {
+        engine->debug("🔗 VAET phase lock: error " + String(phaseError * periodMs, 0) + "ms → trim " +
+                      String(phaseTrim_ * 100.0f, 1) + "%");
+    }
+}
+
+// trackDistance() removed — callers use stats.trackDelta(currentStep, mode) directly
\ No newline at end of file
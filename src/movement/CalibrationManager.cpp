@@ -1,18 +1,29 @@
 // ============================================================================
 // CALIBRATION_MANAGER.CPP - Stepper Motor Calibration Controller
 // ============================================================================
-// Implementation of calibration logic
+// Implementation of calibration logic (resumable state machine, one step per
+// motorTask tick)
 // ============================================================================
 
 #include "movement/CalibrationManager.h"
 #include "core/GlobalState.h"
 #include "core/MovementMath.h"
 #include "core/UtilityEngine.h"
+#include "hardware/PositionVerifier.h"
 
 extern UtilityEngine* engine;
 
 using enum SystemState;
 
+// Non-blocking waits between phases (formerly serviceDelay()/delay())
+constexpr unsigned long CALIB_SETTLE_MS = 200;          // Motor enable settling time
+constexpr unsigned long CALIB_BACKOFF_SETTLE_MS = 100;  // After clearing an already-active opto
+constexpr unsigned long CALIB_RELEASE_SETTLE_MS = 10;   // Opto stabilization after safety margin
+constexpr unsigned long CALIB_DECONTACT_SETTLE_MS = 200;
+constexpr unsigned long CALIB_RETRY_DELAY_MS = 500;
+constexpr unsigned long CALIB_POSITION_TIMEOUT_MS = 30000;  // 30s safety timeout for 10% move
+constexpr long CALIB_MAX_EMERGENCY_STEPS = 300;
+
 // ============================================================================
 // SINGLETON INSTANCE
 // ============================================================================
@@ -32,69 +43,229 @@ void CalibrationManager::init() {
 }
 
 // ============================================================================
-// INTERNAL HELPERS
+// PUBLIC METHODS - Requests (any core)
 // ============================================================================
 
-void CalibrationManager::serviceDelay(unsigned long durationMs) {
-    unsigned long start = millis();
-    while (millis() - start < durationMs) {
-        yield();
-        delay(1);
+bool CalibrationManager::startCalibration() {
+    if (!initialized_) {
+        engine->error("CalibrationManager not initialized!");
+        return false;
+    }
+    if (isBusy()) {
+        engine->warn("⚠️ Calibration already in progress - request ignored");
+        return false;
     }
+
+    // Cooperative flag + state set immediately so callers on either core see it
+    rememberOrigin();
+    calibrationInProgress = true;
+    config.currentState = STATE_CALIBRATING;
+    pendingOp_ = Operation::FULL_CALIBRATION;
+    return true;
 }
 
-void CalibrationManager::yieldIfDue(unsigned long stepCount) {
-    if (stepCount % WEBSOCKET_SERVICE_INTERVAL_STEPS != 0) return;
-    yield();
+bool CalibrationManager::returnToStart() {
+    if (isBusy()) {
+        engine->warn("⚠️ Calibration in progress - return to start ignored");
+        return false;
+    }
+
+    rememberOrigin();
+    calibrationInProgress = true;
+    config.currentState = STATE_CALIBRATING;
+    pendingOp_ = Operation::RETURN_TO_START;
+    return true;
 }
 
-void CalibrationManager::positionAtOffset(long targetSteps) {
-    Motor.setDirection(true);  // Forward
-    const unsigned long startMs = millis();
-    constexpr unsigned long POSITION_TIMEOUT_MS = 30000;  // 30s safety timeout
-    while (currentStep < targetSteps) {
-        if (millis() - startMs > POSITION_TIMEOUT_MS) [[unlikely]] {
-            engine->error("❌ positionAtOffset timeout after " + String(POSITION_TIMEOUT_MS / 1000) + "s");
-            break;
+void CalibrationManager::rememberOrigin() {
+    originState_ = config.currentState;
+    originMaxStep_ = config.maxStep;
+    originDistanceMM_ = config.totalDistanceMM;
+}
+
+void CalibrationManager::abort() {
+    if (isBusy()) {
+        abortRequested_ = true;
+    }
+}
+
+// ============================================================================
+// STATE MACHINE - Tick (Core 1)
+// ============================================================================
+
+void CalibrationManager::process() {
+    if (abortRequested_) [[unlikely]] {
+        abortRequested_ = false;
+        bool fullCalibration = op_ == Operation::FULL_CALIBRATION || pendingOp_ == Operation::FULL_CALIBRATION;
+        pendingOp_ = Operation::NONE;
+        // Position tracking is still valid: steps were counted all along
+        engine->warn("⏹️ Calibration aborted at " + String(MovementMath::stepsToMM(currentStep), 1) + " mm");
+        if (fullCalibration) {
+            // An unvalidated END measurement does not replace the limits we started with
+            config.maxStep = originMaxStep_;
+            config.totalDistanceMM = originDistanceMM_;
         }
-        Motor.step();
-        currentStep = currentStep + 1;
-        delayMicroseconds(CALIB_DELAY);
-        yieldIfDue(static_cast<unsigned long>(currentStep));
+        config.currentState = MovementMath::calibrationAbortState(originState_, config.totalDistanceMM);
+        finishOperation();
+        return;
+    }
+
+    if (phase_ == Phase::IDLE) {
+        Operation op = pendingOp_;
+        if (op == Operation::NONE) return;
+        pendingOp_ = Operation::NONE;
+        beginOperation(op);
+    }
+
+    switch (phase_) {
+        case Phase::WAITING:
+            if (millis() - waitStartMs_ >= waitDurationMs_) {
+                phase_ = resumePhase_;
+            }
+            break;
+        case Phase::ATTEMPT:        beginAttempt(); break;
+        case Phase::LEG_BEGIN:      beginLeg(); break;
+        case Phase::BACKOFF:        tickBackoff(); break;
+        case Phase::DECONTACT_END:  tickDecontactEnd(); break;
+        case Phase::SEEK:           tickSeek(); break;
+        case Phase::RELEASE:        tickRelease(); break;
+        case Phase::SAFETY_MARGIN:  tickSafetyMargin(); break;
+        case Phase::LEG_DONE:       onLegComplete(); break;
+        case Phase::POSITIONING:    tickPositioning(); break;
+        case Phase::IDLE:           break;
     }
 }
 
-bool CalibrationManager::emergencyDecontactEnd() {
-    engine->warn("⚠️ Stuck at END - emergency decontact...");
-    Motor.setDirection(false);  // Backward
+// ============================================================================
+// STATE MACHINE - Transitions
+// ============================================================================
+
+void CalibrationManager::beginOperation(Operation op) {
+    op_ = op;
+    if (op == Operation::FULL_CALIBRATION) {
+        phase_ = Phase::ATTEMPT;
+        return;
+    }
 
-    int emergencySteps = 0;
-    const int MAX_EMERGENCY = 300;
+    engine->debug("Returning to START contact...");
+    Motor.enable();
+    leg_ = Leg::RETURN;
+    phase_ = Phase::LEG_BEGIN;
+}
 
-    // Move until opto clears (goes LOW)
-    while (Contacts.isEndActive() && emergencySteps < MAX_EMERGENCY) {
-        Motor.step();
-        currentStep = currentStep - 1;
-        emergencySteps++;
-        delayMicroseconds(CALIB_DELAY);
-
-        if (emergencySteps % 50 == 0) {
-            yield();
+void CalibrationManager::beginAttempt() {
+    engine->info(attemptCount_ == 0 ? "Starting calibration..." : "Retry calibration...");
+    config.currentState = STATE_CALIBRATING;
+
+    Motor.enable();
+    leg_ = Leg::START;
+    waitThen(CALIB_SETTLE_MS, Phase::LEG_BEGIN);
+}
+
+void CalibrationManager::beginLeg() {
+    phaseSteps_ = 0;
+    lastStepMicros_ = micros();
+
+    if (leg_ == Leg::RETURN) {
+        // Check if stuck at END contact (HIGH = opto blocked = still on contact)
+        Motor.setDirection(false);  // Backward
+        if (Contacts.isEndActive()) {
+            engine->warn("⚠️ Stuck at END - emergency decontact...");
+            phase_ = Phase::DECONTACT_END;
+        } else {
+            phase_ = Phase::SEEK;
         }
+        return;
     }
 
-    if (emergencySteps >= MAX_EMERGENCY) {
-        if (errorCallback_) {
-            errorCallback_("❌ Cannot release from END contact");
-        }
-        Motor.disable();
-        config.currentState = STATE_ERROR;
-        return false;
+    // Check if already on the contact (opto HIGH = blocked = already triggered)
+    if (Contacts.isActive(legPin())) {
+        engine->info(String("⚠️ Already on ") + legName() + " opto - backing off first...");
+        Motor.setDirection(!legSeekForward());
+        phase_ = Phase::BACKOFF;
+        return;
     }
 
-    engine->info("✓ Release successful (" + String(emergencySteps) + " steps)");
-    delay(200);
-    return true;
+    Motor.setDirection(legSeekForward());
+    phase_ = Phase::SEEK;
+}
+
+void CalibrationManager::onLegComplete() {
+    switch (leg_) {
+        case Leg::START:
+            // THIS position = new logical zero
+            config.minStep = 0;
+            currentStep = 0;
+            engine->debug("✓ Position 0 set");
+
+            leg_ = Leg::END;
+            beginLeg();
+            break;
+
+        case Leg::END:
+            // This position = maxStep
+            maxStep_ = currentStep;
+            totalDistanceMM_ = MovementMath::stepsToMM(maxStep_);
+            config.maxStep = maxStep_;
+            config.totalDistanceMM = totalDistanceMM_;
+
+            // Check distance is within acceptable range (returns tri-state)
+            if (int distResult = validateDistance(); distResult != 0) {
+                if (distResult < 0) finishOperation();
+                else waitThen(CALIB_RETRY_DELAY_MS, Phase::ATTEMPT);
+                return;
+            }
+
+            engine->debug("Returning to START contact...");
+            leg_ = Leg::RETURN;
+            beginLeg();
+            break;
+
+        case Leg::RETURN:
+            // Residual offset vs. calibrated zero, captured before re-zeroing
+            returnErrorSteps_ = currentStep;
+            currentStep = 0;
+            PosVerifier.resetTracking();  // Re-synchronized on the START contact
+
+            if (op_ == Operation::RETURN_TO_START) {
+                config.minStep = 0;
+                engine->info("✓ Return to start complete - Position synchronized with calibration");
+                // Keep motor enabled - HSS86 needs to stay synchronized
+                config.currentState = STATE_READY;
+                finishOperation();
+                return;
+            }
+
+            // Check return-to-start accuracy is within tolerance (returns tri-state)
+            if (int accResult = validateCalibrationAccuracy(); accResult != 0) {
+                if (accResult < 0) finishOperation();
+                else waitThen(CALIB_RETRY_DELAY_MS, Phase::ATTEMPT);
+                return;
+            }
+
+            beginFinalPositioning();
+            break;
+    }
+}
+
+void CalibrationManager::waitThen(unsigned long durationMs, Phase next) {
+    waitStartMs_ = millis();
+    waitDurationMs_ = durationMs;
+    resumePhase_ = next;
+    phase_ = Phase::WAITING;
+}
+
+void CalibrationManager::finishOperation() {
+    phase_ = Phase::IDLE;
+    op_ = Operation::NONE;
+    calibrationInProgress = false;
+}
+
+void CalibrationManager::failOperation() {
+    if (op_ == Operation::FULL_CALIBRATION) {
+        handleFailure();
+    }
+    finishOperation();
 }
 
 bool CalibrationManager::handleFailure() {
@@ -113,109 +284,181 @@ bool CalibrationManager::handleFailure() {
 }
 
 // ============================================================================
-// CONTACT DETECTION
+// STEP HELPERS
+// ============================================================================
+
+bool CalibrationManager::stepDue(unsigned long delayMicros) {
+    unsigned long now = micros();
+    if (now - lastStepMicros_ < delayMicros) return false;
+    lastStepMicros_ = now;
+    return true;
+}
+
+void CalibrationManager::stepOnce(bool moveForward) {
+    Motor.step();
+    currentStep = currentStep + (moveForward ? 1 : -1);
+    phaseSteps_++;
+}
+
+uint8_t CalibrationManager::legPin() const {
+    return (leg_ == Leg::END) ? PIN_END_CONTACT : PIN_START_CONTACT;
+}
+
+bool CalibrationManager::legSeekForward() const {
+    return leg_ == Leg::END;
+}
+
+const char* CalibrationManager::legName() const {
+    return (leg_ == Leg::END) ? "END" : "START";
+}
+
+// ============================================================================
+// CONTACT DETECTION - Per-phase ticks
 // ============================================================================
 // OPTO LOGIC: HIGH = blocked/active, LOW = clear/inactive
 
-bool CalibrationManager::findContact(bool moveForward, uint8_t contactPin, const char* contactName) {
-    Motor.setDirection(moveForward);
-    unsigned long stepCount = 0;
+void CalibrationManager::tickBackoff() {
+    // Back off in opposite direction until opto clears (goes LOW)
+    if (phaseSteps_ >= SAFETY_OFFSET_STEPS * 2) {
+        engine->error("❌ Cannot clear " + String(legName()) + " opto!");
+        failOperation();
+        return;
+    }
 
-    // Check if already on the contact (opto HIGH = blocked = already triggered)
-    if (Contacts.isActive(contactPin)) {
-        engine->info(String("⚠️ Already on ") + contactName + " opto - backing off first...");
-
-        // Back off in opposite direction until opto clears (goes LOW)
-        Motor.setDirection(!moveForward);
-        int backoffSteps = 0;
-        while (Contacts.isActive(contactPin) && backoffSteps < SAFETY_OFFSET_STEPS * 2) {
-            Motor.step();
-            currentStep = currentStep + (!moveForward ? -1 : 1);  // 🔧 FIX: Track position during backoff
-            backoffSteps++;
-            delayMicroseconds(CALIB_DELAY * CALIBRATION_SLOW_FACTOR);
-        }
+    if (Contacts.isClear(legPin())) {
+        engine->info("✓ Cleared opto after " + String(phaseSteps_) + " steps, continuing calibration...");
+        Motor.setDirection(legSeekForward());
+        phaseSteps_ = 0;
+        waitThen(CALIB_BACKOFF_SETTLE_MS, Phase::SEEK);
+        return;
+    }
 
-        if (backoffSteps >= SAFETY_OFFSET_STEPS * 2) {
-            engine->error("❌ Cannot clear " + String(contactName) + " opto!");
-            return false;
-        }
+    if (!stepDue(CALIB_DELAY * CALIBRATION_SLOW_FACTOR)) return;
+    stepOnce(!legSeekForward());
+}
 
-        engine->info("✓ Cleared opto after " + String(backoffSteps) + " steps, continuing calibration...");
-        Motor.setDirection(moveForward);
-        serviceDelay(100);
+void CalibrationManager::tickDecontactEnd() {
+    // Move until opto clears (goes LOW)
+    if (!Contacts.isEndActive()) {
+        engine->info("✓ Release successful (" + String(phaseSteps_) + " steps)");
+        phaseSteps_ = 0;
+        waitThen(CALIB_DECONTACT_SETTLE_MS, Phase::SEEK);
+        return;
     }
 
-    // Search for contact: move while opto is LOW (clear), stop when HIGH (blocked)
-    while (Contacts.isClear(contactPin)) {
-        Motor.step();
-        currentStep = currentStep + (moveForward ? 1 : -1);
-        delayMicroseconds(CALIB_DELAY);
-        stepCount++;
-
-        yieldIfDue(stepCount);
-
-        // Timeout protection
-        if (stepCount > CALIBRATION_MAX_STEPS) {
-            String errorMsg = "❌ ERROR: Contact ";
-            errorMsg += contactName;
-            errorMsg += " not found";
-            if (errorCallback_) errorCallback_(errorMsg);
-            Motor.disable();
-            config.currentState = STATE_ERROR;
-            return false;
+    if (phaseSteps_ >= CALIB_MAX_EMERGENCY_STEPS) {
+        if (errorCallback_) {
+            errorCallback_("❌ Cannot release from END contact");
         }
+        Motor.disable();
+        config.currentState = STATE_ERROR;
+        failOperation();
+        return;
     }
 
-    // Validate END contact distance (sanity check - not a retry loop)
-    if (contactPin == PIN_END_CONTACT) {
-        long detectedSteps = abs(currentStep);
-        long minExpectedSteps = MovementMath::mmToSteps(HARD_MIN_DISTANCE_MM);
+    if (!stepDue(CALIB_DELAY)) return;
+    stepOnce(false);
+}
+
+void CalibrationManager::tickSeek() {
+    // Search for contact: move while opto is LOW (clear), stop when HIGH (blocked)
+    if (Contacts.isActive(legPin())) {
+        if (leg_ == Leg::END) {
+            // Validate END contact distance (sanity check - not a retry loop)
+            long detectedSteps = abs(currentStep);
+            long minExpectedSteps = MovementMath::mmToSteps(HARD_MIN_DISTANCE_MM);
+
+            if (detectedSteps < minExpectedSteps) {
+                engine->error("❌ Opto END detected too early (" +
+                             String(detectedSteps) + " < " + String(minExpectedSteps) + " steps)");
+                engine->error("→ Check wiring or opto sensor positions");
+                failOperation();
+                return;
+            }
+        }
+
+        engine->debug(leg_ == Leg::RETURN ? "START contact detected - releasing..."
+                                          : String("✓ ") + legName() + " contact found - releasing slowly...");
+        Motor.setDirection(!legSeekForward());
+        phaseSteps_ = 0;
+        phase_ = Phase::RELEASE;
+        return;
+    }
 
-        if (detectedSteps < minExpectedSteps) {
-            engine->error("❌ Opto END detected too early (" +
-                         String(detectedSteps) + " < " + String(minExpectedSteps) + " steps)");
-            engine->error("→ Check wiring or opto sensor positions");
-            return false;  // Fail without infinite retry
+    // Timeout protection
+    if (leg_ == Leg::RETURN) {
+        if (currentStep < -CALIBRATION_ERROR_MARGIN_STEPS) {
+            if (errorCallback_) {
+                errorCallback_("❌ Cannot return to START contact");
+            }
+            Motor.disable();
+            config.currentState = STATE_ERROR;
+            failOperation();
+            return;
         }
+    } else if (phaseSteps_ > CALIBRATION_MAX_STEPS) {
+        String errorMsg = "❌ ERROR: Contact ";
+        errorMsg += legName();
+        errorMsg += " not found";
+        if (errorCallback_) errorCallback_(errorMsg);
+        Motor.disable();
+        config.currentState = STATE_ERROR;
+        failOperation();
+        return;
     }
 
-    return true;
+    if (!stepDue(CALIB_DELAY)) return;
+    stepOnce(legSeekForward());
 }
 
-void CalibrationManager::releaseContact(uint8_t contactPin, bool moveForward) {
-    Motor.setDirection(moveForward);
-
+void CalibrationManager::tickRelease() {
     // Move slowly until opto clears (HIGH->LOW transition)
     // Timeout: if we can't release within SAFETY_OFFSET_STEPS*4 steps, sensor is stuck
-    int releaseSteps = 0;
-    const int MAX_RELEASE_STEPS = SAFETY_OFFSET_STEPS * 4;
-    while (Contacts.isActive(contactPin) && releaseSteps < MAX_RELEASE_STEPS) {
-        Motor.step();
-        if (!moveForward) currentStep = currentStep - 1;
-        else currentStep = currentStep + 1;
-        releaseSteps++;
-        delayMicroseconds(CALIB_DELAY * CALIBRATION_SLOW_FACTOR * 2);
+    if (phaseSteps_ >= SAFETY_OFFSET_STEPS * 4) {
+        if (leg_ == Leg::RETURN) {
+            engine->error("❌ Cannot release START contact in returnToStart()");
+            Motor.disable();
+            config.currentState = STATE_ERROR;
+            failOperation();
+            return;
+        }
+        // Calibration legs: continue without margin, distance validation catches bad results
+        engine->error("❌ Cannot release contact - sensor stuck after " + String(phaseSteps_) + " steps");
+        phase_ = Phase::LEG_DONE;
+        return;
     }
 
-    if (releaseSteps >= MAX_RELEASE_STEPS) {
-        engine->error("❌ Cannot release contact - sensor stuck after " + String(releaseSteps) + " steps");
-        return;  // 🔧 FIX: Abort if sensor stuck — don't proceed with incorrect position
+    if (Contacts.isClear(legPin())) {
+        phaseSteps_ = 0;
+        phase_ = Phase::SAFETY_MARGIN;
+        return;
     }
 
-    // Add safety margin
-    for (int i = 0; i < SAFETY_OFFSET_STEPS; i++) {
-        Motor.step();
-        if (!moveForward) currentStep = currentStep - 1;
-        else currentStep = currentStep + 1;
-        delayMicroseconds(CALIB_DELAY * CALIBRATION_SLOW_FACTOR);
+    if (!stepDue(CALIB_DELAY * CALIBRATION_SLOW_FACTOR * 2)) return;
+    stepOnce(!legSeekForward());
+}
+
+void CalibrationManager::tickSafetyMargin() {
+    if (phaseSteps_ >= SAFETY_OFFSET_STEPS) {
+        if (leg_ == Leg::RETURN) {
+            phase_ = Phase::LEG_DONE;
+        } else {
+            // Settling time for opto sensor stabilization
+            waitThen(CALIB_RELEASE_SETTLE_MS, Phase::LEG_DONE);
+        }
+        return;
     }
 
-    // Settling time for opto sensor stabilization
-    delay(10);
+    if (!stepDue(CALIB_DELAY * CALIBRATION_SLOW_FACTOR)) return;
+    stepOnce(!legSeekForward());
 }
 
+// ============================================================================
+// VALIDATION
+// ============================================================================
+
 float CalibrationManager::validateAccuracy() {
-    long stepDifference = abs(currentStep);
+    long stepDifference = abs(returnErrorSteps_);
     float differencePercent = (maxStep_ > 0) ?
         ((float)stepDifference / (float)maxStep_) * 100.0f : 0.0f;
 
@@ -230,88 +473,6 @@ float CalibrationManager::validateAccuracy() {
     return differencePercent;
 }
 
-// ============================================================================
-// PUBLIC METHODS
-// ============================================================================
-
-bool CalibrationManager::startCalibration() {
-    if (!initialized_) {
-        engine->error("CalibrationManager not initialized!");
-        return false;
-    }
-
-    // Loop for retries (replaces recursive calls to avoid stack overflow on Core 1)
-    while (true) {
-
-    engine->info(attemptCount_ == 0 ? "Starting calibration..." : "Retry calibration...");
-    config.currentState = STATE_CALIBRATING;
-
-    // Send status updates
-    if (statusCallback_) {
-        for (int i = 0; i < 5; i++) {
-            statusCallback_();
-            serviceDelay(20);
-        }
-    }
-
-    Motor.enable();
-    serviceDelay(200);  // Settling time
-
-    // ========================================
-    // Step 1: Find START contact
-    // ========================================
-    if (!findContact(false, PIN_START_CONTACT, "START")) {
-        return handleFailure();
-    }
-
-    engine->debug("✓ Start contact found - releasing slowly...");
-    releaseContact(PIN_START_CONTACT, true);  // Move forward to release
-
-    // THIS position = new logical zero
-    config.minStep = 0;
-    currentStep = 0;
-    engine->debug("✓ Position 0 set");
-
-    // ========================================
-    // Step 2: Find END contact
-    // ========================================
-    if (!findContact(true, PIN_END_CONTACT, "END")) {
-        return handleFailure();
-    }
-
-    engine->debug("✓ End contact found - releasing slowly...");
-    releaseContact(PIN_END_CONTACT, false);  // Move backward to release
-
-    // This position = maxStep
-    maxStep_ = currentStep;
-    totalDistanceMM_ = MovementMath::stepsToMM(maxStep_);
-    config.maxStep = maxStep_;
-    config.totalDistanceMM = totalDistanceMM_;
-
-    // Check distance is within acceptable range (returns tri-state)
-    if (int distResult = validateDistance(); distResult != 0) {
-        if (distResult < 0) return false;
-        continue;
-    }
-
-    // ========================================
-    // Step 3: Return to START
-    // ========================================
-    if (!returnToStart()) {
-        return handleFailure();
-    }
-
-    // Check return-to-start accuracy is within tolerance (returns tri-state)
-    if (int accResult = validateCalibrationAccuracy(); accResult != 0) {
-        if (accResult < 0) return false;
-        continue;
-    }
-
-    return finalizeCalibration();
-
-    } // end while(true) retry loop
-}
-
 /**
  * Validate calibrated distance range.
  * @return 0=OK, 1=retry needed, -1=fatal failure
@@ -330,7 +491,6 @@ int CalibrationManager::validateDistance() {
             return -1;
         }
         engine->warn("⚠️ Distance too short - Retry " + String(attemptCount_));
-        serviceDelay(500);
         return 1;
     }
 
@@ -365,22 +525,47 @@ int CalibrationManager::validateCalibrationAccuracy() {
     }
 
     engine->warn("⚠️ Error too large - Retry");
-    serviceDelay(500);
     return 1;
 }
 
-/** Position at 10% and finalize calibrated state. */
-bool CalibrationManager::finalizeCalibration() {
+// ============================================================================
+// FINAL POSITIONING
+// ============================================================================
+
+void CalibrationManager::beginFinalPositioning() {
     currentStep = 0;
     config.minStep = 0;
 
     // Position at 10% of total distance (rounded up to nearest mm)
     float tenPercentMM = ceil(totalDistanceMM_ * 0.1f);
-    long targetSteps = MovementMath::mmToSteps(tenPercentMM);
+    positionTargetStep_ = MovementMath::mmToSteps(tenPercentMM);
 
     engine->info("📍 Positioning at 10% (" + String(tenPercentMM, 0) + " mm)...");
-    positionAtOffset(targetSteps);
+    Motor.setDirection(true);  // Forward
+    phaseStartMs_ = millis();
+    lastStepMicros_ = micros();
+    phase_ = Phase::POSITIONING;
+}
 
+void CalibrationManager::tickPositioning() {
+    if (currentStep >= positionTargetStep_) {
+        finalizeCalibration();
+        return;
+    }
+
+    if (millis() - phaseStartMs_ > CALIB_POSITION_TIMEOUT_MS) [[unlikely]] {
+        engine->error("❌ positionAtOffset timeout after " + String(CALIB_POSITION_TIMEOUT_MS / 1000) + "s");
+        finalizeCalibration();
+        return;
+    }
+
+    if (!stepDue(CALIB_DELAY)) return;
+    stepOnce(true);
+}
+
+/** Finalize calibrated state once positioned at 10%. */
+bool CalibrationManager::finalizeCalibration() {
+    float tenPercentMM = ceil(totalDistanceMM_ * 0.1f);
     motion.startPositionMM = tenPercentMM;
     engine->info("✓ Start position set to " + String(tenPercentMM, 0) + " mm");
 
@@ -389,6 +574,7 @@ bool CalibrationManager::finalizeCalibration() {
     attemptCount_ = 0;
 
     engine->info("✓ Calibration complete");
+    finishOperation();
 
     if (completionCallback_) {
         completionCallback_();
@@ -397,73 +583,10 @@ bool CalibrationManager::finalizeCalibration() {
     return true;
 }
 
-bool CalibrationManager::returnToStart() {
-    engine->debug("Returning to START contact...");
-
-    // Check if stuck at END contact (HIGH = opto blocked = still on contact)
-    if (Contacts.isEndActive() && !emergencyDecontactEnd()) {
-        return false;
-    }
-
-    // Search for START contact: move backward while opto is LOW (clear), stop when HIGH (blocked)
-    Motor.setDirection(false);  // Backward
-
-    while (Contacts.isStartClear()) {
-        Motor.step();
-        currentStep = currentStep - 1;
-        delayMicroseconds(CALIB_DELAY);
-
-        yieldIfDue(static_cast<unsigned long>(abs(currentStep)));
-
-        if (currentStep < -CALIBRATION_ERROR_MARGIN_STEPS) {
-            if (errorCallback_) {
-                errorCallback_("❌ Cannot return to START contact");
-            }
-            Motor.disable();
-            config.currentState = STATE_ERROR;
-            return false;
-        }
-    }
-
-    // Release contact: move forward while opto is HIGH (blocked), until it goes LOW (clear)
-    engine->debug("START contact detected - releasing...");
-    Motor.setDirection(true);  // Forward
-
-    int releaseCount = 0;
-    const int MAX_RELEASE = SAFETY_OFFSET_STEPS * 4;
-    while (Contacts.isStartActive() && releaseCount < MAX_RELEASE) {
-        Motor.step();
-        currentStep = currentStep + 1;
-        releaseCount++;
-        delayMicroseconds(CALIB_DELAY * CALIBRATION_SLOW_FACTOR * 2);
-    }
-
-    if (releaseCount >= MAX_RELEASE) {
-        engine->error("❌ Cannot release START contact in returnToStart()");
-        Motor.disable();
-        config.currentState = STATE_ERROR;
-        return false;
-    }
-
-    // Add safety margin
-    for (int i = 0; i < SAFETY_OFFSET_STEPS; i++) {
-        Motor.step();
-        currentStep = currentStep + 1;
-        delayMicroseconds(CALIB_DELAY * CALIBRATION_SLOW_FACTOR);
-    }
-
-    currentStep = 0;
-    return true;
-}
-
 // ============================================================================
 // CALLBACK SETTERS
 // ============================================================================
 
-void CalibrationManager::setStatusCallback(void (*callback)()) {  // NOSONAR(cpp:S5205)
-    statusCallback_ = callback;
-}
-
 void CalibrationManager::setErrorCallback(void (*callback)(const String& msg)) {  // NOSONAR(cpp:S5205)
     errorCallback_ = callback;
 }
@@ -7,12 +7,15 @@
  */
 
 #include "movement/ChaosController.h"
-#include "communication/StatusBroadcaster.h"  // For Status.sendError()
+#include "communication/StatusEvents.h"  // For Events.postError()
+#include "communication/TelemetryStream.h"
 #include "core/UtilityEngine.h"
 #include "core/MovementMath.h"
 #include "core/Validators.h"
 #include "hardware/MotorDriver.h"
 #include "movement/SequenceExecutor.h"
+#include "movement/SpeedCalibration.h"
+#include "movement/StepRateGovernor.h"
 
 using enum ChaosPattern;
 using enum SystemState;
@@ -128,7 +131,7 @@ bool ChaosController::checkLimits() {
 
         float distanceToEndLimitMM = config.totalDistanceMM - maxChaosPositionMM;
         if (distanceToEndLimitMM <= HARD_DRIFT_TEST_ZONE_MM && Contacts.isEndActive()) {
-            Status.sendError("❌ CHAOS: END contact triggered - amplitude near limit");
+            Events.postError("❌ CHAOS: END contact triggered - amplitude near limit");
             config.currentState = STATE_ERROR;
             chaosState.isRunning = false;
             return false;
@@ -146,7 +149,7 @@ bool ChaosController::checkLimits() {
         }
 
         if (minChaosPositionMM <= HARD_DRIFT_TEST_ZONE_MM && Contacts.isStartActive()) {
-            Status.sendError("❌ CHAOS: START contact triggered - amplitude near limit");
+            Events.postError("❌ CHAOS: START contact triggered - amplitude near limit");
             config.currentState = STATE_ERROR;
             chaosState.isRunning = false;
             return false;
@@ -191,7 +194,7 @@ void ChaosController::doStep() {
         currentStep = currentStep + 1;
 
         // Track distance using StatsTracking
-        stats.trackDelta(currentStep);
+        stats.trackDelta(currentStep, MOVEMENT_CHAOS);
 
     } else {
         // ═══════════════════════════════════════════════════════════════════
@@ -222,7 +225,7 @@ void ChaosController::doStep() {
         currentStep = currentStep - 1;
 
         // Track distance using StatsTracking
-        stats.trackDelta(currentStep);
+        stats.trackDelta(currentStep, MOVEMENT_CHAOS);
     }
 }
 
@@ -231,7 +234,14 @@ void ChaosController::doStep() {
 // ============================================================================
 
 void ChaosController::calculateStepDelay() {
-    chaosState.stepDelay = MovementMath::chaosStepDelay(chaosState.currentSpeedLevel);
+    chaosState.stepDelay = Speeds.table().chaosStepDelay(chaosState.currentSpeedLevel);
+
+    // Pattern speed changes blend (S-curve) from the rate being played
+    float rate = 1e6f / static_cast<float>(max(chaosState.stepDelay, 1UL));
+    if (rate != rateBlend_.target()) {
+        rateBlend_.retarget(rate, millis(), CHAOS_SPEED_TRANSITION_MS);
+        rateBlending_ = true;
+    }
 }
 
 // ============================================================================
@@ -828,10 +838,17 @@ void ChaosController::processAtTarget(float effectiveMinLimit, float effectiveMa
 void ChaosController::executeMovementStep() {
     if (currentStep == targetStep) return;
 
-    unsigned long currentMicros = micros();
-    if (currentMicros - chaosState.lastStepMicros < chaosState.stepDelay) return;
+    unsigned long delayMicros = chaosState.stepDelay;
+    if (rateBlending_) [[unlikely]] {
+        uint32_t nowMs = millis();
+        rateBlending_ = rateBlend_.isActive(nowMs);
+        if (rateBlending_) delayMicros = static_cast<unsigned long>(1e6f / rateBlend_.value(nowMs));
+    }
+
+    uint32_t interval = StepScheduler::fromMicros(Governor.govern(delayMicros));
+    if (!chaosState.stepClock.due(micros(), interval)) return;
 
-    chaosState.lastStepMicros = currentMicros;
+    Telemetry.command(interval);
     doStep();
 
     float currentPos = MovementMath::stepsToMM(currentStep);
@@ -887,34 +904,47 @@ void ChaosController::start() {
     chaosState.minReachedMM = MovementMath::stepsToMM(currentStep);
     chaosState.maxReachedMM = chaosState.minReachedMM;
     chaosState.patternsExecuted = 0;
-    chaosState.lastStepMicros = micros();
+    chaosState.stepClock.restart(micros());
 
-    // Move to center if needed
+    // Move to center if needed (non-blocking: beginPatterns() runs on arrival)
     float currentPosMM = MovementMath::stepsToMM(currentStep);
     if (abs(currentPosMM - chaos.centerPositionMM) > 1.0f) {
         engine->info("🎯 Moving to center: " + String(chaos.centerPositionMM, 1) + " mm");
         targetStep = MovementMath::mmToSteps(chaos.centerPositionMM);
 
         Motor.enable();
+        SeqExecutor.beginPositioningMove(targetStep, SequenceExecutor::PositioningPurpose::CHAOS_CENTER);
+        return;
+    }
 
-        if (!SeqExecutor.blockingMoveToStep(targetStep)) {
-            engine->warn("⚠️ Timeout during center positioning");
-            engine->error("❌ Chaos mode aborted - failed to reach center position");
+    beginPatterns();
+}
 
-            chaosState.isRunning = false;
-            config.currentState = STATE_READY;
-            currentMovement = MOVEMENT_VAET;
-            Motor.disable();
+void ChaosController::onCenterReached(bool reached) {
+    if (!chaosState.isRunning) return;  // Stopped while moving to center
 
-            Status.sendError("Cannot reach center - timeout after 30s. Check that the motor can move freely.");
-            Status.send();
-            return;
-        }
+    if (!reached) {
+        engine->warn("⚠️ Timeout during center positioning");
+        engine->error("❌ Chaos mode aborted - failed to reach center position");
+
+        chaosState.isRunning = false;
+        config.currentState = STATE_READY;
+        currentMovement = MOVEMENT_VAET;
+        Motor.disable();
+
+        Events.postError("Cannot reach center - timeout after 30s. Check that the motor can move freely.");
+        return;
     }
 
+    beginPatterns();
+}
+
+void ChaosController::beginPatterns() {
     // Generate first pattern (generatePattern now syncs targetStep via setTargetMM)
     generatePattern();
     calculateStepDelay();
+    rateBlend_.jump(rateBlend_.target());  // From standstill: nothing to blend from
+    rateBlending_ = false;
 
     if (engine->isDebugEnabled()) {
         engine->debug(String("🎲 Pattern: ") + CHAOS_PATTERN_NAMES[static_cast<int>(chaosState.currentPattern)] +
@@ -0,0 +1,110 @@
+// ============================================================================
+// MOTION_TIMELINE.CPP - Scheduled starts + wall-clock phase lock (multi-rig)
+// ============================================================================
+
+#include "movement/MotionTimeline.h"
+#include "communication/StatusEvents.h"  // For Events.postError()
+#include "core/GlobalState.h"
+#include "core/TimeUtils.h"
+#include "core/UtilityEngine.h"
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+MotionTimeline& MotionTimeline::getInstance() {
+    static MotionTimeline instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+void MotionTimeline::begin() {
+    m_mutex = xSemaphoreCreateMutex();
+}
+
+// ============================================================================
+// SCHEDULED START (Core 0)
+// ============================================================================
+
+bool MotionTimeline::schedule(const char* cmd, const String& message, int64_t startAtMs) {
+    if (!TimeUtils::isSynchronized()) {
+        Events.postError("❌ startAt requires a synchronized clock (NTP or syncTime)");
+        return false;
+    }
+
+    int64_t leadMs = startAtMs - TimeUtils::epochMillis();
+    if (leadMs > TIMELINE_MAX_LEAD_MS) {
+        Events.postError(("❌ startAt is too far ahead (" + String((long)(leadMs / 1000)) + "s > " +
+                          String(TIMELINE_MAX_LEAD_MS / 1000) + "s)").c_str());
+        return false;
+    }
+    if (leadMs < -(int64_t)TIMELINE_MAX_LATE_MS) {
+        Events.postError(("❌ startAt already passed (" + String((long)-leadMs) + "ms ago) - check clock sync").c_str());
+        return false;
+    }
+
+    MutexGuard guard(m_mutex);
+    if (!guard) {
+        engine->warn("MotionTimeline::schedule: mutex timeout");
+        return false;
+    }
+
+    if (m_pending) {
+        engine->info("⏱️ Scheduled " + m_pendingCmd + " replaced");
+    }
+    m_pendingMessage = message;
+    m_pendingCmd = cmd;
+    m_pendingStartAtMs = startAtMs;
+    m_pending = true;
+
+    engine->info("⏱️ " + String(cmd) + " scheduled in " + String((long)max(leadMs, (int64_t)0)) + "ms");
+    return true;
+}
+
+bool MotionTimeline::takeDue(String& message) {
+    if (!m_pending) [[likely]] return false;
+
+    MutexGuard guard(m_mutex);
+    if (!guard || !m_pending) return false;
+    if (TimeUtils::epochMillis() < m_pendingStartAtMs) return false;
+
+    message = m_pendingMessage;
+    m_pendingMessage = "";
+    m_pending = false;
+    return true;
+}
+
+void MotionTimeline::cancel() {
+    m_phaseLocked = false;
+    if (!m_pending) return;
+
+    MutexGuard guard(m_mutex);
+    if (!guard) return;
+    if (m_pending) {
+        engine->info("⏱️ Scheduled " + m_pendingCmd + " cancelled");
+        m_pending = false;
+        m_pendingMessage = "";
+    }
+}
+
+// ============================================================================
+// PHASE LOCK
+// ============================================================================
+
+bool MotionTimeline::lockPhase(int64_t anchorMs) {
+    if (!TimeUtils::isSynchronized()) {
+        engine->warn("⚠️ phaseAnchor ignored: clock not synchronized");
+        m_phaseLocked = false;
+        return false;
+    }
+
+    // Core 1 never reads the anchor while unlocked
+    m_phaseLocked = false;
+    m_anchorMs = anchorMs;
+    m_lastPhaseErrorMs = 0.0f;
+    m_phaseLocked = true;
+    return true;
+}
+
+int64_t MotionTimeline::msSinceAnchor() const {
+    return TimeUtils::epochMillis() - m_anchorMs;
+}
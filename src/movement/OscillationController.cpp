@@ -9,12 +9,16 @@
  */
 
 #include "movement/OscillationController.h"
-#include "communication/StatusBroadcaster.h"  // For Status.sendError()
+#include "communication/StatusEvents.h"
 #include "core/Validators.h"
 #include "core/MovementMath.h"
 #include "hardware/MotorDriver.h"
 #include "hardware/ContactSensors.h"
 #include "movement/SequenceExecutor.h"
+#include "movement/StepRateGovernor.h"
+#include "movement/MotionTimeline.h"
+#include "movement/WaveformLibrary.h"
+#include "core/Transition.h"
 
 using enum SystemState;
 using enum OscillationWaveform;
@@ -30,34 +34,28 @@ constinit CyclePauseState oscPauseState;
 float actualOscillationSpeedMMS = 0.0f;
 
 // ============================================================================
-// LOCAL SINE LOOKUP TABLE (for fast oscillation waveform calculation)
+// WAVEFORM TABLES (see WaveformTable.h)
 // ============================================================================
 
-#ifdef USE_SINE_LOOKUP_TABLE
-static std::array<float, SINE_TABLE_SIZE> sineTable;
-static bool sineTableInitialized = false;
-
-static void initSineTable() {
-    if (sineTableInitialized) return;
-    for (int i = 0; i < SINE_TABLE_SIZE; i++) {
-        sineTable[i] = -cosf((static_cast<float>(i) / static_cast<float>(SINE_TABLE_SIZE)) * 2.0f * PI_F);
+/** Table to play for waveform, nullptr = evaluate MovementMath::waveformValue() */
+static const float* waveformTable(OscillationWaveform waveform) {
+    if (waveform == OSC_CUSTOM) {
+        // Selection deleted/failed since the config was accepted: fall back to sine
+        const float* custom = Waveforms.activeTable();
+        return custom != nullptr ? custom : Waveform::SINE.data();
     }
-    sineTableInitialized = true;
+    #ifdef USE_WAVEFORM_LOOKUP_TABLE
+    return Waveform::builtin(waveform);
+    #else
+    return nullptr;
+    #endif
 }
 
-// Fast sine lookup with linear interpolation
-static float fastSine(float phase) {
-    initSineTable();  // Ensure table is initialized
-    float indexFloat = phase * static_cast<float>(SINE_TABLE_SIZE);
-    // Safe modulo: C++ signed % can return negative, so double-mod to guarantee positive
-    int index = ((int)indexFloat % SINE_TABLE_SIZE + SINE_TABLE_SIZE) % SINE_TABLE_SIZE;
-    int nextIndex = (index + 1) % SINE_TABLE_SIZE;
-
-    // Linear interpolation for smooth transitions
-    float fraction = indexFloat - floorf(indexFloat);
-    return sineTable[index] + (sineTable[nextIndex] - sineTable[index]) * fraction;
+/** Table a superposed partial plays (integer phase: always a table) */
+static const float* partialTable(OscillationWaveform waveform) {
+    const float* table = waveform == OSC_CUSTOM ? waveformTable(waveform) : Waveform::builtin(waveform);
+    return table != nullptr ? table : Waveform::SINE.data();
 }
-#endif
 
 // ============================================================================
 // SINGLETON INSTANCE
@@ -84,10 +82,11 @@ void OscillationControllerClass::start() {
         return;
     }
 
-    // Validate configuration
+    // Validate configuration (whole superposed envelope: limits may have changed since it was set)
     String errorMsg;
-    if (!validateAmplitude(oscillation.centerPositionMM, oscillation.amplitudeMM, errorMsg)) {
-        Status.sendError("❌ " + errorMsg);
+    if (!validateAmplitude(oscillation.centerPositionMM,
+                           MovementMath::superposedExcursion(oscillation.amplitudeMM, oscillation.harmonics), errorMsg)) {
+        Events.postError(("❌ " + errorMsg).c_str());
         config.currentState = STATE_ERROR;
         return;
     }
@@ -120,8 +119,14 @@ void OscillationControllerClass::start() {
     oscillationState.oldAmplitudeMM = 0;
     oscillationState.targetAmplitudeMM = 0;
 
+    // 🎼 Superposed partials start at their configured phase
+    customTable_ = Waveforms.activeTable();
+    bank_.configure(oscillation.harmonics, partialTable, false);
+    oscillationState.harmonicsChanged = false;
+
     // 🎯 CALCULATE INITIAL ACTUAL SPEED for display
-    float theoreticalPeakSpeed = 2.0f * PI_F * oscillation.frequencyHz * oscillation.amplitudeMM;
+    float theoreticalPeakSpeed = MovementMath::superposedPeakSpeed(oscillation.frequencyHz, oscillation.amplitudeMM,
+                                                                   oscillation.harmonics);
     actualSpeedMMS_ = min(theoreticalPeakSpeed, OSC_MAX_SPEED_MM_S);
     actualOscillationSpeedMMS = actualSpeedMMS_;  // Sync global for StatusBroadcaster
 
@@ -156,6 +161,10 @@ void OscillationControllerClass::start() {
           "   Amplitude: ±" + String(oscillation.amplitudeMM, 1) + " mm\n" +
           "   Frequency: " + String(oscillation.frequencyHz, 3) + " Hz\n" +
           "   Waveform: " + waveformName + "\n" +
+          (oscillation.harmonics.isActive()
+               ? "   Partials: " + String(oscillation.harmonics.count) + " | drift ±" +
+                     String(oscillation.harmonics.driftAmplitudeMM, 1) + " mm\n"
+               : String()) +
           "   Ramp in: " + String(oscillation.enableRampIn ? "YES" : "NO") + "\n" +
           "   Ramp out: " + String(oscillation.enableRampOut ? "YES" : "NO"));
 }
@@ -224,28 +233,29 @@ void OscillationControllerClass::process() {
     // 🚀 SPEED CALCULATION: Calculate effective frequency (capped if exceeds max speed)
     float effectiveFrequency = MovementMath::effectiveFrequency(oscillation.frequencyHz, oscillation.amplitudeMM);
 
-    // Calculate actual peak speed using effective frequency
-    actualSpeedMMS_ = 2.0f * PI_F * effectiveFrequency * oscillation.amplitudeMM;
+    // Calculate actual peak speed using effective frequency (partials pre-validated, never capped)
+    actualSpeedMMS_ = MovementMath::superposedPeakSpeed(effectiveFrequency, oscillation.amplitudeMM, oscillation.harmonics);
     actualOscillationSpeedMMS = actualSpeedMMS_;  // Sync global for StatusBroadcaster
 
-    // Use minimum step delay (speed is controlled by effective frequency, not delay)
+    // Catch-up only on critical error (>3mm): a faster cadence, otherwise the
+    // minimum step delay (speed is controlled by effective frequency, not delay)
+    float errorMM = MovementMath::stepsToMM(abs(errorSteps));
+    bool isCatchUp = (errorMM > OSC_CATCH_UP_THRESHOLD_MM);
+    unsigned long stepDelayMicros = isCatchUp ? OSC_MIN_STEP_DELAY_MICROS / OSC_MAX_STEPS_PER_CATCH_UP
+                                              : OSC_MIN_STEP_DELAY_MICROS;
+
+    // Catch-up peaks the rate: it is governed like every other step
     unsigned long currentMicros = micros();
-    if (auto elapsedMicros = currentMicros - lastStepMicros_; elapsedMicros < OSC_MIN_STEP_DELAY_MICROS) [[likely]] {
+    if (auto elapsedMicros = currentMicros - lastStepMicros_; elapsedMicros < Governor.govern(stepDelayMicros)) [[likely]] {
         return;  // Too early for next step
     }
 
-    // Catch-up only on critical error (>3mm), otherwise 1 smooth step following the sine formula
-    long absErrorSteps = abs(errorSteps);
-    float errorMM = MovementMath::stepsToMM(absErrorSteps);
-    bool isCatchUp = (errorMM > OSC_CATCH_UP_THRESHOLD_MM);
-
     if (isCatchUp && !catchUpWarningLogged_) {
         engine->warn("⚠️ OSC Catch-up enabled: error of " + String(errorMM, 1) + "mm (threshold: " + String(OSC_CATCH_UP_THRESHOLD_MM, 1) + "mm)");
         catchUpWarningLogged_ = true;
     }
 
-    // Execute steps
-    executeSteps(oscTargetStep, isCatchUp);
+    executeStep(errorSteps > 0);
 
     lastStepMicros_ = currentMicros;
 }
@@ -266,10 +276,18 @@ float OscillationControllerClass::advancePhase(unsigned long currentMs) {
         lastSpeedLimitLogMs_ = currentMs;
     }
 
+    // 🔗 Phase lock: followers (and late starters) join at the shared phase
+    // instead of 0 - same jump as any fresh start, absorbed by ramp-in/catch-up
+    bool phaseLocked = Timeline.isPhaseLocked() && !oscillation.cyclePause.enabled &&
+                       config.executionContext != CONTEXT_SEQUENCER;
+
     // Initialize phase tracking on first call or after reset
     if (oscillationState.lastPhaseUpdateMs == 0) {
         oscillationState.lastPhaseUpdateMs = currentMs;
-        oscillationState.accumulatedPhase = 0.0f;
+        oscillationState.accumulatedPhase = phaseLocked
+            ? MovementMath::anchoredPhase(Timeline.msSinceAnchor(), effectiveFrequency) : 0.0f;
+        lastPhaseLockMs_ = currentMs;
+        phaseTrim_ = 0.0f;
     }
 
     // Calculate time delta since last update
@@ -280,6 +298,7 @@ float OscillationControllerClass::advancePhase(unsigned long currentMs) {
     if (deltaMs > 50) {
         deltaMs = 50;
     }
+    bank_.advance(static_cast<uint32_t>(deltaMs));  // Partials share the main clock (frozen in pauses too)
 
     oscillationState.lastPhaseUpdateMs = currentMs;
 
@@ -287,10 +306,12 @@ float OscillationControllerClass::advancePhase(unsigned long currentMs) {
         unsigned long transitionElapsed = currentMs - oscillationState.transitionStartMs;
 
         if (transitionElapsed < OSC_FREQ_TRANSITION_DURATION_MS) {
-            // Linear interpolation of frequency
+            // S-curve blend of frequency (still capped by the speed limit at every point)
             float progress = (float)transitionElapsed / (float)OSC_FREQ_TRANSITION_DURATION_MS;
-            effectiveFrequency = oscillationState.oldFrequencyHz +
-                                (oscillationState.targetFrequencyHz - oscillationState.oldFrequencyHz) * progress;
+            effectiveFrequency = MovementMath::effectiveFrequency(
+                Transition::at(oscillationState.oldFrequencyHz, oscillationState.targetFrequencyHz,
+                               transitionElapsed, OSC_FREQ_TRANSITION_DURATION_MS),
+                oscillation.amplitudeMM);
 
             // Reduced logging: every 200ms (was 100ms)
             if (currentMs - lastTransitionLogMs_ > OSC_TRANSITION_LOG_INTERVAL_MS) {
@@ -298,13 +319,18 @@ float OscillationControllerClass::advancePhase(unsigned long currentMs) {
                 lastTransitionLogMs_ = currentMs;
             }
         } else {
-            // Transition complete
+            // Transition complete (effectiveFrequency already holds the capped target)
             oscillationState.isTransitioning = false;
-            effectiveFrequency = oscillation.frequencyHz;
             engine->info("✅ Transition complete: " + String(effectiveFrequency, 3) + " Hz");
         }
     }
 
+    // Frequency trim keeps the phase monotonic (a phase jump would miscount cycles)
+    if (phaseLocked && !oscillationState.isTransitioning) [[unlikely]] {
+        updatePhaseLock(currentMs, effectiveFrequency);
+        effectiveFrequency *= 1.0f + phaseTrim_;
+    }
+
     // 🔥 ACCUMULATE PHASE: Add phase increment based on time delta and current frequency
     // phase increment = frequency (cycles/sec) × time (sec)
     float phaseIncrement = effectiveFrequency * (static_cast<float>(deltaMs) / 1000.0f);
@@ -313,6 +339,18 @@ float OscillationControllerClass::advancePhase(unsigned long currentMs) {
     return fmodf(oscillationState.accumulatedPhase, 1.0f);
 }
 
+void OscillationControllerClass::updatePhaseLock(unsigned long currentMs, float frequencyHz) {
+    if (currentMs - lastPhaseLockMs_ < OSC_PHASE_LOCK_INTERVAL_MS) return;
+    lastPhaseLockMs_ = currentMs;
+
+    float wallPhase = MovementMath::anchoredPhase(Timeline.msSinceAnchor(), frequencyHz);
+    float localPhase = fmodf(oscillationState.accumulatedPhase, 1.0f);
+    float phaseError = MovementMath::wrapPhaseError(wallPhase - localPhase);
+
+    phaseTrim_ = MovementMath::phaseLockTrim(phaseError);
+    Timeline.reportPhaseError(phaseError * 1000.0f / max(frequencyHz, 0.001f));
+}
+
 float OscillationControllerClass::getEffectiveAmplitude(unsigned long currentMs) {
     float effectiveAmplitude = oscillation.amplitudeMM;
 
@@ -321,10 +359,10 @@ float OscillationControllerClass::getEffectiveAmplitude(unsigned long currentMs)
         unsigned long ampElapsed = currentMs - oscillationState.amplitudeTransitionStartMs;
 
         if (ampElapsed < OSC_AMPLITUDE_TRANSITION_DURATION_MS) {
-            // Linear interpolation of amplitude
+            // S-curve blend of amplitude
             float progress = (float)ampElapsed / (float)OSC_AMPLITUDE_TRANSITION_DURATION_MS;
-            effectiveAmplitude = oscillationState.oldAmplitudeMM +
-                                (oscillationState.targetAmplitudeMM - oscillationState.oldAmplitudeMM) * progress;
+            effectiveAmplitude = Transition::at(oscillationState.oldAmplitudeMM, oscillationState.targetAmplitudeMM,
+                                                ampElapsed, OSC_AMPLITUDE_TRANSITION_DURATION_MS);
 
             // Log transition progress (every 200ms)
             if (currentMs - lastAmpTransitionLogMs_ > OSC_TRANSITION_LOG_INTERVAL_MS) {
@@ -348,17 +386,20 @@ float OscillationControllerClass::getEffectiveAmplitude(unsigned long currentMs)
         lastDebugLogMs_ = currentMs;
     }
 
+    envelope_ = 1.0f;
     if (oscillationState.isRampingIn) [[unlikely]] {
         unsigned long rampElapsed = currentMs - oscillationState.rampStartMs;
 
         if (static_cast<float>(rampElapsed) < OSC_RAMP_START_DELAY_MS) {
             // Stabilization phase: amplitude = 0
             effectiveAmplitude = 0;
+            envelope_ = 0.0f;
         } else if (static_cast<float>(rampElapsed) < (oscillation.rampInDurationMs + OSC_RAMP_START_DELAY_MS)) {
             // Ramp phase: calculate progress from end of delay
             unsigned long adjustedElapsed = rampElapsed - static_cast<unsigned long>(OSC_RAMP_START_DELAY_MS);
             float rampProgress = (float)adjustedElapsed / oscillation.rampInDurationMs;
             effectiveAmplitude = oscillation.amplitudeMM * rampProgress;
+            envelope_ = rampProgress;
         } else {
             // Ramp in complete - switch to full amplitude
             oscillationState.isRampingIn = false;
@@ -369,9 +410,11 @@ float OscillationControllerClass::getEffectiveAmplitude(unsigned long currentMs)
         if (static_cast<float>(rampElapsed) < oscillation.rampOutDurationMs) {
             float rampProgress = 1.0f - ((float)rampElapsed / oscillation.rampOutDurationMs);
             effectiveAmplitude = oscillation.amplitudeMM * rampProgress;
+            envelope_ = rampProgress;
         } else {
             // Ramp out complete, stop oscillation
             effectiveAmplitude = 0;
+            envelope_ = 0.0f;
             oscillationState.isRampingOut = false;
 
             // 🔧 FIX #14: Set final state based on execution context
@@ -396,10 +439,10 @@ float OscillationControllerClass::getEffectiveCenter(unsigned long currentMs) {
         unsigned long centerElapsed = currentMs - oscillationState.centerTransitionStartMs;
 
         if (centerElapsed < OSC_CENTER_TRANSITION_DURATION_MS) {
-            // Linear interpolation of center position
+            // S-curve blend of center position
             float progress = (float)centerElapsed / (float)OSC_CENTER_TRANSITION_DURATION_MS;
-            effectiveCenterMM = oscillationState.oldCenterMM +
-                                (oscillationState.targetCenterMM - oscillationState.oldCenterMM) * progress;
+            effectiveCenterMM = Transition::at(oscillationState.oldCenterMM, oscillationState.targetCenterMM,
+                                               centerElapsed, OSC_CENTER_TRANSITION_DURATION_MS);
 
             // Log transition progress (every 200ms)
             if (currentMs - lastCenterTransitionLogMs_ > OSC_TRANSITION_LOG_INTERVAL_MS) {
@@ -424,18 +467,21 @@ float OscillationControllerClass::getEffectiveCenter(unsigned long currentMs) {
 float OscillationControllerClass::calculatePosition() {
     unsigned long currentMs = millis();
 
+    // Partials hold table pointers: reload on a live edit or a new custom selection
+    if (const float* custom = Waveforms.activeTable();
+            oscillationState.harmonicsChanged || custom != customTable_) [[unlikely]] {
+        customTable_ = custom;
+        oscillationState.harmonicsChanged = false;
+        bank_.configure(oscillation.harmonics, partialTable, true);
+    }
+
     // Phase tracking with smooth frequency transitions
     float phase = advancePhase(currentMs);
 
-    // Calculate waveform value (-1.0 to +1.0) — delegates to MovementMath for testability
-    #ifdef USE_SINE_LOOKUP_TABLE
-    float waveValue = fastSine(phase);  // Lookup table (2µs) — only for SINE on ESP32
-    if (oscillation.waveform != OSC_SINE) {
-        waveValue = MovementMath::waveformValue(oscillation.waveform, phase);
-    }
-    #else
-    float waveValue = MovementMath::waveformValue(oscillation.waveform, phase);
-    #endif
+    // Calculate waveform value (-1.0 to +1.0) — table lookup (~2µs, any shape)
+    const float* table = waveformTable(oscillation.waveform);
+    float waveValue = table != nullptr ? Waveform::lookup(table, phase)
+                                       : MovementMath::waveformValue(oscillation.waveform, phase);
 
     // Track completed cycles
     // ⚠️ Don't increment during ramp out - we've already reached target cycle count
@@ -459,7 +505,7 @@ float OscillationControllerClass::calculatePosition() {
 
         // Send status update to frontend when cycle completes
         if (config.executionContext == CONTEXT_SEQUENCER) {
-            SeqExecutor.sendStatus();
+            Events.post(StatusEvent::SEQUENCE);
         }
     }
     oscillationState.lastPhase = phase;
@@ -472,6 +518,9 @@ float OscillationControllerClass::calculatePosition() {
 
     // Calculate final position
     float targetPositionMM = effectiveCenterMM + (waveValue * effectiveAmplitude);
+    if (!bank_.isIdle()) [[unlikely]] {
+        targetPositionMM += envelope_ * bank_.partialsMM() + bank_.driftMM();
+    }
 
     // Clamp to physical limits with warning
     float minPositionMM = MovementMath::stepsToMM(config.minStep);
@@ -586,7 +635,7 @@ bool OscillationControllerClass::handleInitialPositioning() {
     }
 
     // Track distance using StatsTracking (AFTER currentStep update)
-    stats.trackDelta(currentStep);
+    stats.trackDelta(currentStep, MOVEMENT_OSC);
 
     lastStepMicros_ = currentMicros;
 
@@ -595,13 +644,14 @@ bool OscillationControllerClass::handleInitialPositioning() {
 
 bool OscillationControllerClass::checkSafetyContacts(long oscTargetStep) {
     // Safety check: only test contacts when oscillation is near limits
-    float minOscPositionMM = oscillation.centerPositionMM - oscillation.amplitudeMM;
-    float maxOscPositionMM = oscillation.centerPositionMM + oscillation.amplitudeMM;
+    float excursionMM = MovementMath::superposedExcursion(oscillation.amplitudeMM, oscillation.harmonics);
+    float minOscPositionMM = oscillation.centerPositionMM - excursionMM;
+    float maxOscPositionMM = oscillation.centerPositionMM + excursionMM;
 
     // Test END contact only if oscillation approaches upper limit
     if (auto distanceToEndLimitMM = config.totalDistanceMM - maxOscPositionMM; distanceToEndLimitMM <= HARD_DRIFT_TEST_ZONE_MM
             && oscTargetStep >= config.maxStep && Contacts.isEndActive()) {
-        Status.sendError("❌ OSCILLATION: END contact reached unexpectedly (amplitude near limit)");
+        Events.postError("❌ OSCILLATION: END contact reached unexpectedly (amplitude near limit)");
         config.currentState = STATE_PAUSED;  // Stop movement (single source of truth)
         return false;
     }
@@ -609,7 +659,7 @@ bool OscillationControllerClass::checkSafetyContacts(long oscTargetStep) {
     // Test START contact only if oscillation approaches lower limit
     if (minOscPositionMM <= HARD_DRIFT_TEST_ZONE_MM
             && oscTargetStep <= config.minStep && Contacts.isStartActive()) {
-        Status.sendError("❌ OSCILLATION: START contact reached unexpectedly (amplitude near limit)");
+        Events.postError("❌ OSCILLATION: START contact reached unexpectedly (amplitude near limit)");
         config.currentState = STATE_PAUSED;  // Stop movement (single source of truth)
         return false;
     }
@@ -617,30 +667,14 @@ bool OscillationControllerClass::checkSafetyContacts(long oscTargetStep) {
     return true;  // Safe
 }
 
-void OscillationControllerClass::executeSteps(long oscTargetStep, bool isCatchUp) {
-    long errorSteps = oscTargetStep - currentStep;
-    long absErrorSteps = abs(errorSteps);
-
-    int stepsToExecute;
-    if (isCatchUp) {
-        stepsToExecute = min(absErrorSteps, (long)OSC_MAX_STEPS_PER_CATCH_UP);
-    } else {
-        // Normal oscillation: 1 smooth step following the sine wave
-        stepsToExecute = 1;
-    }
-
-    // Execute steps
-    bool moveForward = (errorSteps > 0);
+void OscillationControllerClass::executeStep(bool moveForward) {
     Motor.setDirection(moveForward);
-
-    for (int i = 0; i < stepsToExecute; i++) {
-        Motor.step();
-        if (moveForward) {
-            currentStep = currentStep + 1;
-        } else {
-            currentStep = currentStep - 1;
-        }
-        // Track distance traveled using StatsTracking
-        stats.trackDelta(currentStep);
+    Motor.step();
+    if (moveForward) {
+        currentStep = currentStep + 1;
+    } else {
+        currentStep = currentStep - 1;
     }
+    // Track distance traveled using StatsTracking
+    stats.trackDelta(currentStep, MOVEMENT_OSC);
 }
\ No newline at end of file
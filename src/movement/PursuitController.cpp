@@ -3,16 +3,17 @@
  * PursuitController.cpp - Real-time Position Tracking Implementation
  * ============================================================================
  *
- * Implements pursuit mode: pursuitMove(), doPursuitStep()
+ * Implements pursuit mode: target handoff, velocity control, stepping
  * ============================================================================
  */
 
 #include "movement/PursuitController.h"
-#include "communication/StatusBroadcaster.h"  // For Status.sendError()
+#include "communication/StatusEvents.h"  // For Events.postError()
 #include "core/Validators.h"
 #include "core/MovementMath.h"
 #include "hardware/MotorDriver.h"
 #include "hardware/ContactSensors.h"
+#include "movement/SpeedCalibration.h"
 
 // ============================================================================
 // PURSUIT STATE - Owned by this module
@@ -37,87 +38,97 @@ void PursuitControllerClass::begin() const {
 // MAIN CONTROL
 // ============================================================================
 
-void PursuitControllerClass::move(float targetPositionMM, float maxSpeedLevel) const {
+static constexpr float HALF_STEP_MM = 0.5f / STEPS_PER_MM;
+
+/** Range a target may take: calibrated steps and the effective max distance */
+static void pursuitLimitsMM(float& minMM, float& maxMM) {
+    minMM = max(0.0f, MovementMath::stepsToMM(config.minStep));
+    maxMM = min(Validators::getMaxAllowedMM(), MovementMath::stepsToMM(config.maxStep));
+}
+
+/** Stop stepping and drop the commanded velocity (next move ramps from rest) */
+static void haltPursuit() {
+    pursuit.isMoving = false;
+    pursuit.velocityMMS = 0.0f;
+    pursuit.stepDelay = 0;
+}
+
+void PursuitControllerClass::move(float targetPositionMM, float maxSpeedLevel) {
     // Safety check: calibration required
     if (config.totalDistanceMM == 0) {
-        Status.sendError("❌ Pursuit mode requires calibration first!");
+        Events.postError("❌ Pursuit mode requires calibration first!");
         return;
     }
 
-    // Update pursuit parameters
     pursuit.maxSpeedLevel = maxSpeedLevel;
 
-    // Clamp target to valid range (respect effective max distance limit)
-    float maxAllowed = Validators::getMaxAllowedMM();
-    if (targetPositionMM < 0) targetPositionMM = 0;
-    if (targetPositionMM > maxAllowed) targetPositionMM = maxAllowed;
-
-    // Convert to steps and CLAMP to calibrated limits (config.minStep/config.maxStep)
-    pursuit.targetStep = MovementMath::mmToSteps(targetPositionMM);
-    if (pursuit.targetStep < config.minStep) pursuit.targetStep = config.minStep;
-    if (pursuit.targetStep > config.maxStep) pursuit.targetStep = config.maxStep;
+    float minMM;
+    float maxMM;
+    pursuitLimitsMM(minMM, maxMM);
+    postedTargetMM_ = constrain(targetPositionMM, minMM, maxMM);
+    postedTargets_.fetch_add(1, std::memory_order_release);
 
-    long errorSteps = pursuit.targetStep - currentStep;
-    float errorMM = MovementMath::stepsToMM(abs(errorSteps));
+    // Ensure motor is enabled (should already be, but ensure on first call)
+    // pursuit.isMoving is set by control() on Core 1 when it takes the target
+    Motor.enable();
+}
 
-    // If already at target, don't do anything
-    if (errorSteps == 0) {
-        pursuit.isMoving = false;
+void PursuitControllerClass::control() {
+    uint32_t posted = postedTargets_.load(std::memory_order_acquire);
+    if (stopRequested_.exchange(false, std::memory_order_acq_rel)) {
+        // Targets posted before the stop are dropped, not resumed
+        observedTargets_ = posted;
+        haltPursuit();
         return;
     }
-
-    // Only recalculate speed if target or speed setting changed significantly
-    bool targetChanged = (abs(pursuit.targetStep - pursuit.lastTargetStep) > 6);  // >1mm change
-    bool speedSettingChanged = (abs(pursuit.maxSpeedLevel - pursuit.lastMaxSpeedLevel) > 0.5);
-    if (auto hasWork = (errorSteps != 0); targetChanged || speedSettingChanged || !pursuit.isMoving || hasWork) {
-        // Calculate step delay based on error distance
-        pursuit.stepDelay = MovementMath::pursuitStepDelay(errorMM, pursuit.maxSpeedLevel);
-
-        // Remember last values
-        pursuit.lastTargetStep = pursuit.targetStep;
-        pursuit.lastMaxSpeedLevel = pursuit.maxSpeedLevel;
+    if (posted != observedTargets_) {
+        observedTargets_ = posted;
+        tracker_.observe(postedTargetMM_, millis());
+        pursuit.isMoving = true;
     }
 
-    // Set direction and track it
-    bool moveForward = (errorSteps > 0);
-
-    // If direction changed, add a small delay for driver to respond
-    if (pursuit.isMoving && (moveForward != pursuit.direction)) {
-        delayMicroseconds(50);  // Brief pause for HSS86 direction change
+    uint32_t nowUs = micros();
+    uint32_t elapsedUs = nowUs - lastControlUs_;
+    if (elapsedUs < PURSUIT_CONTROL_PERIOD_US || !tracker_.hasTarget()) return;
+    lastControlUs_ = nowUs;
+
+    uint32_t nowMs = millis();
+    float minMM;
+    float maxMM;
+    pursuitLimitsMM(minMM, maxMM);
+    float targetMM = tracker_.target(nowMs, minMM, maxMM);
+    float feedforward = tracker_.feedforward(nowMs, minMM, maxMM);
+    float errorMM = targetMM - MovementMath::stepsToMM(currentStep);
+    pursuit.targetStep = MovementMath::mmToSteps(targetMM);
+
+    // Arrived: on a still target, slow enough to stop dead
+    if (std::fabs(errorMM) < HALF_STEP_MM && feedforward == 0.0f &&
+        std::fabs(pursuit.velocityMMS) * STEPS_PER_MM <= PURSUIT_MIN_STEP_RATE) {
+        haltPursuit();
+        return;
     }
 
-    pursuit.direction = moveForward;
-    Motor.setDirection(moveForward);
-
-    // Ensure motor is enabled (should already be, but ensure on first call)
-    Motor.enable();
-    pursuit.isMoving = true;
+    // A long gap (first tick after idle, loop stall) must not allow a big velocity jump
+    float dtSec = static_cast<float>(min(elapsedUs, static_cast<uint32_t>(5 * PURSUIT_CONTROL_PERIOD_US))) / 1000000.0f;
+    pursuit.velocityMMS = PursuitTracker::nextVelocity(pursuit.velocityMMS, errorMM, feedforward, dtSec,
+                                                       Speeds.table().effectiveLevel(pursuit.maxSpeedLevel) * SPEED_LEVEL_TO_MM_S);
+    applyVelocity(errorMM);
 }
 
 void PursuitControllerClass::process() const {
-    long errorSteps = pursuit.targetStep - currentStep;
-
-    // If at target, stop moving but keep motor enabled
-    if (errorSteps == 0) {
-        pursuit.isMoving = false;
-        return;
-    }
-
     // Safety: respect calibrated limits (don't go beyond config.minStep/config.maxStep)
-    bool moveForward = (errorSteps > 0);
+    bool moveForward = pursuit.direction;
 
     if (moveForward && currentStep >= config.maxStep) {
         // Already at max limit - stop here
-        pursuit.targetStep = currentStep;
-        pursuit.isMoving = false;
+        haltPursuit();
         engine->warn("⚠️ Pursuit: reached config.maxStep limit");
         return;
     }
 
     if (!moveForward && currentStep <= config.minStep) {
         // Already at min limit - stop here
-        pursuit.targetStep = currentStep;
-        pursuit.isMoving = false;
+        haltPursuit();
         engine->warn("⚠️ Pursuit: reached config.minStep limit");
         return;
     }
@@ -136,11 +147,12 @@ void PursuitControllerClass::process() const {
         currentStep = currentStep - 1;
     }
     // Track distance using StatsTracking
-    stats.trackDelta(currentStep);
+    stats.trackDelta(currentStep, MovementType::MOVEMENT_PURSUIT);
 }
 
-void PursuitControllerClass::stop() const {
-    pursuit.isMoving = false;
+void PursuitControllerClass::stop() {
+    stopRequested_.store(true, std::memory_order_release);
+    haltPursuit();
 }
 
 // ============================================================================
@@ -156,9 +168,8 @@ bool PursuitControllerClass::checkSafetyContacts(bool moveForward) const {
         float distanceToLimitMM = MovementMath::stepsToMM(stepsToLimit);
 
         if (distanceToLimitMM <= HARD_DRIFT_TEST_ZONE_MM && Contacts.isEndActive()) {
-            pursuit.isMoving = false;
-            pursuit.targetStep = currentStep;
-            Status.sendError("❌ PURSUIT: END contact reached - safety stop");
+            haltPursuit();
+            Events.postError("❌ PURSUIT: END contact reached - safety stop");
             config.currentState = SystemState::STATE_ERROR;
             return false;
         }
@@ -167,9 +178,8 @@ bool PursuitControllerClass::checkSafetyContacts(bool moveForward) const {
         float distanceToStartMM = MovementMath::stepsToMM(currentStep);
 
         if (distanceToStartMM <= HARD_DRIFT_TEST_ZONE_MM && Contacts.isStartActive()) {
-            pursuit.isMoving = false;
-            pursuit.targetStep = currentStep;
-            Status.sendError("❌ PURSUIT: START contact reached - safety stop");
+            haltPursuit();
+            Events.postError("❌ PURSUIT: START contact reached - safety stop");
             config.currentState = SystemState::STATE_ERROR;
             return false;
         }
@@ -177,3 +187,24 @@ bool PursuitControllerClass::checkSafetyContacts(bool moveForward) const {
 
     return true;  // Safe to continue
 }
+
+void PursuitControllerClass::applyVelocity(float errorMM) const {
+    float stepsPerSecond = std::fabs(pursuit.velocityMMS) * STEPS_PER_MM;
+    bool forward = pursuit.velocityMMS > 0.0f;
+
+    if (stepsPerSecond < PURSUIT_MIN_STEP_RATE) {
+        // Ramped down near the target: crawl the last steps to it, but never
+        // against the current motion (the ramp reverses it first)
+        bool opposing = pursuit.velocityMMS != 0.0f && forward != (errorMM > 0.0f);
+        if (opposing || std::fabs(errorMM) < HALF_STEP_MM) {
+            pursuit.stepDelay = 0;
+            return;
+        }
+        stepsPerSecond = PURSUIT_MIN_STEP_RATE;
+        forward = errorMM > 0.0f;
+    }
+
+    pursuit.direction = forward;
+    Motor.setDirection(forward);  // No-op unless it changed
+    pursuit.stepDelay = static_cast<unsigned long>(1000000.0f / stepsPerSecond);
+}
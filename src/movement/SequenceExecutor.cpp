@@ -8,7 +8,7 @@
 
 #include "movement/SequenceExecutor.h"
 #include "movement/SequenceTableManager.h"
-#include "communication/StatusBroadcaster.h"  // For Status.sendError()
+#include "communication/StatusEvents.h"
 #include "core/GlobalState.h"
 #include "core/MovementMath.h"
 #include "core/UtilityEngine.h"
@@ -18,11 +18,16 @@
 #include "movement/ChaosController.h"
 #include "movement/OscillationController.h"
 #include "movement/BaseMovementController.h"
+#include "movement/SpeedCalibration.h"
+#include "movement/StepRateGovernor.h"
+#include "movement/WaveformLibrary.h"
+#include <esp_heap_caps.h>
 
 using enum MovementType;
 using enum SystemState;
 using enum ExecutionContext;
 using enum OscillationWaveform;
+using enum SequenceOp;
 
 // ============================================================================
 // SEQUENCER STATE - Owned by this module
@@ -45,6 +50,20 @@ SequenceExecutor& SequenceExecutor::getInstance() {
 
 void SequenceExecutor::begin(AsyncWebSocket* ws) {
     _webSocket = ws;
+    Events.subscribe(StatusEventBus::bit(StatusEvent::SEQUENCE), [](uint32_t) { SeqExecutor.sendStatus(); });
+
+    // One instruction per table line, allocated once next to the table
+    size_t codeBytes = SeqTable.capacity() * sizeof(SequenceProgram::Instr);
+    auto* code = static_cast<SequenceProgram::Instr*>(heap_caps_malloc(codeBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    if (code == nullptr) {
+        code = static_cast<SequenceProgram::Instr*>(malloc(codeBytes));
+    }
+    if (code == nullptr && codeBytes > 0) {
+        engine->error("❌ Sequence program allocation failed - sequences cannot start");
+    } else {
+        _program.attach(code, SeqTable.capacity());
+    }
+
     engine->info("SequenceExecutor initialized");
 }
 
@@ -55,25 +74,35 @@ void SequenceExecutor::begin(AsyncWebSocket* ws) {
 void SequenceExecutor::start(bool loopMode) {
     // Check if any lines are enabled
     int enabledCount = 0;
-    for (int i = 0; i < sequenceLineCount; i++) {
-        if (sequenceTable[i].enabled) enabledCount++;
+    for (int i = 0; i < SeqTable.count(); i++) {
+        if (SeqTable.lineAt(i).enabled) enabledCount++;
     }
 
     if (enabledCount == 0) {
-        Status.sendError("❌ No active lines to execute!");
+        Events.postError("❌ No active lines to execute!");
         return;
     }
 
     if (config.currentState != STATE_READY) {
-        Status.sendError("❌ System not ready (calibration required?)");
+        Events.postError("❌ System not ready (calibration required?)");
+        return;
+    }
+
+    if (!compileProgram()) {
+        return;  // Error already sent
+    }
+
+    // First line to run: control lines at the top are resolved now
+    _cursor = {};
+    int16_t firstLine = _program.resolve(_program.entry(), _cursor, [](int32_t choices) { return random(choices); });
+    if (firstLine < 0) {
+        Events.postError("❌ No movement or wait line reachable!");
         return;
     }
 
     // Initialize execution state
     seqState.isRunning = true;
     seqState.isLoopMode = loopMode;
-    seqState.currentLineIndex = 0;
-    seqState.currentCycleInLine = 0;
     seqState.isPaused = false;
     seqState.isWaitingPause = false;
     seqState.loopCount = 0;
@@ -83,16 +112,12 @@ void SequenceExecutor::start(bool loopMode) {
     config.executionContext = CONTEXT_SEQUENCER;
     currentMovement = MOVEMENT_VAET;
 
-    // Skip to first enabled line
-    while (seqState.currentLineIndex < sequenceLineCount &&
-           !sequenceTable[seqState.currentLineIndex].enabled) {
-        seqState.currentLineIndex++;
-    }
+    enterLine(firstLine);
 
     engine->info(String("═══════════════════════════════════════════\n") +
           "▶️ SEQUENCE STARTED - Mode: " + (loopMode ? "INFINITE LOOP" : "SINGLE PLAY") + "\n" +
           "   isLoopMode = " + (seqState.isLoopMode ? "TRUE" : "FALSE") + "\n" +
-          "   Active lines: " + String(enabledCount) + " / " + String(sequenceLineCount) + "\n" +
+          "   Active lines: " + String(enabledCount) + " / " + String(SeqTable.count()) + "\n" +
           "═══════════════════════════════════════════");
 }
 
@@ -141,11 +166,25 @@ void SequenceExecutor::togglePause() {
 
 void SequenceExecutor::skipToNextLine() {
     if (!seqState.isRunning) return;
-    if (seqState.currentLineIndex >= sequenceLineCount) return;  // 🔧 FIX #17: Bounds check
+    if (seqState.currentLineIndex >= SeqTable.count()) return;  // 🔧 FIX #17: Bounds check
+
+    // WAIT line: end the wait, the next line starts on the next tick
+    if (seqState.isWaitingPause && SeqTable.lineAt(seqState.currentLineIndex).op == SEQ_OP_WAIT) {
+        seqState.pauseEndTime = millis();
+        engine->info("⏭️ Wait skipped");
+        return;
+    }
 
     // Force current line to complete
-    seqState.currentCycleInLine = sequenceTable[seqState.currentLineIndex].cycleCount;
-    stopMovement();
+    seqState.currentCycleInLine = SeqTable.lineAt(seqState.currentLineIndex).cycleCount;
+
+    // Repositioning / calibration line: abort it only (stopMovement() would end the sequence)
+    if (isPositioning() || Calibration.isBusy()) {
+        abortPositioningMove();
+        Calibration.abort();
+    } else {
+        stopMovement();
+    }
 
     engine->info("⏭️ Next line...");
 }
@@ -166,12 +205,13 @@ void SequenceExecutor::sendStatus() {
     doc["isPaused"] = seqState.isPaused;
     doc["currentLineIndex"] = seqState.currentLineIndex;
     doc["currentLineNumber"] = seqState.currentLineIndex + 1;
-    doc["totalLines"] = sequenceLineCount;
+    doc["totalLines"] = SeqTable.count();
+    doc["name"] = SeqTable.getActiveName();
 
     // Display real cycle info: for OSC, show internal oscillation cycles
     int displayCycle = seqState.currentCycleInLine + 1;  // +1 because cycles are 1-indexed for display
-    if (seqState.isRunning && seqState.currentLineIndex < sequenceLineCount) {
-        SequenceLine* line = &sequenceTable[seqState.currentLineIndex];
+    if (seqState.isRunning && seqState.currentLineIndex < SeqTable.count()) {
+        const SequenceLine* line = &SeqTable.lineAt(seqState.currentLineIndex);
         if (line->movementType == MOVEMENT_OSC) {
             displayCycle = oscillationState.completedCycles + 1;  // Show oscillation's internal cycle count (1-indexed)
         } else if (line->movementType == MOVEMENT_CHAOS) {
@@ -205,7 +245,7 @@ void SequenceExecutor::onMovementComplete() {
         config.currentState = STATE_READY;  // Signal sequencer that cycle is complete
 
         engine->info("✅ Cycle complete - returning to sequencer");
-        sendStatus();
+        Events.post(StatusEvent::SEQUENCE);
     } else {
         // Standalone mode: movement is complete, return to ready state
         config.currentState = STATE_READY;
@@ -221,123 +261,219 @@ void SequenceExecutor::onMovementComplete() {
 // POSITIONING HELPER
 // ============================================================================
 
-void SequenceExecutor::positionForNextLine() {
-    if (!seqState.isRunning) return;
-    if (seqState.currentLineIndex >= sequenceLineCount) return;
+bool SequenceExecutor::positionForNextLine() {
+    if (!seqState.isRunning) return false;
+    if (seqState.currentLineIndex >= SeqTable.count()) return false;
 
-    SequenceLine* currentLine = &sequenceTable[seqState.currentLineIndex];
+    // Calibration lines position themselves
+    const PreparedLine& prepared = preparedLine(seqState.currentLineIndex);
+    if (!prepared.needsPositioning) return false;
 
-    float targetPositionMM = 0;
-    bool needsPositioning = true;
+    // Limit may have been lowered since the line was compiled
+    long entryStep = min(prepared.entryStep, MovementMath::mmToSteps(Validators::getMaxAllowedMM()));
 
-    // Determine target position based on current line's movement type
-    switch (currentLine->movementType) {
+    // Only move if we're not already at target (tolerance: 1mm)
+    if (abs(currentStep - entryStep) <= MovementMath::mmToSteps(1.0f)) return false;
+
+    engine->info("🎯 Repositioning: " + String(MovementMath::stepsToMM(currentStep), 1) + "mm → " +
+                 String(MovementMath::stepsToMM(entryStep), 1) + "mm (" + String(prepared.transitionDelayMicros) + "µs/step)");
+
+    // CRITICAL: Stop previous movement completely before repositioning
+    {
+        MutexGuard guard(motionMutex);
+        chaosState.isRunning = false;
+        oscillationState.isRampingIn = false;
+        oscillationState.isRampingOut = false;
+        currentMovement = MOVEMENT_VAET;  // Force back to VAET
+    }
+
+    // Line starts from finishPositioningMove() once the target is reached
+    beginPositioningMove(entryStep, PositioningPurpose::NEXT_LINE, POSITIONING_MOVE_TIMEOUT_MS,
+                         prepared.transitionDelayMicros);
+    return true;
+}
+
+// ============================================================================
+// LOOK-AHEAD (next line compiled while the current one runs)
+// ============================================================================
+
+bool SequenceExecutor::isFresh(const PreparedLine& prepared, int lineIndex) {
+    return prepared.valid && prepared.lineIndex == lineIndex &&
+           prepared.tableRevision == sequenceTableRevision.load(std::memory_order_relaxed);
+}
+
+int SequenceExecutor::peekNextLineIndex() const {
+    if (_programRevision != sequenceTableRevision.load(std::memory_order_relaxed)) return -1;
+
+    // Same walk as checkAndHandleSequenceEnd(), on a copy of the cursor
+    SequenceProgram::Cursor cursor = _cursor;
+    bool usedRandom = false;
+    bool wrapped = false;
+    int16_t next = resolveNextLine(cursor, usedRandom, wrapped);
+    return usedRandom ? -1 : next;  // A random pick is only known once drawn
+}
+
+void SequenceExecutor::compileLine(int lineIndex, PreparedLine& out) const {
+    const SequenceLine& line = SeqTable.lineAt(lineIndex);
+    PreparedLine prepared;
+    prepared.lineIndex = lineIndex;
+    prepared.tableRevision = sequenceTableRevision.load(std::memory_order_relaxed);
+
+    if (line.op != SEQ_OP_MOVE) {
+        prepared.valid = true;  // WAIT: nothing to prepare
+        out = prepared;
+        return;
+    }
+
+    float entryMM = 0;
+    unsigned long lineDelayMicros = POSITIONING_STEP_DELAY_MICROS;
+
+    switch (line.movementType) {
         case MOVEMENT_VAET:
-            targetPositionMM = currentLine->startPositionMM;
+            prepared.needsPositioning = true;
+            entryMM = line.startPositionMM;
+            prepared.speedForward = constrain(line.speedForward, 1.0f, MAX_SPEED_LEVEL);
+            prepared.speedBackward = constrain(line.speedBackward, 1.0f, MAX_SPEED_LEVEL);
+            prepared.stepIntervalForward = StepScheduler::toFixed(Speeds.table().vaetStepInterval(prepared.speedForward, line.distanceMM));
+            prepared.stepIntervalBackward = StepScheduler::toFixed(Speeds.table().vaetStepInterval(prepared.speedBackward, line.distanceMM));
+            lineDelayMicros = StepScheduler::wholeMicros(max(prepared.stepIntervalForward, prepared.stepIntervalBackward));  // Slower direction
             break;
 
         case MOVEMENT_OSC:
-            // Start at center position - oscillation always starts from center
-            targetPositionMM = currentLine->oscCenterPositionMM;
+            // Oscillation always starts from center
+            prepared.needsPositioning = true;
+            entryMM = line.oscCenterPositionMM;
             break;
 
         case MOVEMENT_CHAOS:
-            // Start at center of chaos zone
-            targetPositionMM = currentLine->chaosCenterPositionMM;
-            break;
-
-        case MOVEMENT_CALIBRATION:
-            // Calibration will handle positioning itself
-            needsPositioning = false;
+            prepared.needsPositioning = true;
+            entryMM = line.chaosCenterPositionMM;
+            lineDelayMicros = Speeds.table().chaosStepDelay(line.chaosMaxSpeedLevel);
             break;
 
         default:
-            needsPositioning = false;
-            break;
+            break;  // Calibration handles positioning itself
     }
 
-    if (!needsPositioning) return;
-
-    // Validate target position against effective limits
-    float maxAllowed = Validators::getMaxAllowedMM();
-    if (targetPositionMM < 0) {
-        engine->warn("⚠️ Target position negative (" + String(targetPositionMM, 1) + "mm) - adjusted to 0mm");
-        targetPositionMM = 0;
-    }
-    if (targetPositionMM > maxAllowed) {
-        engine->warn("⚠️ Target position (" + String(targetPositionMM, 1) + "mm) exceeds limit (" + String(maxAllowed, 1) + "mm) - adjusted");
-        targetPositionMM = maxAllowed;
-    }
-
-    // Calculate current position
-    float currentPosMM = MovementMath::stepsToMM(currentStep);
-
-    // Only move if we're not already at target (tolerance: 1mm)
-    if (abs(currentPosMM - targetPositionMM) > 1.0f) {
-    engine->info("🎯 Repositioning: " + String(currentPosMM, 1) + "mm → " + String(targetPositionMM, 1) + "mm");
-
-        // CRITICAL: Stop previous movement completely before repositioning
-        {
-            MutexGuard guard(motionMutex);
-            chaosState.isRunning = false;
-            oscillationState.isRampingIn = false;
-            oscillationState.isRampingOut = false;
-            currentMovement = MOVEMENT_VAET;  // Force back to VAET
+    if (prepared.needsPositioning) {
+        // Validate target position against effective limits
+        float maxAllowed = Validators::getMaxAllowedMM();
+        if (entryMM < 0) {
+            engine->warn("⚠️ Line " + String(lineIndex + 1) + ": target position negative (" + String(entryMM, 1) + "mm) - adjusted to 0mm");
+            entryMM = 0;
+        }
+        if (entryMM > maxAllowed) {
+            engine->warn("⚠️ Line " + String(lineIndex + 1) + ": target position (" + String(entryMM, 1) + "mm) exceeds limit (" +
+                         String(maxAllowed, 1) + "mm) - adjusted");
+            entryMM = maxAllowed;
         }
+        prepared.entryStep = MovementMath::mmToSteps(entryMM);
+        prepared.transitionDelayMicros = MovementMath::transitionStepDelay(lineDelayMicros);
+    }
 
-        long targetStepPos = MovementMath::mmToSteps(targetPositionMM);
+    prepared.valid = true;
+    out = prepared;
+}
 
-        // Blocking move to target position (D4: uses shared helper)
-        if (!blockingMoveToStep(targetStepPos)) {
-            engine->warn("⚠️ Repositioning timeout - position: " + String(MovementMath::stepsToMM(currentStep), 1) + "mm");
+const SequenceExecutor::PreparedLine& SequenceExecutor::preparedLine(int lineIndex) {
+    if (!isFresh(_currentLine, lineIndex)) {
+        if (isFresh(_nextLine, lineIndex)) {
+            _currentLine = _nextLine;
         } else {
-            engine->info("✅ Repositioning complete");
+            compileLine(lineIndex, _currentLine);
         }
     }
+    return _currentLine;
 }
 
 // ============================================================================
-// BLOCKING MOVE HELPER (D4: shared by positionForNextLine + completeSequence)
+// POSITIONING MOVE (D4: shared by positionForNextLine + completeSequence + chaos)
 // ============================================================================
 
-bool SequenceExecutor::blockingMoveToStep(long targetStepPos, unsigned long timeoutMs) {
-    if (currentStep == targetStepPos) return true;
+void SequenceExecutor::beginPositioningMove(long targetStepPos, PositioningPurpose purpose,
+                                            unsigned long timeoutMs, unsigned long stepDelayMicros) {
+    _positioning.targetStep = targetStepPos;
+    _positioning.fromStep = currentStep;
+    _positioning.forward = (targetStepPos > currentStep);
+    _positioning.purpose = purpose;
+    _positioning.timeoutMs = timeoutMs;
+    _positioning.stepDelayMicros = stepDelayMicros;
+    _positioning.startMs = millis();
+    _positioning.lastStepMicros = micros();
+    _positioning.abortRequested = false;
+
+    // Cooperative flag: networkTask raises status rate, start commands are refused
+    blockingMoveInProgress = true;
+    _positioning.active = true;
+}
 
-    bool moveForward = (targetStepPos > currentStep);
-    Motor.setDirection(moveForward);
+void SequenceExecutor::abortPositioningMove() {
+    if (_positioning.active) {
+        _positioning.abortRequested = true;
+    }
+}
 
-    unsigned long moveStart = millis();
-    unsigned long lastStepTime = micros();
-    unsigned long lastStatusUpdate = millis();
-    const unsigned long stepDelay = POSITIONING_STEP_DELAY_MICROS;
+void SequenceExecutor::processPositioningMove() {
+    if (!_positioning.active) return;
 
-    // Cooperative flag: networkTask will know blocking move is in progress
-    blockingMoveInProgress = true;
+    if (_positioning.abortRequested) [[unlikely]] {
+        finishPositioningMove(PositioningResult::ABORTED);
+        return;
+    }
 
-    while (currentStep != targetStepPos && (millis() - moveStart < timeoutMs)) {
-        unsigned long now = micros();
-        if (now - lastStepTime >= stepDelay) {
-            Motor.step();
-            if (moveForward) {
-                currentStep = currentStep + 1;
-            } else {
-                currentStep = currentStep - 1;
-            }
-            lastStepTime = now;
-        }
-        yield();
+    if (currentStep == _positioning.targetStep) {
+        finishPositioningMove(PositioningResult::REACHED);
+        return;
+    }
 
-        // Periodic status broadcast (async WS handles delivery automatically)
-        unsigned long nowMs = millis();
-        if (nowMs - lastStatusUpdate >= BLOCKING_MOVE_STATUS_INTERVAL_MS) {
-            Status.send();
-            lastStatusUpdate = nowMs;
-        }
+    if (millis() - _positioning.startMs >= _positioning.timeoutMs) [[unlikely]] {
+        finishPositioningMove(PositioningResult::TIMEOUT);
+        return;
     }
 
+    unsigned long now = micros();
+    if (now - _positioning.lastStepMicros < Governor.govern(_positioning.stepDelayMicros)) return;
+
+    Motor.setDirection(_positioning.forward);  // No-op unless changed
+    Motor.step();
+    currentStep = currentStep + (_positioning.forward ? 1 : -1);
+    _positioning.lastStepMicros = now;
+}
+
+void SequenceExecutor::finishPositioningMove(PositioningResult result) {
+    _positioning.active = false;
     blockingMoveInProgress = false;  // Resume normal networkTask operation
 
-    return (currentStep == targetStepPos);
+    switch (_positioning.purpose) {
+        case PositioningPurpose::NEXT_LINE:
+            if (result == PositioningResult::REACHED) {
+                engine->info("✅ Repositioning complete");
+            } else if (result == PositioningResult::TIMEOUT) {
+                engine->warn("⚠️ Repositioning timeout - position: " + String(MovementMath::stepsToMM(currentStep), 1) + "mm");
+            }
+            if (result == PositioningResult::ABORTED || !seqState.isRunning) return;
+
+            startCurrentLine();
+            // Pause requested while repositioning: hold the freshly started line
+            if (seqState.isPaused) {
+                config.currentState = STATE_PAUSED;
+            }
+            break;
+
+        case PositioningPurpose::SEQUENCE_END:
+            if (result == PositioningResult::REACHED) {
+                engine->info("✓ Return complete: " + String(MovementMath::stepsToMM(_positioning.fromStep), 1) + "mm → Position 0.0mm");
+            } else {
+                engine->warn(String("⚠️ Return ") + (result == PositioningResult::TIMEOUT ? "timeout" : "aborted") +
+                             " at " + String(MovementMath::stepsToMM(currentStep), 1) + "mm - position NOT reset");
+            }
+            finishSequenceCleanup();
+            break;
+
+        case PositioningPurpose::CHAOS_CENTER:
+            Chaos.onCenterReached(result == PositioningResult::REACHED);
+            break;
+    }
 }
 
 // ============================================================================
@@ -349,7 +485,7 @@ void SequenceExecutor::completeSequence(bool autoReturnToStart) {
 
     engine->info("═══════════════════════════════════════════");
     engine->info("✅ SEQUENCE COMPLETE (SINGLE PLAY)!");
-    engine->info("   Lines executed: " + String(sequenceLineCount));
+    engine->info("   Lines executed: " + String(SeqTable.count()));
     engine->info("   Total duration: " + String(elapsedSec) + "s");
     engine->info("═══════════════════════════════════════════");
 
@@ -362,15 +498,14 @@ void SequenceExecutor::completeSequence(bool autoReturnToStart) {
     // Auto-return to START (position 0.0mm) if requested and not already there
     if (autoReturnToStart && currentStep != 0) {
         engine->info("🏠 Auto-return to START contact...");
-        float startPosMM = MovementMath::stepsToMM(currentStep);
-
-        if (blockingMoveToStep(0)) {
-            engine->info("✓ Return complete: " + String(startPosMM, 1) + "mm → Position 0.0mm");
-        } else {
-            engine->warn("⚠️ Return timeout at " + String(MovementMath::stepsToMM(currentStep), 1) + "mm - position NOT reset");
-        }
+        beginPositioningMove(0, PositioningPurpose::SEQUENCE_END);
+        return;  // finishSequenceCleanup() runs on arrival
     }
 
+    finishSequenceCleanup();
+}
+
+void SequenceExecutor::finishSequenceCleanup() {
     // Full cleanup - only reset position if actually at physical zero
     if (currentStep == 0) {
         startStep = 0;
@@ -381,8 +516,7 @@ void SequenceExecutor::completeSequence(bool autoReturnToStart) {
     config.currentState = STATE_READY;
 
     engine->info("✓ System ready for next cycle");
-    sendStatus();
-    ::sendStatus();
+    Events.post(StatusEvent::SEQUENCE);  // Main status follows on networkTask's next broadcast
 }
 
 // ============================================================================
@@ -390,77 +524,131 @@ void SequenceExecutor::completeSequence(bool autoReturnToStart) {
 // ============================================================================
 
 bool SequenceExecutor::checkAndHandleSequenceEnd() {
-    // Move to next line and reset cycle counter
-    seqState.currentLineIndex++;
-    seqState.currentCycleInLine = 0;
+    if (!refreshProgram()) {
+        stop();
+        return false;
+    }
+
+    bool usedRandom = false;
+    bool wrapped = false;
+    int16_t nextLine = resolveNextLine(_cursor, usedRandom, wrapped);
 
     engine->debug("🔍 checkAndHandleSequenceEnd: lineIndex=" + String(seqState.currentLineIndex) +
-                  " / lineCount=" + String(sequenceLineCount) +
+                  " → " + String(nextLine) + " / lineCount=" + String(SeqTable.count()) +
                   " | isLoopMode=" + String(seqState.isLoopMode));
 
-    // Check if sequence is complete
-    if (seqState.currentLineIndex >= sequenceLineCount) {
+    if (wrapped) {
+        seqState.loopCount++;
 
-        // Loop mode: restart sequence
-        if (seqState.isLoopMode) {
-            seqState.currentLineIndex = 0;
-            seqState.loopCount++;
+        engine->info("───────────────────────────────────────────");
+        engine->info("🔁 Loop #" + String(seqState.loopCount) + " complete - Restarting...");
+        engine->info("───────────────────────────────────────────");
+    }
 
-            engine->info("───────────────────────────────────────────");
-            engine->info("🔁 Loop #" + String(seqState.loopCount) + " complete - Restarting...");
-            engine->info("───────────────────────────────────────────");
-        }
-        // Single play mode: stop with auto-return (B4: unified path)
-        else {
-            completeSequence(true);  // Auto-return to start
-            return false;  // Sequence ended
-        }
+    // Single play mode (or nothing left to run): stop with auto-return (B4: unified path)
+    if (nextLine == SequenceProgram::END) {
+        completeSequence(true);  // Auto-return to start
+        return false;  // Sequence ended
     }
 
-    // Skip disabled lines
-    while (seqState.currentLineIndex < sequenceLineCount &&
-           !sequenceTable[seqState.currentLineIndex].enabled) {
-        engine->debug("⏭️ Skipping disabled line " + String(seqState.currentLineIndex));
-        seqState.currentLineIndex++;
+    if (nextLine == SequenceProgram::FAULT) {
+        Events.postError(("❌ Sequence stopped: control lines nested deeper than " + String(SEQUENCE_MAX_NESTING) +
+                          " or looping without a movement").c_str());
+        stop();
+        return false;
     }
 
-    engine->debug("🔍 After skip: lineIndex=" + String(seqState.currentLineIndex) +
-                  " / lineCount=" + String(sequenceLineCount));
+    return enterLine(nextLine);
+}
 
-    // Check again if we've reached the end after skipping (B4: same unified path)
-    if (seqState.currentLineIndex >= sequenceLineCount) {
-        engine->info("🎯 End condition met after skip - triggering sequence end");
-        if (seqState.isLoopMode) {
-            seqState.currentLineIndex = 0;
-            seqState.loopCount++;
-            engine->info("🔁 Loop #" + String(seqState.loopCount) + " - Restarting...");
-        } else {
-            completeSequence(true);  // Auto-return to start (was missing before!)
-            return false;  // Sequence ended
-        }
+// ============================================================================
+// CONTROL FLOW (SequenceProgram)
+// ============================================================================
+
+bool SequenceExecutor::compileProgram() {
+    using Error = SequenceProgram::Error;
+
+    Error error = _program.compile(
+        SeqTable.count(),
+        [](int position) -> const SequenceLine& { return SeqTable.lineAt(position); },
+        [](int32_t lineId) { return SeqTable.findLineIndex(lineId); });
+    _programRevision = sequenceTableRevision.load(std::memory_order_relaxed);
+
+    if (error == Error::NONE) return true;
+
+    String where = " (line " + String(_program.errorPosition() + 1) + ")";
+    switch (error) {
+        case Error::NO_ACTIVE_LINE:       Events.postError("❌ No active lines to execute!"); break;
+        case Error::UNMATCHED_REPEAT:     Events.postError(("❌ Repeat without End repeat" + where).c_str()); break;
+        case Error::UNMATCHED_END_REPEAT: Events.postError(("❌ End repeat without Repeat" + where).c_str()); break;
+        case Error::NESTING_TOO_DEEP:
+            Events.postError(("❌ More than " + String(SEQUENCE_MAX_NESTING) + " nested Repeat blocks" + where).c_str());
+            break;
+        case Error::CALL_TARGET_MISSING:  Events.postError(("❌ Call target line not found" + where).c_str()); break;
+        case Error::BAD_CHOICE:
+            Events.postError(("❌ Random choice must cover existing movement, wait or call lines" + where).c_str());
+            break;
+        default: break;
     }
+    return false;
+}
+
+bool SequenceExecutor::refreshProgram() {
+    if (_programRevision == sequenceTableRevision.load(std::memory_order_relaxed)) return true;
 
-    return true;  // Sequence continues
+    // Edited while running: open blocks keep their positions, new flow applies from here
+    engine->debug("🔄 Sequence table edited - recompiling control flow");
+    return compileProgram();
+}
+
+int16_t SequenceExecutor::resolveNextLine(SequenceProgram::Cursor& cursor, bool& usedRandom, bool& wrapped) const {
+    auto pick = [&usedRandom](int32_t choices) {
+        usedRandom = true;
+        return static_cast<int32_t>(random(choices));
+    };
+
+    int16_t from = SequenceProgram::END;
+    if (seqState.currentLineIndex < SeqTable.count()) {
+        from = _program.at(static_cast<int16_t>(seqState.currentLineIndex)).next;
+    }
+
+    int16_t nextLine = _program.resolve(from, cursor, pick);
+    if (nextLine == SequenceProgram::END && seqState.isLoopMode) {
+        wrapped = true;
+        cursor = {};
+        nextLine = _program.resolve(_program.entry(), cursor, pick);
+    }
+    return nextLine;
+}
+
+bool SequenceExecutor::enterLine(int16_t position) {
+    seqState.currentLineIndex = position;
+    seqState.currentCycleInLine = 0;
+
+    const SequenceLine& line = SeqTable.lineAt(position);
+    if (line.op != SEQ_OP_WAIT) return true;
+
+    // Reuses the between-lines pause: process() advances when it expires
+    seqState.isWaitingPause = true;
+    seqState.pauseEndTime = millis() + static_cast<unsigned long>(max(line.opArg, 0));
+    engine->info(String("⏳ Line ") + String(position + 1) + "/" + String(SeqTable.count()) +
+                 " | WAIT " + String(static_cast<float>(line.opArg) / 1000.0f, 1) + "s");
+    Events.post(StatusEvent::SEQUENCE);
+    return false;
 }
 
 // ============================================================================
 // LINE STARTERS
 // ============================================================================
 
-void SequenceExecutor::startVaEtVientLine(const SequenceLine* line) {
+void SequenceExecutor::startVaEtVientLine(const SequenceLine* line, const PreparedLine& prepared) {
     // Apply line parameters to motion configuration
     motion.startPositionMM = line->startPositionMM;
     motion.targetDistanceMM = line->distanceMM;
 
-    // Apply speed levels directly (0.0-MAX_SPEED_LEVEL scale)
-    motion.speedLevelForward = line->speedForward;
-    motion.speedLevelBackward = line->speedBackward;
-
-    // Clamp to valid range [1, MAX_SPEED_LEVEL]
-    if (motion.speedLevelForward < 1.0f) motion.speedLevelForward = 1.0f;
-    if (motion.speedLevelForward > MAX_SPEED_LEVEL) motion.speedLevelForward = MAX_SPEED_LEVEL;
-    if (motion.speedLevelBackward < 1.0f) motion.speedLevelBackward = 1.0f;
-    if (motion.speedLevelBackward > MAX_SPEED_LEVEL) motion.speedLevelBackward = MAX_SPEED_LEVEL;
+    // Speed levels clamped to [1, MAX_SPEED_LEVEL] at compile time
+    motion.speedLevelForward = prepared.speedForward;
+    motion.speedLevelBackward = prepared.speedBackward;
 
     // Copy zone effect configuration from sequence line (DRY: embedded ZoneEffectConfig)
     // Runtime state is automatically clean via separate ZoneEffectState
@@ -473,11 +661,12 @@ void SequenceExecutor::startVaEtVientLine(const SequenceLine* line) {
     // Validate configuration
     BaseMovement.validateZoneEffect();
 
-    // Calculate step delays and start movement
-    BaseMovement.calculateStepDelay();
+    // Step intervals precomputed by the look-ahead (same math as calculateStepDelay())
+    stepIntervalForward = prepared.stepIntervalForward;
+    stepIntervalBackward = prepared.stepIntervalBackward;
 
     Motor.enable();
-    lastStepMicros = micros();
+    stepClock.restart(micros());
 
     // Calculate step positions
     startStep = MovementMath::mmToSteps(motion.startPositionMM);
@@ -509,13 +698,13 @@ void SequenceExecutor::startVaEtVientLine(const SequenceLine* line) {
 
     seqState.lineStartTime = millis();
 
-    engine->info(String("▶️ Line ") + String(seqState.currentLineIndex + 1) + "/" + String(sequenceLineCount) +
+    engine->info(String("▶️ Line ") + String(seqState.currentLineIndex + 1) + "/" + String(SeqTable.count()) +
           " | 🔄 VA-ET-VIENT | Cycle " + String(seqState.currentCycleInLine + 1) + "/" + String(line->cycleCount) +
           " | " + String(line->startPositionMM, 1) + "mm → " +
           String(line->startPositionMM + line->distanceMM, 1) + "mm | Speed: " +
           String(motion.speedLevelForward, 1) + "/" + String(motion.speedLevelBackward, 1));
 
-    sendStatus();
+    Events.post(StatusEvent::SEQUENCE);
 }
 
 void SequenceExecutor::startOscillationLine(const SequenceLine* line) {
@@ -534,6 +723,9 @@ void SequenceExecutor::startOscillationLine(const SequenceLine* line) {
     // Apply cycle pause configuration from sequence line (DRY: direct struct copy)
     oscillation.cyclePause = line->oscCyclePause;
 
+    // Sequence lines carry no partials: don't inherit the manual mode's superposition
+    oscillation.harmonics = OscillationHarmonics{};
+
     seqState.lineStartTime = millis();
 
     // Start oscillation (will set currentMovement = MOVEMENT_OSC)
@@ -563,6 +755,9 @@ void SequenceExecutor::startOscillationLine(const SequenceLine* line) {
     } else if (line->oscWaveform == OSC_TRIANGLE || line->oscWaveform == OSC_SQUARE) {
         // For triangle/square, approximate phase from position
         initialPhase = (relativePos + 1.0f) / 4.0f;  // Maps [-1,+1] to [0, 0.5]
+    } else if (const float* custom = Waveforms.activeTable(); line->oscWaveform == OSC_CUSTOM && custom != nullptr) {
+        // User waveform: any shape, search its table
+        initialPhase = Waveform::phaseNearest(custom, relativePos);
     }
 
     oscillationState.accumulatedPhase = initialPhase;
@@ -574,14 +769,15 @@ void SequenceExecutor::startOscillationLine(const SequenceLine* line) {
     String waveformName = "SINE";
     if (line->oscWaveform == OSC_TRIANGLE) waveformName = "TRIANGLE";
     if (line->oscWaveform == OSC_SQUARE) waveformName = "SQUARE";
+    if (line->oscWaveform == OSC_CUSTOM) waveformName = "CUSTOM";
 
-    engine->info(String("▶️ Line ") + String(seqState.currentLineIndex + 1) + "/" + String(sequenceLineCount) +
+    engine->info(String("▶️ Line ") + String(seqState.currentLineIndex + 1) + "/" + String(SeqTable.count()) +
           " | 〰️ OSCILLATION (" + String(line->cycleCount) + " internal cycles)" +
           " | Centre: " + String(line->oscCenterPositionMM, 1) + "mm | Amp: ±" +
           String(line->oscAmplitudeMM, 1) + "mm | " + waveformName + " @ " +
           String(line->oscFrequencyHz, 2) + " Hz");
 
-    sendStatus();
+    Events.post(StatusEvent::SEQUENCE);
 }
 
 void SequenceExecutor::startChaosLine(const SequenceLine* line) {
@@ -603,7 +799,7 @@ void SequenceExecutor::startChaosLine(const SequenceLine* line) {
     // Start chaos mode (delegated to ChaosController module)
     Chaos.start();
 
-    engine->info(String("▶️ Line ") + String(seqState.currentLineIndex + 1) + "/" + String(sequenceLineCount) +
+    engine->info(String("▶️ Line ") + String(seqState.currentLineIndex + 1) + "/" + String(SeqTable.count()) +
           " | 🌀 CHAOS | Cycle " + String(seqState.currentCycleInLine + 1) + "/" + String(line->cycleCount) +
           " | Duration: " + String(line->chaosDurationSeconds) + "s | Centre: " +
           String(line->chaosCenterPositionMM, 1) + "mm ±" +
@@ -611,20 +807,20 @@ void SequenceExecutor::startChaosLine(const SequenceLine* line) {
           String(line->chaosMaxSpeedLevel, 1) + " | Madness: " +
           String(line->chaosCrazinessPercent, 0) + "%");
 
-    sendStatus();
+    Events.post(StatusEvent::SEQUENCE);
 }
 
 void SequenceExecutor::startCalibrationLine([[maybe_unused]] const SequenceLine* line) {
-    engine->info(String("▶️ Line ") + String(seqState.currentLineIndex + 1) + "/" + String(sequenceLineCount) +
+    engine->info(String("▶️ Line ") + String(seqState.currentLineIndex + 1) + "/" + String(SeqTable.count()) +
           " | 📏 CALIBRATION | Starting full calibration...");
 
     seqState.lineStartTime = millis();
 
-    // Start full calibration
+    // Arm full calibration (runs from motorTask, sets STATE_CALIBRATING immediately)
     Calibration.startCalibration();
 
     // Note: onMovementComplete() will be called when calibration finishes
-    sendStatus();
+    Events.post(StatusEvent::SEQUENCE);
 }
 
 // ============================================================================
@@ -639,7 +835,7 @@ bool SequenceExecutor::handleLineCompletion(const SequenceLine* line) {
         seqState.isWaitingPause = true;
         seqState.pauseEndTime = millis() + line->pauseAfterMs;
         engine->info("⏸️ Line pause: " + String(static_cast<float>(line->pauseAfterMs) / 1000.0f, 1) + "s");
-        sendStatus();
+        Events.post(StatusEvent::SEQUENCE);
         return false;  // Caller should return (pause active)
     }
 
@@ -647,14 +843,19 @@ bool SequenceExecutor::handleLineCompletion(const SequenceLine* line) {
 }
 
 void SequenceExecutor::startNextCycle() {
-    const SequenceLine* currentLine = &sequenceTable[seqState.currentLineIndex];
-
-    if (seqState.currentCycleInLine == 0) {
-        positionForNextLine();
+    // First cycle of a line: reposition first, the line starts on arrival
+    if (seqState.currentCycleInLine == 0 && positionForNextLine()) {
+        return;
     }
 
+    startCurrentLine();
+}
+
+void SequenceExecutor::startCurrentLine() {
+    const SequenceLine* currentLine = &SeqTable.lineAt(seqState.currentLineIndex);
+
     switch (currentLine->movementType) {
-        case MOVEMENT_VAET:       startVaEtVientLine(currentLine); break;
+        case MOVEMENT_VAET:       startVaEtVientLine(currentLine, preparedLine(seqState.currentLineIndex)); break;
         case MOVEMENT_OSC:        startOscillationLine(currentLine); break;
         case MOVEMENT_CHAOS:      startChaosLine(currentLine); break;
         case MOVEMENT_CALIBRATION: startCalibrationLine(currentLine); break;
@@ -674,6 +875,16 @@ void SequenceExecutor::process() {
         return;
     }
 
+    // Look-ahead: compile the next line while this one runs (no-op once compiled)
+    if (int nextIndex = peekNextLineIndex(); nextIndex >= 0 && !isFresh(_nextLine, nextIndex)) {
+        compileLine(nextIndex, _nextLine);
+    }
+
+    // Repositioning in progress: line starts from finishPositioningMove()
+    if (isPositioning()) {
+        return;
+    }
+
     // Handle pause between lines (temporization)
     if (seqState.isWaitingPause) {
         if (millis() >= seqState.pauseEndTime) {
@@ -683,7 +894,7 @@ void SequenceExecutor::process() {
             }
         } else {
             if (millis() - _lastPauseStatusSend > SEQUENCE_STATUS_UPDATE_MS) {
-                sendStatus();
+                Events.post(StatusEvent::SEQUENCE);
                 _lastPauseStatusSend = millis();
             }
             return;
@@ -692,7 +903,7 @@ void SequenceExecutor::process() {
 
     // Check if current movement is complete
     if (config.currentState == STATE_READY && !seqState.isWaitingPause) {
-        const SequenceLine* currentLine = &sequenceTable[seqState.currentLineIndex];
+        const SequenceLine* currentLine = &SeqTable.lineAt(seqState.currentLineIndex);
 
         // OSC and CHAOS manage their own internal cycles → sequencer sees 1
         int effectiveCycleCount = currentLine->cycleCount;
@@ -700,12 +911,12 @@ void SequenceExecutor::process() {
             effectiveCycleCount = 1;
         }
 
-        if (seqState.currentCycleInLine >= effectiveCycleCount) {
-            if (!handleLineCompletion(currentLine)) {
-                return;
-            }
-        } else {
-            startNextCycle();
+        if (seqState.currentCycleInLine >= effectiveCycleCount && !handleLineCompletion(currentLine)) {
+            return;
         }
+
+        // Next line (already compiled) starts on this same tick: the transition
+        // move follows the line's last step without an idle tick in between
+        startNextCycle();
     }
 }
\ No newline at end of file
@@ -8,7 +8,15 @@
 #include "movement/SequenceTableManager.h"
 #include "communication/StatusBroadcaster.h"  // For Status.sendError()
 #include "core/Validators.h"
+#include "core/filesystem/FileSystem.h"  // For FileSystem::writeAtomic()
+#include "movement/SequenceExecutor.h"  // For seqState (load refused while running)
 #include <ESPAsyncWebServer.h>
+#include <LittleFS.h>
+#include <StreamString.h>
+#include <esp_heap_caps.h>
+#include <bit>
+#include <cstring>
+#include <new>
 
 using enum MovementType;
 using enum SpeedCurve;
@@ -17,34 +25,115 @@ using enum SpeedEffect;
 // ============================================================================
 // SEQUENCE DATA - Owned by this module
 // ============================================================================
-constinit std::array<SequenceLine, MAX_SEQUENCE_LINES> sequenceTable;
-int sequenceLineCount = 0;
+std::atomic<uint32_t> sequenceTableRevision{0};
 
 // ============================================================================
-// CONSTRUCTOR
+// CONSTRUCTOR / INITIALIZATION
 // ============================================================================
 
 SequenceTableManager::SequenceTableManager() = default;
 
+/** lineId index buckets for capacity lines (power of two, at most half full) */
+static uint32_t idBucketCount(uint16_t capacity) {
+  return std::bit_ceil(static_cast<uint32_t>(capacity) * 2);
+}
+
+/** Arena bytes: line slots + id index (keys, slots) + play order + free stack */
+static size_t arenaBytes(uint16_t capacity) {
+  size_t buckets = idBucketCount(capacity);
+  return capacity * sizeof(SequenceLine) + buckets * (sizeof(int32_t) + sizeof(uint16_t)) +
+         capacity * 2 * sizeof(uint16_t);
+}
+
+void SequenceTableManager::begin() {
+  // Allocated once and never freed: edits never touch the heap
+  uint16_t capacity = SEQUENCE_CAPACITY_PSRAM;
+  auto* arena = static_cast<uint8_t*>(heap_caps_malloc(arenaBytes(capacity), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+
+  if (arena == nullptr) {
+    capacity = MAX_SEQUENCE_LINES;
+    arena = static_cast<uint8_t*>(malloc(arenaBytes(capacity)));
+    engine->warn("⚠️ Sequence table: no PSRAM, using internal RAM (" + String(capacity) + " lines)");
+  }
+
+  if (arena == nullptr) {
+    engine->error("❌ Sequence table allocation failed - sequencer disabled");
+    return;
+  }
+
+  // Carve the arena, 4-byte members first
+  uint32_t buckets = idBucketCount(capacity);
+  m_lines = reinterpret_cast<SequenceLine*>(arena);
+  auto* idKeys = reinterpret_cast<int32_t*>(arena + capacity * sizeof(SequenceLine));
+  auto* idSlots = reinterpret_cast<uint16_t*>(idKeys + buckets);
+  m_order = idSlots + buckets;
+  m_freeSlots = m_order + capacity;
+
+  for (uint16_t slot = 0; slot < capacity; slot++) {
+    new (&m_lines[slot]) SequenceLine();
+  }
+  m_ids.attach(idKeys, idSlots, buckets);
+  m_capacity = capacity;
+  clearLines();
+
+  engine->info("📋 Sequence table ready (" + String(m_capacity) + " lines, " +
+               String(arenaBytes(capacity) / 1024) + " KB)");
+}
+
+// ============================================================================
+// STORAGE
+// ============================================================================
+
+void SequenceTableManager::clearLines() {
+  m_count = 0;
+  m_ids.clear();
+  m_freeCount = m_capacity;
+  for (uint16_t idx = 0; idx < m_capacity; idx++) {
+    m_freeSlots[idx] = m_capacity - 1 - idx;  // Lowest slot on top
+  }
+  sequenceTableRevision++;
+}
+
+bool SequenceTableManager::appendLine(const SequenceLine& line) {
+  if (m_freeCount == 0) return false;
+
+  uint16_t slot = m_freeSlots[m_freeCount - 1];
+  if (!m_ids.insert(line.lineId, slot)) return false;
+
+  m_freeCount--;
+  m_lines[slot] = line;
+  m_order[m_count++] = slot;
+  sequenceTableRevision++;
+  return true;
+}
+
+bool SequenceTableManager::importLine(SequenceLine line, int& maxLineId) {
+  // Missing or duplicate ID (hand-edited file): give it a fresh one
+  if (line.lineId <= 0 || m_ids.find(line.lineId) != SequenceIdIndex::NOT_FOUND) {
+    line.lineId = maxLineId + 1;
+  }
+  maxLineId = max(maxLineId, line.lineId);
+  return appendLine(line);
+}
+
 // ============================================================================
 // CRUD OPERATIONS
 // ============================================================================
 
 int SequenceTableManager::addLine(const SequenceLine& newLine) {
-  if (sequenceLineCount >= MAX_SEQUENCE_LINES) {
-    Status.sendError("❌ Sequencer full! Max 20 lines");
+  if (m_count >= m_capacity) {
+    Status.sendError("❌ Sequencer full! Max " + String(m_capacity) + " lines");
     return -1;
   }
 
-  sequenceTable[sequenceLineCount] = newLine;
-  sequenceTable[sequenceLineCount].lineId = config.nextLineId++;  // Assign ID after copy
-  int assignedId = sequenceTable[sequenceLineCount].lineId;
-  sequenceLineCount++;
+  SequenceLine line = newLine;
+  line.lineId = config.nextLineId++;  // Assign ID after copy
+  if (!appendLine(line)) return -1;
 
-  engine->info("✅ Line added: ID=" + String(assignedId) + " | Pos:" +
+  engine->info("✅ Line added: ID=" + String(line.lineId) + " | Pos:" +
         String(newLine.startPositionMM, 1) + "mm, Dist:" + String(newLine.distanceMM, 1) + "mm");
 
-  return assignedId;
+  return line.lineId;
 }
 
 bool SequenceTableManager::deleteLine(int lineId) {
@@ -55,27 +144,30 @@ bool SequenceTableManager::deleteLine(int lineId) {
     return false;
   }
 
-  // Shift lines down
-  for (int i = idx; i < sequenceLineCount - 1; i++) {
-    sequenceTable[i] = sequenceTable[i + 1];
-  }
+  // Close the gap in the play order (the line itself never moves)
+  uint16_t slot = m_order[idx];
+  memmove(&m_order[idx], &m_order[idx + 1], (m_count - idx - 1) * sizeof(uint16_t));
+  m_count--;
+  m_ids.erase(lineId);
+  m_freeSlots[m_freeCount++] = slot;
+  sequenceTableRevision++;
 
-  sequenceLineCount--;
   engine->info("🗑️ Line deleted: ID=" + String(lineId));
 
   return true;
 }
 
 bool SequenceTableManager::updateLine(int lineId, const SequenceLine& updatedLine) {
-  int idx = findLineIndex(lineId);
+  uint16_t slot = m_ids.find(lineId);
 
-  if (idx == -1) {
+  if (slot == SequenceIdIndex::NOT_FOUND) {
     Status.sendError("❌ Line not found");
     return false;
   }
 
-  sequenceTable[idx] = updatedLine;
-  sequenceTable[idx].lineId = lineId;  // Keep original ID
+  m_lines[slot] = updatedLine;
+  m_lines[slot].lineId = lineId;  // Keep original ID
+  sequenceTableRevision++;
 
   engine->info("✏️ Line updated: ID=" + String(lineId));
   return true;
@@ -87,14 +179,13 @@ bool SequenceTableManager::moveLine(int lineId, int direction) {
   if (idx == -1) return false;
 
   int newIdx = idx + direction;
-  if (newIdx < 0 || newIdx >= sequenceLineCount) {
+  if (newIdx < 0 || newIdx >= m_count) {
     return false;  // Out of bounds
   }
 
-  // Swap lines
-  SequenceLine temp = sequenceTable[idx];
-  sequenceTable[idx] = sequenceTable[newIdx];
-  sequenceTable[newIdx] = temp;
+  // Swap play positions
+  std::swap(m_order[idx], m_order[newIdx]);
+  sequenceTableRevision++;
 
   engine->info(String("↕️ Line moved: ID=") + String(lineId) + " | " +
         String(idx + 1) + " → " + String(newIdx + 1));
@@ -106,27 +197,20 @@ bool SequenceTableManager::reorderLine(int lineId, int newIndex) {
   int oldIndex = findLineIndex(lineId);
 
   if (oldIndex == -1) return false;
-  if (newIndex < 0 || newIndex >= sequenceLineCount) return false;
+  if (newIndex < 0 || newIndex >= m_count) return false;
   if (oldIndex == newIndex) return true;  // Already at target
 
-  // Store the line to move
-  SequenceLine lineToMove = sequenceTable[oldIndex];
+  uint16_t slot = m_order[oldIndex];
 
-  // Shift lines to fill the gap
+  // Shift the play positions in between to fill the gap
   if (oldIndex < newIndex) {
-    // Moving down: shift lines up
-    for (int i = oldIndex; i < newIndex; i++) {
-      sequenceTable[i] = sequenceTable[i + 1];
-    }
+    memmove(&m_order[oldIndex], &m_order[oldIndex + 1], (newIndex - oldIndex) * sizeof(uint16_t));
   } else {
-    // Moving up: shift lines down
-    for (int i = oldIndex; i > newIndex; i--) {
-      sequenceTable[i] = sequenceTable[i - 1];
-    }
+    memmove(&m_order[newIndex + 1], &m_order[newIndex], (oldIndex - newIndex) * sizeof(uint16_t));
   }
 
-  // Place the line at new position
-  sequenceTable[newIndex] = lineToMove;
+  m_order[newIndex] = slot;
+  sequenceTableRevision++;
 
   engine->info(String("🔄 Line reordered: ID=") + String(lineId) + " | " +
         String(oldIndex + 1) + " → " + String(newIndex + 1));
@@ -135,28 +219,30 @@ bool SequenceTableManager::reorderLine(int lineId, int newIndex) {
 }
 
 bool SequenceTableManager::toggleLine(int lineId, bool enabled) {
-  int idx = findLineIndex(lineId);
+  uint16_t slot = m_ids.find(lineId);
 
-  if (idx == -1) return false;
+  if (slot == SequenceIdIndex::NOT_FOUND) return false;
 
-  sequenceTable[idx].enabled = enabled;
+  m_lines[slot].enabled = enabled;
+  sequenceTableRevision++;
   engine->info(String(enabled ? "✓" : "✗") + " Line ID=" + String(lineId) +
         (enabled ? " enabled" : " disabled"));
   return true;
 }
 
 int SequenceTableManager::duplicateLine(int lineId) {
-  int idx = findLineIndex(lineId);
+  uint16_t slot = m_ids.find(lineId);
 
-  if (idx == -1) return -1;
+  if (slot == SequenceIdIndex::NOT_FOUND) return -1;
 
-  SequenceLine duplicate = sequenceTable[idx];
+  SequenceLine duplicate = m_lines[slot];
   return addLine(duplicate);
 }
 
 void SequenceTableManager::clear() {
-  sequenceLineCount = 0;
+  clearLines();
   config.nextLineId = 1;
+  m_activeName = "";
   engine->info("🗑️ Table cleared");
 }
 
@@ -165,8 +251,11 @@ void SequenceTableManager::clear() {
 // ============================================================================
 
 int SequenceTableManager::findLineIndex(int lineId) {
-  for (int i = 0; i < sequenceLineCount; i++) {
-    if (sequenceTable[i].lineId == lineId) {
+  uint16_t slot = m_ids.find(lineId);
+  if (slot == SequenceIdIndex::NOT_FOUND) return -1;
+
+  for (int i = 0; i < m_count; i++) {
+    if (m_order[i] == slot) {
       return i;
     }
   }
@@ -178,6 +267,34 @@ int SequenceTableManager::findLineIndex(int lineId) {
 // ============================================================================
 
 String SequenceTableManager::validatePhysics(const SequenceLine& line) {
+  // Control lines never move: check their argument instead
+  switch (line.op) {
+    case SequenceOp::SEQ_OP_MOVE:
+      break;
+    case SequenceOp::SEQ_OP_REPEAT:
+      if (line.opArg < 1 || line.opArg > MAX_CYCLES_PER_LINE) {
+        return "Repeat count must be 1-" + String(MAX_CYCLES_PER_LINE);
+      }
+      return "";
+    case SequenceOp::SEQ_OP_CALL:
+      if (findLineIndex(line.opArg) < 0) {
+        return "Call target line not found";
+      }
+      return "";
+    case SequenceOp::SEQ_OP_RANDOM:
+      if (line.opArg < 1 || line.opArg > SEQUENCE_CAPACITY_PSRAM) {
+        return "Random choice needs at least 1 following line";
+      }
+      return "";
+    case SequenceOp::SEQ_OP_WAIT:
+      if (line.opArg < 1 || static_cast<uint32_t>(line.opArg) > SEQUENCE_MAX_WAIT_MS) {
+        return "Wait must be 1ms-" + String(SEQUENCE_MAX_WAIT_MS / 60000) + "min";
+      }
+      return "";
+    default:
+      return "";  // END_REPEAT / RETURN / END: no argument
+  }
+
   float effectiveMax = Validators::getMaxAllowedMM();
 
   switch (line.movementType) {
@@ -252,8 +369,13 @@ SequenceLine SequenceTableManager::parseFromJson(JsonVariantConst obj) {
   line.enabled = obj["enabled"] | true;
   line.movementType = (MovementType)(obj["movementType"] | 0);
 
-  // Cycle count: always 1 for CALIBRATION, else from JSON
-  if (line.movementType == MOVEMENT_CALIBRATION) {
+  // Control flow (absent in files written before control lines existed)
+  int op = obj["op"] | 0;
+  line.op = (op >= 0 && op <= (int)SequenceOp::SEQ_OP_END) ? (SequenceOp)op : SequenceOp::SEQ_OP_MOVE;
+  line.opArg = obj["opArg"] | 0;
+
+  // Cycle count: always 1 for CALIBRATION and control lines, else from JSON
+  if (line.movementType == MOVEMENT_CALIBRATION || line.op != SequenceOp::SEQ_OP_MOVE) {
     line.cycleCount = 1;
   } else {
     line.cycleCount = obj["cycleCount"] | 1;
@@ -364,92 +486,105 @@ SequenceLine SequenceTableManager::parseFromJson(JsonVariantConst obj) {
 // JSON EXPORT
 // ============================================================================
 
-String SequenceTableManager::exportToJson() {
-  JsonDocument doc;
+void SequenceTableManager::lineToJson(const SequenceLine& line, JsonObject obj) const {
+  // Common fields
+  obj["lineId"] = line.lineId;
+  obj["enabled"] = line.enabled;
+  obj["movementType"] = (int)line.movementType;
 
-  doc["version"] = "2.0";
-  doc["sequenceLineCount"] = sequenceLineCount;
-
-  JsonArray linesArray = doc["lines"].to<JsonArray>();
-
-  for (int i = 0; i < sequenceLineCount; i++) {
-    const SequenceLine* line = &sequenceTable[i];
-
-    JsonObject lineObj = linesArray.add<JsonObject>();
-
-    // Common fields
-    lineObj["lineId"] = line->lineId;
-    lineObj["enabled"] = line->enabled;
-    lineObj["movementType"] = (int)line->movementType;
-
-    // VA-ET-VIENT fields
-    lineObj["startPositionMM"] = serialized(String(line->startPositionMM, 1));
-    lineObj["distanceMM"] = serialized(String(line->distanceMM, 1));
-    lineObj["speedForward"] = serialized(String(line->speedForward, 1));
-    lineObj["speedBackward"] = serialized(String(line->speedBackward, 1));
-
-    // VA-ET-VIENT zone effects (embedded ZoneEffectConfig)
-    JsonObject ze = lineObj["vaetZoneEffect"].to<JsonObject>();
-    ze["enabled"] = line->vaetZoneEffect.enabled;
-    ze["enableStart"] = line->vaetZoneEffect.enableStart;
-    ze["enableEnd"] = line->vaetZoneEffect.enableEnd;
-    ze["mirrorOnReturn"] = line->vaetZoneEffect.mirrorOnReturn;
-    ze["zoneMM"] = serialized(String(line->vaetZoneEffect.zoneMM, 1));
-    ze["speedEffect"] = (int)line->vaetZoneEffect.speedEffect;
-    ze["speedCurve"] = (int)line->vaetZoneEffect.speedCurve;
-    ze["speedIntensity"] = serialized(String(line->vaetZoneEffect.speedIntensity, 0));
-    ze["randomTurnbackEnabled"] = line->vaetZoneEffect.randomTurnbackEnabled;
-    ze["turnbackChance"] = line->vaetZoneEffect.turnbackChance;
-    ze["endPauseEnabled"] = line->vaetZoneEffect.endPauseEnabled;
-    ze["endPauseIsRandom"] = line->vaetZoneEffect.endPauseIsRandom;
-    ze["endPauseDurationSec"] = serialized(String(line->vaetZoneEffect.endPauseDurationSec, 1));
-    ze["endPauseMinSec"] = serialized(String(line->vaetZoneEffect.endPauseMinSec, 1));
-    ze["endPauseMaxSec"] = serialized(String(line->vaetZoneEffect.endPauseMaxSec, 1));
-
-    // VA-ET-VIENT cycle pause (JSON keys unchanged for front-end compatibility)
-    lineObj["vaetCyclePauseEnabled"] = line->vaetCyclePause.enabled;
-    lineObj["vaetCyclePauseIsRandom"] = line->vaetCyclePause.isRandom;
-    lineObj["vaetCyclePauseDurationSec"] = serialized(String(line->vaetCyclePause.pauseDurationSec, 1));
-    lineObj["vaetCyclePauseMinSec"] = serialized(String(line->vaetCyclePause.minPauseSec, 1));
-    lineObj["vaetCyclePauseMaxSec"] = serialized(String(line->vaetCyclePause.maxPauseSec, 1));
-
-    // OSCILLATION fields
-    lineObj["oscCenterPositionMM"] = serialized(String(line->oscCenterPositionMM, 1));
-    lineObj["oscAmplitudeMM"] = serialized(String(line->oscAmplitudeMM, 1));
-    lineObj["oscWaveform"] = (int)line->oscWaveform;
-    lineObj["oscFrequencyHz"] = serialized(String(line->oscFrequencyHz, 3));
-    lineObj["oscEnableRampIn"] = line->oscEnableRampIn;
-    lineObj["oscEnableRampOut"] = line->oscEnableRampOut;
-    lineObj["oscRampInDurationMs"] = serialized(String(line->oscRampInDurationMs, 0));
-    lineObj["oscRampOutDurationMs"] = serialized(String(line->oscRampOutDurationMs, 0));
-
-    // OSCILLATION cycle pause (JSON keys unchanged for front-end compatibility)
-    lineObj["oscCyclePauseEnabled"] = line->oscCyclePause.enabled;
-    lineObj["oscCyclePauseIsRandom"] = line->oscCyclePause.isRandom;
-    lineObj["oscCyclePauseDurationSec"] = serialized(String(line->oscCyclePause.pauseDurationSec, 1));
-    lineObj["oscCyclePauseMinSec"] = serialized(String(line->oscCyclePause.minPauseSec, 1));
-    lineObj["oscCyclePauseMaxSec"] = serialized(String(line->oscCyclePause.maxPauseSec, 1));
-
-    // CHAOS fields
-    lineObj["chaosCenterPositionMM"] = serialized(String(line->chaosCenterPositionMM, 1));
-    lineObj["chaosAmplitudeMM"] = serialized(String(line->chaosAmplitudeMM, 1));
-    lineObj["chaosMaxSpeedLevel"] = serialized(String(line->chaosMaxSpeedLevel, 1));
-    lineObj["chaosCrazinessPercent"] = serialized(String(line->chaosCrazinessPercent, 1));
-    lineObj["chaosDurationSeconds"] = line->chaosDurationSeconds;
-    lineObj["chaosSeed"] = line->chaosSeed;
-
-    JsonArray patternsArray = lineObj["chaosPatternsEnabled"].to<JsonArray>();
-    for (bool flag : line->chaosPatternsEnabled) {
-      patternsArray.add(flag);
-    }
+  // VA-ET-VIENT fields
+  obj["startPositionMM"] = serialized(String(line.startPositionMM, 1));
+  obj["distanceMM"] = serialized(String(line.distanceMM, 1));
+  obj["speedForward"] = serialized(String(line.speedForward, 1));
+  obj["speedBackward"] = serialized(String(line.speedBackward, 1));
+
+  // VA-ET-VIENT zone effects (embedded ZoneEffectConfig)
+  JsonObject ze = obj["vaetZoneEffect"].to<JsonObject>();
+  ze["enabled"] = line.vaetZoneEffect.enabled;
+  ze["enableStart"] = line.vaetZoneEffect.enableStart;
+  ze["enableEnd"] = line.vaetZoneEffect.enableEnd;
+  ze["mirrorOnReturn"] = line.vaetZoneEffect.mirrorOnReturn;
+  ze["zoneMM"] = serialized(String(line.vaetZoneEffect.zoneMM, 1));
+  ze["speedEffect"] = (int)line.vaetZoneEffect.speedEffect;
+  ze["speedCurve"] = (int)line.vaetZoneEffect.speedCurve;
+  ze["speedIntensity"] = serialized(String(line.vaetZoneEffect.speedIntensity, 0));
+  ze["randomTurnbackEnabled"] = line.vaetZoneEffect.randomTurnbackEnabled;
+  ze["turnbackChance"] = line.vaetZoneEffect.turnbackChance;
+  ze["endPauseEnabled"] = line.vaetZoneEffect.endPauseEnabled;
+  ze["endPauseIsRandom"] = line.vaetZoneEffect.endPauseIsRandom;
+  ze["endPauseDurationSec"] = serialized(String(line.vaetZoneEffect.endPauseDurationSec, 1));
+  ze["endPauseMinSec"] = serialized(String(line.vaetZoneEffect.endPauseMinSec, 1));
+  ze["endPauseMaxSec"] = serialized(String(line.vaetZoneEffect.endPauseMaxSec, 1));
+
+  // VA-ET-VIENT cycle pause (JSON keys unchanged for front-end compatibility)
+  obj["vaetCyclePauseEnabled"] = line.vaetCyclePause.enabled;
+  obj["vaetCyclePauseIsRandom"] = line.vaetCyclePause.isRandom;
+  obj["vaetCyclePauseDurationSec"] = serialized(String(line.vaetCyclePause.pauseDurationSec, 1));
+  obj["vaetCyclePauseMinSec"] = serialized(String(line.vaetCyclePause.minPauseSec, 1));
+  obj["vaetCyclePauseMaxSec"] = serialized(String(line.vaetCyclePause.maxPauseSec, 1));
+
+  // OSCILLATION fields
+  obj["oscCenterPositionMM"] = serialized(String(line.oscCenterPositionMM, 1));
+  obj["oscAmplitudeMM"] = serialized(String(line.oscAmplitudeMM, 1));
+  obj["oscWaveform"] = (int)line.oscWaveform;
+  obj["oscFrequencyHz"] = serialized(String(line.oscFrequencyHz, 3));
+  obj["oscEnableRampIn"] = line.oscEnableRampIn;
+  obj["oscEnableRampOut"] = line.oscEnableRampOut;
+  obj["oscRampInDurationMs"] = serialized(String(line.oscRampInDurationMs, 0));
+  obj["oscRampOutDurationMs"] = serialized(String(line.oscRampOutDurationMs, 0));
+
+  // OSCILLATION cycle pause (JSON keys unchanged for front-end compatibility)
+  obj["oscCyclePauseEnabled"] = line.oscCyclePause.enabled;
+  obj["oscCyclePauseIsRandom"] = line.oscCyclePause.isRandom;
+  obj["oscCyclePauseDurationSec"] = serialized(String(line.oscCyclePause.pauseDurationSec, 1));
+  obj["oscCyclePauseMinSec"] = serialized(String(line.oscCyclePause.minPauseSec, 1));
+  obj["oscCyclePauseMaxSec"] = serialized(String(line.oscCyclePause.maxPauseSec, 1));
 
-    // COMMON fields
-    lineObj["cycleCount"] = line->cycleCount;
-    lineObj["pauseAfterMs"] = line->pauseAfterMs;
+  // CHAOS fields
+  obj["chaosCenterPositionMM"] = serialized(String(line.chaosCenterPositionMM, 1));
+  obj["chaosAmplitudeMM"] = serialized(String(line.chaosAmplitudeMM, 1));
+  obj["chaosMaxSpeedLevel"] = serialized(String(line.chaosMaxSpeedLevel, 1));
+  obj["chaosCrazinessPercent"] = serialized(String(line.chaosCrazinessPercent, 1));
+  obj["chaosDurationSeconds"] = line.chaosDurationSeconds;
+  obj["chaosSeed"] = line.chaosSeed;
+
+  JsonArray patternsArray = obj["chaosPatternsEnabled"].to<JsonArray>();
+  for (bool flag : line.chaosPatternsEnabled) {
+    patternsArray.add(flag);
   }
 
-  String output;
-  serializeJson(doc, output);
+  // COMMON fields
+  obj["cycleCount"] = line.cycleCount;
+  obj["pauseAfterMs"] = line.pauseAfterMs;
+
+  // CONTROL FLOW fields
+  obj["op"] = (int)line.op;
+  obj["opArg"] = line.opArg;
+}
+
+void SequenceTableManager::writeTable(Print& out) const {
+  // Envelope by hand, lines one by one: a 1000-line table never needs a
+  // JsonDocument of its own (activeName is validated [A-Za-z0-9_-])
+  out.print(R"({"version":"2.0","name":")");
+  out.print(m_activeName);
+  out.print(R"(","sequenceLineCount":)");
+  out.print(m_count);
+  out.print(R"(,"lines":[)");
+
+  JsonDocument lineDoc;
+  for (int i = 0; i < m_count; i++) {
+    lineDoc.clear();
+    lineToJson(lineAt(i), lineDoc.to<JsonObject>());
+    if (i > 0) out.print(',');
+    serializeJson(lineDoc, out);
+  }
+
+  out.print("]}");
+}
+
+String SequenceTableManager::exportToJson() {
+  StreamString output;
+  writeTable(output);
   return output;
 }
 
@@ -457,15 +592,14 @@ String SequenceTableManager::exportToJson() {
 // JSON IMPORT
 // ============================================================================
 
-int SequenceTableManager::importFromJson(String jsonData) {
-  engine->debug(String("📤 JSON received (") + String(jsonData.length()) + " chars): " +
-        jsonData.substring(0, min(200, (int)jsonData.length())));
+int SequenceTableManager::importFromJson(const char* json, size_t length) {
+  engine->debug(String("📤 JSON received (") + String(length) + " chars)");
 
   // Clear existing table
   clear();
 
   JsonDocument importDoc;
-  if (auto error = deserializeJson(importDoc, jsonData); error) {
+  if (auto error = deserializeJson(importDoc, json, length); error) {
     engine->error("JSON parse error: " + String(error.c_str()));
     Status.sendError("❌ Invalid JSON: " + String(error.c_str()));
     return -1;
@@ -473,8 +607,8 @@ int SequenceTableManager::importFromJson(String jsonData) {
 
   // Validate sequenceLineCount
   int importLineCount = importDoc["sequenceLineCount"] | 0;
-  if (importLineCount <= 0 || importLineCount > MAX_SEQUENCE_LINES) {
-    Status.sendError("❌ Invalid JSON or too many lines");
+  if (importLineCount <= 0 || importLineCount > m_capacity) {
+    Status.sendError("❌ Invalid JSON or too many lines (max " + String(m_capacity) + ")");
     return -1;
   }
 
@@ -491,20 +625,13 @@ int SequenceTableManager::importFromJson(String jsonData) {
   int importedCount = 0;
 
   for (JsonObject lineObj : linesArray) {
-    if (sequenceLineCount >= MAX_SEQUENCE_LINES) {
-      engine->warn("⚠️ Table full, stopping import");
-      break;
-    }
-
     SequenceLine newLine = parseFromJson(lineObj);
     newLine.lineId = lineObj["lineId"] | 0;
 
-    if (newLine.lineId > maxLineId) {
-      maxLineId = newLine.lineId;
+    if (!importLine(newLine, maxLineId)) {
+      engine->warn("⚠️ Table full, stopping import");
+      break;
     }
-
-    sequenceTable[sequenceLineCount] = newLine;
-    sequenceLineCount++;
     importedCount++;
   }
 
@@ -516,6 +643,296 @@ int SequenceTableManager::importFromJson(String jsonData) {
   return importedCount;
 }
 
+// ============================================================================
+// BINARY EXPORT
+// ============================================================================
+
+/** Header record payload + its length prefix, preamble first */
+static size_t binaryHead(const String& name, uint16_t lineCount, uint8_t* out) {
+  SequenceBinary::encodePreamble(out);
+  uint8_t* record = out + SequenceBinary::PREAMBLE_SIZE;
+  size_t length = SequenceBinary::encodeHeader(lineCount, name.c_str(), name.length(),
+                                               record + SequenceBinary::LENGTH_SIZE);
+  SequenceBinary::Writer(record).u16(static_cast<uint16_t>(length));
+  return SequenceBinary::PREAMBLE_SIZE + SequenceBinary::LENGTH_SIZE + length;
+}
+
+static constexpr size_t LINE_STRIDE = SequenceBinary::LENGTH_SIZE + SequenceBinary::LINE_RECORD_SIZE;
+
+/** Preamble + header record (activeName is short: never truncated) */
+static size_t binaryHeadSize(const String& name) {
+  return SequenceBinary::PREAMBLE_SIZE + SequenceBinary::LENGTH_SIZE + 3 + name.length();
+}
+
+size_t SequenceTableManager::binarySize() const {
+  return binaryHeadSize(m_activeName) + m_count * LINE_STRIDE;
+}
+
+size_t SequenceTableManager::readBinary(uint8_t* out, size_t maxLen, size_t offset) const {
+  std::array<uint8_t, SequenceBinary::PREAMBLE_SIZE + SequenceBinary::LENGTH_SIZE + SequenceBinary::HEADER_RECORD_MAX> piece;
+  static_assert(piece.size() >= LINE_STRIDE, "Piece buffer holds one line record");
+
+  size_t headSize = binaryHeadSize(m_activeName);
+  size_t copied = 0;
+  while (copied < maxLen) {
+    size_t position = offset + copied;
+    size_t pieceStart;
+    size_t pieceSize;
+    if (position < headSize) {
+      binaryHead(m_activeName, m_count, piece.data());
+      pieceStart = 0;
+      pieceSize = headSize;
+    } else {
+      size_t line = (position - headSize) / LINE_STRIDE;
+      if (line >= m_count) break;  // End of file
+      pieceStart = headSize + line * LINE_STRIDE;
+      pieceSize = LINE_STRIDE;
+      SequenceBinary::Writer(piece.data()).u16(SequenceBinary::LINE_RECORD_SIZE);
+      SequenceBinary::encodeLine(lineAt(static_cast<int>(line)), piece.data() + SequenceBinary::LENGTH_SIZE);
+    }
+
+    size_t skip = position - pieceStart;
+    size_t count = min(pieceSize - skip, maxLen - copied);
+    memcpy(out + copied, piece.data() + skip, count);
+    copied += count;
+  }
+  return copied;
+}
+
+// ============================================================================
+// BINARY IMPORT
+// ============================================================================
+
+bool SequenceTableManager::beginBinaryImport(const void* owner) {
+  if (m_binaryOwner != nullptr) {
+    Status.sendError("❌ Another sequence upload is in progress");
+    return false;
+  }
+  if (seqState.isRunning) {
+    Status.sendError("❌ Stop the sequence before importing another one");
+    return false;
+  }
+
+  clear();
+  m_binaryOwner = owner;
+  m_binaryReader.reset();
+  m_binaryLineCount = 0;
+  m_binaryMaxLineId = 0;
+  m_binaryFailed = false;
+  return true;
+}
+
+bool SequenceTableManager::feedBinaryImport(const void* owner, const uint8_t* data, size_t length) {
+  if (owner != m_binaryOwner || m_binaryFailed) return false;
+
+  auto status = m_binaryReader.feed(data, length, [this](const uint8_t* record, size_t size, uint32_t index) {
+    return importBinaryRecord(record, size, index);
+  });
+
+  using ReaderStatus = SequenceBinary::RecordReader::Status;
+  switch (status) {
+    case ReaderStatus::OK:
+      return true;
+    case ReaderStatus::BAD_MAGIC:
+      Status.sendError("❌ Not a binary sequence file");
+      break;
+    case ReaderStatus::BAD_VERSION:
+      Status.sendError("❌ Unsupported binary sequence version");
+      break;
+    case ReaderStatus::RECORD_TOO_LARGE:
+      Status.sendError("❌ Corrupted binary sequence (record too large)");
+      break;
+    case ReaderStatus::REJECTED:
+      break;  // importBinaryRecord reported it
+  }
+  m_binaryFailed = true;
+  return false;
+}
+
+bool SequenceTableManager::importBinaryRecord(const uint8_t* data, size_t length, uint32_t index) {
+  if (index == 0) {
+    const char* name = nullptr;
+    size_t nameLength = 0;
+    if (!SequenceBinary::decodeHeader(data, length, m_binaryLineCount, name, nameLength)) {
+      Status.sendError("❌ Corrupted binary sequence (header)");
+      return false;
+    }
+    if (m_binaryLineCount > m_capacity) {
+      Status.sendError("❌ Too many lines (max " + String(m_capacity) + ")");
+      return false;
+    }
+    engine->info(String("📥 Binary import: ") + String(m_binaryLineCount) + " lines");
+    return true;
+  }
+
+  if (index > m_binaryLineCount) {
+    Status.sendError("❌ Corrupted binary sequence (more lines than announced)");
+    return false;
+  }
+  if (!importLine(SequenceBinary::decodeLine(data, length), m_binaryMaxLineId)) {
+    Status.sendError("❌ Sequencer full! Max " + String(m_capacity) + " lines");
+    return false;
+  }
+  return true;
+}
+
+int SequenceTableManager::endBinaryImport(const void* owner) {
+  if (owner != m_binaryOwner) return -1;
+  m_binaryOwner = nullptr;
+  config.nextLineId = m_binaryMaxLineId + 1;
+
+  if (m_binaryFailed) return -1;
+  if (!m_binaryReader.atRecordBoundary() || m_binaryReader.records() != m_binaryLineCount + 1u) {
+    Status.sendError("❌ Binary sequence incomplete (" + String(m_count) + "/" + String(m_binaryLineCount) + " lines)");
+    return -1;
+  }
+
+  engine->info(String("✅ ") + String(m_count) + " lines imported (binary)");
+  return m_count;
+}
+
+void SequenceTableManager::abortBinaryImport(const void* owner) {
+  if (owner != m_binaryOwner) return;
+  m_binaryOwner = nullptr;
+  config.nextLineId = m_binaryMaxLineId + 1;
+  engine->warn("⚠️ Binary sequence upload aborted (" + String(m_count) + " lines kept)");
+}
+
+// ============================================================================
+// NAMED SEQUENCES
+// ============================================================================
+
+String SequenceTableManager::namedPath(const String& name) const {
+  bool valid = name.length() > 0 && name.length() <= SEQUENCE_NAME_MAX_LEN;
+  for (size_t i = 0; valid && i < name.length(); i++) {
+    char c = name[i];
+    valid = isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '-';
+  }
+
+  if (!valid) {
+    Status.sendError("❌ Invalid sequence name (1-" + String(SEQUENCE_NAME_MAX_LEN) + " chars: A-Z a-z 0-9 _ -)");
+    return "";
+  }
+  return String(SEQUENCE_DIR) + "/" + name + ".json";
+}
+
+bool SequenceTableManager::saveNamed(const String& name) {
+  String path = namedPath(name);
+  if (path.isEmpty()) return false;
+
+  if (!LittleFS.exists(SEQUENCE_DIR)) {
+    LittleFS.mkdir(SEQUENCE_DIR);
+  }
+
+  // Write aside then rename: a power cut never leaves a half-written sequence
+  String previousName = m_activeName;
+  m_activeName = name;
+  if (!FileSystem::writeAtomic(path, [this](File& file) { writeTable(file); return true; })) {
+    m_activeName = previousName;
+    Status.sendError("❌ Failed to save sequence '" + name + "' (filesystem full?)");
+    return false;
+  }
+
+  engine->info("💾 Sequence saved: " + name + " (" + String(m_count) + " lines)");
+  return true;
+}
+
+int SequenceTableManager::loadNamed(const String& name) {
+  if (seqState.isRunning) {
+    Status.sendError("❌ Stop the sequence before loading another one");
+    return -1;
+  }
+
+  String path = namedPath(name);
+  if (path.isEmpty()) return -1;
+
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    Status.sendError("❌ Sequence not found: " + name);
+    return -1;
+  }
+
+  // Stream the "lines" array one object at a time: memory use is one line,
+  // whatever the file size
+  if (!file.find("\"lines\"") || !file.find("[")) {
+    file.close();
+    Status.sendError("❌ Invalid sequence file: " + name);
+    return -1;
+  }
+
+  clear();
+
+  int maxLineId = 0;
+  JsonDocument lineDoc;
+  while (file.available()) {
+    int next = file.peek();
+    if (isspace(next)) {
+      file.read();
+      continue;
+    }
+    if (next == ']') break;  // Empty array
+
+    if (auto error = deserializeJson(lineDoc, file); error) {
+      engine->error("Sequence " + name + " parse error: " + String(error.c_str()));
+      break;
+    }
+
+    SequenceLine line = parseFromJson(lineDoc.as<JsonVariantConst>());
+    line.lineId = lineDoc["lineId"] | 0;
+    if (!importLine(line, maxLineId)) {
+      engine->warn("⚠️ Table full, stopping load");
+      break;
+    }
+
+    if (!file.findUntil(",", "]")) break;  // End of array
+  }
+  file.close();
+
+  config.nextLineId = maxLineId + 1;
+  m_activeName = name;
+
+  engine->info("📂 Sequence loaded: " + name + " (" + String(m_count) + " lines)");
+  return m_count;
+}
+
+bool SequenceTableManager::deleteNamed(const String& name) {
+  String path = namedPath(name);
+  if (path.isEmpty()) return false;
+
+  if (!LittleFS.exists(path) || !LittleFS.remove(path)) {
+    Status.sendError("❌ Sequence not found: " + name);
+    return false;
+  }
+
+  if (m_activeName == name) {
+    m_activeName = "";
+  }
+  engine->info("🗑️ Saved sequence deleted: " + name);
+  return true;
+}
+
+String SequenceTableManager::listNamedJson() {
+  JsonDocument doc;
+  JsonArray list = doc.to<JsonArray>();
+
+  File dir = LittleFS.open(SEQUENCE_DIR);
+  if (dir && dir.isDirectory()) {
+    for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+      String fileName = entry.name();
+      if (!entry.isDirectory() && fileName.endsWith(".json")) {
+        JsonObject item = list.add<JsonObject>();
+        item["name"] = fileName.substring(0, fileName.length() - 5);
+        item["size"] = entry.size();
+      }
+      entry.close();
+    }
+  }
+
+  String output;
+  serializeJson(doc, output);
+  return output;
+}
+
 // ============================================================================
 // BROADCASTING
 // ============================================================================
@@ -0,0 +1,64 @@
+// ============================================================================
+// SPEED_CALIBRATION.CPP - Rig-specific speed curve (SpeedTable owner)
+// ============================================================================
+
+#include "movement/SpeedCalibration.h"
+#include "core/UtilityEngine.h"
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+SpeedCalibration& SpeedCalibration::getInstance() {
+    static SpeedCalibration instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+void SpeedCalibration::init() {
+    SpeedTable::Points points;
+    if (!engine->loadSpeedCalibration(points)) {
+        engine->info("✅ Speed curve: nominal");
+        return;
+    }
+    if (!SpeedTable::isValid(points)) {
+        engine->warn("⚠️ Stored speed curve invalid - using nominal");
+        return;
+    }
+
+    publish(points);
+    m_calibrated = true;
+    engine->info("✅ Speed curve: calibrated (level " + String(MAX_SPEED_LEVEL, 0) + " → " +
+                 String(points[SpeedTable::POINTS - 1], 1) + ")");
+}
+
+// ============================================================================
+// CHANGES
+// ============================================================================
+
+bool SpeedCalibration::apply(const SpeedTable::Points& points) {
+    if (!SpeedTable::isValid(points)) return false;
+
+    publish(points);
+    m_calibrated = true;
+    engine->saveSpeedCalibration(points);
+    engine->info("📐 Speed curve calibrated");
+    return true;
+}
+
+void SpeedCalibration::reset() {
+    publish(SpeedTable::nominal());
+    m_calibrated = false;
+    engine->clearSpeedCalibration();
+    engine->info("📐 Speed curve reset to nominal");
+}
+
+void SpeedCalibration::publish(const SpeedTable::Points& points) {
+    uint8_t spare = m_active.load(std::memory_order_relaxed) == 0 ? 1 : 0;
+    m_tables[spare].build(points);
+    m_active.store(spare, std::memory_order_release);
+    m_points = points;
+}
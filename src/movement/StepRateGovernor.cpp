@@ -0,0 +1,167 @@
+// ============================================================================
+// STEP_RATE_GOVERNOR.CPP - Adaptive step-rate / acceleration limiter
+// ============================================================================
+
+#include "movement/StepRateGovernor.h"
+#include "movement/CalibrationManager.h"
+#include "hardware/MotorDriver.h"
+#include "hardware/PositionVerifier.h"
+#include "core/MovementMath.h"
+#include "core/UtilityEngine.h"
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+StepRateGovernor& StepRateGovernor::getInstance() {
+    static StepRateGovernor instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+void StepRateGovernor::init() {
+    uint32_t floorMicros = GOVERNOR_MIN_STEP_DELAY_US;
+    float accel = GOVERNOR_MAX_ACCEL;
+    engine->loadGovernorProfile(floorMicros, accel);
+
+    m_floorMicros = constrain((unsigned long)floorMicros, GOVERNOR_MIN_STEP_DELAY_US, GOVERNOR_MAX_STEP_DELAY_US);
+    m_accel = constrain(accel, GOVERNOR_MIN_ACCEL, GOVERNOR_MAX_ACCEL);
+    m_lastSteps = Motor.getCommandedSteps();
+
+    engine->info("✅ StepRateGovernor ready (floor=" + String(m_floorMicros) + "µs, accel=" +
+                 (m_accel >= GOVERNOR_MAX_ACCEL ? String("unlimited") : String(m_accel, 0) + " steps/s²") + ")");
+}
+
+// ============================================================================
+// HOT PATH (Core 1)
+// ============================================================================
+
+unsigned long StepRateGovernor::govern(unsigned long requestedDelayMicros) {
+    // Coming from rest: ramp restarts at the pull-in rate
+    uint32_t stepsSinceRest = (micros() - m_lastPulseMicros > PEND_MOVE_END_GAP_MS * 1000UL) ? 0 : m_rampSteps;
+    unsigned long limit = MovementMath::governedMinDelay(m_floorMicros, m_accel, stepsSinceRest);
+
+    if (requestedDelayMicros >= limit) [[likely]] return requestedDelayMicros;
+
+    m_throttled = true;
+    return limit;
+}
+
+// ============================================================================
+// LEARNING (Core 1 - motorTask)
+// ============================================================================
+
+void StepRateGovernor::update() {
+    if (m_resetRequested) [[unlikely]] {
+        m_resetRequested = false;
+        m_floorMicros = GOVERNOR_MIN_STEP_DELAY_US;
+        m_accel = GOVERNOR_MAX_ACCEL;
+        m_cleanMoves = 0;
+        m_dirty = true;
+        engine->info("🔄 Step-rate governor reset to hardware limits");
+    }
+
+    observePulses();
+
+    // One outcome per move evaluated by PositionVerifier
+    uint32_t unverified = PosVerifier.getUnverifiedMoves();
+    uint32_t evaluated = PosVerifier.getVerifiedMoves() + unverified;
+    if (evaluated == m_lastEvaluatedMoves) return;
+
+    bool moveFailed = (unverified != m_lastUnverifiedMoves);
+    m_lastEvaluatedMoves = evaluated;
+    m_lastUnverifiedMoves = unverified;
+
+    // Contact seeking is slow by design and ends against a sensor: not a rate sample
+    if (!Calibration.isBusy()) {
+        if (moveFailed) {
+            backOff("PEND not confirmed");
+        } else if (PosVerifier.getLastSettleMicros() > PEND_LAG_WARN_THRESHOLD_MS * 1000UL) {
+            m_cleanMoves = 0;  // Lagging but recovered: hold current limits
+        } else if (m_throttled) {
+            m_cleanMoves = m_cleanMoves + 1;
+            if (m_cleanMoves >= GOVERNOR_PROBE_CLEAN_MOVES) relax();
+        }
+    }
+
+    m_throttled = false;
+    m_fastestInterval = ULONG_MAX;
+}
+
+void StepRateGovernor::observePulses() {
+    uint32_t steps = Motor.getCommandedSteps();
+    if (steps == m_lastSteps) return;
+
+    unsigned long pulseMicros = Motor.getLastStepMicros();
+    bool direction = Motor.getDirection();
+    uint32_t newSteps = steps - m_lastSteps;
+    unsigned long interval = (pulseMicros - m_lastPulseMicros) / newSteps;
+    bool fromRest = interval > PEND_MOVE_END_GAP_MS * 1000UL;
+
+    // Reversal = full stop for the mechanics → ramp restarts
+    if (fromRest || direction != m_lastDirection) {
+        m_rampSteps = 0;
+    } else {
+        m_rampSteps = m_rampSteps + newSteps;
+        if (interval < m_fastestInterval) m_fastestInterval = interval;
+    }
+
+    m_lastSteps = steps;
+    m_lastPulseMicros = pulseMicros;
+    m_lastDirection = direction;
+}
+
+void StepRateGovernor::onAlarm() {
+    backOff("HSS86 alarm");
+}
+
+void StepRateGovernor::backOff(const char* reason) {
+    m_faults = m_faults + 1;
+    m_cleanMoves = 0;
+
+    // No sustained motion since the last verified move: not a rate problem
+    if (m_fastestInterval == ULONG_MAX) {
+        engine->warn(String("⚠️ Governor: ") + reason + " while idle - limits unchanged");
+        return;
+    }
+
+    unsigned long oldFloor = m_floorMicros;
+    m_floorMicros = MovementMath::governorBackoffFloor(m_floorMicros, m_fastestInterval);
+    float accel = (m_accel >= GOVERNOR_MAX_ACCEL) ? GOVERNOR_MAX_ACCEL * GOVERNOR_ACCEL_BACKOFF
+                                                  : m_accel * GOVERNOR_ACCEL_BACKOFF;
+    m_accel = max(accel, GOVERNOR_MIN_ACCEL);
+    m_dirty = true;
+
+    engine->warn(String("🐌 Governor: ") + reason + " at " + String(m_fastestInterval) + "µs/step → floor " +
+                 String(oldFloor) + "→" + String(m_floorMicros) + "µs, accel " + String(m_accel, 0) + " steps/s²");
+}
+
+void StepRateGovernor::relax() {
+    m_cleanMoves = 0;
+
+    unsigned long newFloor = MovementMath::governorRelaxFloor(m_floorMicros);
+    float accel = min(m_accel * GOVERNOR_ACCEL_RELAX, GOVERNOR_MAX_ACCEL);
+    if (newFloor == m_floorMicros && accel == m_accel) return;  // Already at hardware limits
+
+    m_floorMicros = newFloor;
+    m_accel = accel;
+    m_dirty = true;
+    engine->debug("🐇 Governor probing faster: floor " + String(m_floorMicros) + "µs, accel " +
+                  (m_accel >= GOVERNOR_MAX_ACCEL ? String("unlimited") : String(m_accel, 0)));
+}
+
+// ============================================================================
+// PERSISTENCE (Core 0 - networkTask)
+// ============================================================================
+
+void StepRateGovernor::persistIfDirty() {
+    if (!m_dirty) return;
+    if (millis() - m_lastSaveMs < GOVERNOR_SAVE_INTERVAL_MS) return;
+
+    m_dirty = false;
+    m_lastSaveMs = millis();
+    engine->saveGovernorProfile(m_floorMicros, m_accel);
+}
@@ -0,0 +1,349 @@
+// ============================================================================
+// TRAJECTORY_PLAYER.CPP - Keyframe trajectory playback (MOVEMENT_TRAJECTORY)
+// ============================================================================
+
+#include "movement/TrajectoryPlayer.h"
+#include "communication/StatusEvents.h"
+#include "core/GlobalState.h"
+#include "core/MovementMath.h"
+#include "core/UtilityEngine.h"
+#include "core/Validators.h"
+#include "hardware/MotorDriver.h"
+#include "hardware/ContactSensors.h"
+#include "movement/SequenceExecutor.h"  // currentMovement
+#include "movement/StepRateGovernor.h"
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+#include <cstring>
+
+using enum SystemState;
+using enum MovementType;
+
+// Fastest playback step rate (same mechanical limit as oscillation)
+constexpr auto PLAYBACK_MIN_STEP_DELAY_US =
+    static_cast<unsigned long>(1000000.0f / (TRAJECTORY_MAX_SPEED_MM_S * STEPS_PER_MM));
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+TrajectoryPlayer& TrajectoryPlayer::getInstance() {
+    static TrajectoryPlayer instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+void TrajectoryPlayer::begin() {
+    m_writeMutex = xSemaphoreCreateMutex();
+
+    // Allocated once and never freed: no fragmentation from repeated uploads
+    m_frames = static_cast<TrajectoryKeyframe*>(heap_caps_malloc(
+        TRAJECTORY_CAPACITY_PSRAM * sizeof(TrajectoryKeyframe), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    m_capacity = TRAJECTORY_CAPACITY_PSRAM;
+
+    if (m_frames == nullptr) {
+        m_frames = static_cast<TrajectoryKeyframe*>(malloc(TRAJECTORY_CAPACITY_INTERNAL * sizeof(TrajectoryKeyframe)));
+        m_capacity = TRAJECTORY_CAPACITY_INTERNAL;
+        engine->warn("⚠️ Trajectory buffer: no PSRAM, using internal RAM (" + String(m_capacity) + " keyframes)");
+    }
+
+    if (m_frames == nullptr) {
+        m_capacity = 0;
+        engine->error("❌ Trajectory buffer allocation failed - playback disabled");
+        return;
+    }
+
+    m_mask = m_capacity - 1;
+    engine->info("🎞️ TrajectoryPlayer ready (" + String(m_capacity) + " keyframes, " +
+                 String(m_capacity * sizeof(TrajectoryKeyframe) / 1024) + " KB)");
+}
+
+// ============================================================================
+// LOADING (Core 0)
+// ============================================================================
+
+uint32_t TrajectoryPlayer::getCount() const {
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+}
+
+bool TrajectoryPlayer::clear() {
+    if (m_playing) return false;
+
+    MutexGuard guard(m_writeMutex);
+    if (!guard) return false;
+
+    m_head.store(0, std::memory_order_release);
+    m_tail.store(0, std::memory_order_release);
+    m_carryLen = 0;
+    m_lastAppendTimeMs = 0;
+    m_rejected = 0;
+    m_underruns = 0;
+    return true;
+}
+
+bool TrajectoryPlayer::push(const TrajectoryKeyframe& keyframe) {
+    uint32_t head = m_head.load(std::memory_order_relaxed);
+    uint32_t count = head - m_tail.load(std::memory_order_acquire);
+
+    if (count == m_capacity || !MovementMath::trajectoryKeyframeValid(keyframe, count ? m_lastAppendTimeMs : 0)) {
+        m_rejected = m_rejected + 1;
+        return false;
+    }
+
+    m_frames[head & m_mask] = keyframe;
+    m_lastAppendTimeMs = keyframe.timeMs;
+    m_head.store(head + 1, std::memory_order_release);  // Publish after the slot is written
+    return true;
+}
+
+uint32_t TrajectoryPlayer::append(const uint8_t* data, size_t len) {
+    if (m_frames == nullptr) return 0;
+
+    MutexGuard guard(m_writeMutex);
+    if (!guard) {
+        engine->warn("TrajectoryPlayer::append: mutex timeout");
+        return 0;
+    }
+
+    uint32_t rejectedBefore = m_rejected;
+    uint32_t accepted = 0;
+    TrajectoryKeyframe keyframe;
+
+    // Complete a record split across the previous chunk
+    if (m_carryLen > 0) {
+        size_t needed = m_carry.size() - m_carryLen;
+        size_t take = min(needed, len);
+        memcpy(m_carry.data() + m_carryLen, data, take);
+        m_carryLen += take;
+        data += take;
+        len -= take;
+        if (m_carryLen < m_carry.size()) return 0;
+
+        memcpy(&keyframe, m_carry.data(), sizeof(keyframe));
+        m_carryLen = 0;
+        if (push(keyframe)) accepted++;
+    }
+
+    while (len >= sizeof(keyframe)) {
+        memcpy(&keyframe, data, sizeof(keyframe));  // Source may be unaligned
+        if (push(keyframe)) accepted++;
+        data += sizeof(keyframe);
+        len -= sizeof(keyframe);
+    }
+
+    memcpy(m_carry.data(), data, len);
+    m_carryLen = len;
+
+    if (m_rejected != rejectedBefore) {
+        static unsigned long lastWarnMs = 0;
+        if (millis() - lastWarnMs > 1000) {
+            lastWarnMs = millis();
+            engine->warn("⚠️ Trajectory: " + String(m_rejected - rejectedBefore) +
+                         " keyframes dropped (buffer full or time going back)");
+        }
+    }
+    return accepted;
+}
+
+bool TrajectoryPlayer::loadFile(const String& name) {
+    String path = name.startsWith("/") ? name : String(TRAJECTORY_DIR) + "/" + name;
+
+    if (!engine->isFilesystemReady() || !LittleFS.exists(path)) {
+        Events.postError(("❌ Trajectory file not found: " + path).c_str());
+        return false;
+    }
+    if (!clear()) {
+        Events.postError("❌ Stop trajectory playback before loading a file");
+        return false;
+    }
+
+    File file = LittleFS.open(path, "r");
+    if (!file) {
+        Events.postError(("❌ Cannot open trajectory file: " + path).c_str());
+        return false;
+    }
+
+    std::array<uint8_t, 512> chunk{};
+    uint32_t loaded = 0;
+    while (file.available()) {
+        size_t len = file.read(chunk.data(), chunk.size());
+        if (len == 0) break;
+        loaded += append(chunk.data(), len);
+    }
+    file.close();
+
+    engine->info("🎞️ Trajectory loaded: " + path + " (" + String(loaded) + " keyframes, " +
+                 String(m_lastAppendTimeMs / 1000.0f, 1) + "s)");
+    return loaded > 0;
+}
+
+// ============================================================================
+// PLAYBACK CONTROL (Core 0)
+// ============================================================================
+
+bool TrajectoryPlayer::start(bool loop, bool stream) {
+    if (m_frames == nullptr) {
+        Events.postError("❌ Trajectory buffer unavailable");
+        return false;
+    }
+    if (config.totalDistanceMM == 0) {
+        Events.postError("❌ Trajectory playback requires calibration first!");
+        return false;
+    }
+    if (!stream && getCount() < 2) {
+        Events.postError("❌ Trajectory needs at least 2 keyframes (upload or loadTrajectory first)");
+        return false;
+    }
+
+    MutexGuard guard(stateMutex);
+    if (!guard) {
+        engine->warn("TrajectoryPlayer::start: mutex timeout");
+        return false;
+    }
+
+    // Clamp range captured once: Core 1 never reads the limit settings
+    m_minStep = max(config.minStep, 0L);
+    m_maxStep = min(config.maxStep, MovementMath::mmToSteps(Validators::getMaxAllowedMM()));
+
+    m_loop = loop && !stream;
+    m_stream = stream;
+    m_starved = false;
+    m_approaching = true;
+    m_cursor = m_tail.load(std::memory_order_acquire);
+    m_playMicros = 0;
+    m_playMs = 0;
+    m_lastTickMicros = micros();
+    m_lastStepMicros = micros();
+
+    Motor.enable();
+    config.currentState = STATE_RUNNING;
+    currentMovement = MOVEMENT_TRAJECTORY;
+    m_playing = true;  // Last: process() may run from here on
+
+    engine->info(String("🎞️ Trajectory playback started (") + (stream ? "stream" : (m_loop ? "loop" : "one-shot")) +
+                 ", " + String(getCount()) + " keyframes buffered)");
+    return true;
+}
+
+void TrajectoryPlayer::stop() {
+    m_playing = false;
+    m_starved = false;
+}
+
+// ============================================================================
+// PLAYBACK (Core 1 - motorTask)
+// ============================================================================
+
+void TrajectoryPlayer::process() {
+    unsigned long nowMicros = micros();
+    unsigned long tickMicros = nowMicros - m_lastTickMicros;
+    m_lastTickMicros = nowMicros;
+
+    // Clock frozen while paused (tick still consumed above)
+    if (!m_playing || config.currentState != STATE_RUNNING) return;
+
+    uint32_t head = m_head.load(std::memory_order_acquire);
+    if (m_cursor == head) return;  // Stream not fed yet
+
+    // Move to the first keyframe at approach speed before the clock starts
+    if (m_approaching) [[unlikely]] {
+        const TrajectoryKeyframe& first = frame(m_cursor);
+        if (long target = clampedStep(first.positionMM); target != currentStep) {
+            stepToward(target, TRAJECTORY_APPROACH_STEP_DELAY_US, nowMicros);
+            return;
+        }
+        m_approaching = false;
+        m_playMicros = static_cast<uint64_t>(first.timeMs) * 1000ULL;
+        return;
+    }
+
+    // Advance the clock, never past the newest keyframe
+    uint64_t lastMicros = static_cast<uint64_t>(frame(head - 1).timeMs) * 1000ULL;
+    uint64_t clock = m_playMicros + tickMicros;
+
+    if (clock >= lastMicros) {
+        if (m_loop) {
+            // Wrap: carry the overshoot into the next pass
+            uint32_t tail = m_tail.load(std::memory_order_relaxed);
+            uint64_t firstMicros = static_cast<uint64_t>(frame(tail).timeMs) * 1000ULL;
+            m_cursor = tail;
+            clock = firstMicros + min(clock - lastMicros, lastMicros - firstMicros);
+        } else {
+            clock = lastMicros;
+            if (m_stream && !m_starved) {
+                m_starved = true;
+                m_underruns = m_underruns + 1;
+            }
+        }
+    } else {
+        m_starved = false;
+    }
+    m_playMicros = clock;
+    m_playMs = static_cast<uint32_t>(clock / 1000ULL);
+
+    // Segment containing the clock
+    while (m_cursor + 1 != head && static_cast<uint64_t>(frame(m_cursor + 1).timeMs) * 1000ULL <= clock) {
+        m_cursor++;
+    }
+    if (m_stream) {
+        m_tail.store(m_cursor, std::memory_order_release);  // Played keyframes free their slots
+    }
+
+    float targetMM = (m_cursor + 1 == head)
+        ? frame(m_cursor).positionMM
+        : MovementMath::trajectoryInterpolate(frame(m_cursor), frame(m_cursor + 1), clock);
+    long targetStep = clampedStep(targetMM);
+
+    if (!m_loop && !m_stream && m_cursor + 1 == head && targetStep == currentStep) {
+        finish();
+        return;
+    }
+
+    stepToward(targetStep, PLAYBACK_MIN_STEP_DELAY_US, nowMicros);
+}
+
+void TrajectoryPlayer::stepToward(long targetStep, unsigned long minDelayMicros, unsigned long nowMicros) {
+    long errorSteps = targetStep - currentStep;
+    if (errorSteps == 0) return;
+    if (nowMicros - m_lastStepMicros < Governor.govern(minDelayMicros)) return;
+
+    bool moveForward = (errorSteps > 0);
+    if (!checkSafetyContacts(moveForward)) [[unlikely]] return;
+
+    Motor.setDirection(moveForward);
+    Motor.step();
+    currentStep = currentStep + (moveForward ? 1 : -1);
+    stats.trackDelta(currentStep, MOVEMENT_TRAJECTORY);
+    m_lastStepMicros = nowMicros;
+}
+
+long TrajectoryPlayer::clampedStep(float positionMM) const {
+    return constrain(MovementMath::mmToSteps(positionMM), m_minStep, m_maxStep);
+}
+
+bool TrajectoryPlayer::checkSafetyContacts(bool moveForward) {
+    // Only test contacts when close to a limit (same zone as the other modes)
+    if (moveForward) {
+        if (MovementMath::stepsToMM(config.maxStep - currentStep) <= HARD_DRIFT_TEST_ZONE_MM && Contacts.isEndActive()) {
+            m_playing = false;
+            Events.postError("❌ TRAJECTORY: END contact reached - safety stop");
+            config.currentState = STATE_ERROR;
+            return false;
+        }
+    } else if (MovementMath::stepsToMM(currentStep) <= HARD_DRIFT_TEST_ZONE_MM && Contacts.isStartActive()) {
+        m_playing = false;
+        Events.postError("❌ TRAJECTORY: START contact reached - safety stop");
+        config.currentState = STATE_ERROR;
+        return false;
+    }
+    return true;
+}
+
+void TrajectoryPlayer::finish() {
+    m_playing = false;
+    config.currentState = STATE_READY;
+    engine->info("✅ Trajectory playback complete (" + String(m_playMs / 1000.0f, 1) + "s)");
+}
@@ -0,0 +1,203 @@
+// ============================================================================
+// WAVEFORM_LIBRARY.CPP - Uploadable oscillation waveforms
+// ============================================================================
+
+#include "movement/WaveformLibrary.h"
+#include "core/UtilityEngine.h"
+#include "core/filesystem/FileSystem.h"
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+#include <vector>
+
+// ============================================================================
+// SINGLETON INSTANCE
+// ============================================================================
+
+WaveformLibrary& WaveformLibrary::getInstance() {
+    static WaveformLibrary instance; // NOSONAR(cpp:S6018)
+    return instance;
+}
+
+static String activePath() {
+    return String(WAVEFORM_DIR) + "/.active";
+}
+
+/** Replace path with text (FileSystem::writeAtomic) */
+static bool writeText(const String& path, const String& text) {
+    return FileSystem::writeAtomic(path, [&text](File& file) { return file.print(text) == text.length(); });
+}
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+void WaveformLibrary::begin() {
+    if (!engine->isFilesystemReady()) {
+        engine->error("❌ Waveform library: LittleFS not mounted");
+        return;
+    }
+    if (!LittleFS.exists(WAVEFORM_DIR)) LittleFS.mkdir(WAVEFORM_DIR);
+
+    // Allocated once and never freed
+    for (float*& table : m_tables) {
+        table = static_cast<float*>(heap_caps_malloc(sizeof(Waveform::Table), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+        if (table == nullptr) {
+            table = static_cast<float*>(malloc(sizeof(Waveform::Table)));
+            engine->warn("⚠️ Waveform library: no PSRAM, using internal RAM");
+        }
+        if (table == nullptr) {
+            engine->error("❌ Waveform table allocation failed - custom waveforms disabled");
+            return;
+        }
+    }
+    m_ready = true;
+
+    File file = LittleFS.open(activePath(), "r");
+    if (!file) return;
+    String name = file.readString();
+    file.close();
+    name.trim();
+    if (name.isEmpty()) return;
+
+    if (Result result = select(name.c_str()); result != Result::OK) {
+        engine->warn("⚠️ Selected waveform '" + name + "' not loaded: " + resultMessage(result));
+        return;
+    }
+    engine->info("🌊 Custom waveform restored: " + name);
+}
+
+// ============================================================================
+// RECORDS
+// ============================================================================
+
+bool WaveformLibrary::isValidName(const char* name) {
+    if (name == nullptr) return false;
+    size_t length = strlen(name);
+    if (length == 0 || length > WAVEFORM_NAME_MAX) return false;
+    for (size_t idx = 0; idx < length; ++idx) {
+        char c = name[idx];
+        if (!isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '-') return false;
+    }
+    return true;
+}
+
+String WaveformLibrary::pathFor(const char* name) {
+    return String(WAVEFORM_DIR) + "/" + name + ".json";
+}
+
+WaveformLibrary::Result WaveformLibrary::bakeSpare(JsonVariantConst waveform) {
+    const char* kindName = waveform["kind"] | "samples";
+    Waveform::Kind kind;
+    if (strcmp(kindName, "samples") == 0) kind = Waveform::Kind::SAMPLES;
+    else if (strcmp(kindName, "spline") == 0) kind = Waveform::Kind::SPLINE;
+    else return Result::INVALID_POINTS;
+
+    JsonArrayConst pointsArray = waveform["points"];
+    if (pointsArray.isNull() || pointsArray.size() < 2 || pointsArray.size() > WAVEFORM_MAX_POINTS) {
+        return Result::INVALID_POINTS;
+    }
+    std::vector<float> points;
+    points.reserve(pointsArray.size());
+    for (JsonVariantConst point : pointsArray) {
+        if (!point.is<float>()) return Result::INVALID_POINTS;
+        points.push_back(point.as<float>());
+    }
+
+    float* spare = m_tables[m_active.load(std::memory_order_relaxed) == m_tables[0] ? 1 : 0];
+    return Waveform::bake(kind, points.data(), points.size(), spare) ? Result::OK : Result::INVALID_POINTS;
+}
+
+void WaveformLibrary::publishSpare(const char* name) {
+    float* spare = m_tables[m_active.load(std::memory_order_relaxed) == m_tables[0] ? 1 : 0];
+    m_active.store(spare, std::memory_order_release);
+    m_activeName = name;
+    if (!writeText(activePath(), m_activeName)) engine->warn("⚠️ Waveform selection not persisted");
+}
+
+WaveformLibrary::Result WaveformLibrary::save(JsonVariantConst waveform, String& outName) {
+    if (!m_ready) return Result::IO_ERROR;
+    const char* name = waveform["name"];
+    if (!isValidName(name)) return Result::INVALID_NAME;
+
+    String path = pathFor(name);
+    if (!LittleFS.exists(path)) {
+        JsonDocument list;
+        writeList(list);
+        if (list["waveforms"].size() >= WAVEFORM_MAX_COUNT) return Result::FULL;
+    }
+
+    if (Result result = bakeSpare(waveform); result != Result::OK) return result;
+
+    // Store the normalized record (drops unknown fields)
+    JsonDocument record;
+    record["name"] = name;
+    record["kind"] = waveform["kind"] | "samples";
+    record["points"] = waveform["points"];
+    String text;
+    serializeJson(record, text);
+    if (!writeText(path, text)) return Result::IO_ERROR;
+
+    publishSpare(name);
+    outName = name;
+    return Result::OK;
+}
+
+WaveformLibrary::Result WaveformLibrary::select(const char* name) {
+    if (!m_ready) return Result::IO_ERROR;
+    if (!isValidName(name)) return Result::INVALID_NAME;
+
+    File file = LittleFS.open(pathFor(name), "r");
+    if (!file) return Result::NOT_FOUND;
+    JsonDocument record;
+    DeserializationError error = deserializeJson(record, file);
+    file.close();
+    if (error) return Result::IO_ERROR;
+
+    if (Result result = bakeSpare(record); result != Result::OK) return result;
+    publishSpare(name);
+    return Result::OK;
+}
+
+WaveformLibrary::Result WaveformLibrary::remove(const char* name) {
+    if (!m_ready) return Result::IO_ERROR;
+    if (!isValidName(name)) return Result::INVALID_NAME;
+
+    String path = pathFor(name);
+    if (!LittleFS.exists(path)) return Result::NOT_FOUND;
+    if (!LittleFS.remove(path)) return Result::IO_ERROR;
+
+    if (m_activeName == name) {
+        m_activeName = "";
+        LittleFS.remove(activePath());
+    }
+    return Result::OK;
+}
+
+// ============================================================================
+// LISTING
+// ============================================================================
+
+void WaveformLibrary::writeList(JsonDocument& doc) const {
+    doc["active"] = m_activeName;
+    JsonArray names = doc["waveforms"].to<JsonArray>();
+
+    File dir = LittleFS.open(WAVEFORM_DIR);
+    if (!dir || !dir.isDirectory()) return;
+    for (File file = dir.openNextFile(); file; file = dir.openNextFile()) {
+        String fileName = file.name();
+        file.close();
+        if (fileName.endsWith(".json")) names.add(fileName.substring(0, fileName.length() - 5));
+    }
+}
+
+const char* WaveformLibrary::resultMessage(Result result) {
+    switch (result) {
+        case Result::OK:             return "OK";
+        case Result::INVALID_NAME:   return "Invalid name (1-24 characters: letters, digits, _ or -)";
+        case Result::INVALID_POINTS: return "Invalid waveform (kind samples|spline, 2-1024 numeric points)";
+        case Result::NOT_FOUND:      return "Waveform not found";
+        case Result::FULL:           return "Waveform library full";
+        case Result::IO_ERROR:       return "Filesystem error";
+        default:                     return "Unknown error";
+    }
+}
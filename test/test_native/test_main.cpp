@@ -13,6 +13,9 @@
 #include <unity.h>
 #include <cmath>
 #include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
 
 // ============================================================================
 // EXTERN DEFINITIONS (satisfy Config.h externs)
@@ -27,6 +30,21 @@ const char* otaPassword = "test_ota";
 #include "core/Types.h"
 #include "core/MovementMath.h"
 #include "movement/ChaosPatterns.h"
+#include "communication/CommandTable.h"
+#include "movement/SequenceIdIndex.h"
+#include "movement/SequenceProgram.h"
+#include "movement/SequenceBinary.h"
+#include "communication/MetricsSeries.h"
+#include "communication/StepSamples.h"
+#include "communication/StatusSections.h"
+#include "communication/StatusEvents.h"
+#include "movement/ZoneProfile.h"
+#include "core/SpeedTable.h"
+#include "core/StepScheduler.h"
+#include "core/Transition.h"
+#include "movement/WaveformTable.h"
+#include "movement/OscillatorBank.h"
+#include "movement/PursuitTracker.h"
 
 using enum SystemState;
 using enum MovementType;
@@ -145,7 +163,7 @@ void test_sequence_limits_sane() {
 void test_oscillation_constants_sane() {
     TEST_ASSERT_TRUE(OSC_MIN_STEP_DELAY_MICROS > 0);
     TEST_ASSERT_TRUE(OSC_MAX_STEPS_PER_CATCH_UP >= 1);
-    TEST_ASSERT_TRUE(SINE_TABLE_SIZE > 0);
+    TEST_ASSERT_TRUE(WAVEFORM_TABLE_SIZE > 0);
     TEST_ASSERT_TRUE(OSC_FREQ_TRANSITION_DURATION_MS > 0);
 }
 
@@ -291,6 +309,7 @@ void test_sequence_line_defaults() {
     TEST_ASSERT_FLOAT_NEAR(5.0f, sl.speedBackward, 0.001f);
     TEST_ASSERT_EQUAL_INT(1, sl.cycleCount);
     TEST_ASSERT_EQUAL_INT(0, sl.pauseAfterMs);
+    TEST_ASSERT_TRUE(sl.op == SequenceOp::SEQ_OP_MOVE);  // Files without "op" load as movements
     // Chaos patterns all enabled
     for (int i = 0; i < CHAOS_PATTERN_COUNT; i++) {
         TEST_ASSERT_TRUE(sl.chaosPatternsEnabled[i]);
@@ -342,9 +361,9 @@ void test_speed_level_clamped_max() {
 void test_vaet_step_delay_known_values() {
     // speed=5 → 50 cpm, distance=50mm → 400 steps
     // halfCycle = 60000/50/2 = 600ms, rawDelay = 600000/400 = 1500µs
-    // delay = (1500 - 6) / 1.0 = 1494µs
+    // delay = 1500 / 1.0 = 1500µs (pulse/loop overhead absorbed by StepScheduler)
     unsigned long delay = MovementMath::vaetStepDelay(5.0f, 50.0f);
-    TEST_ASSERT_FLOAT_NEAR(1494.0f, (float)delay, 5.0f);
+    TEST_ASSERT_FLOAT_NEAR(1500.0f, (float)delay, 5.0f);
 }
 
 void test_vaet_step_delay_zero_distance() {
@@ -396,35 +415,6 @@ void test_chaos_step_delay_min_clamp() {
     TEST_ASSERT_TRUE(delay >= 20);
 }
 
-void test_pursuit_delay_far_from_target() {
-    // >5mm error: uses full maxSpeedLevel
-    unsigned long d1 = MovementMath::pursuitStepDelay(10.0f, 10.0f);
-    unsigned long d2 = MovementMath::pursuitStepDelay(50.0f, 10.0f);
-    // Same delay regardless of how far (both >5mm)
-    TEST_ASSERT_EQUAL_UINT32(d1, d2);
-}
-
-void test_pursuit_delay_close_ramp() {
-    // Between 1-5mm: speed ramps from 60% to 100%
-    unsigned long far_delay = MovementMath::pursuitStepDelay(4.5f, 10.0f);
-    unsigned long close_delay = MovementMath::pursuitStepDelay(1.5f, 10.0f);
-    // Closer = slower = longer delay
-    TEST_ASSERT_TRUE(close_delay > far_delay);
-}
-
-void test_pursuit_delay_very_close() {
-    // <1mm: minimum speed (60% of max)
-    unsigned long d1 = MovementMath::pursuitStepDelay(0.5f, 10.0f);
-    unsigned long d2 = MovementMath::pursuitStepDelay(0.1f, 10.0f);
-    // Same delay (both <1mm → same speed)
-    TEST_ASSERT_EQUAL_UINT32(d1, d2);
-}
-
-void test_pursuit_delay_minimum_clamp() {
-    unsigned long delay = MovementMath::pursuitStepDelay(100.0f, MAX_SPEED_LEVEL);
-    TEST_ASSERT_TRUE(delay >= 20);
-}
-
 // ============================================================================
 // 4. ZONE EFFECT CURVES — uses MovementMath::zoneSpeedFactor (real production)
 // ============================================================================
@@ -789,67 +779,75 @@ void test_validator_distance_limit_percent() {
 
 void test_stats_tracking_reset() {
     StatsTracking st;
-    st.totalDistanceTraveled = 5000;
-    st.lastSavedDistance = 3000;
+    st.syncPosition(0);
+    st.trackDelta(5000, MovementType::MOVEMENT_VAET);
+    st.markSaved(3000);
     st.reset();
-    TEST_ASSERT_EQUAL_UINT32(0, st.totalDistanceTraveled);
-    TEST_ASSERT_EQUAL_UINT32(0, st.lastSavedDistance);
+    TEST_ASSERT_TRUE(st.sessionSteps() == 0);
+    TEST_ASSERT_TRUE(st.getIncrementSteps() == 0);
+    TEST_ASSERT_TRUE(st.odometer.totalSteps() == 5000);  // Lifetime counter survives a reset
 }
 
 void test_stats_tracking_add_distance() {
+    OdometerCounters saved;
+    saved.totalSteps = 1000;
     StatsTracking st;
-    st.addDistance(100);
-    TEST_ASSERT_EQUAL_UINT32(100, st.totalDistanceTraveled);
-    st.addDistance(50);
-    TEST_ASSERT_EQUAL_UINT32(150, st.totalDistanceTraveled);
-    // Negative delta ignored
-    st.addDistance(-10);
-    TEST_ASSERT_EQUAL_UINT32(150, st.totalDistanceTraveled);
+    st.restoreOdometer(saved);
+    TEST_ASSERT_TRUE(st.sessionSteps() == 0);  // Session starts at the restored total
+    st.syncPosition(0);
+    st.trackDelta(100, MovementType::MOVEMENT_VAET);
+    TEST_ASSERT_TRUE(st.sessionSteps() == 100);
+    st.trackDelta(150, MovementType::MOVEMENT_VAET);
+    TEST_ASSERT_TRUE(st.sessionSteps() == 150);
+    TEST_ASSERT_TRUE(st.getIncrementSteps() == 150);
 }
 
 void test_stats_tracking_increment() {
     StatsTracking st;
-    st.addDistance(500);
-    st.markSaved();
-    st.addDistance(200);
+    st.syncPosition(0);
+    st.trackDelta(500, MovementType::MOVEMENT_VAET);
+    st.markSaved(st.getIncrementSteps());
+    st.trackDelta(700, MovementType::MOVEMENT_VAET);
     TEST_ASSERT_EQUAL_UINT32(200, st.getIncrementSteps());
 }
 
 void test_stats_tracking_track_delta() {
     StatsTracking st;
     st.syncPosition(100);
-    st.trackDelta(110);
-    TEST_ASSERT_EQUAL_UINT32(10, st.totalDistanceTraveled);
-    st.trackDelta(105);
-    TEST_ASSERT_EQUAL_UINT32(15, st.totalDistanceTraveled);  // 10 + 5
+    st.trackDelta(110, MovementType::MOVEMENT_OSC);
+    TEST_ASSERT_TRUE(st.sessionSteps() == 10);
+    st.trackDelta(105, MovementType::MOVEMENT_OSC);
+    TEST_ASSERT_TRUE(st.sessionSteps() == 15);  // 10 + 5
+    TEST_ASSERT_TRUE(st.odometer.snapshot().reversals == 1);
 }
 
 void test_stats_tracking_zero_delta() {
     StatsTracking st;
     st.syncPosition(50);
-    st.trackDelta(50);  // No movement
-    TEST_ASSERT_EQUAL_UINT32(0, st.totalDistanceTraveled);
+    st.trackDelta(50, MovementType::MOVEMENT_VAET);  // No movement
+    TEST_ASSERT_TRUE(st.sessionSteps() == 0);
 }
 
 void test_stats_tracking_backward_delta() {
     StatsTracking st;
     st.syncPosition(200);
-    st.trackDelta(180);  // Moved backward 20 steps
-    TEST_ASSERT_EQUAL_UINT32(20, st.totalDistanceTraveled);
+    st.trackDelta(180, MovementType::MOVEMENT_CHAOS);  // Moved backward 20 steps
+    TEST_ASSERT_TRUE(st.sessionSteps() == 20);
+    TEST_ASSERT_TRUE(st.odometer.snapshot().stepsByMode[static_cast<size_t>(MovementType::MOVEMENT_CHAOS)] == 20);
 }
 
 void test_stats_tracking_multiple_saves() {
     StatsTracking st;
-    st.addDistance(100);
-    st.markSaved();
+    st.syncPosition(0);
+    st.trackDelta(100, MovementType::MOVEMENT_VAET);
+    st.markSaved(st.getIncrementSteps());
     TEST_ASSERT_EQUAL_UINT32(0, st.getIncrementSteps());
-    st.addDistance(50);
-    TEST_ASSERT_EQUAL_UINT32(50, st.getIncrementSteps());
-    st.markSaved();
-    st.addDistance(25);
+    st.trackDelta(150, MovementType::MOVEMENT_VAET);
+    uint64_t increment = st.getIncrementSteps();
+    TEST_ASSERT_EQUAL_UINT32(50, increment);
+    st.trackDelta(175, MovementType::MOVEMENT_VAET);  // Core 1 steps before the save completes
+    st.markSaved(increment);
     TEST_ASSERT_EQUAL_UINT32(25, st.getIncrementSteps());
-    // Total is still cumulative
-    TEST_ASSERT_EQUAL_UINT32(175, st.totalDistanceTraveled);
 }
 
 // ============================================================================
@@ -1272,8 +1270,7 @@ void test_zone_effect_state_extended_defaults() {
 
 void test_pursuit_state_extended_defaults() {
     constexpr PursuitState ps;
-    TEST_ASSERT_EQUAL_INT32(0, ps.lastTargetStep);
-    TEST_ASSERT_FLOAT_NEAR(10.0f, ps.lastMaxSpeedLevel, 0.001f);
+    TEST_ASSERT_FLOAT_NEAR(0.0f, ps.velocityMMS, 0.001f);
     TEST_ASSERT_TRUE(ps.direction);
 }
 
@@ -1297,7 +1294,9 @@ void test_chaos_execution_state_extended_defaults() {
     TEST_ASSERT_EQUAL_UINT32(0, cs.pauseStartTime);
     TEST_ASSERT_EQUAL_UINT32(0, cs.pauseDuration);
     TEST_ASSERT_FLOAT_NEAR(0.0f, cs.lastCalmSineValue, 0.001f);
-    TEST_ASSERT_EQUAL_UINT32(0, cs.lastStepMicros);
+    StepScheduler clock = cs.stepClock;  // Deadline starts at 0
+    TEST_ASSERT_FALSE(clock.due(cs.stepDelay - 1, StepScheduler::fromMicros(cs.stepDelay)));
+    TEST_ASSERT_TRUE(clock.due(cs.stepDelay, StepScheduler::fromMicros(cs.stepDelay)));
 }
 
 // ============================================================================
@@ -1361,24 +1360,6 @@ void test_chaos_step_delay_mid_range() {
     TEST_ASSERT_TRUE(delay < 2000);
 }
 
-void test_pursuit_delay_exact_threshold() {
-    // At exactly 5mm: uses max speed
-    unsigned long d5 = MovementMath::pursuitStepDelay(5.0f, 10.0f);
-    unsigned long d5_1 = MovementMath::pursuitStepDelay(5.1f, 10.0f);
-    // At 5mm and above, should give full speed (same delay)
-    TEST_ASSERT_EQUAL_UINT32(d5_1, d5_1);  // Both > 5mm
-}
-
-void test_pursuit_delay_at_1mm_boundary() {
-    // At exactly 1mm: bottom of ramp zone
-    unsigned long d1 = MovementMath::pursuitStepDelay(1.0f, 10.0f);
-    unsigned long d09 = MovementMath::pursuitStepDelay(0.9f, 10.0f);
-    // Below 1mm uses constant 60% speed, at 1mm uses ramp (also 60%)
-    // d1: ratio = (1-1)/(5-1) = 0 → speed = 10 * (0.6+0) = 6.0
-    // d09: speed = 10 * 0.6 = 6.0
-    TEST_ASSERT_EQUAL_UINT32(d1, d09);
-}
-
 // ============================================================================
 // 23. ENUM VALUE COVERAGE
 // ============================================================================
@@ -1398,15 +1379,16 @@ void test_movement_type_all_values() {
     MovementType types[] = {
         MovementType::MOVEMENT_VAET, MovementType::MOVEMENT_OSC,
         MovementType::MOVEMENT_CHAOS, MovementType::MOVEMENT_PURSUIT,
-        MovementType::MOVEMENT_CALIBRATION
+        MovementType::MOVEMENT_CALIBRATION, MovementType::MOVEMENT_TRAJECTORY
     };
-    TEST_ASSERT_EQUAL_INT(5, sizeof(types) / sizeof(types[0]));
+    TEST_ASSERT_EQUAL_INT(6, sizeof(types) / sizeof(types[0]));
     // Verify specific integer values
     TEST_ASSERT_EQUAL_INT(0, (int)MovementType::MOVEMENT_VAET);
     TEST_ASSERT_EQUAL_INT(1, (int)MovementType::MOVEMENT_OSC);
     TEST_ASSERT_EQUAL_INT(2, (int)MovementType::MOVEMENT_CHAOS);
     TEST_ASSERT_EQUAL_INT(3, (int)MovementType::MOVEMENT_PURSUIT);
     TEST_ASSERT_EQUAL_INT(4, (int)MovementType::MOVEMENT_CALIBRATION);
+    TEST_ASSERT_EQUAL_INT(5, (int)MovementType::MOVEMENT_TRAJECTORY);
 }
 
 void test_chaos_pattern_all_values() {
@@ -1540,15 +1522,6 @@ void test_speed_monotonicity_chaos() {
     }
 }
 
-void test_speed_monotonicity_pursuit() {
-    // Farther from target → faster (shorter delay), within ramp zone
-    for (float err = 1.5f; err < 4.5f; err += 0.5f) {
-        unsigned long d1 = MovementMath::pursuitStepDelay(err, 10.0f);
-        unsigned long d2 = MovementMath::pursuitStepDelay(err + 0.5f, 10.0f);
-        TEST_ASSERT_TRUE_MESSAGE(d2 <= d1, "pursuitStepDelay not monotonically decreasing with error");
-    }
-}
-
 void test_distance_monotonicity_vaet() {
     // Longer distance → shorter step delay (more distance to cover per cycle)
     for (float dist = 10.0f; dist < 190.0f; dist += 20.0f) {
@@ -1566,10 +1539,6 @@ void test_all_delays_above_minimum() {
         TEST_ASSERT_TRUE(dv >= 20);
         TEST_ASSERT_TRUE(dc >= 20);
     }
-    for (float err = 0.1f; err <= 10.0f; err += 1.0f) {
-        unsigned long dp = MovementMath::pursuitStepDelay(err, 10.0f);
-        TEST_ASSERT_TRUE(dp >= 20);
-    }
 }
 
 void test_zone_decel_reduces_speed() {
@@ -1657,6 +1626,1166 @@ void test_effective_freq_speed_invariant() {
     }
 }
 
+// ============================================================================
+// 28. PEND position verification (5 tests)
+// ============================================================================
+
+void test_pend_following_error_rounding() {
+    // 2.5ms settle at 1ms/step → 2.5 steps behind → rounds to 3
+    TEST_ASSERT_EQUAL(3, MovementMath::pendFollowingErrorSteps(2500, 1000));
+    TEST_ASSERT_EQUAL(2, MovementMath::pendFollowingErrorSteps(2400, 1000));
+}
+
+void test_pend_following_error_zero_settle() {
+    // PEND already HIGH at the last pulse → no lag
+    TEST_ASSERT_EQUAL(0, MovementMath::pendFollowingErrorSteps(0, 500));
+}
+
+void test_pend_following_error_zero_interval_guard() {
+    // Single-pulse move has no measured interval → no division, no estimate
+    TEST_ASSERT_EQUAL(0, MovementMath::pendFollowingErrorSteps(10000, 0));
+}
+
+void test_soft_recal_lost_steps_threshold() {
+    TEST_ASSERT_FALSE(MovementMath::needsSoftRecalibration(PEND_RECAL_LOST_STEPS - 1, 0));
+    TEST_ASSERT_TRUE(MovementMath::needsSoftRecalibration(PEND_RECAL_LOST_STEPS, 0));
+}
+
+void test_soft_recal_unverified_moves_threshold() {
+    TEST_ASSERT_FALSE(MovementMath::needsSoftRecalibration(0, PEND_RECAL_UNVERIFIED_MOVES - 1));
+    TEST_ASSERT_TRUE(MovementMath::needsSoftRecalibration(0, PEND_RECAL_UNVERIFIED_MOVES));
+}
+
+// ============================================================================
+// 29. Step-rate governor (6 tests)
+// ============================================================================
+
+void test_governor_unlimited_accel_floor_only() {
+    // Default profile: no ramp, just the floor
+    TEST_ASSERT_EQUAL(100, MovementMath::governedMinDelay(100, GOVERNOR_MAX_ACCEL, 0));
+}
+
+void test_governor_ramp_starts_at_pull_in_rate() {
+    // n = 0 → v = v0 → delay = 1e6 / v0
+    auto expected = (unsigned long)(1000000.0f / GOVERNOR_START_RATE_STEPS_S);
+    TEST_ASSERT_EQUAL(expected, MovementMath::governedMinDelay(20, GOVERNOR_MIN_ACCEL, 0));
+}
+
+void test_governor_ramp_monotonic_to_floor() {
+    unsigned long prev = MovementMath::governedMinDelay(50, 100000.0f, 0);
+    for (uint32_t n = 1; n < 5000; n *= 2) {
+        unsigned long d = MovementMath::governedMinDelay(50, 100000.0f, n);
+        TEST_ASSERT_TRUE(d <= prev);
+        TEST_ASSERT_TRUE(d >= 50);
+        prev = d;
+    }
+    TEST_ASSERT_EQUAL(50, prev);  // Long run: floor reached
+}
+
+void test_governor_backoff_slower_than_fault() {
+    // Fault at 100µs/step → floor at 125µs
+    TEST_ASSERT_EQUAL(125, MovementMath::governorBackoffFloor(GOVERNOR_MIN_STEP_DELAY_US, 100));
+    // Never relaxes an already slower floor
+    TEST_ASSERT_EQUAL(400, MovementMath::governorBackoffFloor(400, 100));
+}
+
+void test_governor_backoff_clamped() {
+    TEST_ASSERT_EQUAL(GOVERNOR_MAX_STEP_DELAY_US, MovementMath::governorBackoffFloor(100, 50000));
+}
+
+void test_governor_relax_clamped_to_hardware() {
+    TEST_ASSERT_EQUAL(95, MovementMath::governorRelaxFloor(100));
+    TEST_ASSERT_EQUAL(GOVERNOR_MIN_STEP_DELAY_US, MovementMath::governorRelaxFloor(GOVERNOR_MIN_STEP_DELAY_US));
+}
+
+// ============================================================================
+// 30. Wall-clock phase lock (6 tests)
+// ============================================================================
+
+void test_phase_error_wraps_to_half_cycle() {
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.1f, MovementMath::wrapPhaseError(0.1f));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, -0.1f, MovementMath::wrapPhaseError(0.9f));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.2f, MovementMath::wrapPhaseError(-0.8f));
+}
+
+void test_anchored_phase_before_and_after_anchor() {
+    // 0.5 Hz: 500ms = quarter cycle; 500ms BEFORE the anchor = 3/4 cycle
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.25f, MovementMath::anchoredPhase(500, 0.5f));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.75f, MovementMath::anchoredPhase(-500, 0.5f));
+}
+
+void test_anchored_phase_precise_hours_later() {
+    // 10h + 250ms at 1.25 Hz = 45000.3125 cycles (float alone keeps no fraction)
+    int64_t elapsedMs = 36000000LL + 250;
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.3125f, MovementMath::anchoredPhase(elapsedMs, 1.25f));
+}
+
+void test_phase_lock_trim_direction_and_clamp() {
+    TEST_ASSERT_TRUE(MovementMath::phaseLockTrim(0.02f) > 0.0f);   // Behind → faster
+    TEST_ASSERT_TRUE(MovementMath::phaseLockTrim(-0.02f) < 0.0f);  // Ahead → slower
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, PHASE_LOCK_MAX_TRIM, MovementMath::phaseLockTrim(0.5f));
+    // Trimmed delay: +5% speed → delay / 1.05
+    TEST_ASSERT_EQUAL(1000, MovementMath::trimmedStepDelay(1050, 0.05f));
+}
+
+void test_vaet_phase_lock_learns_period_bias() {
+    // Rig cycles 4% slower than the nominal grid: the loop must settle with
+    // ~4% trim and a vanishing phase error
+    float error = 0.0f;
+    float integral = 0.0f;
+    for (int cycle = 0; cycle < 60; cycle++) {
+        float trim = MovementMath::vaetPhaseLockTrim(error, integral);
+        error = MovementMath::wrapPhaseError(error + 0.04f - trim);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.0f, error);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.04f, integral);
+}
+
+void test_vaet_cycle_period_from_half_cycles() {
+    // 60 c/min forward + 30 c/min backward → 500ms + 1000ms
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 1500.0f, MovementMath::vaetCyclePeriodMs(60.0f, 30.0f));
+}
+
+// ============================================================================
+// 31. Trajectory playback (5 tests)
+// ============================================================================
+
+void test_trajectory_interpolate_midpoint() {
+    TrajectoryKeyframe from{1000, 10.0f};
+    TrajectoryKeyframe to{2000, 30.0f};
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 20.0f, MovementMath::trajectoryInterpolate(from, to, 1500000ULL));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 15.0f, MovementMath::trajectoryInterpolate(from, to, 1250000ULL));
+}
+
+void test_trajectory_interpolate_clamped_to_segment() {
+    TrajectoryKeyframe from{1000, 10.0f};
+    TrajectoryKeyframe to{2000, 30.0f};
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 10.0f, MovementMath::trajectoryInterpolate(from, to, 0ULL));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 30.0f, MovementMath::trajectoryInterpolate(from, to, 5000000ULL));
+}
+
+void test_trajectory_interpolate_zero_length_segment() {
+    // Same timestamp twice = instantaneous jump target (no division by zero)
+    TrajectoryKeyframe from{1000, 10.0f};
+    TrajectoryKeyframe to{1000, 50.0f};
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 50.0f, MovementMath::trajectoryInterpolate(from, to, 1000000ULL));
+}
+
+void test_trajectory_keyframe_validation() {
+    TEST_ASSERT_TRUE(MovementMath::trajectoryKeyframeValid({500, 12.5f}, 500));
+    TEST_ASSERT_FALSE(MovementMath::trajectoryKeyframeValid({499, 12.5f}, 500));  // Time going back
+    TEST_ASSERT_FALSE(MovementMath::trajectoryKeyframeValid({600, NAN}, 500));
+    TEST_ASSERT_FALSE(MovementMath::trajectoryKeyframeValid({600, INFINITY}, 500));
+}
+
+void test_trajectory_fill_percent() {
+    TEST_ASSERT_EQUAL_UINT8(0, MovementMath::fillPercent(10, 0));
+    TEST_ASSERT_EQUAL_UINT8(49, MovementMath::fillPercent(32767, 65536));
+    TEST_ASSERT_EQUAL_UINT8(100, MovementMath::fillPercent(TRAJECTORY_CAPACITY_PSRAM, TRAJECTORY_CAPACITY_PSRAM));
+}
+
+// ============================================================================
+// 32. Command table perfect hash (3 tests)
+// ============================================================================
+
+struct TestCommand { const char* name; int id; };
+
+constexpr std::array<TestCommand, 6> TEST_COMMANDS = {{
+    {"start", 0}, {"stop", 1}, {"startChaos", 2},
+    {"stopChaos", 3}, {"pursuitMove", 4}, {"getStatus", 5},
+}};
+constexpr auto TEST_INDEX = CommandTable::buildPerfectHash<16>(TEST_COMMANDS);
+static_assert(TEST_INDEX.valid, "Perfect hash must be found at compile time");
+
+void test_command_table_resolves_every_name() {
+    for (const auto& command : TEST_COMMANDS) {
+        const TestCommand* found = CommandTable::find(TEST_COMMANDS, TEST_INDEX, command.name);
+        TEST_ASSERT_NOT_NULL(found);
+        TEST_ASSERT_EQUAL_INT(command.id, found->id);
+    }
+}
+
+void test_command_table_rejects_unknown_and_prefixes() {
+    TEST_ASSERT_NULL(CommandTable::find(TEST_COMMANDS, TEST_INDEX, "sta"));         // Prefix of "start"
+    TEST_ASSERT_NULL(CommandTable::find(TEST_COMMANDS, TEST_INDEX, "startChaosX"));
+    TEST_ASSERT_NULL(CommandTable::find(TEST_COMMANDS, TEST_INDEX, ""));
+    TEST_ASSERT_NULL(CommandTable::find(TEST_COMMANDS, TEST_INDEX, "Start"));        // Case-sensitive
+}
+
+void test_command_table_duplicate_name_invalid() {
+    constexpr std::array<TestCommand, 3> duplicated = {{{"stop", 0}, {"start", 1}, {"stop", 2}}};
+    constexpr auto index = CommandTable::buildPerfectHash<8>(duplicated);
+    TEST_ASSERT_FALSE(index.valid);
+}
+
+// ============================================================================
+// 33. WebSocket binary frames (1 test)
+// ============================================================================
+
+void test_ws_pursuit_frame_matches_js_encoding() {
+    // DataView.setFloat32(.., true) for 12.5 and 10.0 after the 'P' opcode
+    const uint8_t wire[] = {WS_BINARY_PURSUIT_MOVE, 0x00, 0x00, 0x48, 0x41, 0x00, 0x00, 0x20, 0x41};
+    TEST_ASSERT_EQUAL_INT(1 + sizeof(WsPursuitMoveFrame), sizeof(wire));
+
+    WsPursuitMoveFrame frame;
+    memcpy(&frame, wire + 1, sizeof(frame));
+    TEST_ASSERT_EQUAL_FLOAT(12.5f, frame.targetMM);
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, frame.maxSpeedLevel);
+}
+
+// ============================================================================
+// 34. Sequencer look-ahead transition speed (1 test)
+// ============================================================================
+
+void test_transition_step_delay_clamped() {
+    using MovementMath::transitionStepDelay;
+    // Slow line: never slower than the legacy positioning speed
+    TEST_ASSERT_EQUAL_UINT32(POSITIONING_STEP_DELAY_MICROS, transitionStepDelay(5000));
+    // Fast line: capped at the transition ceiling
+    TEST_ASSERT_EQUAL_UINT32(SEQUENCE_TRANSITION_MIN_STEP_DELAY_MICROS, transitionStepDelay(50));
+    // In between: the line's own speed
+    TEST_ASSERT_EQUAL_UINT32(600, transitionStepDelay(600));
+    TEST_ASSERT_TRUE(SEQUENCE_TRANSITION_MIN_STEP_DELAY_MICROS < POSITIONING_STEP_DELAY_MICROS);
+}
+
+// ============================================================================
+// 35. Sequence line ID index (2 tests)
+// ============================================================================
+
+void test_sequence_id_index_insert_find_erase() {
+    int32_t keys[8];
+    uint16_t slots[8];
+    SequenceIdIndex index;
+    index.attach(keys, slots, 8);
+
+    for (int32_t id = 1; id <= 7; ++id) {
+        TEST_ASSERT_TRUE(index.insert(id * 8, static_cast<uint16_t>(id)));  // 7 of 8 buckets: long probe runs
+    }
+    TEST_ASSERT_FALSE(index.insert(100, 0));  // One bucket always stays empty
+    TEST_ASSERT_EQUAL_UINT32(7, index.size());
+
+    // Erase from the middle of the runs: every other entry stays reachable
+    TEST_ASSERT_TRUE(index.erase(24));
+    TEST_ASSERT_TRUE(index.erase(40));
+    TEST_ASSERT_FALSE(index.erase(24));
+    TEST_ASSERT_EQUAL_UINT16(SequenceIdIndex::NOT_FOUND, index.find(24));
+    for (int32_t id : {1, 2, 4, 6, 7}) {
+        TEST_ASSERT_EQUAL_UINT16(id, index.find(id * 8));
+    }
+    TEST_ASSERT_TRUE(index.insert(24, 9));
+    TEST_ASSERT_EQUAL_UINT16(9, index.find(24));
+}
+
+void test_sequence_id_index_rejects_invalid_ids() {
+    int32_t keys[4];
+    uint16_t slots[4];
+    SequenceIdIndex index;
+    index.attach(keys, slots, 4);
+
+    TEST_ASSERT_FALSE(index.insert(0, 1));   // 0 marks an empty bucket
+    TEST_ASSERT_FALSE(index.insert(-3, 1));
+    TEST_ASSERT_TRUE(index.insert(5, 1));
+    TEST_ASSERT_FALSE(index.insert(5, 2));   // Duplicate keeps the first slot
+    TEST_ASSERT_EQUAL_UINT16(1, index.find(5));
+
+    index.clear();
+    TEST_ASSERT_EQUAL_UINT32(0, index.size());
+    TEST_ASSERT_EQUAL_UINT16(SequenceIdIndex::NOT_FOUND, index.find(5));
+}
+
+// ============================================================================
+// 36. Sequence control flow (3 tests)
+// ============================================================================
+
+using enum SequenceOp;
+
+/** Table of control/move lines, lineId = position + 1 */
+template <size_t N>
+struct ProgramFixture {
+    std::array<SequenceLine, N> lines{};
+    std::array<SequenceProgram::Instr, N> code{};
+    SequenceProgram program;
+    SequenceProgram::Cursor cursor;
+
+    ProgramFixture(std::initializer_list<std::pair<SequenceOp, int32_t>> ops) {
+        size_t pos = 0;
+        for (const auto& [op, arg] : ops) {
+            lines[pos].op = op;
+            lines[pos].opArg = arg;
+            lines[pos].lineId = static_cast<int>(pos + 1);
+            ++pos;
+        }
+        program.attach(code.data(), N);
+    }
+
+    SequenceProgram::Error compile() {
+        return program.compile(
+            static_cast<int>(N), [this](int pos) -> const SequenceLine& { return lines[pos]; },
+            [](int32_t lineId) { return static_cast<int>(lineId - 1); });
+    }
+
+    /** Line run after position (first line if position is -1) */
+    int16_t after(int16_t position, int32_t choice = 0) {
+        int16_t from = position < 0 ? program.entry() : program.at(position).next;
+        return program.resolve(from, cursor, [choice](int32_t) { return choice; });
+    }
+};
+
+void test_sequence_program_repeat_and_call() {
+    ProgramFixture<7> fx({{SEQ_OP_REPEAT, 2},
+                          {SEQ_OP_MOVE, 0},
+                          {SEQ_OP_CALL, 6},       // → line 6 (position 5)
+                          {SEQ_OP_END_REPEAT, 0},
+                          {SEQ_OP_END, 0},        // Subroutine below is only reached by CALL
+                          {SEQ_OP_MOVE, 0},
+                          {SEQ_OP_RETURN, 0}});
+    TEST_ASSERT_EQUAL(static_cast<int>(SequenceProgram::Error::NONE), static_cast<int>(fx.compile()));
+
+    const int16_t expected[] = {1, 5, 1, 5, SequenceProgram::END};
+    int16_t position = -1;
+    for (int16_t line : expected) {
+        position = fx.after(position);
+        TEST_ASSERT_EQUAL_INT16(line, position);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, fx.cursor.depth);  // Every block and call closed
+}
+
+void test_sequence_program_random_choice_skips_disabled() {
+    ProgramFixture<5> fx({{SEQ_OP_RANDOM, 3},
+                          {SEQ_OP_MOVE, 0},
+                          {SEQ_OP_MOVE, 0},       // Disabled below: not a candidate
+                          {SEQ_OP_WAIT, 500},
+                          {SEQ_OP_MOVE, 0}});
+    fx.lines[2].enabled = false;
+    TEST_ASSERT_EQUAL(static_cast<int>(SequenceProgram::Error::NONE), static_cast<int>(fx.compile()));
+    TEST_ASSERT_EQUAL_INT32(2, fx.program.at(0).arg);  // Enabled members
+
+    TEST_ASSERT_EQUAL_INT16(3, fx.after(-1, 1));       // Second enabled member: the WAIT
+    TEST_ASSERT_EQUAL_INT16(4, fx.after(3));           // Members continue after the group
+    TEST_ASSERT_EQUAL_INT16(1, fx.after(-1, 0));
+    TEST_ASSERT_EQUAL_INT16(4, fx.after(1));
+}
+
+void test_sequence_program_rejects_bad_structure() {
+    using Error = SequenceProgram::Error;
+
+    ProgramFixture<2> endWithoutRepeat({{SEQ_OP_MOVE, 0}, {SEQ_OP_END_REPEAT, 0}});
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::UNMATCHED_END_REPEAT), static_cast<int>(endWithoutRepeat.compile()));
+    TEST_ASSERT_EQUAL_INT16(1, endWithoutRepeat.program.errorPosition());
+
+    ProgramFixture<2> repeatWithoutEnd({{SEQ_OP_REPEAT, 2}, {SEQ_OP_MOVE, 0}});
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::UNMATCHED_REPEAT), static_cast<int>(repeatWithoutEnd.compile()));
+
+    ProgramFixture<2> missingTarget({{SEQ_OP_CALL, 9}, {SEQ_OP_MOVE, 0}});
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::CALL_TARGET_MISSING), static_cast<int>(missingTarget.compile()));
+
+    ProgramFixture<2> choicePastEnd({{SEQ_OP_RANDOM, 2}, {SEQ_OP_MOVE, 0}});
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::BAD_CHOICE), static_cast<int>(choicePastEnd.compile()));
+
+    ProgramFixture<4> blockInChoice({{SEQ_OP_RANDOM, 2}, {SEQ_OP_REPEAT, 2}, {SEQ_OP_MOVE, 0}, {SEQ_OP_END_REPEAT, 0}});
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::BAD_CHOICE), static_cast<int>(blockInChoice.compile()));
+
+    // Recursion compiles but overflows the frame stack at run time
+    ProgramFixture<2> recursion({{SEQ_OP_CALL, 1}, {SEQ_OP_MOVE, 0}});
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::NONE), static_cast<int>(recursion.compile()));
+    TEST_ASSERT_EQUAL_INT16(SequenceProgram::FAULT, recursion.after(-1));
+}
+
+// ============================================================================
+// 37. Sequence binary format (2 tests)
+// ============================================================================
+
+void test_sequence_binary_line_round_trip() {
+    SequenceLine line;
+    line.lineId = 42;
+    line.enabled = false;
+    line.movementType = MOVEMENT_CHAOS;
+    line.op = SEQ_OP_WAIT;
+    line.opArg = 1500;
+    line.speedBackward = 12.5f;
+    line.vaetZoneEffect.mirrorOnReturn = true;
+    line.vaetZoneEffect.speedCurve = CURVE_SINE_INV;
+    line.oscCyclePause.isRandom = true;
+    line.chaosSeed = 0xDEADBEEF;
+    line.chaosPatternsEnabled[3] = false;
+
+    std::array<uint8_t, SequenceBinary::LINE_RECORD_SIZE> record{};
+    TEST_ASSERT_EQUAL_UINT(SequenceBinary::LINE_RECORD_SIZE, SequenceBinary::encodeLine(line, record.data()));
+
+    SequenceLine decoded = SequenceBinary::decodeLine(record.data(), record.size());
+    TEST_ASSERT_EQUAL_INT(42, decoded.lineId);
+    TEST_ASSERT_FALSE(decoded.enabled);
+    TEST_ASSERT_TRUE(decoded.movementType == MOVEMENT_CHAOS);
+    TEST_ASSERT_TRUE(decoded.op == SEQ_OP_WAIT);
+    TEST_ASSERT_EQUAL_INT32(1500, decoded.opArg);
+    TEST_ASSERT_EQUAL_FLOAT(12.5f, decoded.speedBackward);
+    TEST_ASSERT_TRUE(decoded.vaetZoneEffect.mirrorOnReturn);
+    TEST_ASSERT_TRUE(decoded.vaetZoneEffect.speedCurve == CURVE_SINE_INV);
+    TEST_ASSERT_TRUE(decoded.oscCyclePause.isRandom);
+    TEST_ASSERT_EQUAL_UINT32(0xDEADBEEF, decoded.chaosSeed);
+    TEST_ASSERT_FALSE(decoded.chaosPatternsEnabled[3]);
+    TEST_ASSERT_TRUE(decoded.chaosPatternsEnabled[4]);
+
+    // Older (shorter) record: fields it lacks keep their defaults
+    SequenceLine older = SequenceBinary::decodeLine(record.data(), 19);
+    TEST_ASSERT_EQUAL_INT32(1500, older.opArg);
+    TEST_ASSERT_EQUAL_FLOAT(SequenceLine{}.speedBackward, older.speedBackward);
+    TEST_ASSERT_EQUAL_UINT32(0, older.chaosSeed);
+}
+
+void test_sequence_binary_reader_splits_any_chunking() {
+    // Preamble + header (2 lines, name "ab") + two 3-byte records
+    std::array<uint8_t, 4 + 2 + 5 + 2 * (2 + 3)> stream{};
+    SequenceBinary::encodePreamble(stream.data());
+    SequenceBinary::Writer(stream.data() + 4).u16(5);
+    SequenceBinary::encodeHeader(2, "ab", 2, stream.data() + 6);
+    for (size_t rec = 0; rec < 2; ++rec) {
+        uint8_t* out = stream.data() + 11 + rec * 5;
+        SequenceBinary::Writer(out).u16(3);
+        out[2] = out[3] = out[4] = static_cast<uint8_t>(rec + 1);
+    }
+
+    for (size_t chunk : {size_t{1}, size_t{3}, stream.size()}) {
+        SequenceBinary::RecordReader reader;
+        reader.reset();
+        std::array<size_t, 3> lengths{};
+        std::array<uint8_t, 3> firstBytes{};
+        auto onRecord = [&](const uint8_t* data, size_t length, uint32_t index) {
+            lengths[index] = length;
+            firstBytes[index] = data[0];
+            return true;
+        };
+        for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+            size_t len = std::min(chunk, stream.size() - pos);
+            TEST_ASSERT_TRUE(reader.feed(stream.data() + pos, len, onRecord) == SequenceBinary::RecordReader::Status::OK);
+        }
+        TEST_ASSERT_EQUAL_UINT32(3, reader.records());
+        TEST_ASSERT_TRUE(reader.atRecordBoundary());
+        TEST_ASSERT_EQUAL_UINT(5, lengths[0]);
+        TEST_ASSERT_EQUAL_UINT(3, lengths[2]);
+        TEST_ASSERT_EQUAL_UINT8(2, firstBytes[2]);
+    }
+
+    SequenceBinary::RecordReader reader;
+    reader.reset();
+    stream[0] = '{';  // A JSON file posted as binary
+    TEST_ASSERT_TRUE(reader.feed(stream.data(), stream.size(), [](const uint8_t*, size_t, uint32_t) { return true; }) ==
+                     SequenceBinary::RecordReader::Status::BAD_MAGIC);
+}
+
+// ============================================================================
+// 38. Odometer wear counters (2 tests)
+// ============================================================================
+
+void test_odometer_counts_modes_reversals_and_speed() {
+    Odometer odometer;
+    const auto osc = static_cast<uint8_t>(MovementType::MOVEMENT_OSC);
+    const auto chaos = static_cast<uint8_t>(MovementType::MOVEMENT_CHAOS);
+
+    odometer.record(osc, 1, 100000);                                  // First step: slow, no reversal
+    odometer.record(osc, 1, ODOMETER_HIGH_SPEED_INTERVAL_US);         // At the threshold: high-speed
+    odometer.record(chaos, -3, 3 * ODOMETER_HIGH_SPEED_INTERVAL_US);  // Reversal, 3 fast steps
+    odometer.record(chaos, 0, 0);                                     // No motion: ignored
+    odometer.record(chaos, 2, 10 * ODOMETER_HIGH_SPEED_INTERVAL_US);  // Reversal, slow
+
+    OdometerCounters counters = odometer.snapshot();
+    TEST_ASSERT_TRUE(counters.totalSteps == 7);
+    TEST_ASSERT_TRUE(counters.stepsByMode[osc] == 2);
+    TEST_ASSERT_TRUE(counters.stepsByMode[chaos] == 5);
+    TEST_ASSERT_TRUE(counters.reversals == 2);
+    TEST_ASSERT_TRUE(counters.highSpeedSteps == 4);
+    TEST_ASSERT_TRUE(odometer.totalSteps() == 7);
+}
+
+void test_odometer_restore_goes_past_32_bits() {
+    OdometerCounters saved;
+    saved.totalSteps = 0xFFFFFFF0ULL;  // ~537 km at 8 steps/mm: where a 32-bit counter wraps
+    saved.stepsByMode[0] = saved.totalSteps;
+
+    Odometer odometer;
+    odometer.restore(saved);
+    odometer.record(0, 0x20, 1000000);
+
+    TEST_ASSERT_TRUE(odometer.totalSteps() == 0x100000010ULL);
+    TEST_ASSERT_TRUE(odometer.snapshot().stepsByMode[0] == 0x100000010ULL);
+}
+
+// ============================================================================
+// 39. Metrics history series (2 tests)
+// ============================================================================
+
+void test_metrics_downsampler_folds_seconds_into_minutes_and_hours() {
+    std::array<MetricsSeries::Sample, 200> seconds{};
+    std::array<MetricsSeries::Sample, 100> minutes{};
+    std::array<MetricsSeries::Sample, 10> hours{};
+    MetricsSeries::Downsampler series;
+    series.rings[MetricsSeries::SECONDS].attach(seconds.data(), seconds.size());
+    series.rings[MetricsSeries::MINUTES].attach(minutes.data(), minutes.size());
+    series.rings[MetricsSeries::HOURS].attach(hours.data(), hours.size());
+
+    // 2 h + 1 s of samples: speed alternates 10 / 30, heap dips once in the first minute
+    for (uint32_t t = 0; t <= 7200; ++t) {
+        MetricsSeries::Sample sample;
+        sample.uptimeSec = t;
+        sample.count = 1;
+        sample.speedDmmS = (t % 2 == 0) ? 10 : 30;
+        sample.heapFreeKB = (t == 30) ? 100 : 200;
+        sample.jitterUs = static_cast<uint16_t>(t % 60);
+        sample.tempDeciC = -50;
+        series.push(sample);
+    }
+
+    const auto& minuteRing = series.rings[MetricsSeries::MINUTES];
+    TEST_ASSERT_EQUAL_UINT32(120, minuteRing.end());  // Minute 120 still open
+    MetricsSeries::Sample first;
+    TEST_ASSERT_TRUE(minuteRing.read(120 - minutes.size(), first));
+    TEST_ASSERT_FALSE(minuteRing.read(0, first));     // Overwritten
+    TEST_ASSERT_EQUAL_UINT16(0, first.count);
+
+    MetricsSeries::Sample hour;
+    TEST_ASSERT_TRUE(series.rings[MetricsSeries::HOURS].read(0, hour));
+    TEST_ASSERT_EQUAL_UINT32(1, series.rings[MetricsSeries::HOURS].end());
+    TEST_ASSERT_EQUAL_UINT32(0, hour.uptimeSec);
+    TEST_ASSERT_EQUAL_UINT16(3600, hour.count);
+    TEST_ASSERT_EQUAL_UINT16(20, hour.speedDmmS);     // Mean
+    TEST_ASSERT_EQUAL_UINT16(100, hour.heapFreeKB);   // Worst
+    TEST_ASSERT_EQUAL_UINT16(59, hour.jitterUs);      // Worst
+    TEST_ASSERT_EQUAL_INT16(-50, hour.tempDeciC);
+}
+
+void test_metrics_ring_first_after_skips_known_samples() {
+    std::array<MetricsSeries::Sample, 8> storage{};
+    MetricsSeries::Ring ring;
+    ring.attach(storage.data(), storage.size());
+    for (uint32_t seq = 0; seq < 20; ++seq) {
+        MetricsSeries::Sample sample;
+        sample.uptimeSec = 100 + seq * 60;
+        sample.count = 60;
+        ring.push(sample);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(12, ring.begin());
+    TEST_ASSERT_EQUAL_UINT32(12, ring.firstAfter(0));                 // Older than anything held
+    TEST_ASSERT_EQUAL_UINT32(16, ring.firstAfter(100 + 15 * 60));     // Client already has #15
+    TEST_ASSERT_EQUAL_UINT32(16, ring.firstAfter(100 + 15 * 60 + 1));
+    TEST_ASSERT_EQUAL_UINT32(20, ring.firstAfter(100 + 19 * 60));     // Up to date
+}
+
+// ============================================================================
+// 40. Zone profile table (2 tests)
+// ============================================================================
+
+void test_zone_profile_matches_zone_speed_factor_per_step() {
+    static ZoneProfile profile;
+    ZoneEffectConfig cfg;
+    cfg.speedEffect = SPEED_DECEL;
+    cfg.speedCurve = CURVE_SINE;
+    cfg.speedIntensity = 75.0f;
+    cfg.zoneMM = 50.0f;
+    TEST_ASSERT_FALSE(profile.matches(cfg));
+    profile.build(cfg);
+    TEST_ASSERT_TRUE(profile.matches(cfg));
+    TEST_ASSERT_EQUAL_UINT32(400, profile.zoneSteps());
+
+    for (uint32_t steps = 0; steps <= 400; ++steps) {
+        float expected = MovementMath::zoneSpeedFactor(SPEED_DECEL, CURVE_SINE, 75.0f, static_cast<float>(steps) / 400.0f);
+        float baked = static_cast<float>(profile.factorAt(steps)) / ZoneProfile::UNITY;
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, expected, baked);
+    }
+    TEST_ASSERT_EQUAL_UINT32(ZoneProfile::UNITY, profile.factorAt(401));  // Past the zone
+    TEST_ASSERT_EQUAL_UINT32(10000, ZoneProfile::scale(1000, 10 * ZoneProfile::UNITY));
+
+    cfg.speedIntensity = 50.0f;
+    TEST_ASSERT_FALSE(profile.matches(cfg));  // Stale after a config change
+}
+
+void test_zone_profile_strides_large_zones_and_combines_overlaps() {
+    static ZoneProfile profile;
+    // Large zone: one entry per stride, still monotonic and bounded
+    profile.build(5000.0f, [](float progress) { return 1.0f + 9.0f * (1.0f - progress); });
+    TEST_ASSERT_EQUAL_UINT32(5000, profile.zoneSteps());
+    TEST_ASSERT_EQUAL_UINT32(10 * ZoneProfile::UNITY, profile.factorAt(0));
+    TEST_ASSERT_UINT32_WITHIN(ZoneProfile::UNITY / 100, ZoneProfile::UNITY, profile.factorAt(5000));
+    TEST_ASSERT_TRUE(profile.factorAt(1000) >= profile.factorAt(1001));
+
+    // Overlapping start/end zones: the stronger effect wins, accel or decel
+    ZoneEffectConfig cfg;
+    cfg.speedEffect = SPEED_ACCEL;
+    cfg.speedCurve = CURVE_LINEAR;
+    cfg.speedIntensity = 100.0f;
+    cfg.zoneMM = 10.0f;
+    profile.build(cfg);
+    uint32_t nearStart = profile.factorFor(true, 75, true, 5);
+    TEST_ASSERT_EQUAL_UINT32(profile.factorAt(75), nearStart);
+    TEST_ASSERT_TRUE(nearStart < ZoneProfile::UNITY);
+    TEST_ASSERT_EQUAL_UINT32(ZoneProfile::UNITY, profile.factorFor(false, 0, true, 200));
+}
+
+// ============================================================================
+// 41. Step scheduler (2 tests)
+// ============================================================================
+
+void test_step_scheduler_keeps_fractional_rate_despite_late_polls() {
+    // Short fast stroke: 20.4 µs per step, which whole-µs delays cannot hold
+    uint32_t interval = StepScheduler::toFixed(20.4f);
+    StepScheduler clock;
+    clock.restart(0);
+
+    uint32_t now = 0;
+    uint32_t steps = 0;
+    uint32_t lastStepAt = 0;
+    uint32_t shortestGap = UINT32_MAX;
+    while (steps < 10000) {
+        now += 3 + (now * 7u) % 5;  // Loop polls every 3-7 µs
+        if (clock.due(now, interval)) {
+            if (steps > 0) shortestGap = std::min(shortestGap, now - lastStepAt);
+            lastStepAt = now;
+            ++steps;
+        }
+    }
+    // 10000 intervals of 20.4 µs = 204000 µs, within 0.1 % (plus one poll)
+    TEST_ASSERT_UINT32_WITHIN(204 + 7, 204000, lastStepAt);
+    TEST_ASSERT_TRUE(shortestGap >= 20 - 7);  // Made-up lateness is at most one poll: no bursts
+}
+
+void test_step_scheduler_restarts_after_a_stall_instead_of_bursting() {
+    uint32_t interval = StepScheduler::fromMicros(100);
+    StepScheduler clock;
+    clock.restart(1000);
+    TEST_ASSERT_FALSE(clock.due(1099, interval));
+    TEST_ASSERT_TRUE(clock.due(1130, interval));   // 30 µs late: next wait is 70 µs
+    TEST_ASSERT_FALSE(clock.due(1199, interval));
+    TEST_ASSERT_TRUE(clock.due(1200, interval));
+
+    TEST_ASSERT_TRUE(clock.due(5000, interval));   // Stalled: step, then start over
+    TEST_ASSERT_FALSE(clock.due(5001, interval));
+    TEST_ASSERT_FALSE(clock.due(5099, interval));
+    TEST_ASSERT_TRUE(clock.due(5100, interval));
+
+    // Whole-µs conversions
+    TEST_ASSERT_EQUAL_UINT32(20, StepScheduler::wholeMicros(StepScheduler::toFixed(20.4f)));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, StepScheduler::fromMicros(0xFFFFFFFFul));
+}
+
+// ============================================================================
+// 42. Waveform tables (2 tests)
+// ============================================================================
+
+void test_builtin_waveform_tables_match_waveform_value() {
+    // Compile-time tables must play the same shapes as the float reference
+    static_assert(Waveform::builtin(OscillationWaveform::OSC_CUSTOM) == nullptr);
+    for (float phase = 0.0f; phase < 1.0f; phase += 0.0137f) {
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, MovementMath::waveformValue(OscillationWaveform::OSC_SINE, phase),
+                                 Waveform::lookup(Waveform::SINE.data(), phase));
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, MovementMath::waveformValue(OscillationWaveform::OSC_TRIANGLE, phase),
+                                 Waveform::lookup(Waveform::TRIANGLE.data(), phase));
+    }
+    // Phase wraps (the accumulator may pass 1.0 between resets)
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, Waveform::lookup(Waveform::SINE.data(), 0.25f),
+                             Waveform::lookup(Waveform::SINE.data(), 1.25f));
+    TEST_ASSERT_FLOAT_WITHIN(1.0f / WAVEFORM_TABLE_SIZE, 0.25f, Waveform::phaseNearest(Waveform::SINE.data(), 0.0f));
+}
+
+void test_bake_user_waveform_passes_through_points() {
+    static Waveform::Table table;
+    const float points[] = {-1.0f, 1.0f, 0.0f, 0.5f};
+    const uint32_t quarter = WAVEFORM_TABLE_SIZE / 4;
+
+    for (Waveform::Kind kind : {Waveform::Kind::SAMPLES, Waveform::Kind::SPLINE}) {
+        TEST_ASSERT_TRUE(Waveform::bake(kind, points, 4, table.data()));
+        for (uint32_t idx = 0; idx < 4; ++idx) {
+            TEST_ASSERT_FLOAT_WITHIN(0.0001f, points[idx], table[idx * quarter]);
+        }
+        for (float value : table) TEST_ASSERT_TRUE(value >= -1.0f && value <= 1.0f);  // Spline overshoot clamped
+    }
+    // Samples: straight line between points; periodic wrap back to the first
+    Waveform::bake(Waveform::Kind::SAMPLES, points, 4, table.data());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, table[quarter / 2]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, -0.25f, table[quarter * 3 + quarter / 2]);
+
+    // Point count limits leave the table untouched
+    float before = table[1];
+    TEST_ASSERT_FALSE(Waveform::bake(Waveform::Kind::SAMPLES, points, 1, table.data()));
+    TEST_ASSERT_FALSE(Waveform::bake(Waveform::Kind::SAMPLES, points, WAVEFORM_MAX_POINTS + 1, table.data()));
+    TEST_ASSERT_EQUAL_FLOAT(before, table[1]);
+}
+
+// ============================================================================
+// 43. Superposed oscillation (2 tests)
+// ============================================================================
+
+void test_oscillator_bank_integer_phase_tracks_partials() {
+    OscillationHarmonics harmonics;
+    harmonics.count = 2;
+    harmonics.partials[0].frequencyHz = 2.0f;
+    harmonics.partials[0].amplitudeMM = 5.0f;
+    harmonics.partials[1].frequencyHz = 0.5f;
+    harmonics.partials[1].amplitudeMM = 3.0f;
+    harmonics.partials[1].phase = 0.5f;
+    harmonics.partials[1].waveform = OscillationWaveform::OSC_TRIANGLE;
+    harmonics.driftAmplitudeMM = 10.0f;
+    harmonics.driftPeriodSec = 40.0f;
+
+    OscillatorBank bank;
+    bank.configure(harmonics, [](OscillationWaveform waveform) { return Waveform::builtin(waveform); }, false);
+    TEST_ASSERT_FALSE(bank.isIdle());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, bank.driftMM());  // Drift starts at the center
+
+    // Run 10 s in 1-7 ms slices, checking against the float reference as it goes
+    uint32_t elapsedMs = 0;
+    for (int slice = 0; elapsedMs < 10000; ++slice) {
+        uint32_t deltaMs = 1 + static_cast<uint32_t>(slice % 7);
+        bank.advance(deltaMs);
+        elapsedMs += deltaMs;
+        float seconds = static_cast<float>(elapsedMs) / 1000.0f;
+        float expected = 5.0f * MovementMath::waveformValue(OscillationWaveform::OSC_SINE, fmodf(2.0f * seconds, 1.0f)) +
+                         3.0f * MovementMath::waveformValue(OscillationWaveform::OSC_TRIANGLE, fmodf(0.5f + 0.5f * seconds, 1.0f));
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, expected, bank.partialsMM());
+    }
+    // 10 s = quarter drift period past its start: top of the drift
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 10.0f, bank.driftMM());
+
+    // Live change keeps the running phase (partial 0 sits in its trough after 20 whole cycles)
+    harmonics.partials[0].amplitudeMM = 2.5f;
+    float before = bank.partialsMM();
+    bank.configure(harmonics, [](OscillationWaveform waveform) { return Waveform::builtin(waveform); }, true);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, before + 2.5f, bank.partialsMM());
+    TEST_ASSERT_EQUAL_UINT32(0x40000000u, OscillatorBank::phaseFixed(1.25f));
+}
+
+void test_validators_oscillation_harmonics_budget() {
+    String err;
+    OscillationConfig cfg;
+    cfg.centerPositionMM = 100.0f;
+    cfg.amplitudeMM = 20.0f;
+    cfg.frequencyHz = 1.0f;
+    TEST_ASSERT_TRUE(Validators::oscillationHarmonics(cfg, err));  // No partials: nothing to check
+
+    cfg.harmonics.count = 1;
+    cfg.harmonics.partials[0].frequencyHz = 3.0f;
+    cfg.harmonics.partials[0].amplitudeMM = 10.0f;
+    TEST_ASSERT_TRUE(Validators::oscillationHarmonics(cfg, err));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 2.0f * PI_F * 50.0f, MovementMath::superposedPeakSpeed(1.0f, 20.0f, cfg.harmonics));
+
+    // Each part fits, the sum does not: 2π·(20 + 3·60) mm/s > OSC_MAX_SPEED_MM_S
+    cfg.harmonics.partials[0].amplitudeMM = 60.0f;
+    TEST_ASSERT_FALSE(Validators::oscillationHarmonics(cfg, err));
+
+    // Envelope: 100 ± (20 + 10 + 75) leaves the 0..200 mm range
+    cfg.harmonics.partials[0].amplitudeMM = 10.0f;
+    cfg.harmonics.driftAmplitudeMM = 75.0f;
+    TEST_ASSERT_FALSE(Validators::oscillationHarmonics(cfg, err));
+
+    cfg.harmonics.driftAmplitudeMM = 20.0f;
+    cfg.harmonics.driftPeriodSec = 1.0f;  // Below OSC_DRIFT_MIN_PERIOD_SEC
+    TEST_ASSERT_FALSE(Validators::oscillationHarmonics(cfg, err));
+    cfg.harmonics.driftPeriodSec = 30.0f;
+    TEST_ASSERT_TRUE(Validators::oscillationHarmonics(cfg, err));
+}
+
+// ============================================================================
+// 44. Live transitions (2 tests)
+// ============================================================================
+
+void test_transition_s_curve_is_smooth_and_monotonic() {
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, Transition::sCurve(-0.5f));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, Transition::sCurve(0.0f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.5f, Transition::sCurve(0.5f));
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, Transition::sCurve(1.0f));
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, Transition::sCurve(2.0f));
+
+    float previous = 0.0f;
+    for (int idx = 1; idx <= 100; ++idx) {
+        float progress = static_cast<float>(idx) / 100.0f;
+        float weight = Transition::sCurve(progress);
+        TEST_ASSERT_TRUE(weight >= previous);
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f - weight, Transition::sCurve(1.0f - progress));  // Symmetric
+        previous = weight;
+    }
+    // Flat at both ends: the first 1% moves far less than 1% (a linear ramp would)
+    TEST_ASSERT_TRUE(Transition::sCurve(0.01f) < 1e-4f);
+
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, Transition::at(2.0f, 4.0f, 0, 500));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 3.0f, Transition::at(2.0f, 4.0f, 250, 500));
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, Transition::at(2.0f, 4.0f, 500, 500));
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, Transition::at(2.0f, 4.0f, 0, 0));  // No duration: switch
+}
+
+void test_transition_retarget_continues_from_current_value() {
+    Transition blend;
+    blend.jump(100.0f);
+    TEST_ASSERT_FALSE(blend.isActive(0));
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, blend.value(12345));
+
+    blend.retarget(200.0f, 1000, 400);
+    TEST_ASSERT_TRUE(blend.isActive(1000));
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, blend.value(1000));
+    float midway = blend.value(1200);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 150.0f, midway);
+
+    // Same target again: the running blend is untouched
+    blend.retarget(200.0f, 1200, 400);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, midway, blend.value(1200));
+    TEST_ASSERT_FALSE(blend.isActive(1400));
+
+    // New target mid-blend: no jump, then a full blend to the new target
+    blend.retarget(50.0f, 1200, 400);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, midway, blend.value(1200));
+    TEST_ASSERT_TRUE(blend.isActive(1599));
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, blend.value(1600));
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, blend.target());
+
+    // Millisecond counter wrap mid-blend
+    blend.start(0.0f, 10.0f, UINT32_MAX - 99, 200);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 5.0f, blend.value(0));
+}
+
+// ============================================================================
+// 45. Pursuit tracking (2 tests)
+// ============================================================================
+
+void test_pursuit_tracker_estimates_velocity_and_extrapolates() {
+    PursuitTracker tracker;
+    TEST_ASSERT_FALSE(tracker.hasTarget());
+
+    // 20 Hz packets of a target moving at 100 mm/s, one arriving 10 ms late
+    for (uint32_t packet = 0; packet <= 10; ++packet) {
+        uint32_t sentMs = 1000 + packet * 50;
+        tracker.observe(50.0f + 0.1f * static_cast<float>(sentMs - 1000), packet == 6 ? sentMs + 10 : sentMs);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(5.0f, 100.0f, tracker.targetVelocity());
+
+    // Between packets: where the target should be now
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, 103.0f, tracker.target(1530, 0.0f, 200.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, tracker.targetVelocity(), tracker.feedforward(1530, 0.0f, 200.0f));
+
+    // Missed packets: extrapolate up to PURSUIT_EXTRAPOLATE_MAX_MS, then hold
+    float heldMM = tracker.target(1500 + PURSUIT_EXTRAPOLATE_MAX_MS, 0.0f, 200.0f);
+    TEST_ASSERT_EQUAL_FLOAT(heldMM, tracker.target(5000, 0.0f, 200.0f));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, tracker.feedforward(5000, 0.0f, 200.0f));
+
+    // Limits clamp the prediction and stop the feedforward
+    TEST_ASSERT_EQUAL_FLOAT(102.0f, tracker.target(1530, 0.0f, 102.0f));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, tracker.feedforward(1530, 0.0f, 101.0f));
+
+    // Stream resumes after a gap: the old samples no longer count
+    tracker.observe(20.0f, 9000);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, tracker.targetVelocity());
+}
+
+void test_pursuit_velocity_law_tracks_without_lag_or_overshoot() {
+    constexpr float DT = 0.001f;
+    constexpr float MAX_SPEED = 300.0f;
+    PursuitTracker tracker;
+    float positionMM = 20.0f;
+    float velocity = 0.0f;
+    float maxStep = 0.0f;
+
+    // Target sweeps at 80 mm/s (packets every 50 ms); after 2 s the lag is gone
+    for (uint32_t ms = 0; ms < 2000; ++ms) {
+        if (ms % 50 == 0) tracker.observe(20.0f + 0.08f * static_cast<float>(ms), ms);
+        float errorMM = tracker.target(ms, 0.0f, 400.0f) - positionMM;
+        float next = PursuitTracker::nextVelocity(velocity, errorMM, tracker.feedforward(ms, 0.0f, 400.0f), DT, MAX_SPEED);
+        maxStep = std::max(maxStep, std::fabs(next - velocity));
+        velocity = next;
+        positionMM += velocity * DT;
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 20.0f + 0.08f * 1999.0f, positionMM);
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, 80.0f, velocity);
+    TEST_ASSERT_TRUE(maxStep <= PURSUIT_ACCEL_MM_S2 * DT + 1e-3f);  // Acceleration limited throughout
+
+    // Still target 60 mm away from rest: capped speed, braked arrival, no overshoot
+    PursuitTracker still;
+    still.observe(100.0f, 0);
+    positionMM = 40.0f;
+    velocity = 0.0f;
+    float peakMM = positionMM;
+    float peakSpeed = 0.0f;
+    for (uint32_t ms = 1; ms < 3000; ++ms) {
+        velocity = PursuitTracker::nextVelocity(velocity, still.target(ms, 0.0f, 400.0f) - positionMM, 0.0f, DT, MAX_SPEED);
+        positionMM += velocity * DT;
+        peakMM = std::max(peakMM, positionMM);
+        peakSpeed = std::max(peakSpeed, velocity);
+    }
+    TEST_ASSERT_TRUE(peakSpeed <= MAX_SPEED);
+    TEST_ASSERT_TRUE(peakMM < 100.0f + 0.1f);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 100.0f, positionMM);
+}
+
+// ============================================================================
+// 46. Speed tables (2 tests)
+// ============================================================================
+
+void test_nominal_speed_table_matches_movement_math() {
+    static_assert(NOMINAL_SPEED_TABLE.effectiveLevel(MAX_SPEED_LEVEL) == MAX_SPEED_LEVEL, "Built at compile time");
+
+    const float distances[] = {2.0f, 50.0f, 137.5f, 400.0f};
+    for (size_t idx = 0; idx < SpeedTable::ENTRIES; ++idx) {
+        float level = static_cast<float>(idx) / 10.0f;
+        TEST_ASSERT_EQUAL_UINT32(idx, SpeedTable::index(level));
+        TEST_ASSERT_EQUAL_FLOAT(level, NOMINAL_SPEED_TABLE.effectiveLevel(level));
+        TEST_ASSERT_EQUAL_UINT32(MovementMath::chaosStepDelay(level), NOMINAL_SPEED_TABLE.chaosStepDelay(level));
+        for (float distanceMM : distances) {
+            TEST_ASSERT_EQUAL_FLOAT(MovementMath::vaetStepInterval(level, distanceMM),
+                                    NOMINAL_SPEED_TABLE.vaetStepInterval(level, distanceMM));
+        }
+    }
+
+    // Out of range: clamped like the formulas
+    TEST_ASSERT_EQUAL_UINT32(MovementMath::chaosStepDelay(MAX_SPEED_LEVEL), NOMINAL_SPEED_TABLE.chaosStepDelay(99.0f));
+    TEST_ASSERT_EQUAL_UINT32(MovementMath::chaosStepDelay(0.0f), NOMINAL_SPEED_TABLE.chaosStepDelay(-3.0f));
+    TEST_ASSERT_EQUAL_FLOAT(1000.0f, NOMINAL_SPEED_TABLE.vaetStepInterval(0.0f, 50.0f));
+}
+
+void test_calibrated_speed_table_interpolates_measured_points() {
+    SpeedTable::Points points = SpeedTable::nominal();
+    TEST_ASSERT_TRUE(SpeedTable::isValid(points));
+    points[10] = 12.0f;  // Rig measured slow around level 10
+    points[11] = 12.5f;
+
+    SpeedTable table;
+    table.build(points);
+    TEST_ASSERT_EQUAL_FLOAT(12.0f, table.effectiveLevel(10.0f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 12.25f, table.effectiveLevel(10.5f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 10.5f, table.effectiveLevel(9.5f));
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, table.effectiveLevel(5.0f));  // Untouched elsewhere
+    TEST_ASSERT_EQUAL_UINT32(MovementMath::chaosStepDelay(12.0f), table.chaosStepDelay(10.0f));
+    TEST_ASSERT_EQUAL_FLOAT(MovementMath::vaetStepInterval(12.0f, 80.0f), table.vaetStepInterval(10.0f, 80.0f));
+    TEST_ASSERT_EQUAL_UINT32(103, SpeedTable::index(10.26f));  // Nearest 0.1
+
+    points[12] = 12.4f;  // Below points[11]: a faster level would drive slower
+    TEST_ASSERT_FALSE(SpeedTable::isValid(points));
+    points[12] = MAX_SPEED_LEVEL + 1.0f;
+    TEST_ASSERT_FALSE(SpeedTable::isValid(points));
+    points[12] = NAN;
+    TEST_ASSERT_FALSE(SpeedTable::isValid(points));
+    TEST_ASSERT_FALSE(SpeedTable::isValid(SpeedTable::Points{}));  // All zero
+}
+
+// ============================================================================
+// 47. Step telemetry (2 tests)
+// ============================================================================
+
+void test_step_decimator_keeps_one_sample_per_period() {
+    StepSamples::Decimator decimator;
+    TEST_ASSERT_FALSE(decimator.take(0));  // No rate = off
+
+    decimator.setRate(TELEMETRY_MAX_RATE_HZ);  // 2000 µs period
+    int kept = 0;
+    for (uint32_t t = 1000; t < 1000 + 100000; t += 50) {  // 20 kHz steps for 100 ms
+        if (decimator.take(t)) kept++;
+    }
+    TEST_ASSERT_EQUAL_INT(50, kept);
+
+    // Across the micros() wrap
+    decimator.setRate(100);
+    TEST_ASSERT_TRUE(decimator.take(UINT32_MAX - 1000));
+    TEST_ASSERT_FALSE(decimator.take(5000));
+    TEST_ASSERT_TRUE(decimator.take(9000));
+}
+
+void test_step_ring_drops_new_samples_when_full_and_counts_them() {
+    StepSamples::Ring<4> ring;
+    for (int32_t idx = 0; idx < 6; ++idx) {
+        bool stored = ring.push({static_cast<uint32_t>(idx) * 100, idx, 250.0f, 251});
+        TEST_ASSERT_EQUAL(idx < 4, stored);
+    }
+    TEST_ASSERT_EQUAL_UINT32(4, ring.size());
+    TEST_ASSERT_EQUAL_UINT32(2, ring.takeDropped());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.takeDropped());
+
+    // Oldest first, in batches, wrapping the slots
+    std::array<StepSamples::Sample, 3> out{};
+    TEST_ASSERT_EQUAL_UINT32(3, ring.pop(out.data(), out.size()));
+    TEST_ASSERT_EQUAL_INT32(0, out[0].step);
+    TEST_ASSERT_EQUAL_INT32(2, out[2].step);
+    TEST_ASSERT_TRUE(ring.push({700, 7, 0.0f, 0}));
+    TEST_ASSERT_EQUAL_UINT32(2, ring.pop(out.data(), out.size()));
+    TEST_ASSERT_EQUAL_INT32(3, out[0].step);
+    TEST_ASSERT_EQUAL_INT32(7, out[1].step);
+    TEST_ASSERT_EQUAL_UINT32(0, ring.pop(out.data(), out.size()));
+
+    ring.push({800, 8, 0.0f, 0});
+    ring.clear();
+    TEST_ASSERT_EQUAL_UINT32(0, ring.size());
+}
+
+// ============================================================================
+// 48. Status sections (2 tests)
+// ============================================================================
+
+void test_status_section_rebuilds_only_when_config_changes() {
+    StatusSections::Cache<ZoneEffectConfig, std::string> cache;
+    int builds = 0;
+    auto build = [&builds](const ZoneEffectConfig& config) {
+        builds++;
+        return std::to_string(static_cast<int>(config.zoneMM));
+    };
+
+    ZoneEffectConfig zone;
+    TEST_ASSERT_EQUAL_STRING("50", cache.get(zone, build).c_str());
+    for (int tick = 0; tick < 10; ++tick) cache.get(zone, build);
+    TEST_ASSERT_EQUAL_INT(1, builds);
+
+    zone.zoneMM = 80.0f;
+    TEST_ASSERT_EQUAL_STRING("80", cache.get(zone, build).c_str());
+    TEST_ASSERT_EQUAL_INT(2, builds);
+
+    // Nested fields count too
+    zone.endPauseMaxSec = 3.0f;
+    cache.get(zone, build);
+    TEST_ASSERT_EQUAL_INT(3, builds);
+}
+
+void test_status_section_text_describes_the_snapshot_it_was_built_from() {
+    StatusSections::Cache<OscillationConfig, std::string> cache;
+    OscillationConfig osc;
+    osc.harmonics.count = 1;
+
+    // A write landing while the text is built is picked up on the next call
+    auto racing = [&osc](const OscillationConfig& config) {
+        osc.harmonics.count = 2;
+        return std::to_string(config.harmonics.count);
+    };
+    TEST_ASSERT_EQUAL_STRING("1", cache.get(osc, racing).c_str());
+    auto build = [](const OscillationConfig& config) { return std::to_string(config.harmonics.count); };
+    TEST_ASSERT_EQUAL_STRING("2", cache.get(osc, build).c_str());
+}
+
+// ============================================================================
+// 49. Status events (4 tests)
+// ============================================================================
+
+static int statusHandlerCalls = 0;
+static uint32_t statusHandlerEvents = 0;
+static int sequenceHandlerCalls = 0;
+
+void test_status_events_coalesce_into_one_call_per_subscriber() {
+    statusHandlerCalls = 0;
+    statusHandlerEvents = 0;
+    sequenceHandlerCalls = 0;
+    StatusEventBus bus;
+    TEST_ASSERT_TRUE(bus.subscribe(StatusEventBus::bit(StatusEvent::STATE) | StatusEventBus::bit(StatusEvent::CONFIG),
+                                   [](uint32_t events) { statusHandlerCalls++; statusHandlerEvents = events; }));
+    TEST_ASSERT_TRUE(bus.subscribe(StatusEventBus::bit(StatusEvent::SEQUENCE), [](uint32_t) { sequenceHandlerCalls++; }));
+
+    TEST_ASSERT_EQUAL_UINT32(0, bus.dispatch());  // Nothing pending
+    TEST_ASSERT_EQUAL_INT(0, statusHandlerCalls);
+
+    // A command that stops, reconfigures and restarts: one broadcast
+    bus.post(StatusEvent::STATE);
+    bus.post(StatusEvent::CONFIG);
+    bus.post(StatusEvent::STATE);
+    bus.dispatch();
+    TEST_ASSERT_EQUAL_INT(1, statusHandlerCalls);
+    TEST_ASSERT_EQUAL_UINT32(StatusEventBus::bit(StatusEvent::STATE) | StatusEventBus::bit(StatusEvent::CONFIG),
+                             statusHandlerEvents);
+    TEST_ASSERT_EQUAL_INT(0, sequenceHandlerCalls);
+
+    bus.dispatch();  // Taken: nothing left
+    TEST_ASSERT_EQUAL_INT(1, statusHandlerCalls);
+}
+
+void test_status_events_reach_only_interested_subscribers() {
+    statusHandlerCalls = 0;
+    statusHandlerEvents = 0;
+    sequenceHandlerCalls = 0;
+    StatusEventBus bus;
+    bus.subscribe(StatusEventBus::bit(StatusEvent::STATE), [](uint32_t events) { statusHandlerCalls++; statusHandlerEvents = events; });
+    bus.subscribe(StatusEventBus::bit(StatusEvent::SEQUENCE), [](uint32_t) { sequenceHandlerCalls++; });
+
+    // Unsubscribed events are still taken (and dropped)
+    bus.post(StatusEvent::SEQUENCE);
+    bus.post(StatusEvent::REFRESH);
+    TEST_ASSERT_EQUAL_UINT32(StatusEventBus::bit(StatusEvent::SEQUENCE) | StatusEventBus::bit(StatusEvent::REFRESH),
+                             bus.dispatch());
+    TEST_ASSERT_EQUAL_INT(0, statusHandlerCalls);
+    TEST_ASSERT_EQUAL_INT(1, sequenceHandlerCalls);
+
+    // Full: further subscriptions are refused
+    for (size_t idx = 2; idx < StatusEventBus::MAX_SUBSCRIBERS; ++idx) {
+        TEST_ASSERT_TRUE(bus.subscribe(0, [](uint32_t) {}));
+    }
+    TEST_ASSERT_FALSE(bus.subscribe(StatusEventBus::bit(StatusEvent::STATE), [](uint32_t) {}));
+    TEST_ASSERT_FALSE(StatusEventBus().subscribe(0, nullptr));
+}
+
+void test_status_events_queue_errors_in_order() {
+    StatusEventBus bus;
+    std::array<char, StatusEventBus::ERROR_MESSAGE_SIZE> message;
+    TEST_ASSERT_FALSE(bus.takeError(message));
+
+    TEST_ASSERT_TRUE(bus.postError("first"));
+    TEST_ASSERT_TRUE(bus.postError("second"));
+    TEST_ASSERT_EQUAL_UINT32(StatusEventBus::bit(StatusEvent::ERROR), bus.dispatch());
+    TEST_ASSERT_TRUE(bus.takeError(message));
+    TEST_ASSERT_EQUAL_STRING("first", message.data());
+    TEST_ASSERT_TRUE(bus.takeError(message));
+    TEST_ASSERT_EQUAL_STRING("second", message.data());
+    TEST_ASSERT_FALSE(bus.takeError(message));
+
+    // Full: the newest message is dropped, the queued ones survive
+    for (size_t idx = 0; idx < StatusEventBus::ERROR_SLOTS; ++idx) TEST_ASSERT_TRUE(bus.postError("queued"));
+    TEST_ASSERT_FALSE(bus.postError("dropped"));
+    for (size_t idx = 0; idx < StatusEventBus::ERROR_SLOTS; ++idx) TEST_ASSERT_TRUE(bus.takeError(message));
+    TEST_ASSERT_EQUAL_STRING("queued", message.data());
+    TEST_ASSERT_FALSE(bus.takeError(message));
+
+    // Too long: cut before the multi-byte character that would not fit
+    std::string longMessage(StatusEventBus::ERROR_MESSAGE_SIZE - 2, 'x');
+    longMessage += "\u00e9\u00e9";
+    TEST_ASSERT_TRUE(bus.postError(longMessage.c_str()));
+    TEST_ASSERT_TRUE(bus.takeError(message));
+    TEST_ASSERT_EQUAL_UINT32(StatusEventBus::ERROR_MESSAGE_SIZE - 2, std::strlen(message.data()));
+}
+
+// Sources whose functions can run on motorTask (directly or via the
+// sequencer, calibration callbacks and restarts): they report errors
+// through Events.postError, never the WebSocket-sending Status.sendError
+void test_status_events_motor_side_sources_never_send_errors_inline() {
+    static const char* const MOTOR_SIDE_SOURCES[] = {
+        "src/StepperController.cpp",
+        "src/hardware/ContactSensors.cpp",
+        "src/hardware/MotorDriver.cpp",
+        "src/hardware/PositionVerifier.cpp",
+        "src/movement/BaseMovementController.cpp",
+        "src/movement/CalibrationManager.cpp",
+        "src/movement/ChaosController.cpp",
+        "src/movement/MotionTimeline.cpp",
+        "src/movement/OscillationController.cpp",
+        "src/movement/PursuitController.cpp",
+        "src/movement/SequenceExecutor.cpp",
+        "src/movement/SpeedCalibration.cpp",
+        "src/movement/StepRateGovernor.cpp",
+        "src/movement/TrajectoryPlayer.cpp",
+    };
+    // Project root from this file's path: the runner's working directory varies
+    std::string root = __FILE__;
+    root.resize(root.size() - std::strlen("test/test_native/test_main.cpp"));
+
+    for (const char* source : MOTOR_SIDE_SOURCES) {
+        std::ifstream file(root + source);
+        TEST_ASSERT_TRUE_MESSAGE(file.is_open(), source);
+        std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        TEST_ASSERT_TRUE_MESSAGE(text.find("Status.sendError") == std::string::npos, source);
+    }
+}
+
+// ============================================================================
+// 50. Calibration abort (1 test)
+// ============================================================================
+
+void test_calibration_abort_never_reports_ready_without_calibration() {
+    // First calibration after boot: no limits yet
+    TEST_ASSERT_EQUAL(STATE_INIT, MovementMath::calibrationAbortState(STATE_INIT, 0.0f));
+    TEST_ASSERT_EQUAL(STATE_INIT, MovementMath::calibrationAbortState(STATE_READY, 0.0f));
+    // Limits known but a recalibration was required (sensor mode changed)
+    TEST_ASSERT_EQUAL(STATE_INIT, MovementMath::calibrationAbortState(STATE_INIT, 350.0f));
+    // A previous calibration still holds
+    TEST_ASSERT_EQUAL(STATE_READY, MovementMath::calibrationAbortState(STATE_READY, 350.0f));
+    TEST_ASSERT_EQUAL(STATE_READY, MovementMath::calibrationAbortState(STATE_ERROR, 350.0f));
+}
+
 // ============================================================================
 // MAIN — Register all tests
 // ============================================================================
@@ -1697,7 +2826,7 @@ int main(int argc, char **argv) {
     RUN_TEST(test_sequence_execution_state_defaults);
     RUN_TEST(test_system_config_defaults);
 
-    // 3. Speed math (17 tests)
+    // 3. Speed math (13 tests)
     RUN_TEST(test_speed_level_to_cpm_linear);
     RUN_TEST(test_speed_level_clamped_negative);
     RUN_TEST(test_speed_level_clamped_max);
@@ -1711,10 +2840,6 @@ int main(int argc, char **argv) {
     RUN_TEST(test_chaos_step_delay_zero);
     RUN_TEST(test_chaos_step_delay_max_clamp);
     RUN_TEST(test_chaos_step_delay_min_clamp);
-    RUN_TEST(test_pursuit_delay_far_from_target);
-    RUN_TEST(test_pursuit_delay_close_ramp);
-    RUN_TEST(test_pursuit_delay_very_close);
-    RUN_TEST(test_pursuit_delay_minimum_clamp);
 
     // 4. Zone effect curves (14 tests)
     RUN_TEST(test_zone_decel_linear_at_boundary);
@@ -1854,12 +2979,10 @@ int main(int argc, char **argv) {
     // 21. Oscillation config ramp defaults (1 test)
     RUN_TEST(test_oscillation_config_ramp_defaults);
 
-    // 22. Speed formula edge cases (6 tests)
+    // 22. Speed formula edge cases (3 tests)
     RUN_TEST(test_vaet_step_delay_very_short_distance);
     RUN_TEST(test_vaet_step_delay_max_distance);
     RUN_TEST(test_chaos_step_delay_mid_range);
-    RUN_TEST(test_pursuit_delay_exact_threshold);
-    RUN_TEST(test_pursuit_delay_at_1mm_boundary);
 
     // 23. Enum value coverage (6 tests)
     RUN_TEST(test_system_state_all_values);
@@ -1879,10 +3002,9 @@ int main(int argc, char **argv) {
     RUN_TEST(test_validator_chaos_center_plus_amplitude_at_limit);
     RUN_TEST(test_validator_chaos_center_minus_amplitude_below_zero);
 
-    // 25. MovementMath cross-function invariants (8 tests)
+    // 25. MovementMath cross-function invariants (6 tests)
     RUN_TEST(test_speed_monotonicity_vaet);
     RUN_TEST(test_speed_monotonicity_chaos);
-    RUN_TEST(test_speed_monotonicity_pursuit);
     RUN_TEST(test_distance_monotonicity_vaet);
     RUN_TEST(test_all_delays_above_minimum);
     RUN_TEST(test_zone_decel_reduces_speed);
@@ -1897,5 +3019,112 @@ int main(int argc, char **argv) {
     RUN_TEST(test_effective_freq_monotonic_with_amplitude);
     RUN_TEST(test_effective_freq_speed_invariant);
 
+    // 28. PEND position verification (5 tests)
+    RUN_TEST(test_pend_following_error_rounding);
+    RUN_TEST(test_pend_following_error_zero_settle);
+    RUN_TEST(test_pend_following_error_zero_interval_guard);
+    RUN_TEST(test_soft_recal_lost_steps_threshold);
+    RUN_TEST(test_soft_recal_unverified_moves_threshold);
+
+    // 29. Step-rate governor (6 tests)
+    RUN_TEST(test_governor_unlimited_accel_floor_only);
+    RUN_TEST(test_governor_ramp_starts_at_pull_in_rate);
+    RUN_TEST(test_governor_ramp_monotonic_to_floor);
+    RUN_TEST(test_governor_backoff_slower_than_fault);
+    RUN_TEST(test_governor_backoff_clamped);
+    RUN_TEST(test_governor_relax_clamped_to_hardware);
+
+    // 30. Wall-clock phase lock (6 tests)
+    RUN_TEST(test_phase_error_wraps_to_half_cycle);
+    RUN_TEST(test_anchored_phase_before_and_after_anchor);
+    RUN_TEST(test_anchored_phase_precise_hours_later);
+    RUN_TEST(test_phase_lock_trim_direction_and_clamp);
+    RUN_TEST(test_vaet_phase_lock_learns_period_bias);
+    RUN_TEST(test_vaet_cycle_period_from_half_cycles);
+
+    // 31. Trajectory playback (5 tests)
+    RUN_TEST(test_trajectory_interpolate_midpoint);
+    RUN_TEST(test_trajectory_interpolate_clamped_to_segment);
+    RUN_TEST(test_trajectory_interpolate_zero_length_segment);
+    RUN_TEST(test_trajectory_keyframe_validation);
+    RUN_TEST(test_trajectory_fill_percent);
+
+    // 32. Command table perfect hash (3 tests)
+    RUN_TEST(test_command_table_resolves_every_name);
+    RUN_TEST(test_command_table_rejects_unknown_and_prefixes);
+    RUN_TEST(test_command_table_duplicate_name_invalid);
+
+    // 33. WebSocket binary frames (1 test)
+    RUN_TEST(test_ws_pursuit_frame_matches_js_encoding);
+
+    // 34. Sequencer look-ahead transition speed (1 test)
+    RUN_TEST(test_transition_step_delay_clamped);
+
+    // 35. Sequence line ID index (2 tests)
+    RUN_TEST(test_sequence_id_index_insert_find_erase);
+    RUN_TEST(test_sequence_id_index_rejects_invalid_ids);
+
+    // 36. Sequence control flow (3 tests)
+    RUN_TEST(test_sequence_program_repeat_and_call);
+    RUN_TEST(test_sequence_program_random_choice_skips_disabled);
+    RUN_TEST(test_sequence_program_rejects_bad_structure);
+
+    // 37. Sequence binary format (2 tests)
+    RUN_TEST(test_sequence_binary_line_round_trip);
+    RUN_TEST(test_sequence_binary_reader_splits_any_chunking);
+
+    // 38. Odometer wear counters (2 tests)
+    RUN_TEST(test_odometer_counts_modes_reversals_and_speed);
+    RUN_TEST(test_odometer_restore_goes_past_32_bits);
+
+    // 39. Metrics history series (2 tests)
+    RUN_TEST(test_metrics_downsampler_folds_seconds_into_minutes_and_hours);
+    RUN_TEST(test_metrics_ring_first_after_skips_known_samples);
+
+    // 40. Zone profile table (2 tests)
+    RUN_TEST(test_zone_profile_matches_zone_speed_factor_per_step);
+    RUN_TEST(test_zone_profile_strides_large_zones_and_combines_overlaps);
+
+    // 41. Step scheduler (2 tests)
+    RUN_TEST(test_step_scheduler_keeps_fractional_rate_despite_late_polls);
+    RUN_TEST(test_step_scheduler_restarts_after_a_stall_instead_of_bursting);
+
+    // 42. Waveform tables (2 tests)
+    RUN_TEST(test_builtin_waveform_tables_match_waveform_value);
+    RUN_TEST(test_bake_user_waveform_passes_through_points);
+
+    // 43. Superposed oscillation (2 tests)
+    RUN_TEST(test_oscillator_bank_integer_phase_tracks_partials);
+    RUN_TEST(test_validators_oscillation_harmonics_budget);
+
+    // 44. Live transitions (2 tests)
+    RUN_TEST(test_transition_s_curve_is_smooth_and_monotonic);
+    RUN_TEST(test_transition_retarget_continues_from_current_value);
+
+    // 45. Pursuit tracking (2 tests)
+    RUN_TEST(test_pursuit_tracker_estimates_velocity_and_extrapolates);
+    RUN_TEST(test_pursuit_velocity_law_tracks_without_lag_or_overshoot);
+
+    // 46. Speed tables (2 tests)
+    RUN_TEST(test_nominal_speed_table_matches_movement_math);
+    RUN_TEST(test_calibrated_speed_table_interpolates_measured_points);
+
+    // 47. Step telemetry (2 tests)
+    RUN_TEST(test_step_decimator_keeps_one_sample_per_period);
+    RUN_TEST(test_step_ring_drops_new_samples_when_full_and_counts_them);
+
+    // 48. Status sections (2 tests)
+    RUN_TEST(test_status_section_rebuilds_only_when_config_changes);
+    RUN_TEST(test_status_section_text_describes_the_snapshot_it_was_built_from);
+
+    // 49. Status events (4 tests)
+    RUN_TEST(test_status_events_coalesce_into_one_call_per_subscriber);
+    RUN_TEST(test_status_events_reach_only_interested_subscribers);
+    RUN_TEST(test_status_events_queue_errors_in_order);
+    RUN_TEST(test_status_events_motor_side_sources_never_send_errors_inline);
+
+    // 50. Calibration abort (1 test)
+    RUN_TEST(test_calibration_abort_never_reports_ready_without_calibration);
+
     return UNITY_END();
 }